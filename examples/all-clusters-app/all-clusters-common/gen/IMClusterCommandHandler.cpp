@@ -27,6 +27,8 @@
 #include "app/util/util.h"
 
 #include <app/InteractionModelEngine.h>
+#include <app/util/command-set.h>
+#include <lib/core/CHIPTLVCodec.h>
 
 // Currently we need some work to keep compatible with ember lib.
 #include <app/util/ember-compatibility-functions.h>
@@ -40,6 +42,12 @@ namespace clusters {
 
 namespace BarrierControl {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::BarrierControl::Commands::Ids::BarrierControlGoToPercent,
+    Clusters::BarrierControl::Commands::Ids::BarrierControlStop,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -63,7 +71,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, percentOpen) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -160,6 +176,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace Basic {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -215,6 +234,12 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace Binding {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::Binding::Commands::Ids::Bind,
+    Clusters::Binding::Commands::Ids::Unbind,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -241,7 +266,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<chip::NodeId, chip::GroupId, chip::EndpointId, chip::ClusterId>;
+            if (ArgumentsCodec::Decode(aDataTlv, nodeId, groupId, endpointId, clusterId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -312,7 +345,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<chip::NodeId, chip::GroupId, chip::EndpointId, chip::ClusterId>;
+            if (ArgumentsCodec::Decode(aDataTlv, nodeId, groupId, endpointId, clusterId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -412,6 +453,29 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace ColorControl {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::ColorControl::Commands::Ids::ColorLoopSet,
+    Clusters::ColorControl::Commands::Ids::EnhancedMoveHue,
+    Clusters::ColorControl::Commands::Ids::EnhancedMoveToHue,
+    Clusters::ColorControl::Commands::Ids::EnhancedMoveToHueAndSaturation,
+    Clusters::ColorControl::Commands::Ids::EnhancedStepHue,
+    Clusters::ColorControl::Commands::Ids::MoveColor,
+    Clusters::ColorControl::Commands::Ids::MoveColorTemperature,
+    Clusters::ColorControl::Commands::Ids::MoveHue,
+    Clusters::ColorControl::Commands::Ids::MoveSaturation,
+    Clusters::ColorControl::Commands::Ids::MoveToColor,
+    Clusters::ColorControl::Commands::Ids::MoveToColorTemperature,
+    Clusters::ColorControl::Commands::Ids::MoveToHue,
+    Clusters::ColorControl::Commands::Ids::MoveToHueAndSaturation,
+    Clusters::ColorControl::Commands::Ids::MoveToSaturation,
+    Clusters::ColorControl::Commands::Ids::StepColor,
+    Clusters::ColorControl::Commands::Ids::StepColorTemperature,
+    Clusters::ColorControl::Commands::Ids::StepHue,
+    Clusters::ColorControl::Commands::Ids::StepSaturation,
+    Clusters::ColorControl::Commands::Ids::StopMoveStep,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -441,7 +505,16 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint16_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, updateFlags, action, direction, time, startHue, optionsMask,
+                                       optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 7;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -522,7 +595,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, moveMode, rate, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -595,7 +676,16 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, enhancedHue, direction, transitionTime, optionsMask,
+                                       optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -671,7 +761,16 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, enhancedHue, saturation, transitionTime, optionsMask,
+                                       optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -747,7 +846,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, stepMode, stepSize, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -822,7 +929,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<int16_t, int16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, rateX, rateY, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -895,7 +1010,16 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, moveMode, rate, colorTemperatureMinimum, colorTemperatureMaximum, optionsMask,
+                                       optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 6;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -973,7 +1097,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, moveMode, rate, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1044,7 +1176,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, moveMode, rate, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1117,7 +1257,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint16_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, colorX, colorY, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1192,7 +1340,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, colorTemperature, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1265,7 +1421,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, hue, direction, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1341,7 +1505,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, hue, saturation, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1416,7 +1588,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, saturation, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1489,7 +1669,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<int16_t, int16_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, stepX, stepY, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1567,7 +1755,16 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, stepMode, stepSize, transitionTime, colorTemperatureMinimum,
+                                       colorTemperatureMaximum, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 7;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1650,7 +1847,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, stepMode, stepSize, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1726,7 +1931,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, stepMode, stepSize, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1799,7 +2012,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1893,6 +2114,11 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace DiagnosticLogs {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::DiagnosticLogs::Commands::Ids::RetrieveLogsRequest,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -1949,12 +2175,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 case 1:
                     TLVUnpackError = aDataTlv.Get(requestedProtocol);
                     break;
-                case 2: {
-                    const uint8_t * data   = nullptr;
-                    TLVUnpackError         = aDataTlv.GetDataPtr(data);
-                    transferFileDesignator = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 2:
+                    TLVUnpackError = aDataTlv.Get(transferFileDesignator);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -2019,6 +2242,33 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace DoorLock {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::DoorLock::Commands::Ids::ClearAllPins,
+    Clusters::DoorLock::Commands::Ids::ClearAllRfids,
+    Clusters::DoorLock::Commands::Ids::ClearHolidaySchedule,
+    Clusters::DoorLock::Commands::Ids::ClearPin,
+    Clusters::DoorLock::Commands::Ids::ClearRfid,
+    Clusters::DoorLock::Commands::Ids::ClearWeekdaySchedule,
+    Clusters::DoorLock::Commands::Ids::ClearYeardaySchedule,
+    Clusters::DoorLock::Commands::Ids::GetHolidaySchedule,
+    Clusters::DoorLock::Commands::Ids::GetLogRecord,
+    Clusters::DoorLock::Commands::Ids::GetPin,
+    Clusters::DoorLock::Commands::Ids::GetRfid,
+    Clusters::DoorLock::Commands::Ids::GetUserType,
+    Clusters::DoorLock::Commands::Ids::GetWeekdaySchedule,
+    Clusters::DoorLock::Commands::Ids::GetYeardaySchedule,
+    Clusters::DoorLock::Commands::Ids::LockDoor,
+    Clusters::DoorLock::Commands::Ids::SetHolidaySchedule,
+    Clusters::DoorLock::Commands::Ids::SetPin,
+    Clusters::DoorLock::Commands::Ids::SetRfid,
+    Clusters::DoorLock::Commands::Ids::SetUserType,
+    Clusters::DoorLock::Commands::Ids::SetWeekdaySchedule,
+    Clusters::DoorLock::Commands::Ids::SetYeardaySchedule,
+    Clusters::DoorLock::Commands::Ids::UnlockDoor,
+    Clusters::DoorLock::Commands::Ids::UnlockWithTimeout,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -2054,7 +2304,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, scheduleId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2113,7 +2371,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, userId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2172,7 +2438,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, userId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2232,7 +2506,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, scheduleId, userId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2295,7 +2577,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, scheduleId, userId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2357,7 +2647,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, scheduleId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2416,7 +2714,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, logIndex) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2475,7 +2781,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, userId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2534,7 +2848,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, userId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2593,7 +2915,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, userId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2653,7 +2983,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, scheduleId, userId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2716,7 +3054,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, scheduleId, userId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2841,7 +3187,16 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint32_t, uint32_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, scheduleId, localStartTime, localEndTime,
+                                       operatingModeDuringHoliday) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -3057,7 +3412,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, userId, userType) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -3125,7 +3488,16 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, scheduleId, userId, daysMask, startHour, startMinute, endHour,
+                                       endMinute) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 7;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -3206,7 +3578,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint32_t, uint32_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, scheduleId, userId, localStartTime, localEndTime) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -3432,6 +3812,11 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace EthernetNetworkDiagnostics {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::EthernetNetworkDiagnostics::Commands::Ids::ResetCounts,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -3494,6 +3879,13 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace GeneralCommissioning {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::GeneralCommissioning::Commands::Ids::ArmFailSafe,
+    Clusters::GeneralCommissioning::Commands::Ids::CommissioningComplete,
+    Clusters::GeneralCommissioning::Commands::Ids::SetRegulatoryConfig,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -3519,7 +3911,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint64_t, uint32_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, expiryLengthSeconds, breadcrumb, timeoutMs) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 3;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -3696,6 +4096,16 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace Groups {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::Groups::Commands::Ids::AddGroup,
+    Clusters::Groups::Commands::Ids::AddGroupIfIdentifying,
+    Clusters::Groups::Commands::Ids::GetGroupMembership,
+    Clusters::Groups::Commands::Ids::RemoveAllGroups,
+    Clusters::Groups::Commands::Ids::RemoveGroup,
+    Clusters::Groups::Commands::Ids::ViewGroup,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -3918,7 +4328,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, groupId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -3977,7 +4395,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, groupId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -4068,6 +4494,11 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace IasZone {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::IasZone::Commands::Ids::ZoneEnrollResponse,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -4092,7 +4523,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, enrollResponseCode, zoneId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -4186,6 +4625,12 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace Identify {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::Identify::Commands::Ids::Identify,
+    Clusters::Identify::Commands::Ids::IdentifyQuery,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -4209,7 +4654,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, identifyTime) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -4306,6 +4759,18 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace LevelControl {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::LevelControl::Commands::Ids::Move,
+    Clusters::LevelControl::Commands::Ids::MoveToLevel,
+    Clusters::LevelControl::Commands::Ids::MoveToLevelWithOnOff,
+    Clusters::LevelControl::Commands::Ids::MoveWithOnOff,
+    Clusters::LevelControl::Commands::Ids::Step,
+    Clusters::LevelControl::Commands::Ids::StepWithOnOff,
+    Clusters::LevelControl::Commands::Ids::Stop,
+    Clusters::LevelControl::Commands::Ids::StopWithOnOff,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -4332,7 +4797,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, moveMode, rate, optionMask, optionOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -4403,7 +4876,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, level, transitionTime, optionMask, optionOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -4473,7 +4954,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, level, transitionTime) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -4536,7 +5025,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, moveMode, rate) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -4602,7 +5099,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, stepMode, stepSize, transitionTime, optionMask, optionOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -4676,7 +5181,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, stepMode, stepSize, transitionTime) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 3;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -4742,7 +5255,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, optionMask, optionOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -4842,6 +5363,11 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace LowPower {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::LowPower::Commands::Ids::Sleep,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -4903,6 +5429,19 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace NetworkCommissioning {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::NetworkCommissioning::Commands::Ids::AddThreadNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::AddWiFiNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::DisableNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::EnableNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::GetLastNetworkCommissioningResult,
+    Clusters::NetworkCommissioning::Commands::Ids::RemoveNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::ScanNetworks,
+    Clusters::NetworkCommissioning::Commands::Ids::UpdateThreadNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::UpdateWiFiNetwork,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -4953,12 +5492,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    operationalDataset   = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(operationalDataset);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -5025,18 +5561,12 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    credentials          = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(ssid);
+                    break;
+                case 1:
+                    TLVUnpackError = aDataTlv.Get(credentials);
+                    break;
                 case 2:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -5102,12 +5632,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    networkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(networkID);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -5173,12 +5700,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    networkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(networkID);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -5217,7 +5741,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint32_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, timeoutMs) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -5303,12 +5835,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    NetworkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(NetworkID);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(Breadcrumb);
                     break;
@@ -5374,12 +5903,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(ssid);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -5444,12 +5970,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    operationalDataset   = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(operationalDataset);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -5516,18 +6039,12 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    credentials          = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(ssid);
+                    break;
+                case 1:
+                    TLVUnpackError = aDataTlv.Get(credentials);
+                    break;
                 case 2:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -5598,6 +6115,13 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace OtaSoftwareUpdateProvider {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::OtaSoftwareUpdateProvider::Commands::Ids::ApplyUpdateRequest,
+    Clusters::OtaSoftwareUpdateProvider::Commands::Ids::NotifyUpdateApplied,
+    Clusters::OtaSoftwareUpdateProvider::Commands::Ids::QueryImage,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -5647,12 +6171,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    updateToken          = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(updateToken);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(newVersion);
                     break;
@@ -5714,12 +6235,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    updateToken          = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(updateToken);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(currentVersion);
                     break;
@@ -5814,12 +6332,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 case 7:
                     TLVUnpackError = aDataTlv.Get(requestorCanConsent);
                     break;
-                case 8: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    metadataForProvider  = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 8:
+                    TLVUnpackError = aDataTlv.Get(metadataForProvider);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -5886,6 +6401,13 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace OnOff {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::OnOff::Commands::Ids::Off,
+    Clusters::OnOff::Commands::Ids::On,
+    Clusters::OnOff::Commands::Ids::Toggle,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -5959,6 +6481,18 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace OperationalCredentials {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::OperationalCredentials::Commands::Ids::AddOpCert,
+    Clusters::OperationalCredentials::Commands::Ids::AddTrustedRootCertificate,
+    Clusters::OperationalCredentials::Commands::Ids::OpCSRRequest,
+    Clusters::OperationalCredentials::Commands::Ids::RemoveAllFabrics,
+    Clusters::OperationalCredentials::Commands::Ids::RemoveFabric,
+    Clusters::OperationalCredentials::Commands::Ids::RemoveTrustedRootCertificate,
+    Clusters::OperationalCredentials::Commands::Ids::SetFabric,
+    Clusters::OperationalCredentials::Commands::Ids::UpdateFabricLabel,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -6010,18 +6544,12 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    NOCArray             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    IPKValue             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(NOCArray);
+                    break;
+                case 1:
+                    TLVUnpackError = aDataTlv.Get(IPKValue);
+                    break;
                 case 2:
                     TLVUnpackError = aDataTlv.Get(CaseAdminNode);
                     break;
@@ -6085,12 +6613,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    RootCertificate      = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(RootCertificate);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -6147,12 +6672,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    CSRNonce             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(CSRNonce);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -6192,7 +6714,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<chip::FabricId, chip::NodeId, uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, FabricId, NodeId, VendorId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 3;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -6282,12 +6812,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data  = nullptr;
-                    TLVUnpackError        = aDataTlv.GetDataPtr(data);
-                    TrustedRootIdentifier = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(TrustedRootIdentifier);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -6320,7 +6847,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, VendorId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -6472,6 +7007,17 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace Scenes {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::Scenes::Commands::Ids::AddScene,
+    Clusters::Scenes::Commands::Ids::GetSceneMembership,
+    Clusters::Scenes::Commands::Ids::RecallScene,
+    Clusters::Scenes::Commands::Ids::RemoveAllScenes,
+    Clusters::Scenes::Commands::Ids::RemoveScene,
+    Clusters::Scenes::Commands::Ids::StoreScene,
+    Clusters::Scenes::Commands::Ids::ViewScene,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -6573,7 +7119,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, groupId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -6634,7 +7188,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint8_t, uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, groupId, sceneId, transitionTime) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 3;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -6699,7 +7261,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, groupId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -6759,7 +7329,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, groupId, sceneId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -6822,7 +7400,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, groupId, sceneId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -6885,7 +7471,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, groupId, sceneId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -6979,6 +7573,13 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace TestCluster {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::TestCluster::Commands::Ids::Test,
+    Clusters::TestCluster::Commands::Ids::TestNotHandled,
+    Clusters::TestCluster::Commands::Ids::TestSpecific,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -7135,6 +7736,53 @@ exit:
     aReader.ExitContainer(dataTlvType);
 }
 
+bool ServerClusterAcceptsCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId)
+{
+    switch (aClusterId)
+    {
+    case Clusters::BarrierControl::Id:
+        return clusters::BarrierControl::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::Basic::Id:
+        return clusters::Basic::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::Binding::Id:
+        return clusters::Binding::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::ColorControl::Id:
+        return clusters::ColorControl::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::DiagnosticLogs::Id:
+        return clusters::DiagnosticLogs::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::DoorLock::Id:
+        return clusters::DoorLock::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::EthernetNetworkDiagnostics::Id:
+        return clusters::EthernetNetworkDiagnostics::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::GeneralCommissioning::Id:
+        return clusters::GeneralCommissioning::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::Groups::Id:
+        return clusters::Groups::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::IasZone::Id:
+        return clusters::IasZone::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::Identify::Id:
+        return clusters::Identify::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::LevelControl::Id:
+        return clusters::LevelControl::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::LowPower::Id:
+        return clusters::LowPower::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::NetworkCommissioning::Id:
+        return clusters::NetworkCommissioning::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::OtaSoftwareUpdateProvider::Id:
+        return clusters::OtaSoftwareUpdateProvider::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::OnOff::Id:
+        return clusters::OnOff::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::OperationalCredentials::Id:
+        return clusters::OperationalCredentials::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::Scenes::Id:
+        return clusters::Scenes::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::TestCluster::Id:
+        return clusters::TestCluster::kAcceptedCommands.Contains(aCommandId);
+    default:
+        return false;
+    }
+}
+
 void DispatchSingleClusterResponseCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId, chip::EndpointId aEndPointId,
                                           chip::TLV::TLVReader & aReader, CommandSender * apCommandObj)
 {
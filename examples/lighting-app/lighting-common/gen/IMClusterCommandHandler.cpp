@@ -27,6 +27,8 @@
 #include "app/util/util.h"
 
 #include <app/InteractionModelEngine.h>
+#include <app/util/command-set.h>
+#include <lib/core/CHIPTLVCodec.h>
 
 // Currently we need some work to keep compatible with ember lib.
 #include <app/util/ember-compatibility-functions.h>
@@ -40,6 +42,29 @@ namespace clusters {
 
 namespace ColorControl {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::ColorControl::Commands::Ids::ColorLoopSet,
+    Clusters::ColorControl::Commands::Ids::EnhancedMoveHue,
+    Clusters::ColorControl::Commands::Ids::EnhancedMoveToHue,
+    Clusters::ColorControl::Commands::Ids::EnhancedMoveToHueAndSaturation,
+    Clusters::ColorControl::Commands::Ids::EnhancedStepHue,
+    Clusters::ColorControl::Commands::Ids::MoveColor,
+    Clusters::ColorControl::Commands::Ids::MoveColorTemperature,
+    Clusters::ColorControl::Commands::Ids::MoveHue,
+    Clusters::ColorControl::Commands::Ids::MoveSaturation,
+    Clusters::ColorControl::Commands::Ids::MoveToColor,
+    Clusters::ColorControl::Commands::Ids::MoveToColorTemperature,
+    Clusters::ColorControl::Commands::Ids::MoveToHue,
+    Clusters::ColorControl::Commands::Ids::MoveToHueAndSaturation,
+    Clusters::ColorControl::Commands::Ids::MoveToSaturation,
+    Clusters::ColorControl::Commands::Ids::StepColor,
+    Clusters::ColorControl::Commands::Ids::StepColorTemperature,
+    Clusters::ColorControl::Commands::Ids::StepHue,
+    Clusters::ColorControl::Commands::Ids::StepSaturation,
+    Clusters::ColorControl::Commands::Ids::StopMoveStep,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -69,7 +94,16 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint16_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, updateFlags, action, direction, time, startHue, optionsMask,
+                                       optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 7;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -150,7 +184,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, moveMode, rate, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -223,7 +265,16 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, enhancedHue, direction, transitionTime, optionsMask,
+                                       optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -299,7 +350,16 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, enhancedHue, saturation, transitionTime, optionsMask,
+                                       optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -375,7 +435,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, stepMode, stepSize, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -450,7 +518,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<int16_t, int16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, rateX, rateY, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -523,7 +599,16 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, moveMode, rate, colorTemperatureMinimum, colorTemperatureMaximum, optionsMask,
+                                       optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 6;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -601,7 +686,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, moveMode, rate, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -672,7 +765,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, moveMode, rate, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -745,7 +846,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint16_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, colorX, colorY, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -820,7 +929,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, colorTemperature, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -893,7 +1010,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, hue, direction, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -969,7 +1094,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, hue, saturation, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1044,7 +1177,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, saturation, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1117,7 +1258,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<int16_t, int16_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, stepX, stepY, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1195,7 +1344,16 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, stepMode, stepSize, transitionTime, colorTemperatureMinimum,
+                                       colorTemperatureMaximum, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 7;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1278,7 +1436,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, stepMode, stepSize, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1354,7 +1520,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, stepMode, stepSize, transitionTime, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1427,7 +1601,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, optionsMask, optionsOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1521,6 +1703,11 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace DiagnosticLogs {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::DiagnosticLogs::Commands::Ids::RetrieveLogsRequest,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -1577,12 +1764,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 case 1:
                     TLVUnpackError = aDataTlv.Get(requestedProtocol);
                     break;
-                case 2: {
-                    const uint8_t * data   = nullptr;
-                    TLVUnpackError         = aDataTlv.GetDataPtr(data);
-                    transferFileDesignator = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 2:
+                    TLVUnpackError = aDataTlv.Get(transferFileDesignator);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -1647,6 +1831,11 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace EthernetNetworkDiagnostics {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::EthernetNetworkDiagnostics::Commands::Ids::ResetCounts,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -1709,6 +1898,13 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace GeneralCommissioning {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::GeneralCommissioning::Commands::Ids::ArmFailSafe,
+    Clusters::GeneralCommissioning::Commands::Ids::CommissioningComplete,
+    Clusters::GeneralCommissioning::Commands::Ids::SetRegulatoryConfig,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -1734,7 +1930,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint64_t, uint32_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, expiryLengthSeconds, breadcrumb, timeoutMs) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 3;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1911,6 +2115,18 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace LevelControl {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::LevelControl::Commands::Ids::Move,
+    Clusters::LevelControl::Commands::Ids::MoveToLevel,
+    Clusters::LevelControl::Commands::Ids::MoveToLevelWithOnOff,
+    Clusters::LevelControl::Commands::Ids::MoveWithOnOff,
+    Clusters::LevelControl::Commands::Ids::Step,
+    Clusters::LevelControl::Commands::Ids::StepWithOnOff,
+    Clusters::LevelControl::Commands::Ids::Stop,
+    Clusters::LevelControl::Commands::Ids::StopWithOnOff,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -1937,7 +2153,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, moveMode, rate, optionMask, optionOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2008,7 +2232,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, level, transitionTime, optionMask, optionOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2078,7 +2310,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, level, transitionTime) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2141,7 +2381,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, moveMode, rate) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2207,7 +2455,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, stepMode, stepSize, transitionTime, optionMask, optionOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2281,7 +2537,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, stepMode, stepSize, transitionTime) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 3;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2347,7 +2611,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, optionMask, optionOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2447,6 +2719,19 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace NetworkCommissioning {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::NetworkCommissioning::Commands::Ids::AddThreadNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::AddWiFiNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::DisableNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::EnableNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::GetLastNetworkCommissioningResult,
+    Clusters::NetworkCommissioning::Commands::Ids::RemoveNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::ScanNetworks,
+    Clusters::NetworkCommissioning::Commands::Ids::UpdateThreadNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::UpdateWiFiNetwork,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -2497,12 +2782,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    operationalDataset   = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(operationalDataset);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -2569,18 +2851,12 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    credentials          = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(ssid);
+                    break;
+                case 1:
+                    TLVUnpackError = aDataTlv.Get(credentials);
+                    break;
                 case 2:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -2646,12 +2922,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    networkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(networkID);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -2717,12 +2990,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    networkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(networkID);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -2761,7 +3031,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint32_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, timeoutMs) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2847,12 +3125,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    NetworkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(NetworkID);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(Breadcrumb);
                     break;
@@ -2918,12 +3193,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(ssid);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -2988,12 +3260,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    operationalDataset   = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(operationalDataset);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -3060,18 +3329,12 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    credentials          = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(ssid);
+                    break;
+                case 1:
+                    TLVUnpackError = aDataTlv.Get(credentials);
+                    break;
                 case 2:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -3142,6 +3405,13 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace OnOff {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::OnOff::Commands::Ids::Off,
+    Clusters::OnOff::Commands::Ids::On,
+    Clusters::OnOff::Commands::Ids::Toggle,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -3215,6 +3485,18 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace OperationalCredentials {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::OperationalCredentials::Commands::Ids::AddOpCert,
+    Clusters::OperationalCredentials::Commands::Ids::AddTrustedRootCertificate,
+    Clusters::OperationalCredentials::Commands::Ids::OpCSRRequest,
+    Clusters::OperationalCredentials::Commands::Ids::RemoveAllFabrics,
+    Clusters::OperationalCredentials::Commands::Ids::RemoveFabric,
+    Clusters::OperationalCredentials::Commands::Ids::RemoveTrustedRootCertificate,
+    Clusters::OperationalCredentials::Commands::Ids::SetFabric,
+    Clusters::OperationalCredentials::Commands::Ids::UpdateFabricLabel,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -3266,18 +3548,12 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    NOCArray             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    IPKValue             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(NOCArray);
+                    break;
+                case 1:
+                    TLVUnpackError = aDataTlv.Get(IPKValue);
+                    break;
                 case 2:
                     TLVUnpackError = aDataTlv.Get(CaseAdminNode);
                     break;
@@ -3341,12 +3617,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    RootCertificate      = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(RootCertificate);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -3403,12 +3676,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    CSRNonce             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(CSRNonce);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -3448,7 +3718,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<chip::FabricId, chip::NodeId, uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, FabricId, NodeId, VendorId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 3;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -3538,12 +3816,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data  = nullptr;
-                    TLVUnpackError        = aDataTlv.GetDataPtr(data);
-                    TrustedRootIdentifier = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(TrustedRootIdentifier);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -3576,7 +3851,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, VendorId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -3778,6 +4061,31 @@ exit:
     aReader.ExitContainer(dataTlvType);
 }
 
+bool ServerClusterAcceptsCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId)
+{
+    switch (aClusterId)
+    {
+    case Clusters::ColorControl::Id:
+        return clusters::ColorControl::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::DiagnosticLogs::Id:
+        return clusters::DiagnosticLogs::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::EthernetNetworkDiagnostics::Id:
+        return clusters::EthernetNetworkDiagnostics::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::GeneralCommissioning::Id:
+        return clusters::GeneralCommissioning::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::LevelControl::Id:
+        return clusters::LevelControl::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::NetworkCommissioning::Id:
+        return clusters::NetworkCommissioning::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::OnOff::Id:
+        return clusters::OnOff::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::OperationalCredentials::Id:
+        return clusters::OperationalCredentials::kAcceptedCommands.Contains(aCommandId);
+    default:
+        return false;
+    }
+}
+
 void DispatchSingleClusterResponseCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId, chip::EndpointId aEndPointId,
                                           chip::TLV::TLVReader & aReader, CommandSender * apCommandObj)
 {
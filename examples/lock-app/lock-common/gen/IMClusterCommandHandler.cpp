@@ -27,6 +27,8 @@
 #include "app/util/util.h"
 
 #include <app/InteractionModelEngine.h>
+#include <app/util/command-set.h>
+#include <lib/core/CHIPTLVCodec.h>
 
 // Currently we need some work to keep compatible with ember lib.
 #include <app/util/ember-compatibility-functions.h>
@@ -40,6 +42,11 @@ namespace clusters {
 
 namespace DiagnosticLogs {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::DiagnosticLogs::Commands::Ids::RetrieveLogsRequest,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -96,12 +103,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 case 1:
                     TLVUnpackError = aDataTlv.Get(requestedProtocol);
                     break;
-                case 2: {
-                    const uint8_t * data   = nullptr;
-                    TLVUnpackError         = aDataTlv.GetDataPtr(data);
-                    transferFileDesignator = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 2:
+                    TLVUnpackError = aDataTlv.Get(transferFileDesignator);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -166,6 +170,13 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace GeneralCommissioning {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::GeneralCommissioning::Commands::Ids::ArmFailSafe,
+    Clusters::GeneralCommissioning::Commands::Ids::CommissioningComplete,
+    Clusters::GeneralCommissioning::Commands::Ids::SetRegulatoryConfig,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -191,7 +202,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint64_t, uint32_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, expiryLengthSeconds, breadcrumb, timeoutMs) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 3;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -368,6 +387,19 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace NetworkCommissioning {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::NetworkCommissioning::Commands::Ids::AddThreadNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::AddWiFiNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::DisableNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::EnableNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::GetLastNetworkCommissioningResult,
+    Clusters::NetworkCommissioning::Commands::Ids::RemoveNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::ScanNetworks,
+    Clusters::NetworkCommissioning::Commands::Ids::UpdateThreadNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::UpdateWiFiNetwork,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -418,12 +450,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    operationalDataset   = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(operationalDataset);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -490,18 +519,12 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    credentials          = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(ssid);
+                    break;
+                case 1:
+                    TLVUnpackError = aDataTlv.Get(credentials);
+                    break;
                 case 2:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -567,12 +590,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    networkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(networkID);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -638,12 +658,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    networkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(networkID);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -682,7 +699,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint32_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, timeoutMs) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -768,12 +793,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    NetworkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(NetworkID);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(Breadcrumb);
                     break;
@@ -839,12 +861,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(ssid);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -909,12 +928,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    operationalDataset   = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(operationalDataset);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -981,18 +997,12 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    credentials          = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(ssid);
+                    break;
+                case 1:
+                    TLVUnpackError = aDataTlv.Get(credentials);
+                    break;
                 case 2:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -1063,6 +1073,13 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace OnOff {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::OnOff::Commands::Ids::Off,
+    Clusters::OnOff::Commands::Ids::On,
+    Clusters::OnOff::Commands::Ids::Toggle,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -1136,6 +1153,18 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace OperationalCredentials {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::OperationalCredentials::Commands::Ids::AddOpCert,
+    Clusters::OperationalCredentials::Commands::Ids::AddTrustedRootCertificate,
+    Clusters::OperationalCredentials::Commands::Ids::OpCSRRequest,
+    Clusters::OperationalCredentials::Commands::Ids::RemoveAllFabrics,
+    Clusters::OperationalCredentials::Commands::Ids::RemoveFabric,
+    Clusters::OperationalCredentials::Commands::Ids::RemoveTrustedRootCertificate,
+    Clusters::OperationalCredentials::Commands::Ids::SetFabric,
+    Clusters::OperationalCredentials::Commands::Ids::UpdateFabricLabel,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -1187,18 +1216,12 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    NOCArray             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    IPKValue             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(NOCArray);
+                    break;
+                case 1:
+                    TLVUnpackError = aDataTlv.Get(IPKValue);
+                    break;
                 case 2:
                     TLVUnpackError = aDataTlv.Get(CaseAdminNode);
                     break;
@@ -1262,12 +1285,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    RootCertificate      = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(RootCertificate);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -1324,12 +1344,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    CSRNonce             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(CSRNonce);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -1369,7 +1386,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<chip::FabricId, chip::NodeId, uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, FabricId, NodeId, VendorId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 3;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1459,12 +1484,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data  = nullptr;
-                    TLVUnpackError        = aDataTlv.GetDataPtr(data);
-                    TrustedRootIdentifier = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(TrustedRootIdentifier);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -1497,7 +1519,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, VendorId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1690,6 +1720,25 @@ exit:
     aReader.ExitContainer(dataTlvType);
 }
 
+bool ServerClusterAcceptsCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId)
+{
+    switch (aClusterId)
+    {
+    case Clusters::DiagnosticLogs::Id:
+        return clusters::DiagnosticLogs::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::GeneralCommissioning::Id:
+        return clusters::GeneralCommissioning::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::NetworkCommissioning::Id:
+        return clusters::NetworkCommissioning::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::OnOff::Id:
+        return clusters::OnOff::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::OperationalCredentials::Id:
+        return clusters::OperationalCredentials::kAcceptedCommands.Contains(aCommandId);
+    default:
+        return false;
+    }
+}
+
 void DispatchSingleClusterResponseCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId, chip::EndpointId aEndPointId,
                                           chip::TLV::TLVReader & aReader, CommandSender * apCommandObj)
 {
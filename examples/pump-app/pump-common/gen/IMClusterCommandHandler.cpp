@@ -27,6 +27,8 @@
 #include "app/util/util.h"
 
 #include <app/InteractionModelEngine.h>
+#include <app/util/command-set.h>
+#include <lib/core/CHIPTLVCodec.h>
 
 // Currently we need some work to keep compatible with ember lib.
 #include <app/util/ember-compatibility-functions.h>
@@ -40,6 +42,9 @@ namespace clusters {
 
 namespace Basic {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -95,6 +100,11 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace DiagnosticLogs {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::DiagnosticLogs::Commands::Ids::RetrieveLogsRequest,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -151,12 +161,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 case 1:
                     TLVUnpackError = aDataTlv.Get(requestedProtocol);
                     break;
-                case 2: {
-                    const uint8_t * data   = nullptr;
-                    TLVUnpackError         = aDataTlv.GetDataPtr(data);
-                    transferFileDesignator = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 2:
+                    TLVUnpackError = aDataTlv.Get(transferFileDesignator);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -221,6 +228,13 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace GeneralCommissioning {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::GeneralCommissioning::Commands::Ids::ArmFailSafe,
+    Clusters::GeneralCommissioning::Commands::Ids::CommissioningComplete,
+    Clusters::GeneralCommissioning::Commands::Ids::SetRegulatoryConfig,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -246,7 +260,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint64_t, uint32_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, expiryLengthSeconds, breadcrumb, timeoutMs) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 3;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -423,6 +445,18 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace LevelControl {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::LevelControl::Commands::Ids::Move,
+    Clusters::LevelControl::Commands::Ids::MoveToLevel,
+    Clusters::LevelControl::Commands::Ids::MoveToLevelWithOnOff,
+    Clusters::LevelControl::Commands::Ids::MoveWithOnOff,
+    Clusters::LevelControl::Commands::Ids::Step,
+    Clusters::LevelControl::Commands::Ids::StepWithOnOff,
+    Clusters::LevelControl::Commands::Ids::Stop,
+    Clusters::LevelControl::Commands::Ids::StopWithOnOff,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -449,7 +483,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, moveMode, rate, optionMask, optionOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -520,7 +562,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, level, transitionTime, optionMask, optionOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 4;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -590,7 +640,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, level, transitionTime) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -653,7 +711,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, moveMode, rate) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -719,7 +785,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint16_t, uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, stepMode, stepSize, transitionTime, optionMask, optionOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 5;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -793,7 +867,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, stepMode, stepSize, transitionTime) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 3;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -859,7 +941,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, optionMask, optionOverride) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 2;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -959,6 +1049,18 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace NetworkCommissioning {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::NetworkCommissioning::Commands::Ids::AddThreadNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::AddWiFiNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::DisableNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::EnableNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::RemoveNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::ScanNetworks,
+    Clusters::NetworkCommissioning::Commands::Ids::UpdateThreadNetwork,
+    Clusters::NetworkCommissioning::Commands::Ids::UpdateWiFiNetwork,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -1009,12 +1111,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    operationalDataset   = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(operationalDataset);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -1081,18 +1180,12 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    credentials          = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(ssid);
+                    break;
+                case 1:
+                    TLVUnpackError = aDataTlv.Get(credentials);
+                    break;
                 case 2:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -1158,12 +1251,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    networkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(networkID);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -1229,12 +1319,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    networkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(networkID);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -1300,12 +1387,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    NetworkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(NetworkID);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(Breadcrumb);
                     break;
@@ -1371,12 +1455,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(ssid);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -1441,12 +1522,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    operationalDataset   = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(operationalDataset);
+                    break;
                 case 1:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -1513,18 +1591,12 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    credentials          = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(ssid);
+                    break;
+                case 1:
+                    TLVUnpackError = aDataTlv.Get(credentials);
+                    break;
                 case 2:
                     TLVUnpackError = aDataTlv.Get(breadcrumb);
                     break;
@@ -1595,6 +1667,13 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace OnOff {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::OnOff::Commands::Ids::Off,
+    Clusters::OnOff::Commands::Ids::On,
+    Clusters::OnOff::Commands::Ids::Toggle,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -1668,6 +1747,18 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
 namespace OperationalCredentials {
 
+// The commands DispatchServerCommand handles.
+constexpr CommandSet kAcceptedCommands = {
+    Clusters::OperationalCredentials::Commands::Ids::AddOpCert,
+    Clusters::OperationalCredentials::Commands::Ids::AddTrustedRootCertificate,
+    Clusters::OperationalCredentials::Commands::Ids::OpCSRRequest,
+    Clusters::OperationalCredentials::Commands::Ids::RemoveAllFabrics,
+    Clusters::OperationalCredentials::Commands::Ids::RemoveFabric,
+    Clusters::OperationalCredentials::Commands::Ids::RemoveTrustedRootCertificate,
+    Clusters::OperationalCredentials::Commands::Ids::SetFabric,
+    Clusters::OperationalCredentials::Commands::Ids::UpdateFabricLabel,
+};
+
 void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aCommandId, EndpointId aEndpointId,
                            TLV::TLVReader & aDataTlv)
 {
@@ -1719,18 +1810,12 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    NOCArray             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    IPKValue             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(NOCArray);
+                    break;
+                case 1:
+                    TLVUnpackError = aDataTlv.Get(IPKValue);
+                    break;
                 case 2:
                     TLVUnpackError = aDataTlv.Get(CaseAdminNode);
                     break;
@@ -1794,12 +1879,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    RootCertificate      = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(RootCertificate);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -1856,12 +1938,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    CSRNonce             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(CSRNonce);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -1901,7 +1980,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<chip::FabricId, chip::NodeId, uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, FabricId, NodeId, VendorId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 3;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -1991,12 +2078,9 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
                 }
                 switch (currentDecodeTagId)
                 {
-                case 0: {
-                    const uint8_t * data  = nullptr;
-                    TLVUnpackError        = aDataTlv.GetDataPtr(data);
-                    TrustedRootIdentifier = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
+                case 0:
+                    TLVUnpackError = aDataTlv.Get(TrustedRootIdentifier);
+                    break;
                 default:
                     // Unsupported tag, ignore it.
                     ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
@@ -2029,7 +2113,15 @@ void DispatchServerCommand(app::CommandHandler * apCommandObj, CommandId aComman
 
             memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+            // Arguments in the fixed layout of their codec are decoded in one step, anything else by the loop below.
+            using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+            if (ArgumentsCodec::Decode(aDataTlv, VendorId) == CHIP_NO_ERROR)
+            {
+                validArgumentCount = 1;
+                TLVError           = CHIP_END_OF_TLV;
+            }
+
+            while (CHIP_NO_ERROR == TLVError && (TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
             {
                 // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
                 // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
@@ -2228,6 +2320,29 @@ exit:
     aReader.ExitContainer(dataTlvType);
 }
 
+bool ServerClusterAcceptsCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId)
+{
+    switch (aClusterId)
+    {
+    case Clusters::Basic::Id:
+        return clusters::Basic::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::DiagnosticLogs::Id:
+        return clusters::DiagnosticLogs::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::GeneralCommissioning::Id:
+        return clusters::GeneralCommissioning::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::LevelControl::Id:
+        return clusters::LevelControl::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::NetworkCommissioning::Id:
+        return clusters::NetworkCommissioning::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::OnOff::Id:
+        return clusters::OnOff::kAcceptedCommands.Contains(aCommandId);
+    case Clusters::OperationalCredentials::Id:
+        return clusters::OperationalCredentials::kAcceptedCommands.Contains(aCommandId);
+    default:
+        return false;
+    }
+}
+
 void DispatchSingleClusterResponseCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId, chip::EndpointId aEndPointId,
                                           chip::TLV::TLVReader & aReader, CommandSender * apCommandObj)
 {
@@ -23,6 +23,8 @@
 
 namespace chip {
 namespace app {
+class ReadHandler;
+
 struct ClusterInfo
 {
     enum class Flags : uint8_t
@@ -45,6 +47,13 @@ struct ClusterInfo
     BitFlags<Flags> mFlags;
     ClusterInfo * mpNext = nullptr;
     EventId mEventId     = 0;
+    // Index of the attribute that a report of this path with a wildcard field ID resumes at, for reports split over chunks.
+    uint16_t mResumeAttributeIndex = 0;
+    // Links used by the reporting engine while the path belongs to a read handler: the handler's list of dirty paths, and
+    // the engine's index from path to the handlers interested in it.
+    ClusterInfo * mpNextDirty      = nullptr;
+    ClusterInfo * mpNextInterested = nullptr;
+    ReadHandler * mpReadHandler    = nullptr;
     /* For better structure alignment
      * Above ordering is by bit-size to ensure least amount of memory alignment padding.
      * Changing order to something more natural (e.g. clusterid before nodeid) will result
@@ -58,7 +67,10 @@ struct ClusterInfo
      * uint8_t mType
      * uint32_t mpNext
      * uint16_t EventId
-     * padding 2 bytes
+     * uint16_t mResumeAttributeIndex
+     * uint32_t mpNextDirty
+     * uint32_t mpNextInterested
+     * uint32_t mpReadHandler
      */
 };
 } // namespace app
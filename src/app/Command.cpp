@@ -58,10 +58,10 @@ CHIP_ERROR Command::Reset()
 
     mCommandMessageWriter.Reset();
 
-    System::PacketBufferHandle commandPacket = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+    System::PacketBufferHandle commandPacket = MessagePacketBuffer::NewChainHead(chip::app::kMaxSecureSduLengthBytes);
     VerifyOrExit(!commandPacket.IsNull(), err = CHIP_ERROR_NO_MEMORY);
 
-    mCommandMessageWriter.Init(std::move(commandPacket));
+    mCommandMessageWriter.Init(std::move(commandPacket), true /* useChainedBuffers */, chip::app::kMaxSecureSduLengthBytes);
     err = mInvokeCommandBuilder.Init(&mCommandMessageWriter);
     SuccessOrExit(err);
 
@@ -97,6 +97,20 @@ CHIP_ERROR CommandHandler::ProcessCommandDataElement(CommandDataElement::Parser
 
     VerifyOrExit(ServerClusterCommandExists(clusterId, commandId, endpointId), err = CHIP_ERROR_INVALID_PROFILE_ID);
 
+    if (!ServerClusterAcceptsCommand(clusterId, commandId))
+    {
+        // Report the same status as the generated dispatch code does for a command it does not handle, without handing it
+        // the command data.
+        chip::app::CommandPathParams returnStatusParam = { endpointId,
+                                                           0, // GroupId
+                                                           clusterId, commandId, (chip::app::CommandPathFlags::kEndpointIdValid) };
+
+        ChipLogError(DataManagement, "Unknown command 0x%" PRIx32 " for cluster 0x%" PRIx32, commandId, clusterId);
+        AddStatusCode(returnStatusParam, GeneralStatusCode::kNotFound, Protocols::SecureChannel::Id,
+                      Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
+        ExitNow();
+    }
+
     err = aCommandElement.GetData(&commandDataReader);
     if (CHIP_END_OF_TLV == err)
     {
@@ -17,6 +17,7 @@
  */
 
 #include <app/EventManagement.h>
+#include <algorithm>
 #include <app/InteractionModelEngine.h>
 #include <core/CHIPEventLoggingConfig.h>
 #include <core/CHIPTLVUtilities.hpp>
@@ -64,6 +65,7 @@ struct ReclaimEventCtx
 {
     CircularEventBuffer * mpEventBuffer = nullptr;
     size_t mSpaceNeededForMovedEvent    = 0;
+    uint64_t mMovedEventPathMask        = 0;
 };
 
 /**
@@ -145,7 +147,7 @@ void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, uint3
 #endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
 }
 
-CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer)
+CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer, uint64_t aPathMask)
 {
     CircularTLVWriter writer;
     CircularTLVReader reader;
@@ -155,7 +157,9 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-    CircularEventBuffer backup = *nextBuffer;
+    const CircularEventBuffer::Checkpoint checkpoint = nextBuffer->GetCheckpoint();
+    const uint64_t position                          = nextBuffer->GetTailPosition();
+    const EventIndexEntry * indexEntry;
 
     // Set up the next buffer s.t. it fails if needs to evict an element
     nextBuffer->mProcessEvictedElement = AlwaysFail;
@@ -174,12 +178,26 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     err = writer.Finalize();
     SuccessOrExit(err);
 
+    // The event keeps its index entry, if it has one, in its new buffer.
+    indexEntry = apEventBuffer->GetHeadIndexEntry();
+    if (indexEntry != nullptr)
+    {
+        EventIndexEntry movedEntry = *indexEntry;
+        movedEntry.mPosition       = position;
+        movedEntry.mPathMask       = aPathMask;
+        nextBuffer->AddIndexEntry(movedEntry);
+    }
+    else
+    {
+        nextBuffer->AddEventPathMask(aPathMask);
+    }
+
     ChipLogProgress(EventLogging, "Copy Event to next buffer with priority %u",
                     static_cast<unsigned>(nextBuffer->GetPriorityLevel()));
 exit:
     if (err != CHIP_NO_ERROR)
     {
-        *nextBuffer = backup;
+        nextBuffer->RestoreCheckpoint(checkpoint);
     }
     return err;
 }
@@ -206,7 +224,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace)
 
             eventBuffer->mProcessEvictedElement = EvictEvent;
             eventBuffer->mAppData               = &ctx;
-            err                                 = eventBuffer->EvictHead();
+            err                                 = eventBuffer->EvictHeadEvent();
 
             // one of two things happened: either the element was evicted immediately if the head's priority is same as current
             // buffer(final one), or we figured out how much space we need to evict it into the next buffer, the check happens in
@@ -224,11 +242,11 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace)
                     // Since we're calling CopyElement and we've checked
                     // that there is space in the next buffer, we don't expect
                     // this to fail.
-                    err = CopyToNextBuffer(eventBuffer);
+                    err = CopyToNextBuffer(eventBuffer, ctx.mMovedEventPathMask);
                     SuccessOrExit(err);
                     // success; evict head unconditionally
                     eventBuffer->mProcessEvictedElement = nullptr;
-                    err                                 = eventBuffer->EvictHead();
+                    err                                 = eventBuffer->EvictHeadEvent();
                     // if unconditional eviction failed, this
                     // means that we have no way of further
                     // clearing the buffer.  fail out and let the
@@ -273,6 +291,17 @@ exit:
     return err;
 }
 
+void EventManagement::InitIndexEntry(EventIndexEntry & aEntry)
+{
+    aEntry.mPosition = mpEventBuffer->GetTailPosition();
+    for (CircularEventBuffer * buffer = mpEventBuffer; buffer != nullptr; buffer = buffer->GetNextCircularEventBuffer())
+    {
+        const size_t priority                 = static_cast<size_t>(buffer->GetPriorityLevel());
+        aEntry.mNextEventNumber[priority]     = buffer->GetNextEventNumber();
+        aEntry.mLastSystemTimestamp[priority] = buffer->GetLastEventSystemTimestamp();
+    }
+}
+
 CHIP_ERROR EventManagement::CalculateEventSize(EventLoggingDelegate * apDelegate, const EventOptions * apOptions,
                                                uint32_t & requiredSize)
 {
@@ -492,11 +521,12 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, E
                                             EventNumber & aEventNumber)
 {
     CircularTLVWriter writer;
-    CHIP_ERROR err                 = CHIP_NO_ERROR;
-    uint32_t requestSize           = 0;
-    aEventNumber                   = 0;
-    CircularEventBuffer checkpoint = *mpEventBuffer;
-    CircularEventBuffer * buffer   = nullptr;
+    CHIP_ERROR err                                   = CHIP_NO_ERROR;
+    uint32_t requestSize                             = 0;
+    aEventNumber                                     = 0;
+    const CircularEventBuffer::Checkpoint checkpoint = mpEventBuffer->GetCheckpoint();
+    CircularEventBuffer * buffer                     = nullptr;
+    EventIndexEntry indexEntry;
     EventLoadOutContext ctxt       = EventLoadOutContext(writer, aEventOptions.mpEventSchema->mPriority,
                                                    GetPriorityBuffer(aEventOptions.mpEventSchema->mPriority)->GetLastEventNumber());
     Timestamp timestamp(Timestamp::Type::kSystem, System::Clock::GetMonotonicMilliseconds());
@@ -532,6 +562,10 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, E
     err = EnsureSpaceInCircularBuffer(requestSize);
     SuccessOrExit(err);
 
+    InitIndexEntry(indexEntry);
+    indexEntry.mPathMask =
+        EventPathMask(opts.mpEventSchema->mEndpointId, opts.mpEventSchema->mClusterId, opts.mpEventSchema->mEventId);
+
     err = ConstructEvent(&ctxt, apDelegate, &opts);
     SuccessOrExit(err);
 
@@ -559,13 +593,14 @@ exit:
     ChipLogFunctError(err);
     if (err != CHIP_NO_ERROR)
     {
-        *mpEventBuffer = checkpoint;
+        mpEventBuffer->RestoreCheckpoint(checkpoint);
     }
     else if (opts.mpEventSchema->mPriority >= CHIP_CONFIG_EVENT_GLOBAL_PRIORITY)
     {
         CircularEventBuffer * currentBuffer = GetPriorityBuffer(opts.mpEventSchema->mPriority);
         aEventNumber                        = currentBuffer->VendEventNumber();
         currentBuffer->UpdateFirstLastEventTime(opts.mTimestamp);
+        mpEventBuffer->AddIndexEntry(indexEntry);
 
 #if CHIP_CONFIG_EVENT_LOGGING_VERBOSE_DEBUG_LOGS
         ChipLogDetail(EventLogging,
@@ -656,8 +691,11 @@ CHIP_ERROR EventManagement::EventIterator(const TLVReader & aReader, size_t aDep
 
     if (event.mPriority == apEventLoadOutContext->mPriority)
     {
+        const bool interested = IsInterestedEventPaths(apEventLoadOutContext, event);
+
         apEventLoadOutContext->mCurrentSystemTime.mValue += event.mDeltaSystemTime.mValue;
-        if (IsInterestedEventPaths(apEventLoadOutContext, event))
+        apEventLoadOutContext->mCurrentEventNumber++;
+        if (interested)
         {
             return CHIP_EVENT_ID_FOUND;
         }
@@ -670,7 +708,6 @@ CHIP_ERROR EventManagement::CopyEventsSince(const TLVReader & aReader, size_t aD
 {
     EventLoadOutContext * const loadOutContext = static_cast<EventLoadOutContext *>(apContext);
     CHIP_ERROR err                             = EventIterator(aReader, aDepth, loadOutContext);
-    loadOutContext->mCurrentEventNumber++;
     if (err == CHIP_EVENT_ID_FOUND)
     {
         // checkpoint the writer
@@ -695,14 +732,41 @@ CHIP_ERROR EventManagement::CopyEventsSince(const TLVReader & aReader, size_t aD
     return err;
 }
 
-CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, ClusterInfo * apClusterInfolist, PriorityLevel aPriority,
-                                             EventNumber & aEventNumber)
+CHIP_ERROR EventManagement::CopyEventsInRange(CircularEventBuffer * apBuffer, uint32_t aOffset, uint32_t aLength,
+                                              EventLoadOutContext & aContext)
 {
-    // TODO: Add particular set of event Paths in FetchEventsSince so that we can filter the interested paths
-    CHIP_ERROR err     = CHIP_NO_ERROR;
-    const bool recurse = false;
     TLVReader reader;
+    CircularEventReader circularReader;
     CircularEventBufferWrapper bufWrapper;
+
+    bufWrapper.mpCurrent    = apBuffer;
+    bufWrapper.mStartOffset = aOffset;
+    circularReader.Init(&bufWrapper);
+    reader.Init(circularReader);
+
+    while (reader.GetLengthRead() < aLength)
+    {
+        ReturnErrorOnFailure(reader.Next());
+        ReturnErrorOnFailure(CopyEventsSince(reader, 0, &aContext));
+        ReturnErrorOnFailure(reader.Skip());
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, ClusterInfo * apClusterInfolist, PriorityLevel aPriority,
+                                             EventNumber & aEventNumber)
+{
+    CHIP_ERROR err                  = CHIP_NO_ERROR;
+    uint64_t interestedPaths        = 0;
+    CircularEventBuffer * current   = nullptr;
+    size_t segment                  = 0;
+    CircularEventBuffer * last      = nullptr;
+    size_t lastSegment              = 0;
+    CircularEventBuffer * runBuffer = nullptr;
+    uint32_t runOffset              = 0;
+    uint32_t runLength              = 0;
+    const size_t priority           = static_cast<size_t>(aPriority);
     EventLoadOutContext context(aWriter, aPriority, aEventNumber);
 
     CircularEventBuffer * buf = mpEventBuffer;
@@ -715,19 +779,106 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, ClusterInfo *
         buf = buf->GetNextCircularEventBuffer();
     }
 
+    for (ClusterInfo * path = apClusterInfolist; path != nullptr; path = path->mpNext)
+    {
+        interestedPaths |= EventPathMask(path->mEndpointId, path->mClusterId, path->mEventId);
+    }
+
     context.mpInterestedEventPaths    = apClusterInfolist;
     context.mCurrentSystemTime.mValue = buf->GetFirstEventSystemTimestamp();
     context.mCurrentEventNumber       = buf->GetFirstEventNumber();
-    err                               = GetEventReader(reader, aPriority, &bufWrapper);
-    SuccessOrExit(err);
 
-    err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
-    if (err == CHIP_END_OF_TLV)
+    // The buffers are read from buf down to mpEventBuffer, oldest event first, one segment after the other. Start at the
+    // newest indexed event from which no requested event is missed, looking in the newest buffer first, or else at the head
+    // of buf.
+    current = mpEventBuffer;
+    while (!current->FindIndexedSegment(aPriority, aEventNumber, segment))
     {
-        err = CHIP_NO_ERROR;
+        if (current == buf)
+        {
+            segment = 0;
+            break;
+        }
+        current = current->GetNextCircularEventBuffer();
+    }
+
+    // Find the newest segment that may hold an interesting event; there is nothing to copy after it.
+    for (CircularEventBuffer * candidate = mpEventBuffer; last == nullptr; candidate = candidate->GetNextCircularEventBuffer())
+    {
+        const size_t firstSegment = (candidate == current) ? segment : 0;
+        for (size_t i = candidate->GetSegmentCount(); i > firstSegment; i--)
+        {
+            if ((candidate->GetSegment(i - 1).mPathMask & interestedPaths) != 0)
+            {
+                last        = candidate;
+                lastSegment = i - 1;
+                break;
+            }
+        }
+        if (candidate == current)
+        {
+            break;
+        }
     }
 
+    // Read runs of segments that may hold interesting events, and skip the others. Skipping a segment loses track of the
+    // number and timestamp of the events of aPriority, so a segment is only skipped if the next one starts at an indexed
+    // event, which tells them again.
+    while (last != nullptr)
+    {
+        const CircularEventBuffer::Segment range = current->GetSegment(segment);
+        const bool isLast                        = (current == last) && (segment == lastSegment);
+        const bool nextIsIndexed                 = (segment + 1 < current->GetSegmentCount());
+
+        if (isLast || !nextIsIndexed || (range.mPathMask & interestedPaths) != 0)
+        {
+            if (runBuffer == nullptr)
+            {
+                if (range.mpEntry != nullptr && range.mpEntry->mLastSystemTimestamp[priority] != 0)
+                {
+                    context.mCurrentSystemTime.mValue = range.mpEntry->mLastSystemTimestamp[priority];
+                    context.mCurrentEventNumber       = range.mpEntry->mNextEventNumber[priority];
+                }
+                runBuffer = current;
+                runOffset = range.mOffset;
+                runLength = 0;
+            }
+            runLength += range.mLength;
+        }
+        else if (runBuffer != nullptr)
+        {
+            SuccessOrExit(err = CopyEventsInRange(runBuffer, runOffset, runLength, context));
+            runBuffer = nullptr;
+        }
+
+        if (isLast)
+        {
+            break;
+        }
+        if (nextIsIndexed)
+        {
+            segment++;
+        }
+        else
+        {
+            current = current->GetPreviousCircularEventBuffer();
+            segment = 0;
+        }
+    }
+
+    if (runBuffer != nullptr)
+    {
+        SuccessOrExit(err = CopyEventsInRange(runBuffer, runOffset, runLength, context));
+    }
+
+    // Every event of aPriority has been looked at.
+    context.mCurrentEventNumber = buf->GetNextEventNumber();
+
 exit:
+    if (err == CHIP_END_OF_TLV)
+    {
+        err = CHIP_NO_ERROR;
+    }
     aEventNumber = context.mCurrentEventNumber;
 
     return err;
@@ -821,6 +972,7 @@ CHIP_ERROR EventManagement::EvictEvent(CHIPCircularTLVBuffer & apBuffer, void *
 
     // event is not getting dropped. Note how much space it requires, and return.
     ctx->mSpaceNeededForMovedEvent = aReader.GetLengthRead();
+    ctx->mMovedEventPathMask       = EventPathMask(context.mEndpointId, context.mClusterId, context.mEventId);
     return CHIP_END_OF_TLV;
 }
 
@@ -830,6 +982,16 @@ CHIP_ERROR EventManagement::ScheduleFlushIfNeeded(EventOptions::Type aUrgent)
     return CHIP_NO_ERROR;
 }
 
+uint64_t EventManagement::EventPathMask(EndpointId aEndpointId, ClusterId aClusterId, EventId aEventId)
+{
+    uint64_t key = static_cast<uint64_t>(aClusterId) << 32 | aEventId;
+    key ^= static_cast<uint64_t>(aEndpointId) * 0xC2B2AE3D27D4EB4FULL;
+
+    // The top bits of a multiplicative hash pick one of the 64 bits.
+    key *= 0x9E3779B97F4A7C15ULL;
+    return 1ULL << (key >> 58);
+}
+
 void EventManagement::SetScheduledEventEndpoint(EventNumber * apEventEndpoints)
 {
     CircularEventBuffer * eventBuffer = mpEventBuffer;
@@ -860,6 +1022,13 @@ void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, Circu
     mFirstEventSystemTimestamp = Timestamp::System(0);
     mLastEventSystemTimestamp  = Timestamp::System(0);
     mpEventNumberCounter       = nullptr;
+    mHeadPosition              = 0;
+    mHeadPathMask              = 0;
+    mIndexStart                = 0;
+    mIndexCount                = 0;
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    mIndexStride = aBufferLength / CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
@@ -882,6 +1051,140 @@ void CircularEventBuffer::RemoveEvent(EventNumber aNumEvents)
     mFirstEventNumber = mFirstEventNumber + aNumEvents;
 }
 
+CHIP_ERROR CircularEventBuffer::EvictHeadEvent()
+{
+    const uint32_t dataLength = DataLength();
+
+    ReturnErrorOnFailure(EvictHead());
+    mHeadPosition += dataLength - DataLength();
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    // Entries of evicted events are always the oldest ones. What is left of their segments joins the segment at the head.
+    while (mIndexCount > 0 && mIndex[mIndexStart].mPosition < mHeadPosition)
+    {
+        mHeadPathMask |= mIndex[mIndexStart].mPathMask;
+        mIndexStart = (mIndexStart + 1) % CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE;
+        mIndexCount--;
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    if (GetSegment(0).mLength == 0)
+    {
+        mHeadPathMask = 0;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CircularEventBuffer::Checkpoint CircularEventBuffer::GetCheckpoint() const
+{
+    return { *this,         mFirstEventNumber, mFirstEventSystemTimestamp, mLastEventSystemTimestamp, mRequiredSpaceForEvicted,
+             mHeadPosition, mHeadPathMask,     mIndexStart,                mIndexCount };
+}
+
+void CircularEventBuffer::RestoreCheckpoint(const Checkpoint & aCheckpoint)
+{
+    TLV::CHIPCircularTLVBuffer::operator=(aCheckpoint.mBuffer);
+    mFirstEventNumber          = aCheckpoint.mFirstEventNumber;
+    mFirstEventSystemTimestamp = aCheckpoint.mFirstEventSystemTimestamp;
+    mLastEventSystemTimestamp  = aCheckpoint.mLastEventSystemTimestamp;
+    mRequiredSpaceForEvicted   = aCheckpoint.mRequiredSpaceForEvicted;
+    mHeadPosition              = aCheckpoint.mHeadPosition;
+    mHeadPathMask              = aCheckpoint.mHeadPathMask;
+    mIndexStart                = aCheckpoint.mIndexStart;
+    mIndexCount                = aCheckpoint.mIndexCount;
+}
+
+void CircularEventBuffer::AddIndexEntry(const EventIndexEntry & aEntry)
+{
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    if (mIndexCount > 0 &&
+        aEntry.mPosition < mIndex[(mIndexStart + mIndexCount - 1) % CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE].mPosition + mIndexStride)
+    {
+        AddEventPathMask(aEntry.mPathMask);
+        return;
+    }
+
+    if (mIndexCount == CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE)
+    {
+        mHeadPathMask |= mIndex[mIndexStart].mPathMask;
+        mIndexStart = (mIndexStart + 1) % CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE;
+        mIndexCount--;
+    }
+    mIndex[(mIndexStart + mIndexCount) % CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE] = aEntry;
+    mIndexCount++;
+#else  // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    AddEventPathMask(aEntry.mPathMask);
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+}
+
+void CircularEventBuffer::AddEventPathMask(uint64_t aPathMask)
+{
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    if (mIndexCount > 0)
+    {
+        mIndex[(mIndexStart + mIndexCount - 1) % CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE].mPathMask |= aPathMask;
+        return;
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    mHeadPathMask |= aPathMask;
+}
+
+const EventIndexEntry * CircularEventBuffer::GetHeadIndexEntry() const
+{
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    if (mIndexCount > 0 && mIndex[mIndexStart].mPosition == mHeadPosition)
+    {
+        return &mIndex[mIndexStart];
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    return nullptr;
+}
+
+bool CircularEventBuffer::FindIndexedSegment(PriorityLevel aPriority, EventNumber aEventNumber, size_t & aSegment) const
+{
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    const size_t priority = static_cast<size_t>(aPriority);
+
+    for (size_t i = mIndexCount; i > 0; i--)
+    {
+        const EventIndexEntry & entry = mIndex[(mIndexStart + i - 1) % CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE];
+
+        // Without a preceding event of aPriority, the entry does not know the timestamp the next one is relative to.
+        if (entry.mLastSystemTimestamp[priority] != 0 && entry.mNextEventNumber[priority] <= aEventNumber)
+        {
+            aSegment = i;
+            return true;
+        }
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    return false;
+}
+
+CircularEventBuffer::Segment CircularEventBuffer::GetSegment(size_t aSegment) const
+{
+    Segment segment;
+    uint64_t end = GetTailPosition();
+
+    segment.mOffset   = 0;
+    segment.mPathMask = mHeadPathMask;
+    segment.mpEntry   = nullptr;
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    if (aSegment < mIndexCount)
+    {
+        end = mIndex[(mIndexStart + aSegment) % CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE].mPosition;
+    }
+
+    if (aSegment > 0)
+    {
+        segment.mpEntry   = &mIndex[(mIndexStart + aSegment - 1) % CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE];
+        segment.mOffset   = static_cast<uint32_t>(segment.mpEntry->mPosition - mHeadPosition);
+        segment.mPathMask = segment.mpEntry->mPathMask;
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    segment.mLength = static_cast<uint32_t>(end - mHeadPosition) - segment.mOffset;
+    return segment;
+}
+
 void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
 {
     CircularEventBuffer * prev;
@@ -889,8 +1192,10 @@ void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
     if (apBufWrapper->mpCurrent == nullptr)
         return;
 
-    TLVReader::Init(*apBufWrapper, apBufWrapper->mpCurrent->DataLength());
-    mMaxLen = apBufWrapper->mpCurrent->DataLength();
+    const uint32_t dataLength = apBufWrapper->mpCurrent->DataLength() - apBufWrapper->mStartOffset;
+
+    TLVReader::Init(*apBufWrapper, dataLength);
+    mMaxLen = dataLength;
     for (prev = apBufWrapper->mpCurrent->GetPreviousCircularEventBuffer(); prev != nullptr;
          prev = prev->GetPreviousCircularEventBuffer())
     {
@@ -903,7 +1208,27 @@ void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
 CHIP_ERROR CircularEventBufferWrapper::GetNextBuffer(TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
-    mpCurrent->GetNextBuffer(aReader, aBufStart, aBufLen);
+    if (aBufStart == nullptr && mStartOffset != 0)
+    {
+        // Start at an event inside mpCurrent rather than at its head; reading then goes on from there as usual.
+        const uint8_t * queueEnd = mpCurrent->GetQueue() + mpCurrent->GetTotalDataLength();
+        const uint32_t headRoom  = static_cast<uint32_t>(queueEnd - mpCurrent->QueueHead());
+
+        if (mStartOffset < headRoom)
+        {
+            aBufStart = mpCurrent->QueueHead() + mStartOffset;
+        }
+        else
+        {
+            aBufStart = mpCurrent->GetQueue() + (mStartOffset - headRoom);
+        }
+        aBufLen      = std::min(mpCurrent->DataLength() - mStartOffset, static_cast<uint32_t>(queueEnd - aBufStart));
+        mStartOffset = 0;
+    }
+    else
+    {
+        mpCurrent->GetNextBuffer(aReader, aBufStart, aBufLen);
+    }
     SuccessOrExit(err);
 
     if ((aBufLen == 0) && (mpCurrent->GetPreviousCircularEventBuffer() != nullptr))
@@ -32,6 +32,7 @@
 #include <app/MessageDef/EventDataElement.h>
 #include <app/util/basic-types.h>
 #include <core/CHIPCircularTLVBuffer.h>
+#include <core/CHIPEventLoggingConfig.h>
 #include <messaging/ExchangeMgr.h>
 #include <support/PersistedCounter.h>
 #include <system/SystemMutex.h>
@@ -43,6 +44,20 @@ namespace app {
 constexpr size_t kMaxEventSizeReserve  = 512;
 constexpr uint16_t kRequiredEventField = (1 << EventDataElement::kCsTag_PriorityLevel) |
     (1 << EventDataElement::kCsTag_DeltaSystemTimestamp) | (1 << EventDataElement::kCsTag_EventPath);
+constexpr size_t kNumPriorityLevels = static_cast<size_t>(PriorityLevel::Last) + 1;
+
+/**
+ * @brief
+ *   An entry of the event number index of a CircularEventBuffer: where an event starts in the buffer, and the state a
+ *   reader starting at that event needs for each priority level.
+ */
+struct EventIndexEntry
+{
+    uint64_t mPosition = 0; ///< Offset of the event from the first byte ever written to the buffer
+    EventNumber mNextEventNumber[kNumPriorityLevels]  = {}; ///< Number of the first event of each priority from here on
+    uint64_t mLastSystemTimestamp[kNumPriorityLevels] = {}; ///< Timestamp of the preceding event of each priority, 0 if none
+    uint64_t mPathMask = 0; ///< EventPathMask() of the paths of the events from here up to the next indexed event
+};
 
 /**
  * @brief
@@ -142,6 +157,103 @@ public:
 
     uint64_t GetLastEventSystemTimestamp() { return mLastEventSystemTimestamp.mValue; }
 
+    /**
+     * @brief
+     *   The event number the next event of this buffer's priority will get.
+     */
+    EventNumber GetNextEventNumber() { return static_cast<EventNumber>(mpEventNumberCounter->GetValue()); }
+
+    /**
+     * @brief
+     *   Evict the event at the head of the buffer, and drop it from the event number index.
+     */
+    CHIP_ERROR EvictHeadEvent();
+
+    /**
+     * @brief
+     *   The position, in the numbering used by EventIndexEntry::mPosition, at which the next event will be written.
+     */
+    uint64_t GetTailPosition() const { return mHeadPosition + DataLength(); }
+
+    /**
+     * @brief
+     *   A run of consecutive events in the buffer: either the events from one indexed event up to the next one, or the
+     *   events from the head of the buffer up to the first indexed event.
+     */
+    struct Segment
+    {
+        uint32_t mOffset;                ///< Offset of the first event from the head of the buffer
+        uint32_t mLength;                ///< Length of the events, in bytes
+        uint64_t mPathMask;              ///< Superset of the EventPathMask() of the paths of the events
+        const EventIndexEntry * mpEntry; ///< Index entry of the first event, nullptr for the segment at the head
+    };
+
+    /**
+     * @brief
+     *   Add an entry for the event written at aEntry.mPosition to the event number index.
+     *
+     * The index is sparse: the entry is only kept if the event starts at least 1/CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE of
+     * the buffer after the newest indexed event. Otherwise, or if the index is disabled, the event's path mask is added to
+     * the newest segment. Entries must be added in position order.
+     */
+    void AddIndexEntry(const EventIndexEntry & aEntry);
+
+    /**
+     * @brief
+     *   Add the path mask of an event written at the tail of the buffer without an index entry to the newest segment.
+     */
+    void AddEventPathMask(uint64_t aPathMask);
+
+    /**
+     * @brief
+     *   The index entry of the event at the head of the buffer, or nullptr if that event is not indexed.
+     */
+    const EventIndexEntry * GetHeadIndexEntry() const;
+
+    /**
+     * @brief
+     *   Find the newest indexed event from which a reader of aPriority events will not miss any event numbered
+     *   aEventNumber or later.
+     *
+     * @param[out] aSegment  On success, the number of the segment that starts at that event.
+     *
+     * @return Whether there is such an event in this buffer.
+     */
+    bool FindIndexedSegment(PriorityLevel aPriority, EventNumber aEventNumber, size_t & aSegment) const;
+
+    /**
+     * @brief
+     *   The number of segments in the buffer, oldest first. Segment 0 is the one at the head, and may be empty.
+     */
+    size_t GetSegmentCount() const { return mIndexCount + 1; }
+    Segment GetSegment(size_t aSegment) const;
+
+    /**
+     * @brief
+     *   The state of the buffer that writing and evicting events change, without the entries of the event number index,
+     *   so that it is cheap to save before logging an event.
+     */
+    struct Checkpoint
+    {
+        TLV::CHIPCircularTLVBuffer mBuffer;
+        EventNumber mFirstEventNumber;
+        Timestamp mFirstEventSystemTimestamp;
+        Timestamp mLastEventSystemTimestamp;
+        size_t mRequiredSpaceForEvicted;
+        uint64_t mHeadPosition;
+        uint64_t mHeadPathMask;
+        size_t mIndexStart;
+        size_t mIndexCount;
+    };
+
+    Checkpoint GetCheckpoint() const;
+
+    /**
+     * @brief
+     *   Undo the writes and evictions done since aCheckpoint was taken. No index entry may have been added since.
+     */
+    void RestoreCheckpoint(const Checkpoint & aCheckpoint);
+
     virtual ~CircularEventBuffer() = default;
 
 private:
@@ -162,6 +274,16 @@ private:
     EventNumber mLastEventNumber    = 0;  ///< Last event Number vended for this priority
     Timestamp mFirstEventSystemTimestamp; ///< The timestamp of the first event in this buffer
     Timestamp mLastEventSystemTimestamp;  ///< The timestamp of the last event in this buffer
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    // Sparse index of the events in the buffer, oldest first, kept as a ring starting at mIndexStart.
+    EventIndexEntry mIndex[CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE];
+    uint32_t mIndexStride = 0; ///< Minimum distance between indexed events
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    uint64_t mHeadPosition = 0; ///< Number of bytes evicted from the buffer since Init
+    uint64_t mHeadPathMask = 0; ///< Path mask of the segment at the head
+    size_t mIndexStart     = 0;
+    size_t mIndexCount     = 0;
 };
 
 class CircularEventReader;
@@ -177,6 +299,7 @@ class CircularEventBufferWrapper : public TLV::CHIPCircularTLVBuffer
 public:
     CircularEventBufferWrapper() : CHIPCircularTLVBuffer(nullptr, 0), mpCurrent(nullptr){};
     CircularEventBuffer * mpCurrent;
+    uint32_t mStartOffset = 0; ///< Offset from the head of mpCurrent at which reading starts
 
 private:
     CHIP_ERROR GetNextBuffer(chip::TLV::TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override;
@@ -371,6 +494,9 @@ public:
      * specified event.  The function will continue fetching events until
      * it runs out of space in the TLV::TLVWriter or in the log. The function
      * will terminate the event writing on event boundary.
+     * Only events whose path is in apClusterInfolist are fetched, and
+     * stretches of the log that hold none of them are skipped without
+     * being read.
      *
      * @param[in] aWriter     The writer to use for event storage
      * @param[in] apClusterInfolist the interested cluster info list with event path inside
@@ -461,6 +587,13 @@ public:
      */
     void SetScheduledEventEndpoint(EventNumber * aEventEndpoints);
 
+    /**
+     * @brief
+     *   A one-bit mask standing for the event path (aEndpointId, aClusterId, aEventId). Events of different paths may share
+     *   the bit, so a mask only tells for sure which paths an event log segment does not contain.
+     */
+    static uint64_t EventPathMask(EndpointId aEndpointId, ClusterId aClusterId, EventId aEventId);
+
 private:
     CHIP_ERROR CalculateEventSize(EventLoggingDelegate * apDelegate, const EventOptions * apOptions, uint32_t & requiredSize);
     /**
@@ -487,8 +620,25 @@ private:
      *
      * @param[in] apEventBuffer  CircularEventBuffer
      *
+     * @param[in] aPathMask      EventPathMask() of the event's path
+     *
+     */
+    CHIP_ERROR CopyToNextBuffer(CircularEventBuffer * apEventBuffer, uint64_t aPathMask);
+
+    /**
+     * @brief Fill in the index entry for an event about to be written at the tail of the top-level buffer
+     *
+     * @param[out] aEntry  The index entry
+     *
+     */
+    void InitIndexEntry(EventIndexEntry & aEntry);
+
+    /**
+     * @brief Copy the interesting events among the aLength bytes of events starting aOffset bytes after the head of
+     * apBuffer, which may reach into the previous buffers, like CopyEventsSince does.
      */
-    CHIP_ERROR CopyToNextBuffer(CircularEventBuffer * apEventBuffer);
+    CHIP_ERROR CopyEventsInRange(CircularEventBuffer * apBuffer, uint32_t aOffset, uint32_t aLength,
+                                 EventLoadOutContext & aContext);
 
     /**
      * @brief eusure current buffer has enough space, if not, when current buffer is final destination of last tail's event
@@ -40,21 +40,31 @@ InteractionModelEngine * InteractionModelEngine::GetInstance()
     return &sInteractionModelEngine;
 }
 
-CHIP_ERROR InteractionModelEngine::Init(Messaging::ExchangeManager * apExchangeMgr, InteractionModelDelegate * apDelegate)
+CHIP_ERROR InteractionModelEngine::Init(Messaging::ExchangeManager * apExchangeMgr, InteractionModelDelegate * apDelegate,
+                                        const InteractionModelPoolSizes & aPoolSizes)
 {
     mpExchangeMgr = apExchangeMgr;
     mpDelegate    = apDelegate;
 
-    ReturnErrorOnFailure(mpExchangeMgr->RegisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id, this));
-
-    mReportingEngine.Init();
+    VerifyOrReturnError(aPoolSizes.mNumPathGroups > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    ReturnErrorOnFailure(mCommandHandlerObjs.Init(aPoolSizes.mNumCommandHandlers));
+    ReturnErrorOnFailure(mReadHandlers.Init(aPoolSizes.mNumReadHandlers));
 
-    for (uint32_t index = 0; index < IM_SERVER_MAX_NUM_PATH_GROUPS - 1; index++)
+    // Handlers that are still serving a request keep their slot and their paths.
+    mMaxPaths = aPoolSizes.mNumPathGroups;
+    mNumPaths = 0;
+    for (size_t index = 0; index < mReadHandlers.Capacity(); index++)
     {
-        mClusterInfoPool[index].mpNext = &mClusterInfoPool[index + 1];
+        if (!mReadHandlers[index].IsFree())
+        {
+            mNumPaths += mReadHandlers[index].GetNumPaths();
+        }
     }
-    mClusterInfoPool[IM_SERVER_MAX_NUM_PATH_GROUPS - 1].mpNext = nullptr;
-    mpNextAvailableClusterInfo                                 = mClusterInfoPool;
+    mPathsHighWaterMark = mNumPaths;
+
+    ReturnErrorOnFailure(mpExchangeMgr->RegisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id, this));
+
+    mReportingEngine.Init();
 
     return CHIP_NO_ERROR;
 }
@@ -69,11 +79,11 @@ void InteractionModelEngine::Shutdown()
         }
     }
 
-    for (auto & commandHandler : mCommandHandlerObjs)
+    for (size_t index = 0; index < mCommandHandlerObjs.Capacity(); index++)
     {
-        if (!commandHandler.IsFree())
+        if (!mCommandHandlerObjs[index].IsFree())
         {
-            commandHandler.Shutdown();
+            mCommandHandlerObjs[index].Shutdown();
         }
     }
 
@@ -85,11 +95,11 @@ void InteractionModelEngine::Shutdown()
         }
     }
 
-    for (auto & readHandler : mReadHandlers)
+    for (size_t index = 0; index < mReadHandlers.Capacity(); index++)
     {
-        if (!readHandler.IsFree())
+        if (!mReadHandlers[index].IsFree())
         {
-            readHandler.Shutdown();
+            mReadHandlers[index].Shutdown();
         }
     }
 
@@ -109,13 +119,11 @@ void InteractionModelEngine::Shutdown()
         }
     }
 
-    for (uint32_t index = 0; index < IM_SERVER_MAX_NUM_PATH_GROUPS; index++)
-    {
-        mClusterInfoPool[index].mpNext = nullptr;
-        mClusterInfoPool[index].ClearDirty();
-    }
-
-    mpNextAvailableClusterInfo = nullptr;
+    mCommandHandlerObjs.Shutdown();
+    mReadHandlers.Shutdown();
+    mMaxPaths           = 0;
+    mNumPaths           = 0;
+    mPathsHighWaterMark = 0;
 
     mpExchangeMgr->UnregisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id);
 }
@@ -210,16 +218,23 @@ CHIP_ERROR InteractionModelEngine::OnInvokeCommandRequest(Messaging::ExchangeCon
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    for (auto & commandHandler : mCommandHandlerObjs)
+    CommandHandler * commandHandler = mCommandHandlerObjs.Allocate();
+
+    if (commandHandler != nullptr)
     {
-        if (commandHandler.IsFree())
+        err = commandHandler->Init(mpExchangeMgr, mpDelegate);
+        if (err == CHIP_NO_ERROR)
         {
-            err = commandHandler.Init(mpExchangeMgr, mpDelegate);
-            SuccessOrExit(err);
-            err = commandHandler.OnInvokeCommandRequest(apExchangeContext, aPacketHeader, aPayloadHeader, std::move(aPayload));
+            err = commandHandler->OnInvokeCommandRequest(apExchangeContext, aPacketHeader, aPayloadHeader, std::move(aPayload));
             apExchangeContext = nullptr;
-            break;
         }
+
+        // The handler is done with the request by now. One that stopped part way keeps its slot, as it stays in use.
+        if (commandHandler->IsFree())
+        {
+            mCommandHandlerObjs.Release(commandHandler);
+        }
+        SuccessOrExit(err);
     }
 
 exit:
@@ -239,16 +254,19 @@ CHIP_ERROR InteractionModelEngine::OnReadRequest(Messaging::ExchangeContext * ap
 
     ChipLogDetail(DataManagement, "Receive Read request");
 
-    for (auto & readHandler : mReadHandlers)
+    ReadHandler * readHandler = mReadHandlers.Allocate();
+
+    if (readHandler != nullptr)
     {
-        if (readHandler.IsFree())
+        err = readHandler->Init(mpDelegate);
+        if (err != CHIP_NO_ERROR)
         {
-            err = readHandler.Init(mpDelegate);
-            SuccessOrExit(err);
-            err               = readHandler.OnReadRequest(apExchangeContext, std::move(aPayload));
-            apExchangeContext = nullptr;
-            break;
+            mReadHandlers.Release(readHandler);
+            ExitNow();
         }
+        // The handler returns itself to the pool when it shuts down.
+        err               = readHandler->OnReadRequest(apExchangeContext, std::move(aPayload));
+        apExchangeContext = nullptr;
     }
 
 exit:
@@ -351,6 +369,11 @@ WriteSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVReader & aReader, Wri
     return CHIP_NO_ERROR;
 }
 
+void InteractionModelReportingAttributeChangeCallback(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId)
+{
+    InteractionModelEngine::GetInstance()->GetReportingEngine().SetDirty(aEndpointId, aClusterId, aAttributeId);
+}
+
 uint16_t InteractionModelEngine::GetReadClientArrayIndex(const ReadClient * const apReadClient) const
 {
     return static_cast<uint16_t>(apReadClient - mReadClients);
@@ -361,37 +384,30 @@ uint16_t InteractionModelEngine::GetWriteClientArrayIndex(const WriteClient * co
     return static_cast<uint16_t>(apWriteClient - mWriteClients);
 }
 
-void InteractionModelEngine::ReleaseClusterInfoList(ClusterInfo *& aClusterInfo)
+void InteractionModelEngine::ReleaseClusterInfos(TransactionArena & aArena, size_t & aNumPaths)
 {
-    ClusterInfo * lastClusterInfo = aClusterInfo;
-    if (lastClusterInfo == nullptr)
-    {
-        return;
-    }
-
-    while (lastClusterInfo != nullptr && lastClusterInfo->mpNext != nullptr)
-    {
-        lastClusterInfo->ClearDirty();
-        lastClusterInfo = lastClusterInfo->mpNext;
-    }
-    lastClusterInfo->ClearDirty();
-    lastClusterInfo->mFlags.ClearAll();
-    lastClusterInfo->mpNext    = mpNextAvailableClusterInfo;
-    mpNextAvailableClusterInfo = aClusterInfo;
-    aClusterInfo               = nullptr;
+    VerifyOrDie(aNumPaths <= mNumPaths);
+    mNumPaths -= aNumPaths;
+    aNumPaths = 0;
+    aArena.Reset();
 }
 
-CHIP_ERROR InteractionModelEngine::PushFront(ClusterInfo *& aClusterInfoList, ClusterInfo & aClusterInfo)
+CHIP_ERROR InteractionModelEngine::PushFront(TransactionArena & aArena, size_t & aNumPaths, ClusterInfo *& aClusterInfoList,
+                                             ClusterInfo & aClusterInfo)
 {
-    ClusterInfo * last = aClusterInfoList;
-    if (mpNextAvailableClusterInfo == nullptr)
+    VerifyOrReturnError(mNumPaths < mMaxPaths, CHIP_ERROR_NO_MEMORY);
+
+    ClusterInfo * clusterInfo = aArena.New(aClusterInfo);
+    VerifyOrReturnError(clusterInfo != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    clusterInfo->mpNext = aClusterInfoList;
+    aClusterInfoList    = clusterInfo;
+    aNumPaths++;
+    mNumPaths++;
+    if (mNumPaths > mPathsHighWaterMark)
     {
-        return CHIP_ERROR_NO_MEMORY;
+        mPathsHighWaterMark = mNumPaths;
     }
-    aClusterInfoList           = mpNextAvailableClusterInfo;
-    mpNextAvailableClusterInfo = mpNextAvailableClusterInfo->mpNext;
-    *aClusterInfoList          = aClusterInfo;
-    aClusterInfoList->mpNext   = last;
     return CHIP_NO_ERROR;
 }
 
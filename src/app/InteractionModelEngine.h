@@ -42,6 +42,8 @@
 #include <app/CommandHandler.h>
 #include <app/CommandSender.h>
 #include <app/InteractionModelDelegate.h>
+#include <app/ObjectPool.h>
+#include <app/TransactionArena.h>
 #include <app/ReadClient.h>
 #include <app/ReadHandler.h>
 #include <app/WriteClient.h>
@@ -50,12 +52,19 @@
 #include <app/util/basic-types.h>
 
 // TODO: Make number of command/read/write client/handler configurable
+// The command handler, read handler and path group counts are the defaults of InteractionModelPoolSizes.
+#ifndef CHIP_MAX_NUM_COMMAND_HANDLER
 #define CHIP_MAX_NUM_COMMAND_HANDLER 4
+#endif
 #define CHIP_MAX_NUM_COMMAND_SENDER 4
 #define CHIP_MAX_NUM_READ_CLIENT 4
+#ifndef CHIP_MAX_NUM_READ_HANDLER
 #define CHIP_MAX_NUM_READ_HANDLER 4
+#endif
 #define CHIP_MAX_REPORTS_IN_FLIGHT 4
+#ifndef IM_SERVER_MAX_NUM_PATH_GROUPS
 #define IM_SERVER_MAX_NUM_PATH_GROUPS 8
+#endif
 #define CHIP_MAX_NUM_WRITE_CLIENT 4
 #define CHIP_MAX_NUM_WRITE_HANDLER 4
 
@@ -67,6 +76,16 @@ constexpr size_t kMaxSecureSduLengthBytes = 1024;
 constexpr uint32_t kImMessageTimeoutMsec = 12000;
 constexpr FieldId kRootFieldId           = 0;
 
+/**
+ * The number of requests, and of paths in them, the interaction model engine can serve at the same time.
+ */
+struct InteractionModelPoolSizes
+{
+    size_t mNumCommandHandlers = CHIP_MAX_NUM_COMMAND_HANDLER;
+    size_t mNumReadHandlers    = CHIP_MAX_NUM_READ_HANDLER;
+    size_t mNumPathGroups      = IM_SERVER_MAX_NUM_PATH_GROUPS; ///< Attribute and event paths, over all read handlers.
+};
+
 /**
  * @class InteractionModelEngine
  *
@@ -92,13 +111,16 @@ public:
      *
      *  @param[in]    apExchangeMgr    A pointer to the ExchangeManager object.
      *  @param[in]    apDelegate       InteractionModelDelegate set by application.
+     *  @param[in]    aPoolSizes       The number of command handlers and read handlers to allocate, and of paths to serve.
      *
      *  @retval #CHIP_ERROR_INCORRECT_STATE If the state is not equal to
      *          kState_NotInitialized.
+     *  @retval #CHIP_ERROR_NO_MEMORY If the pools could not be allocated.
      *  @retval #CHIP_NO_ERROR On success.
      *
      */
-    CHIP_ERROR Init(Messaging::ExchangeManager * apExchangeMgr, InteractionModelDelegate * apDelegate);
+    CHIP_ERROR Init(Messaging::ExchangeManager * apExchangeMgr, InteractionModelDelegate * apDelegate,
+                    const InteractionModelPoolSizes & aPoolSizes = InteractionModelPoolSizes());
 
     void Shutdown();
 
@@ -151,8 +173,40 @@ public:
 
     reporting::Engine & GetReportingEngine() { return mReportingEngine; }
 
-    void ReleaseClusterInfoList(ClusterInfo *& aClusterInfo);
-    CHIP_ERROR PushFront(ClusterInfo *& aClusterInfoLisst, ClusterInfo & aClusterInfo);
+    /**
+     *  Copy aClusterInfo into aArena and push the copy at the front of aClusterInfoList, counting it in aNumPaths. The path
+     *  counts against the number of paths the engine was initialized with until ReleaseClusterInfos() is called for aArena.
+     *
+     *  @retval #CHIP_ERROR_NO_MEMORY If read handlers hold as many paths as they may, or the arena is out of memory.
+     *  @retval #CHIP_NO_ERROR On success.
+     */
+    CHIP_ERROR PushFront(TransactionArena & aArena, size_t & aNumPaths, ClusterInfo *& aClusterInfoList,
+                         ClusterInfo & aClusterInfo);
+
+    /**
+     *  Free all aNumPaths paths pushed into aArena at once, make them available to other requests, and reset aNumPaths.
+     */
+    void ReleaseClusterInfos(TransactionArena & aArena, size_t & aNumPaths);
+
+    /**
+     *  Return a read handler that has shut down to the pool. Does nothing for handlers not allocated by the engine.
+     */
+    void ReleaseReadHandler(ReadHandler * apReadHandler) { mReadHandlers.Release(apReadHandler); }
+
+    /**
+     *  The pools requests are served from. Their Allocated() and HighWaterMark() counts show how close a deployment
+     *  comes to the sizes it was initialized with.
+     */
+    const ObjectPool<CommandHandler> & GetCommandHandlerPool() const { return mCommandHandlerObjs; }
+    const ObjectPool<ReadHandler> & GetReadHandlerPool() const { return mReadHandlers; }
+
+    /**
+     *  The number of paths read handlers may hold over all of them, the number they hold, and the most they held at the
+     *  same time.
+     */
+    size_t GetMaxPaths() const { return mMaxPaths; }
+    size_t GetNumPaths() const { return mNumPaths; }
+    size_t GetPathsHighWaterMark() const { return mPathsHighWaterMark; }
 
 private:
     friend class reporting::Engine;
@@ -191,15 +245,17 @@ private:
 
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
     InteractionModelDelegate * mpDelegate      = nullptr;
-    CommandHandler mCommandHandlerObjs[CHIP_MAX_NUM_COMMAND_HANDLER];
+    ObjectPool<CommandHandler> mCommandHandlerObjs;
     CommandSender mCommandSenderObjs[CHIP_MAX_NUM_COMMAND_SENDER];
     ReadClient mReadClients[CHIP_MAX_NUM_READ_CLIENT];
-    ReadHandler mReadHandlers[CHIP_MAX_NUM_READ_HANDLER];
+    ObjectPool<ReadHandler> mReadHandlers;
     WriteClient mWriteClients[CHIP_MAX_NUM_WRITE_CLIENT];
     WriteHandler mWriteHandlers[CHIP_MAX_NUM_WRITE_HANDLER];
     reporting::Engine mReportingEngine;
-    ClusterInfo mClusterInfoPool[IM_SERVER_MAX_NUM_PATH_GROUPS];
-    ClusterInfo * mpNextAvailableClusterInfo = nullptr;
+    // Read handlers allocate their paths from their own arenas; the engine only counts them.
+    size_t mMaxPaths           = 0;
+    size_t mNumPaths           = 0;
+    size_t mPathsHighWaterMark = 0;
 };
 
 void DispatchSingleClusterCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId, chip::EndpointId aEndPointId,
@@ -207,6 +263,13 @@ void DispatchSingleClusterCommand(chip::ClusterId aClusterId, chip::CommandId aC
 void DispatchSingleClusterResponseCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId, chip::EndpointId aEndPointId,
                                           chip::TLV::TLVReader & aReader, CommandSender * apCommandObj);
 
+/**
+ *  Check whether DispatchSingleClusterCommand handles the given command of the server side of the given cluster, in constant
+ *  time. The implementation is generated along with DispatchSingleClusterCommand. CommandHandler reports other commands of
+ *  an existing cluster as UnsupportedCommand without dispatching them.
+ */
+bool ServerClusterAcceptsCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId);
+
 /**
  *  Check whether the given cluster exists on the given endpoint and supports the given command.
  *  TODO: The implementation lives in ember-compatibility-functions.cpp, this should be replaced by IM command catalog look up
@@ -238,6 +301,29 @@ bool ServerClusterCommandExists(chip::ClusterId aClusterId, chip::CommandId aCom
  *  @retval  CHIP_NO_ERROR on success
  */
 CHIP_ERROR ReadSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVWriter * apWriter, bool * apDataExists);
+
+/**
+ *  Write every attribute of the cluster that aClusterInfo covers with a wildcard field ID to aAttributeDataList, as one attribute
+ * data element per attribute carrying its value or the interaction model error code of reading it. The cluster is resolved once
+ * and its attributes are read in one pass. If the cluster does not exist, a single element with its error code is written.
+ *  The walk starts at the attribute at index aClusterInfo.mResumeAttributeIndex. If an element does not fit, it is rolled back,
+ * mResumeAttributeIndex is set to that attribute so that the next call picks up there, and the writer error is returned.
+ * Otherwise mResumeAttributeIndex is reset to 0.
+ *  This function is implemented by CHIP as a part of cluster data storage & management.
+ *
+ *  @param[in]    aClusterInfo        The wildcard cluster path.
+ *  @param[in]    aAttributeDataList  The list to append the attribute data elements to.
+ *  @param[out]   aNumElements        The number of elements appended, including on error.
+ *
+ *  @retval  CHIP_NO_ERROR on success
+ */
+CHIP_ERROR ReadClusterData(ClusterInfo & aClusterInfo, AttributeDataList::Builder & aAttributeDataList, size_t & aNumElements);
 CHIP_ERROR WriteSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVReader & aReader, WriteHandler * apWriteHandler);
+
+/**
+ *  Notify the interaction model that the value of the given attribute has changed, so that it gets reported to the readers
+ * interested in it. Must be called on the CHIP thread.
+ */
+void InteractionModelReportingAttributeChangeCallback(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId);
 } // namespace app
 } // namespace chip
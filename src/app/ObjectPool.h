@@ -0,0 +1,191 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the pool the Interaction Model engine hands out
+ *      its command and read handlers from.
+ */
+
+#pragma once
+
+#include <new>
+#include <stddef.h>
+
+#include <core/CHIPError.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * @class ObjectPool
+ *
+ * @brief
+ *  A pool of objects of type @p T whose number is chosen at runtime.
+ *
+ *  The objects are constructed once, when the pool is initialized, and are reused afterwards: Allocate() hands out a free
+ *  object and Release() takes it back, both in constant time through a stack of free object indices. The pool counts the
+ *  objects in use and the most that were in use at the same time, so that deployments can size it.
+ *
+ *  The objects live in Platform memory, which may be shut down before static objects are destroyed, so the pool does not
+ *  free them on destruction: Shutdown() must be called for that.
+ */
+template <typename T>
+class ObjectPool
+{
+public:
+    ObjectPool() = default;
+
+    ObjectPool(const ObjectPool &) = delete;
+    ObjectPool & operator=(const ObjectPool &) = delete;
+
+    /**
+     * Allocate and construct @p aCapacity objects, all of them free. If the pool already holds that many objects, they are
+     * kept as they are.
+     *
+     * @retval CHIP_ERROR_INVALID_ARGUMENT @p aCapacity is 0.
+     * @retval CHIP_ERROR_INCORRECT_STATE  The pool holds a different number of objects, some of which are in use.
+     * @retval CHIP_ERROR_NO_MEMORY        The objects could not be allocated.
+     */
+    CHIP_ERROR Init(size_t aCapacity)
+    {
+        VerifyOrReturnError(aCapacity > 0, CHIP_ERROR_INVALID_ARGUMENT);
+        if (aCapacity == mCapacity)
+        {
+            return CHIP_NO_ERROR;
+        }
+        VerifyOrReturnError(mAllocated == 0, CHIP_ERROR_INCORRECT_STATE);
+        Shutdown();
+
+        mObjects   = static_cast<T *>(Platform::MemoryCalloc(aCapacity, sizeof(T)));
+        mFreeStack = static_cast<size_t *>(Platform::MemoryCalloc(aCapacity, sizeof(size_t)));
+        mInUse     = static_cast<bool *>(Platform::MemoryCalloc(aCapacity, sizeof(bool)));
+        if (mObjects == nullptr || mFreeStack == nullptr || mInUse == nullptr)
+        {
+            Platform::MemoryFree(mObjects);
+            Platform::MemoryFree(mFreeStack);
+            Platform::MemoryFree(mInUse);
+            mObjects   = nullptr;
+            mFreeStack = nullptr;
+            mInUse     = nullptr;
+            return CHIP_ERROR_NO_MEMORY;
+        }
+
+        for (size_t i = 0; i < aCapacity; i++)
+        {
+            new (&mObjects[i]) T();
+        }
+        mCapacity      = aCapacity;
+        mHighWaterMark = 0;
+        ReleaseAll();
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * Destroy all objects and free their memory.
+     */
+    void Shutdown()
+    {
+        for (size_t i = 0; i < mCapacity; i++)
+        {
+            mObjects[i].~T();
+        }
+        Platform::MemoryFree(mObjects);
+        Platform::MemoryFree(mFreeStack);
+        Platform::MemoryFree(mInUse);
+        mObjects       = nullptr;
+        mFreeStack     = nullptr;
+        mInUse         = nullptr;
+        mCapacity      = 0;
+        mNumFree       = 0;
+        mAllocated     = 0;
+        mHighWaterMark = 0;
+    }
+
+    /**
+     * Returns a free object, or nullptr if all objects are in use. Objects are handed out lowest index first while none
+     * has been released.
+     */
+    T * Allocate()
+    {
+        VerifyOrReturnError(mNumFree > 0, nullptr);
+
+        const size_t index = mFreeStack[--mNumFree];
+        mInUse[index]      = true;
+        mAllocated++;
+        if (mAllocated > mHighWaterMark)
+        {
+            mHighWaterMark = mAllocated;
+        }
+        return &mObjects[index];
+    }
+
+    /**
+     * Return @p aObject to the pool. Does nothing if it is free already or was not allocated from this pool.
+     */
+    void Release(T * aObject)
+    {
+        VerifyOrReturn(Contains(aObject));
+
+        const size_t index = static_cast<size_t>(aObject - mObjects);
+        VerifyOrReturn(mInUse[index]);
+
+        mInUse[index]          = false;
+        mFreeStack[mNumFree++] = index;
+        mAllocated--;
+    }
+
+    /**
+     * Mark all objects as free, without changing them.
+     */
+    void ReleaseAll()
+    {
+        for (size_t i = 0; i < mCapacity; i++)
+        {
+            mInUse[i]     = false;
+            mFreeStack[i] = mCapacity - 1 - i;
+        }
+        mNumFree   = mCapacity;
+        mAllocated = 0;
+    }
+
+    bool Contains(const T * aObject) const { return mCapacity > 0 && aObject >= mObjects && aObject < mObjects + mCapacity; }
+
+    /**
+     * Returns the object at @p aIndex, whether or not it is in use.
+     */
+    T & operator[](size_t aIndex) { return mObjects[aIndex]; }
+
+    size_t Capacity() const { return mCapacity; }
+    size_t Allocated() const { return mAllocated; }
+    size_t HighWaterMark() const { return mHighWaterMark; }
+
+private:
+    T * mObjects          = nullptr;
+    size_t * mFreeStack   = nullptr; ///< Indices of the free objects; the next one to hand out is on top.
+    bool * mInUse         = nullptr;
+    size_t mCapacity      = 0;
+    size_t mNumFree       = 0;
+    size_t mAllocated     = 0;
+    size_t mHighWaterMark = 0;
+};
+
+} // namespace app
+} // namespace chip
@@ -24,6 +24,7 @@
 
 #include <app/AppBuildConfig.h>
 #include <app/InteractionModelEngine.h>
+#include <app/MessageDef/StatusElement.h>
 #include <app/ReadClient.h>
 
 namespace chip {
@@ -37,10 +38,11 @@ CHIP_ERROR ReadClient::Init(Messaging::ExchangeManager * apExchangeMgr, Interact
     VerifyOrExit(apExchangeMgr != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     VerifyOrExit(mpExchangeMgr == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
-    mpExchangeMgr  = apExchangeMgr;
-    mpDelegate     = apDelegate;
-    mState         = ClientState::Initialized;
-    mAppIdentifier = aAppIdentifier;
+    mpExchangeMgr        = apExchangeMgr;
+    mpDelegate           = apDelegate;
+    mState               = ClientState::Initialized;
+    mAppIdentifier       = aAppIdentifier;
+    mMoreChunkedMessages = false;
 
     AbortExistingExchangeContext();
 
@@ -232,6 +234,16 @@ CHIP_ERROR ReadClient::OnMessageReceived(Messaging::ExchangeContext * apExchange
                  err = CHIP_ERROR_INVALID_MESSAGE_TYPE);
     err = ProcessReportData(std::move(aPayload));
 
+    if (err == CHIP_NO_ERROR && mMoreChunkedMessages)
+    {
+        // Ask for the rest of the report, which follows on this exchange.
+        err = SendStatusResponse();
+        if (err == CHIP_NO_ERROR)
+        {
+            return err;
+        }
+    }
+
 exit:
     ChipLogFunctError(err);
 
@@ -249,12 +261,32 @@ exit:
         }
     }
 
-    // TODO(#7521): Should close it after checking moreChunkedMessages flag is not set.
     ShutdownInternal();
 
     return err;
 }
 
+CHIP_ERROR ReadClient::SendStatusResponse()
+{
+    System::PacketBufferTLVWriter writer;
+    StatusElement::Builder statusElement;
+    System::PacketBufferHandle msgBuf = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
+    VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    writer.Init(std::move(msgBuf));
+    ReturnErrorOnFailure(statusElement.Init(&writer));
+    statusElement
+        .EncodeStatusElement(Protocols::SecureChannel::GeneralStatusCode::kSuccess,
+                             Protocols::InteractionModel::Id.ToFullyQualifiedSpecForm(),
+                             to_underlying(Protocols::InteractionModel::ProtocolCode::Success))
+        .EndOfStatusElement();
+    ReturnErrorOnFailure(statusElement.GetError());
+    ReturnErrorOnFailure(writer.Finalize(&msgBuf));
+
+    return mpExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::StatusResponse, std::move(msgBuf),
+                                      Messaging::SendFlags(Messaging::SendMessageFlags::kExpectResponse));
+}
+
 CHIP_ERROR ReadClient::AbortExistingExchangeContext()
 {
     if (mpExchangeCtx != nullptr)
@@ -303,6 +335,7 @@ CHIP_ERROR ReadClient::ProcessReportData(System::PacketBufferHandle && aPayload)
         err = CHIP_NO_ERROR;
     }
     SuccessOrExit(err);
+    mMoreChunkedMessages = moreChunkedMessages;
 
     err                = report.GetEventDataList(&eventList);
     isEventListPresent = (err == CHIP_NO_ERROR);
@@ -327,7 +360,7 @@ CHIP_ERROR ReadClient::ProcessReportData(System::PacketBufferHandle && aPayload)
         err = CHIP_NO_ERROR;
     }
     SuccessOrExit(err);
-    if (isAttributeDataListPresent && nullptr != mpDelegate && !moreChunkedMessages)
+    if (isAttributeDataListPresent && nullptr != mpDelegate)
     {
         chip::TLV::TLVReader attributeDataListReader;
         attributeDataList.GetReader(&attributeDataListReader);
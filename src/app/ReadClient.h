@@ -57,7 +57,8 @@ public:
      *
      *  SDK consumer can choose when to shut down the ReadClient.
      *  The ReadClient will automatically shut itself down when it receives a
-     *  response or the response times out.  So manual shutdown is only needed
+     *  response (the last chunk, if the report is sent in several messages)
+     *  or the response times out.  So manual shutdown is only needed
      *  to shut down a ReadClient before one of those two things has happened,
      *  (e.g. if SendReadRequest returned failure).
      */
@@ -127,6 +128,7 @@ private:
 
     void MoveToState(const ClientState aTargetState);
     CHIP_ERROR ProcessReportData(System::PacketBufferHandle && aPayload);
+    CHIP_ERROR SendStatusResponse();
     CHIP_ERROR AbortExistingExchangeContext();
     const char * GetStateStr() const;
 
@@ -141,6 +143,9 @@ private:
     InteractionModelDelegate * mpDelegate      = nullptr;
     ClientState mState                         = ClientState::Uninitialized;
     intptr_t mAppIdentifier                    = 0;
+
+    // Whether the last report received said more of it follows
+    bool mMoreChunkedMessages = false;
 };
 
 }; // namespace app
@@ -25,6 +25,7 @@
 #include <app/AppBuildConfig.h>
 #include <app/InteractionModelEngine.h>
 #include <app/MessageDef/EventPath.h>
+#include <app/MessageDef/StatusElement.h>
 #include <app/ReadHandler.h>
 #include <app/reporting/Engine.h>
 
@@ -35,12 +36,13 @@ CHIP_ERROR ReadHandler::Init(InteractionModelDelegate * apDelegate)
     CHIP_ERROR err = CHIP_NO_ERROR;
     // Error if already initialized.
     VerifyOrExit(mpExchangeCtx == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
-    mpExchangeCtx              = nullptr;
-    mpDelegate                 = apDelegate;
-    mSuppressResponse          = true;
-    mpAttributeClusterInfoList = nullptr;
-    mpEventClusterInfoList     = nullptr;
-    mCurrentPriority           = PriorityLevel::Invalid;
+    mpExchangeCtx                   = nullptr;
+    mpDelegate                      = apDelegate;
+    mSuppressResponse               = true;
+    mpAttributeClusterInfoList      = nullptr;
+    mpEventClusterInfoList          = nullptr;
+    mpDirtyAttributeClusterInfoList = nullptr;
+    mCurrentPriority                = PriorityLevel::Invalid;
     MoveToState(HandlerState::Initialized);
 
 exit:
@@ -50,14 +52,21 @@ exit:
 
 void ReadHandler::Shutdown()
 {
-    InteractionModelEngine::GetInstance()->ReleaseClusterInfoList(mpAttributeClusterInfoList);
-    InteractionModelEngine::GetInstance()->ReleaseClusterInfoList(mpEventClusterInfoList);
+    if (mState == HandlerState::AwaitingReportResponse)
+    {
+        // The chunk sent last will not be confirmed anymore.
+        InteractionModelEngine::GetInstance()->GetReportingEngine().OnReportConfirm();
+    }
+    InteractionModelEngine::GetInstance()->GetReportingEngine().RemoveInterest(*this);
+    InteractionModelEngine::GetInstance()->ReleaseClusterInfos(mArena, mNumPaths);
     AbortExistingExchangeContext();
     MoveToState(HandlerState::Uninitialized);
-    mpDelegate                 = nullptr;
-    mpAttributeClusterInfoList = nullptr;
-    mpEventClusterInfoList     = nullptr;
-    mCurrentPriority           = PriorityLevel::Invalid;
+    mpDelegate                      = nullptr;
+    mpAttributeClusterInfoList      = nullptr;
+    mpEventClusterInfoList          = nullptr;
+    mpDirtyAttributeClusterInfoList = nullptr;
+    mCurrentPriority                = PriorityLevel::Invalid;
+    InteractionModelEngine::GetInstance()->ReleaseReadHandler(this);
 }
 
 CHIP_ERROR ReadHandler::AbortExistingExchangeContext()
@@ -90,18 +99,93 @@ CHIP_ERROR ReadHandler::OnReadRequest(Messaging::ExchangeContext * apExchangeCon
     return err;
 }
 
-CHIP_ERROR ReadHandler::SendReportData(System::PacketBufferHandle && aPayload)
+CHIP_ERROR ReadHandler::SendReportData(System::PacketBufferHandle && aPayload, bool aMoreChunkedMessages)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     VerifyOrExit(mpExchangeCtx != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
+    if (aMoreChunkedMessages)
+    {
+        // Keep the exchange open until the initiator asks for the next chunk, which may happen before SendMessage() returns.
+        MoveToState(HandlerState::AwaitingReportResponse);
+        mpExchangeCtx->SetDelegate(this);
+        mpExchangeCtx->SetResponseTimeout(kImMessageTimeoutMsec);
+        err = mpExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::ReportData, std::move(aPayload),
+                                         Messaging::SendFlags(Messaging::SendMessageFlags::kExpectResponse));
+        if (err == CHIP_NO_ERROR)
+        {
+            return err;
+        }
+
+        // The reporting engine takes a report that could not be sent out of flight itself.
+        MoveToState(HandlerState::Reportable);
+        ExitNow();
+    }
+
     err = mpExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::ReportData, std::move(aPayload));
+
 exit:
     ChipLogFunctError(err);
     Shutdown();
     return err;
 }
 
+CHIP_ERROR ReadHandler::OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
+                                          const PayloadHeader & aPayloadHeader, System::PacketBufferHandle && aPayload)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    VerifyOrExit(apExchangeContext == mpExchangeCtx && mState == HandlerState::AwaitingReportResponse,
+                 err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::StatusResponse),
+                 err = CHIP_ERROR_INVALID_MESSAGE_TYPE);
+    err = ProcessStatusResponse(std::move(aPayload));
+    SuccessOrExit(err);
+
+    // The next chunk goes out on this exchange, on the next run of the reporting engine.
+    InteractionModelEngine::GetInstance()->GetReportingEngine().OnReportConfirm();
+    MoveToState(HandlerState::Reportable);
+    mpExchangeCtx->WillSendMessage();
+    err = InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
+
+exit:
+    ChipLogFunctError(err);
+    if (err != CHIP_NO_ERROR)
+    {
+        Shutdown();
+    }
+    return err;
+}
+
+void ReadHandler::OnResponseTimeout(Messaging::ExchangeContext * apExchangeContext)
+{
+    ChipLogProgress(DataManagement, "Time out! failed to receive status response from Exchange: %d",
+                    apExchangeContext->GetExchangeId());
+    Shutdown();
+}
+
+CHIP_ERROR ReadHandler::ProcessStatusResponse(System::PacketBufferHandle && aPayload)
+{
+    System::PacketBufferTLVReader reader;
+    StatusElement::Parser statusElement;
+    Protocols::SecureChannel::GeneralStatusCode generalCode = Protocols::SecureChannel::GeneralStatusCode::kFailure;
+    uint32_t protocolId                                     = 0;
+    uint16_t protocolCode                                   = 0;
+
+    reader.Init(std::move(aPayload));
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(statusElement.Init(reader));
+#if CHIP_CONFIG_IM_ENABLE_SCHEMA_CHECK
+    ReturnErrorOnFailure(statusElement.CheckSchemaValidity());
+#endif
+    ReturnErrorOnFailure(statusElement.DecodeStatusElement(&generalCode, &protocolId, &protocolCode));
+
+    VerifyOrReturnError(generalCode == Protocols::SecureChannel::GeneralStatusCode::kSuccess &&
+                            protocolCode == to_underlying(Protocols::InteractionModel::ProtocolCode::Success),
+                        CHIP_ERROR_STATUS_REPORT_RECEIVED);
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR ReadHandler::ProcessReadRequest(System::PacketBufferHandle && aPayload)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -215,9 +299,10 @@ CHIP_ERROR ReadHandler::ProcessAttributePathList(AttributePathList::Parser & aAt
         }
         SuccessOrExit(err);
 
-        err = InteractionModelEngine::GetInstance()->PushFront(mpAttributeClusterInfoList, clusterInfo);
+        err = InteractionModelEngine::GetInstance()->PushFront(mArena, mNumPaths, mpAttributeClusterInfoList, clusterInfo);
         SuccessOrExit(err);
-        mpAttributeClusterInfoList->SetDirty();
+        InteractionModelEngine::GetInstance()->GetReportingEngine().AddInterest(*this, *mpAttributeClusterInfoList);
+        SetDirty(*mpAttributeClusterInfoList);
     }
     // if we have exhausted this container
     if (CHIP_END_OF_TLV == err)
@@ -260,7 +345,7 @@ CHIP_ERROR ReadHandler::ProcessEventPathList(EventPathList::Parser & aEventPathL
             err = CHIP_NO_ERROR;
         }
         SuccessOrExit(err);
-        err = InteractionModelEngine::GetInstance()->PushFront(mpEventClusterInfoList, clusterInfo);
+        err = InteractionModelEngine::GetInstance()->PushFront(mArena, mNumPaths, mpEventClusterInfoList, clusterInfo);
         SuccessOrExit(err);
     }
 
@@ -288,6 +373,9 @@ const char * ReadHandler::GetStateStr() const
 
     case HandlerState::Reportable:
         return "Reportable";
+
+    case HandlerState::AwaitingReportResponse:
+        return "AwaitingReportResponse";
     }
 #endif // CHIP_DETAIL_LOGGING
     return "N/A";
@@ -327,6 +415,29 @@ bool ReadHandler::CheckEventClean(EventManagement & aEventManager)
     }
 }
 
+void ReadHandler::SetDirty(ClusterInfo & aClusterInfo)
+{
+    if (aClusterInfo.IsDirty())
+    {
+        return;
+    }
+
+    aClusterInfo.SetDirty();
+    aClusterInfo.mpNextDirty        = mpDirtyAttributeClusterInfoList;
+    mpDirtyAttributeClusterInfoList = &aClusterInfo;
+}
+
+ClusterInfo * ReadHandler::PopDirtyAttributeClusterInfo()
+{
+    ClusterInfo * clusterInfo = mpDirtyAttributeClusterInfoList;
+    if (clusterInfo != nullptr)
+    {
+        mpDirtyAttributeClusterInfoList = clusterInfo->mpNextDirty;
+        clusterInfo->mpNextDirty        = nullptr;
+    }
+    return clusterInfo;
+}
+
 void ReadHandler::MoveToNextScheduledDirtyPriority()
 {
     for (uint8_t i = 0; i < ArraySize(mSelfProcessedEvents); i++)
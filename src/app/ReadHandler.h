@@ -27,6 +27,7 @@
 #include <app/ClusterInfo.h>
 #include <app/EventManagement.h>
 #include <app/InteractionModelDelegate.h>
+#include <app/TransactionArena.h>
 #include <core/CHIPCore.h>
 #include <core/CHIPTLVDebug.hpp>
 #include <messaging/ExchangeContext.h>
@@ -47,7 +48,7 @@ namespace app {
  *         for the relevant data, and sending a reply.
  *
  */
-class ReadHandler
+class ReadHandler : public Messaging::ExchangeDelegate
 {
 public:
     /**
@@ -86,15 +87,25 @@ public:
     CHIP_ERROR OnReadRequest(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle && aPayload);
 
     /**
-     *  Send ReportData to initiator
+     *  Send ReportData to initiator. The handler shuts itself down afterwards, unless more chunks of the report follow; then it
+     *  waits for the initiator to ask for the next chunk with a status response.
      *
      *  @param[in]    aPayload             A payload that has read request data
+     *  @param[in]    aMoreChunkedMessages Whether the report continues in another message
      *
      *  @retval #Others If fails to send report data
      *  @retval #CHIP_NO_ERROR On success.
      *
      */
-    CHIP_ERROR SendReportData(System::PacketBufferHandle && aPayload);
+    CHIP_ERROR SendReportData(System::PacketBufferHandle && aPayload, bool aMoreChunkedMessages = false);
+
+    /**
+     *  Process the status response with which the initiator asks for the next chunk of a report, and let the reporting engine
+     *  send that chunk.
+     */
+    CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
+                                 const PayloadHeader & aPayloadHeader, System::PacketBufferHandle && aPayload) override;
+    void OnResponseTimeout(Messaging::ExchangeContext * apExchangeContext) override;
 
     bool IsFree() const { return mState == HandlerState::Uninitialized; }
     bool IsReportable() const { return mState == HandlerState::Reportable; }
@@ -102,7 +113,9 @@ public:
     virtual ~ReadHandler() = default;
 
     ClusterInfo * GetAttributeClusterInfolist() { return mpAttributeClusterInfoList; }
+    ClusterInfo * GetDirtyAttributeClusterInfolist() { return mpDirtyAttributeClusterInfoList; }
     ClusterInfo * GetEventClusterInfolist() { return mpEventClusterInfoList; }
+    size_t GetNumPaths() const { return mNumPaths; }
     EventNumber * GetVendedEventNumberList() { return mSelfProcessedEvents; }
     PriorityLevel GetCurrentPriority() { return mCurrentPriority; }
 
@@ -114,15 +127,28 @@ public:
     // Move to the next dirty priority where last schedule event number is larger than current self vended event number
     void MoveToNextScheduledDirtyPriority();
 
+    /**
+     *  Queue one of this handler's attribute paths for the next report. Does nothing if it is already queued.
+     */
+    void SetDirty(ClusterInfo & aClusterInfo);
+
+    /**
+     *  Remove the first queued attribute path from the queue and return it, or return nullptr if none is queued. The path
+     *  stays marked dirty until its data is retrieved.
+     */
+    ClusterInfo * PopDirtyAttributeClusterInfo();
+
 private:
     enum class HandlerState
     {
-        Uninitialized = 0, ///< The handler has not been initialized
-        Initialized,       ///< The handler has been initialized and is ready
-        Reportable,        ///< The handler has received read request and is waiting for the data to send to be available
+        Uninitialized = 0,      ///< The handler has not been initialized
+        Initialized,            ///< The handler has been initialized and is ready
+        Reportable,             ///< The handler has received read request and is waiting for the data to send to be available
+        AwaitingReportResponse, ///< The handler has sent a chunk of a report and is waiting for the initiator to ask for more
     };
 
     CHIP_ERROR ProcessReadRequest(System::PacketBufferHandle && aPayload);
+    CHIP_ERROR ProcessStatusResponse(System::PacketBufferHandle && aPayload);
     CHIP_ERROR ProcessAttributePathList(AttributePathList::Parser & aAttributePathListParser);
     CHIP_ERROR ProcessEventPathList(EventPathList::Parser & aEventPathListParser);
     void MoveToState(const HandlerState aTargetState);
@@ -141,6 +167,14 @@ private:
     ClusterInfo * mpAttributeClusterInfoList = nullptr;
     ClusterInfo * mpEventClusterInfoList     = nullptr;
 
+    // The attribute paths to report, linked through ClusterInfo::mpNextDirty
+    ClusterInfo * mpDirtyAttributeClusterInfoList = nullptr;
+
+    // Holds the attribute and event paths of the request being served, which are all freed at once when it completes.
+    TransactionArena mArena;
+    // The number of paths in mArena, which count against the paths the engine may serve.
+    size_t mNumPaths = 0;
+
     PriorityLevel mCurrentPriority = PriorityLevel::Invalid;
 
     // The event number of the last processed event for each priority level
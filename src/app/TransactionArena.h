@@ -0,0 +1,170 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the arena that holds the state an Interaction Model
+ *      handler builds up while it serves one interaction.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <stdint.h>
+#include <type_traits>
+
+#include <core/CHIPConfig.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * @class TransactionArena
+ *
+ * @brief
+ *  A bump allocator for the state of one interaction, whose allocations are all freed together when the interaction ends.
+ *
+ *  Memory comes in blocks of at least the block size from Platform memory. Allocate() hands out the next bytes of the
+ *  current block, and Reset() frees everything at once by going back to the start of the first block, in constant time.
+ *  Blocks are kept for the next interaction until Release() is called, so an arena that is reused for interactions of
+ *  similar size stops allocating from Platform memory after the first one, and never fragments it.
+ *
+ *  Reset() does not run destructors, so New() only accepts trivially destructible types.
+ */
+class TransactionArena
+{
+public:
+    static constexpr size_t kDefaultBlockSize = CHIP_CONFIG_IM_TRANSACTION_ARENA_BLOCK_SIZE;
+
+    explicit TransactionArena(size_t aBlockSize = kDefaultBlockSize) : mBlockSize(aBlockSize) {}
+    ~TransactionArena() { Release(); }
+
+    TransactionArena(const TransactionArena &) = delete;
+    TransactionArena & operator=(const TransactionArena &) = delete;
+
+    /**
+     * Returns @p aSize bytes aligned to @p aAlignment, which must be a power of two no larger than the alignment of
+     * std::max_align_t, or nullptr if no memory is available.
+     */
+    void * Allocate(size_t aSize, size_t aAlignment = alignof(std::max_align_t))
+    {
+        VerifyOrReturnError(aAlignment > 0 && (aAlignment & (aAlignment - 1)) == 0 && aAlignment <= alignof(std::max_align_t),
+                            nullptr);
+
+        size_t offset = (mUsed + aAlignment - 1) & ~(aAlignment - 1);
+        if (mpCurrent == nullptr || offset > mpCurrent->mSize || aSize > mpCurrent->mSize - offset)
+        {
+            VerifyOrReturnError(NextBlock(aSize), nullptr);
+            offset = 0;
+        }
+
+        mUsed = offset + aSize;
+        mAllocations++;
+        mBytesAllocated += aSize;
+        if (mBytesAllocated > mHighWaterMark)
+        {
+            mHighWaterMark = mBytesAllocated;
+        }
+        return mpCurrent->Data() + offset;
+    }
+
+    /**
+     * Returns a copy of @p aValue in the arena, or nullptr if no memory is available.
+     */
+    template <typename T>
+    T * New(const T & aValue)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "Reset() does not destroy the objects in the arena");
+        void * object = Allocate(sizeof(T), alignof(T));
+        return (object == nullptr) ? nullptr : new (object) T(aValue);
+    }
+
+    /**
+     * Free everything allocated from the arena. Its blocks are kept for the allocations that follow.
+     */
+    void Reset()
+    {
+        mpCurrent       = mpFirst;
+        mUsed           = 0;
+        mAllocations    = 0;
+        mBytesAllocated = 0;
+    }
+
+    /**
+     * Free everything allocated from the arena, and give its blocks back to Platform memory.
+     */
+    void Release()
+    {
+        while (mpFirst != nullptr)
+        {
+            Block * next = mpFirst->mpNext;
+            Platform::MemoryFree(mpFirst);
+            mpFirst = next;
+        }
+        Reset();
+    }
+
+    size_t Allocations() const { return mAllocations; }
+    size_t BytesAllocated() const { return mBytesAllocated; }
+    size_t HighWaterMark() const { return mHighWaterMark; }
+
+private:
+    struct alignas(std::max_align_t) Block
+    {
+        Block * mpNext;
+        size_t mSize;
+
+        uint8_t * Data() { return reinterpret_cast<uint8_t *>(this + 1); }
+    };
+
+    bool NextBlock(size_t aSize)
+    {
+        Block * next = (mpCurrent == nullptr) ? mpFirst : mpCurrent->mpNext;
+        if (next == nullptr || next->mSize < aSize)
+        {
+            const size_t size = (aSize > mBlockSize) ? aSize : mBlockSize;
+            VerifyOrReturnError(size <= SIZE_MAX - sizeof(Block), false);
+
+            Block * block = static_cast<Block *>(Platform::MemoryAlloc(sizeof(Block) + size));
+            VerifyOrReturnError(block != nullptr, false);
+
+            // A kept block that is too small stays after the new one, for smaller allocations.
+            block->mpNext = next;
+            block->mSize  = size;
+            (mpCurrent == nullptr ? mpFirst : mpCurrent->mpNext) = block;
+            next                                                 = block;
+        }
+
+        mpCurrent = next;
+        mUsed     = 0;
+        return true;
+    }
+
+    const size_t mBlockSize;
+    Block * mpFirst        = nullptr;
+    Block * mpCurrent      = nullptr; ///< The block allocations come from, or nullptr before the first one.
+    size_t mUsed           = 0;       ///< Bytes of the current block handed out.
+    size_t mAllocations    = 0;
+    size_t mBytesAllocated = 0;
+    size_t mHighWaterMark  = 0;
+};
+
+} // namespace app
+} // namespace chip
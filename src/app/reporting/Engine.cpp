@@ -26,6 +26,7 @@
 #include <app/AppBuildConfig.h>
 #include <app/InteractionModelEngine.h>
 #include <app/reporting/Engine.h>
+#include <support/HashUtils.h>
 
 namespace chip {
 namespace app {
@@ -35,9 +36,106 @@ CHIP_ERROR Engine::Init()
     mMoreChunkedMessages = false;
     mNumReportsInFlight  = 0;
     mCurReadHandlerIdx   = 0;
+    mNumDirtyPaths       = 0;
+    mDirtyVersion        = 0;
+    mReportStatistics    = ReportStatistics();
+    for (ClusterInfo *& bucket : mInterestBuckets)
+    {
+        bucket = nullptr;
+    }
     return CHIP_NO_ERROR;
 }
 
+size_t Engine::InterestBucket(EndpointId aEndpointId, ClusterId aClusterId)
+{
+    uint64_t key = (static_cast<uint64_t>(aClusterId) << 16) | aEndpointId;
+
+    // Mix the key, so that every key bit affects the low bits used to pick a bucket.
+    return static_cast<size_t>(MixBits64(key)) & kInterestBucketMask;
+}
+
+void Engine::AddInterest(ReadHandler & aReadHandler, ClusterInfo & aClusterInfo)
+{
+    ClusterInfo *& bucket = mInterestBuckets[InterestBucket(aClusterInfo.mEndpointId, aClusterInfo.mClusterId)];
+
+    aClusterInfo.mpReadHandler    = &aReadHandler;
+    aClusterInfo.mpNextInterested = bucket;
+    bucket                        = &aClusterInfo;
+}
+
+void Engine::RemoveInterest(ReadHandler & aReadHandler)
+{
+    ClusterInfo * clusterInfo = aReadHandler.GetAttributeClusterInfolist();
+    while (clusterInfo != nullptr)
+    {
+        ClusterInfo ** link = &mInterestBuckets[InterestBucket(clusterInfo->mEndpointId, clusterInfo->mClusterId)];
+        while (*link != nullptr && *link != clusterInfo)
+        {
+            link = &(*link)->mpNextInterested;
+        }
+        if (*link != nullptr)
+        {
+            *link = clusterInfo->mpNextInterested;
+        }
+        clusterInfo->mpNextInterested = nullptr;
+        clusterInfo->mpReadHandler    = nullptr;
+        clusterInfo                   = clusterInfo->mpNext;
+    }
+}
+
+void Engine::SetDirty(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId)
+{
+    mDirtyVersion++;
+
+    for (size_t i = 0; i < mNumDirtyPaths; i++)
+    {
+        const DirtyPath & path = mDirtyPaths[i];
+        if (path.mEndpointId == aEndpointId && path.mClusterId == aClusterId && path.mAttributeId == aAttributeId)
+        {
+            return;
+        }
+    }
+
+    if (mNumDirtyPaths == ArraySize(mDirtyPaths))
+    {
+        ProcessDirtyPaths();
+    }
+
+    mDirtyPaths[mNumDirtyPaths++] = { aEndpointId, aClusterId, aAttributeId };
+
+    if (mNumDirtyPaths == 1)
+    {
+        // A run is already pending if there were recorded changes; it picks this one up too.
+        CHIP_ERROR err = ScheduleRun();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogDetail(DataManagement, "<RE> Unable to schedule run for changed attribute: %" CHIP_ERROR_FORMAT,
+                          ChipError::FormatError(err));
+        }
+    }
+}
+
+void Engine::ProcessDirtyPaths()
+{
+    for (size_t i = 0; i < mNumDirtyPaths; i++)
+    {
+        const DirtyPath & path = mDirtyPaths[i];
+        for (ClusterInfo * clusterInfo = mInterestBuckets[InterestBucket(path.mEndpointId, path.mClusterId)];
+             clusterInfo != nullptr; clusterInfo = clusterInfo->mpNextInterested)
+        {
+            if (clusterInfo->mEndpointId == path.mEndpointId && clusterInfo->mClusterId == path.mClusterId &&
+                (!clusterInfo->mFlags.Has(ClusterInfo::Flags::kFieldIdValid) || clusterInfo->mFieldId == path.mAttributeId))
+            {
+                // A whole-cluster path that is being reported over several chunks starts over, as the changed attribute
+                // may already have been reported.
+                clusterInfo->mResumeAttributeIndex = 0;
+                clusterInfo->mpReadHandler->SetDirty(*clusterInfo);
+            }
+        }
+    }
+    mNumDirtyPaths = 0;
+}
+
 EventNumber Engine::CountEvents(ReadHandler * apReadHandler, EventNumber * apInitialEvents)
 {
     EventNumber event_count             = 0;
@@ -86,24 +184,77 @@ exit:
 CHIP_ERROR Engine::BuildSingleReportDataAttributeDataList(ReportData::Builder & reportDataBuilder, ReadHandler * apReadHandler)
 {
     CHIP_ERROR err                               = CHIP_NO_ERROR;
-    ClusterInfo * clusterInfo                    = apReadHandler->GetAttributeClusterInfolist();
+    ClusterInfo * clusterInfo                    = nullptr;
+    size_t numAttributes                         = 0;
     AttributeDataList::Builder attributeDataList = reportDataBuilder.CreateAttributeDataListBuilder();
     SuccessOrExit(err = reportDataBuilder.GetError());
-    // TODO: Need to handle multiple chunk of message
-    while (clusterInfo != nullptr)
+    while ((clusterInfo = apReadHandler->PopDirtyAttributeClusterInfo()) != nullptr)
     {
-        if (clusterInfo->IsDirty())
+        if (!clusterInfo->mFlags.Has(ClusterInfo::Flags::kFieldIdValid))
         {
-            AttributeDataElement::Builder attributeDataElementBuilder = attributeDataList.CreateAttributeDataElementBuilder();
-            ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Field %" PRIx32 " is dirty", clusterInfo->mClusterId,
-                          clusterInfo->mFieldId);
-            // Retrieve data for this cluster instance and clear its dirty flag.
-            err = RetrieveClusterData(attributeDataElementBuilder, *clusterInfo);
+            // Whole-cluster path: all its attributes are read in one pass, resuming where the previous chunk stopped.
+            size_t numElements = 0;
+            clusterInfo->ClearDirty();
+            err = ReadClusterData(*clusterInfo, attributeDataList, numElements);
+            numAttributes += numElements;
+            if ((err == CHIP_ERROR_BUFFER_TOO_SMALL) || (err == CHIP_ERROR_NO_MEMORY))
+            {
+                err = CHIP_NO_ERROR;
+                if (numAttributes == 0)
+                {
+                    ChipLogError(DataManagement,
+                                 "<RE:Run> Cluster %" PRIx32 ", attribute #%" PRIu16 " does not fit in a report, skipping",
+                                 clusterInfo->mClusterId, clusterInfo->mResumeAttributeIndex);
+                    clusterInfo->mResumeAttributeIndex++;
+                    apReadHandler->SetDirty(*clusterInfo);
+                    continue;
+                }
+
+                apReadHandler->SetDirty(*clusterInfo);
+                mMoreChunkedMessages = true;
+                break;
+            }
             VerifyOrExit(err == CHIP_NO_ERROR,
                          ChipLogError(DataManagement, "<RE:Run> Error retrieving data from cluster, aborting"));
+            continue;
         }
 
-        clusterInfo = clusterInfo->mpNext;
+        TLV::TLVWriter backup;
+        AttributeDataList::Builder attributeDataListBackup = attributeDataList;
+        attributeDataList.Checkpoint(backup);
+
+        AttributeDataElement::Builder attributeDataElementBuilder = attributeDataList.CreateAttributeDataElementBuilder();
+        ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Field %" PRIx32 " is dirty", clusterInfo->mClusterId,
+                      clusterInfo->mFieldId);
+        err = attributeDataList.GetError();
+        if (err == CHIP_NO_ERROR)
+        {
+            // Retrieve data for this cluster instance and clear its dirty flag.
+            err = RetrieveClusterData(attributeDataElementBuilder, *clusterInfo);
+        }
+
+        if ((err == CHIP_ERROR_BUFFER_TOO_SMALL) || (err == CHIP_ERROR_NO_MEMORY))
+        {
+            // The report is full: drop the partial element and end the report here.
+            attributeDataList = attributeDataListBackup;
+            attributeDataList.Rollback(backup);
+            err = CHIP_NO_ERROR;
+            clusterInfo->ClearDirty();
+
+            if (numAttributes == 0)
+            {
+                ChipLogError(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Field %" PRIx32 " does not fit in a report, skipping",
+                             clusterInfo->mClusterId, clusterInfo->mFieldId);
+                continue;
+            }
+
+            // Report it first in the next chunk.
+            apReadHandler->SetDirty(*clusterInfo);
+            mMoreChunkedMessages = true;
+            break;
+        }
+        VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(DataManagement, "<RE:Run> Error retrieving data from cluster, aborting"));
+        numAttributes++;
     }
     attributeDataList.EndOfAttributeDataList();
     err = attributeDataList.GetError();
@@ -193,7 +344,8 @@ CHIP_ERROR Engine::BuildSingleReportDataEventList(ReportData::Builder & aReportD
                 // (we will get another chance immediately afterwards,
                 // with a ew buffer) and do not advance the processing
                 // to the next priority level.
-                err = CHIP_NO_ERROR;
+                err                  = CHIP_NO_ERROR;
+                mMoreChunkedMessages = true;
                 break;
             }
             mMoreChunkedMessages = true;
@@ -222,16 +374,20 @@ exit:
     return err;
 }
 
-CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
+CHIP_ERROR Engine::BuildSingleReportData(ReadHandler * apReadHandler, System::PacketBufferHandle & aPayload)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::System::PacketBufferTLVWriter reportDataWriter;
     ReportData::Builder reportDataBuilder;
-    chip::System::PacketBufferHandle bufHandle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+    chip::System::PacketBufferHandle bufHandle = MessagePacketBuffer::NewChainHead(kMaxReportDataLengthBytes);
 
     VerifyOrExit(!bufHandle.IsNull(), err = CHIP_ERROR_NO_MEMORY);
 
-    reportDataWriter.Init(std::move(bufHandle));
+    // Fill no more than a message carries, and keep room for the flag that says the report goes on. Where buffers are smaller
+    // than a message, the report continues in buffers chained to the first one, which are encrypted and sent as they are.
+    reportDataWriter.Init(std::move(bufHandle), true /* useChainedBuffers */, kMaxReportDataLengthBytes);
+    SuccessOrExit(err = reportDataWriter.ReserveBuffer(kReservedSizeForMoreChunksFlag));
+    mMoreChunkedMessages = false;
 
     // Create a report data.
     err = reportDataBuilder.Init(&reportDataWriter);
@@ -240,11 +396,15 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     err = BuildSingleReportDataAttributeDataList(reportDataBuilder, apReadHandler);
     SuccessOrExit(err);
 
-    err = BuildSingleReportDataEventList(reportDataBuilder, apReadHandler);
-    SuccessOrExit(err);
+    // Events go into the space the attributes leave; if they filled the report, events start the next chunk.
+    if (!mMoreChunkedMessages)
+    {
+        err = BuildSingleReportDataEventList(reportDataBuilder, apReadHandler);
+        SuccessOrExit(err);
+    }
 
     // TODO: Add mechanism to set mSuppressResponse to handle status reports for multiple reports
-    // TODO: Add more chunk message support, currently mMoreChunkedMessages is always false.
+    SuccessOrExit(err = reportDataWriter.UnreserveBuffer(kReservedSizeForMoreChunksFlag));
     if (mMoreChunkedMessages)
     {
         reportDataBuilder.MoreChunkedMessages(mMoreChunkedMessages);
@@ -253,7 +413,7 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     reportDataBuilder.EndOfReportData();
     SuccessOrExit(err = reportDataBuilder.GetError());
 
-    err = reportDataWriter.Finalize(&bufHandle);
+    err = reportDataWriter.Finalize(&aPayload);
     SuccessOrExit(err);
 
 #if CHIP_CONFIG_IM_ENABLE_SCHEMA_CHECK
@@ -262,7 +422,7 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
         chip::System::PacketBufferTLVReader reader;
         ReportData::Parser report;
 
-        reader.Init(bufHandle.Retain());
+        reader.Init(aPayload.Retain(), true /* useChainedBuffers */);
         reader.Next();
 
         err = report.Init(reader);
@@ -273,15 +433,41 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     }
 #endif // CHIP_CONFIG_IM_ENABLE_SCHEMA_CHECK
 
+exit:
+    ChipLogFunctError(err);
+    return err;
+}
+
+CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::System::PacketBufferHandle bufHandle;
+    uint16_t reportLength = 0;
+
+    err = BuildSingleReportData(apReadHandler, bufHandle);
+    SuccessOrExit(err);
+    reportLength = bufHandle->TotalLength();
+
     ChipLogDetail(DataManagement, "<RE> Sending report...");
     err = SendReport(apReadHandler, std::move(bufHandle));
     VerifyOrExit(err == CHIP_NO_ERROR,
                  ChipLogError(DataManagement, "<RE> Error sending out report data with %" CHIP_ERROR_FORMAT "!",
                               ChipError::FormatError(err)));
 
+    mReportStatistics.mNumMessages++;
+    mReportStatistics.mNumBytes += reportLength;
+    if (mMoreChunkedMessages)
+    {
+        mReportStatistics.mNumChunkedMessages++;
+    }
+
     ChipLogDetail(DataManagement, "<RE> ReportsInFlight = %" PRIu32 " with readHandler %" PRIu32 ", RE has %s", mNumReportsInFlight,
                   mCurReadHandlerIdx, mMoreChunkedMessages ? "more messages" : "no more messages");
+    ChipLogDetail(DataManagement, "<RE> Sent %u-byte report, %" PRIu32 " bytes per message on average",
+                  static_cast<unsigned>(reportLength), GetReportBytesPerMessage());
 
+    // A chunk that is not the last stays in flight until the initiator asks for the next one, see
+    // ReadHandler::OnMessageReceived().
     if (!mMoreChunkedMessages)
     {
         OnReportConfirm();
@@ -289,13 +475,23 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
 
 exit:
     ChipLogFunctError(err);
-    if (!mMoreChunkedMessages || err != CHIP_NO_ERROR)
+    // A handler that failed to send has shut itself down already.
+    if (err != CHIP_NO_ERROR && !apReadHandler->IsFree())
     {
         apReadHandler->Shutdown();
     }
     return err;
 }
 
+uint32_t Engine::GetReportBytesPerMessage() const
+{
+    if (mReportStatistics.mNumMessages == 0)
+    {
+        return 0;
+    }
+    return static_cast<uint32_t>(mReportStatistics.mNumBytes / mReportStatistics.mNumMessages);
+}
+
 void Engine::Run(System::Layer * aSystemLayer, void * apAppState, CHIP_ERROR)
 {
     Engine * const pEngine = reinterpret_cast<Engine *>(apAppState);
@@ -316,22 +512,27 @@ CHIP_ERROR Engine::ScheduleRun()
 
 void Engine::Run()
 {
-    uint32_t numReadHandled = 0;
+    size_t numReadHandled = 0;
 
     InteractionModelEngine * imEngine = InteractionModelEngine::GetInstance();
-    ReadHandler * readHandler         = imEngine->mReadHandlers + mCurReadHandlerIdx;
+    const size_t numReadHandlers      = imEngine->mReadHandlers.Capacity();
+
+    ProcessDirtyPaths();
 
-    while ((mNumReportsInFlight < CHIP_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < CHIP_MAX_NUM_READ_HANDLER))
+    // Send one report message for each reportable handler, starting after the one served last. A handler that sent a chunk
+    // schedules another run once the initiator asks for the next one, so a large report is interleaved with the others.
+    while ((mNumReportsInFlight < CHIP_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < numReadHandlers))
     {
+        // The pool may have been resized since the last run.
+        mCurReadHandlerIdx        = static_cast<uint32_t>(mCurReadHandlerIdx % numReadHandlers);
+        ReadHandler * readHandler = &imEngine->mReadHandlers[mCurReadHandlerIdx];
         if (readHandler->IsReportable())
         {
             CHIP_ERROR err = BuildAndSendSingleReportData(readHandler);
             ChipLogFunctError(err);
-            return;
         }
         numReadHandled++;
-        mCurReadHandlerIdx = (mCurReadHandlerIdx + 1) % CHIP_MAX_NUM_READ_HANDLER;
-        readHandler        = imEngine->mReadHandlers + mCurReadHandlerIdx;
+        mCurReadHandlerIdx++;
     }
 }
 
@@ -342,7 +543,7 @@ CHIP_ERROR Engine::SendReport(ReadHandler * apReadHandler, System::PacketBufferH
     // We can only have 1 report in flight for any given read - increment and break out.
     mNumReportsInFlight++;
 
-    err = apReadHandler->SendReportData(std::move(aPayload));
+    err = apReadHandler->SendReportData(std::move(aPayload), mMoreChunkedMessages);
 
     if (err != CHIP_NO_ERROR)
     {
@@ -35,6 +35,7 @@
 #include <support/logging/CHIPLogging.h>
 #include <system/SystemPacketBuffer.h>
 #include <system/TLVPacketBufferBackingStore.h>
+#include <transport/raw/MessageHeader.h>
 
 namespace chip {
 namespace app {
@@ -52,6 +53,21 @@ namespace reporting {
 class Engine
 {
 public:
+    /**
+     * The largest report payload the engine packs into one message: the largest application payload of a secure message.
+     */
+    static constexpr uint32_t kMaxReportDataLengthBytes = kMaxAppMessageLen;
+
+    /**
+     * Counters of the report messages sent since the engine was initialized, to judge how well reports fill their messages.
+     */
+    struct ReportStatistics
+    {
+        uint32_t mNumMessages        = 0; ///< Report messages sent.
+        uint32_t mNumChunkedMessages = 0; ///< Messages followed by another chunk of the same report.
+        uint64_t mNumBytes           = 0; ///< Report payload bytes sent.
+    };
+
     /**
      * Initializes the reporting engine. Should only be called once.
      *
@@ -70,14 +86,83 @@ public:
      */
     CHIP_ERROR ScheduleRun();
 
+    /**
+     * Should be invoked when the device receives a Status report, or when the Report data request times out.
+     * This allows the engine to do some clean-up.
+     *
+     */
+    void OnReportConfirm();
+
+    /**
+     * Record that the value of an attribute has changed, and schedule a run that queues it for reporting to the read
+     * handlers interested in it. Changes to the same attribute before that run are merged.
+     */
+    void SetDirty(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId);
+
+    /**
+     * Register @p aClusterInfo, an attribute path of @p aReadHandler, so that changes to attributes it covers are queued on
+     * @p aReadHandler.
+     */
+    void AddInterest(ReadHandler & aReadHandler, ClusterInfo & aClusterInfo);
+
+    /**
+     * Unregister all attribute paths of @p aReadHandler. Must be called before its attribute path list is released.
+     */
+    void RemoveInterest(ReadHandler & aReadHandler);
+
+    /**
+     * Returns the number of attribute changes recorded since the engine was initialized.
+     */
+    uint32_t GetDirtyVersion() const { return mDirtyVersion; }
+
+    const ReportStatistics & GetReportStatistics() const { return mReportStatistics; }
+
+    /**
+     * Returns the average size of the report messages sent, in bytes, or 0 if none has been sent.
+     */
+    uint32_t GetReportBytesPerMessage() const;
+
 private:
     friend class TestReportingEngine;
+
+    /**
+     * An attribute that has changed since the last run.
+     */
+    struct DirtyPath
+    {
+        EndpointId mEndpointId;
+        ClusterId mClusterId;
+        AttributeId mAttributeId;
+    };
+
+    // Size of the MoreChunkedMessages element: a control byte and a context tag.
+    static constexpr uint32_t kReservedSizeForMoreChunksFlag = 2;
+
+    static constexpr size_t kInterestBucketMask = CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_BUCKETS - 1;
+    static_assert((CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_BUCKETS & kInterestBucketMask) == 0,
+                  "CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_BUCKETS must be a power of two");
+
+    static size_t InterestBucket(EndpointId aEndpointId, ClusterId aClusterId);
+
+    /**
+     * Queue every registered attribute path that covers a recorded change on its read handler, and forget the changes.
+     * The cost depends on the number of changes and the paths registered under the same buckets, not on the total
+     * number of read handlers and paths.
+     */
+    void ProcessDirtyPaths();
     /**
      * Build Single Report Data including attribute changes and event data stream, and send out
      *
      */
     CHIP_ERROR BuildAndSendSingleReportData(ReadHandler * apReadHandler);
 
+    /**
+     * Build the next report message for @p apReadHandler into @p aPayload, packing as many queued attribute changes and
+     * events as fit in kMaxReportDataLengthBytes. Whatever does not fit stays queued for the next chunk, and
+     * mMoreChunkedMessages tells whether there is one.
+     */
+    CHIP_ERROR BuildSingleReportData(ReadHandler * apReadHandler, System::PacketBufferHandle & aPayload);
+
     CHIP_ERROR BuildSingleReportDataAttributeDataList(ReportData::Builder & reportDataBuilder, ReadHandler * apReadHandler);
     CHIP_ERROR BuildSingleReportDataEventList(ReportData::Builder & reportDataBuilder, ReadHandler * apReadHandler);
     CHIP_ERROR RetrieveClusterData(AttributeDataElement::Builder & aAttributeDataElementBuilder, ClusterInfo & aClusterInfo);
@@ -89,13 +174,6 @@ private:
      */
     CHIP_ERROR SendReport(ReadHandler * apReadHandler, System::PacketBufferHandle && aPayload);
 
-    /**
-     * Should be invoked when the device receives a Status report, or when the Report data request times out.
-     * This allows the engine to do some clean-up.
-     *
-     */
-    void OnReportConfirm();
-
     /**
      * Generate and send the report data request when there exists subscription or read request
      *
@@ -119,6 +197,22 @@ private:
      *
      */
     uint32_t mCurReadHandlerIdx = 0;
+
+    /**
+     *  Attributes changed since the last run, in the order of their first change
+     *
+     */
+    DirtyPath mDirtyPaths[CHIP_CONFIG_IM_MAX_DIRTY_ATTRIBUTE_PATHS];
+    size_t mNumDirtyPaths  = 0;
+    uint32_t mDirtyVersion = 0;
+
+    /**
+     *  Registered attribute paths, chained through ClusterInfo::mpNextInterested and hashed by endpoint and cluster
+     *
+     */
+    ClusterInfo * mInterestBuckets[CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_BUCKETS] = {};
+
+    ReportStatistics mReportStatistics;
 };
 
 }; // namespace reporting
@@ -0,0 +1,61 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the ReadSingleClusterData and ReadClusterData
+ *      stubs that the app unit tests share, since they are linked from the
+ *      same test library.
+ */
+
+#include "MockClusterData.h"
+
+#include <app/InteractionModelEngine.h>
+#include <protocols/interaction_model/Constants.h>
+#include <support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+
+CHIP_ERROR ReadSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVWriter * apWriter, bool * apDataExists)
+{
+    VerifyOrReturnError(apWriter != nullptr, CHIP_NO_ERROR);
+
+    if (aClusterInfo.mClusterId != Test::kMockClusterId || aClusterInfo.mEndpointId != Test::kMockEndpointId)
+    {
+        return apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Status),
+                             static_cast<uint16_t>(Protocols::InteractionModel::ProtocolCode::UnsupportedAttribute));
+    }
+
+    uint8_t value[Test::kMockAttributeLength];
+    memset(value, static_cast<uint8_t>(aClusterInfo.mFieldId), sizeof(value));
+    ReturnErrorOnFailure(apWriter->PutBytes(TLV::ContextTag(AttributeDataElement::kCsTag_Data), value, sizeof(value)));
+    return apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_DataVersion), static_cast<DataVersion>(0));
+}
+
+CHIP_ERROR ReadClusterData(ClusterInfo & aClusterInfo, AttributeDataList::Builder & aAttributeDataList, size_t & aNumElements)
+{
+    // No whole-cluster reads are expected, report no attributes.
+    aNumElements = 0;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace app
+} // namespace chip
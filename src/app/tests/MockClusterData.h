@@ -0,0 +1,43 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares the attributes that the ReadSingleClusterData and
+ *      ReadClusterData stubs shared by the app unit tests report.
+ */
+
+#pragma once
+
+#include <app/util/basic-types.h>
+
+#include <stddef.h>
+
+namespace chip {
+namespace app {
+namespace Test {
+
+// Every attribute of this cluster, on this endpoint, reads as kMockAttributeLength bytes that each hold the low byte of
+// the attribute ID. All other attributes read as unsupported.
+constexpr ClusterId kMockClusterId    = 6;
+constexpr EndpointId kMockEndpointId  = 1;
+constexpr size_t kMockAttributeLength = 32;
+
+} // namespace Test
+} // namespace app
+} // namespace chip
@@ -0,0 +1,154 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the attribute index used by
+ *      attribute storage.
+ */
+
+#include <app/util/attribute-index.h>
+#include <support/CHIPMem.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+namespace chip {
+namespace app {
+namespace {
+
+AttributeIndex::Entry MakeEntry(EndpointId endpoint, ClusterId cluster, AttributeId attribute, uint16_t endpointIndex,
+                                uint16_t attributeIndex)
+{
+    AttributeIndex::Entry entry;
+    entry.mEndpointId     = endpoint;
+    entry.mClusterId      = cluster;
+    entry.mAttributeId    = attribute;
+    entry.mEndpointIndex  = endpointIndex;
+    entry.mAttributeIndex = attributeIndex;
+    entry.mOffset         = static_cast<uint16_t>(attributeIndex * 2);
+    entry.mClusterIndex   = 0;
+    return entry;
+}
+
+bool AnyEntry(const AttributeIndex::Entry &)
+{
+    return true;
+}
+
+void TestFind(nlTestSuite * inSuite, void * inContext)
+{
+    AttributeIndex index;
+    NL_TEST_ASSERT(inSuite, !index.IsInitialized());
+    NL_TEST_ASSERT(inSuite, index.Find(1, 6, 0, AnyEntry) == nullptr);
+    NL_TEST_ASSERT(inSuite, index.Add(MakeEntry(1, 6, 0, 0, 0)) == CHIP_ERROR_INCORRECT_STATE);
+
+    NL_TEST_ASSERT(inSuite, index.Init(4) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.Add(MakeEntry(1, 6, 0, 0, 0)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.Add(MakeEntry(1, 6, 1, 0, 1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.Add(MakeEntry(2, 6, 0, 1, 0)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.Count() == 3);
+
+    const AttributeIndex::Entry * entry = index.Find(1, 6, 1, AnyEntry);
+    NL_TEST_ASSERT(inSuite, entry != nullptr && entry->mEndpointIndex == 0 && entry->mAttributeIndex == 1 && entry->mOffset == 2);
+
+    entry = index.Find(2, 6, 0, AnyEntry);
+    NL_TEST_ASSERT(inSuite, entry != nullptr && entry->mEndpointIndex == 1 && entry->mAttributeIndex == 0);
+
+    NL_TEST_ASSERT(inSuite, index.Find(2, 6, 1, AnyEntry) == nullptr);
+    NL_TEST_ASSERT(inSuite, index.Find(1, 8, 0, AnyEntry) == nullptr);
+    NL_TEST_ASSERT(inSuite, index.Find(3, 6, 0, AnyEntry) == nullptr);
+
+    NL_TEST_ASSERT(inSuite, index.Add(MakeEntry(3, 6, 0, 2, 0)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.Add(MakeEntry(4, 6, 0, 3, 0)) == CHIP_ERROR_NO_MEMORY);
+    NL_TEST_ASSERT(inSuite, index.Count() == 4);
+
+    NL_TEST_ASSERT(inSuite, index.Init(1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.Count() == 0);
+    NL_TEST_ASSERT(inSuite, index.Find(1, 6, 0, AnyEntry) == nullptr);
+
+    index.Shutdown();
+    NL_TEST_ASSERT(inSuite, !index.IsInitialized());
+}
+
+void TestFindSharedKey(nlTestSuite * inSuite, void * inContext)
+{
+    AttributeIndex index;
+    NL_TEST_ASSERT(inSuite, index.Init(8) == CHIP_NO_ERROR);
+
+    // The client and server side of a cluster on the same endpoint share their keys.
+    NL_TEST_ASSERT(inSuite, index.Add(MakeEntry(1, 6, 0, 0, 0)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.Add(MakeEntry(1, 6, 0, 0, 5)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.Add(MakeEntry(1, 6, 0, 0, 9)) == CHIP_NO_ERROR);
+
+    // Entries come in the order they were added, and the first one accepted wins.
+    uint16_t seen[3] = {};
+    size_t seenCount = 0;
+
+    const AttributeIndex::Entry * entry = index.Find(1, 6, 0, [&seen, &seenCount](const AttributeIndex::Entry & candidate) {
+        seen[seenCount++] = candidate.mAttributeIndex;
+        return candidate.mAttributeIndex != 0;
+    });
+    NL_TEST_ASSERT(inSuite, entry != nullptr && entry->mAttributeIndex == 5);
+    NL_TEST_ASSERT(inSuite, seenCount == 2 && seen[0] == 0 && seen[1] == 5);
+
+    entry = index.Find(1, 6, 0, [](const AttributeIndex::Entry & candidate) { return false; });
+    NL_TEST_ASSERT(inSuite, entry == nullptr);
+
+    index.Shutdown();
+}
+
+int TestSetup(void * inContext)
+{
+    return (Platform::MemoryInit() == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int TestTeardown(void * inContext)
+{
+    Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+} // namespace app
+} // namespace chip
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestFind", chip::app::TestFind),                   //
+    NL_TEST_DEF("TestFindSharedKey", chip::app::TestFindSharedKey), //
+    NL_TEST_SENTINEL(),                                             //
+};
+
+int TestAttributeIndex()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+	{
+        "TestAttributeIndex",
+        &sTests[0],
+        chip::app::TestSetup,
+        chip::app::TestTeardown
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestAttributeIndex)
@@ -0,0 +1,217 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test of a read whose report takes several
+ *      messages, sent between a ReadClient and a ReadHandler over a reliable
+ *      exchange.
+ *
+ */
+
+#include "MockClusterData.h"
+
+#include <app/InteractionModelEngine.h>
+#include <app/reporting/Engine.h>
+#include <core/CHIPCore.h>
+#include <core/CHIPTLV.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeMgr.h>
+#include <messaging/tests/MessagingContext.h>
+#include <support/ErrorStr.h>
+#include <support/UnitTestRegistration.h>
+#include <system/SystemPacketBuffer.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
+
+#include <nlunit-test.h>
+
+namespace {
+chip::TransportMgrBase gTransportManager;
+chip::Test::LoopbackTransport gLoopback;
+
+using TestContext = chip::Test::MessagingContext;
+TestContext sContext;
+
+constexpr size_t kNumPaths    = 40;
+constexpr unsigned kMaxWaitMs = 5000;
+
+} // namespace
+
+namespace chip {
+namespace app {
+
+class TestChunkedRead
+{
+public:
+    static void TestChunkedReadRoundtrip(nlTestSuite * apSuite, void * apContext);
+};
+
+class ChunkedReadDelegate : public InteractionModelDelegate
+{
+public:
+    void OnReportData(const ReadClient * apReadClient, const ClusterInfo & aPath, TLV::TLVReader * apData,
+                      Protocols::InteractionModel::ProtocolCode status) override
+    {
+        uint8_t value[Test::kMockAttributeLength];
+        uint8_t expected[Test::kMockAttributeLength];
+        memset(expected, static_cast<uint8_t>(aPath.mFieldId), sizeof(expected));
+        if (apData == nullptr || aPath.mFieldId >= kNumPaths || apData->GetBytes(value, sizeof(value)) != CHIP_NO_ERROR ||
+            memcmp(value, expected, sizeof(value)) != 0)
+        {
+            mNumBadAttributes++;
+            return;
+        }
+        mNumReceived[aPath.mFieldId]++;
+    }
+
+    CHIP_ERROR ReportProcessed(const ReadClient * apReadClient) override
+    {
+        mGotReport = true;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR ReportError(const ReadClient * apReadClient, CHIP_ERROR aError) override
+    {
+        mGotError = true;
+        return CHIP_NO_ERROR;
+    }
+
+    size_t mNumReceived[kNumPaths] = {};
+    size_t mNumBadAttributes       = 0;
+    bool mGotReport                = false;
+    bool mGotError                 = false;
+};
+
+void TestChunkedRead::TestChunkedReadRoundtrip(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    AttributePathParams attributePathParams[kNumPaths];
+    InteractionModelPoolSizes sizes;
+    ChunkedReadDelegate delegate;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    sizes.mNumPathGroups = kNumPaths;
+    auto * engine        = InteractionModelEngine::GetInstance();
+    err                  = engine->Init(&ctx.GetExchangeManager(), &delegate, sizes);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    const reporting::Engine & reportingEngine = engine->GetReportingEngine();
+
+    // Read more attributes than fit in one report message, but few enough for their paths to fit in the request.
+    for (size_t i = 0; i < kNumPaths; i++)
+    {
+        attributePathParams[i] = AttributePathParams(ctx.GetDestinationNodeId(), Test::kMockEndpointId, Test::kMockClusterId,
+                                                     static_cast<FieldId>(i), 0, AttributePathParams::Flags::kFieldIdValid);
+    }
+
+    SecureSessionHandle session = ctx.GetSessionLocalToPeer();
+    err = engine->SendReadRequest(ctx.GetDestinationNodeId(), ctx.GetAdminId(), &session, nullptr, 0, attributePathParams, kNumPaths,
+                                  0);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // Each chunk is only sent once the client asked for it, so this takes several runs of the reporting engine.
+    ctx.DriveIOUntil(kMaxWaitMs, [&delegate]() { return delegate.mGotReport || delegate.mGotError; });
+    NL_TEST_ASSERT(apSuite, delegate.mGotReport && !delegate.mGotError);
+    NL_TEST_ASSERT(apSuite, reportingEngine.GetReportStatistics().mNumChunkedMessages > 0);
+
+    // Every attribute arrived exactly once.
+    NL_TEST_ASSERT(apSuite, delegate.mNumBadAttributes == 0);
+    for (size_t i = 0; i < kNumPaths; i++)
+    {
+        NL_TEST_ASSERT(apSuite, delegate.mNumReceived[i] == 1);
+    }
+
+    // By now every chunk and status response has been acknowledged, and the read handler is gone.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+    NL_TEST_ASSERT(apSuite, engine->GetReadHandlerPool().Allocated() == 0);
+    NL_TEST_ASSERT(apSuite, engine->GetNumPaths() == 0);
+
+    engine->Shutdown();
+}
+
+} // namespace app
+} // namespace chip
+
+namespace {
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+
+// clang-format off
+const nlTest sTests[] =
+{
+        NL_TEST_DEF("CheckChunkedReadRoundtrip", chip::app::TestChunkedRead::TestChunkedReadRoundtrip),
+        NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int Initialize(void * aContext);
+int Finalize(void * aContext);
+
+// clang-format off
+nlTestSuite sSuite =
+{
+    "TestChunkedRead",
+    &sTests[0],
+    Initialize,
+    Finalize
+};
+// clang-format on
+
+int Initialize(void * aContext)
+{
+    CHIP_ERROR err = chip::Platform::MemoryInit();
+    if (err != CHIP_NO_ERROR)
+    {
+        return FAILURE;
+    }
+
+    gTransportManager.Init(&gLoopback);
+
+    auto * ctx = static_cast<TestContext *>(aContext);
+    err        = ctx->Init(&sSuite, &gTransportManager);
+    if (err != CHIP_NO_ERROR)
+    {
+        return FAILURE;
+    }
+
+    gTransportManager.SetSecureSessionMgr(&ctx->GetSecureSessionManager());
+    return SUCCESS;
+}
+
+int Finalize(void * aContext)
+{
+    CHIP_ERROR err = reinterpret_cast<TestContext *>(aContext)->Shutdown();
+    chip::Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+} // namespace
+
+int TestChunkedRead()
+{
+    nlTestRunner(&sSuite, &sContext);
+
+    return (nlTestRunnerStats(&sSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestChunkedRead)
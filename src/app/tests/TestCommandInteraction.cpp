@@ -92,16 +92,14 @@ void DispatchSingleClusterResponseCommand(chip::ClusterId aClusterId, chip::Comm
 
 bool ServerClusterCommandExists(chip::ClusterId aClusterId, chip::CommandId aCommandId, chip::EndpointId aEndPointId)
 {
-    // Mock cluster catalog, only support one command on one cluster on one endpoint.
-    return (aEndPointId == kTestEndpointId && aClusterId == kTestClusterId && aCommandId == kTestCommandId);
+    // Mock cluster catalog, only support one cluster on one endpoint.
+    return (aEndPointId == kTestEndpointId && aClusterId == kTestClusterId);
 }
 
-CHIP_ERROR ReadSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVWriter * apWriter, bool * apDataExists)
+bool ServerClusterAcceptsCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId)
 {
-    // We do not really care about the value, just return a not found status code.
-    VerifyOrReturnError(apWriter != nullptr, CHIP_NO_ERROR);
-    return apWriter->Put(chip::TLV::ContextTag(AttributeDataElement::kCsTag_Status),
-                         static_cast<uint16_t>(Protocols::InteractionModel::ProtocolCode::UnsupportedAttribute));
+    // The mock cluster only supports one command.
+    return (aClusterId == kTestClusterId && aCommandId == kTestCommandId);
 }
 
 class TestCommandInteraction
@@ -113,6 +111,7 @@ public:
     static void TestCommandHandlerWithSendEmptyCommand(nlTestSuite * apSuite, void * apContext);
     static void TestCommandSenderWithProcessReceivedMsg(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerWithProcessReceivedNotExistCommand(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandHandlerWithProcessReceivedUnsupportedCommand(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerWithSendSimpleCommandData(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerWithSendSimpleStatusCode(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerWithSendEmptyResponse(nlTestSuite * apSuite, void * apContext);
@@ -125,6 +124,7 @@ private:
                                         ClusterId aClusterId = kTestClusterId, CommandId aCommandId = kTestCommandId);
     static void AddCommandDataElement(nlTestSuite * apSuite, void * apContext, Command * apCommand, bool aNeedStatusCode);
     static void ValidateCommandHandlerWithSendCommand(nlTestSuite * apSuite, void * apContext, bool aNeedStatusCode);
+    static uint16_t GetResponseProtocolCode(nlTestSuite * apSuite, CommandHandler & aCommandHandler);
 };
 
 class TestExchangeDelegate : public Messaging::ExchangeDelegate
@@ -398,9 +398,62 @@ void TestCommandInteraction::TestCommandHandlerWithProcessReceivedNotExistComman
     chip::isCommandDispatched = false;
     err                       = commandHandler.ProcessCommandMessage(std::move(commandDatabuf), Command::CommandRoleId::HandlerId);
     NL_TEST_ASSERT(apSuite, !chip::isCommandDispatched);
+    NL_TEST_ASSERT(apSuite,
+                   GetResponseProtocolCode(apSuite, commandHandler) ==
+                       to_underlying(Protocols::InteractionModel::ProtocolCode::InvalidCommand));
     commandHandler.Shutdown();
 }
 
+void TestCommandInteraction::TestCommandHandlerWithProcessReceivedUnsupportedCommand(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    app::CommandHandler commandHandler;
+    System::PacketBufferHandle commandDatabuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    err                                       = commandHandler.Init(&chip::gExchangeManager, nullptr);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    // The cluster exists on the endpoint, but does not support the command.
+    GenerateReceivedCommand(apSuite, apContext, commandDatabuf, true /*aNeedCommandData*/, kTestEndpointId, kTestClusterId,
+                            0xEF /* command */);
+
+    chip::isCommandDispatched = false;
+    err                       = commandHandler.ProcessCommandMessage(std::move(commandDatabuf), Command::CommandRoleId::HandlerId);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR && !chip::isCommandDispatched);
+    NL_TEST_ASSERT(apSuite,
+                   GetResponseProtocolCode(apSuite, commandHandler) ==
+                       to_underlying(Protocols::InteractionModel::ProtocolCode::UnsupportedCommand));
+    commandHandler.Shutdown();
+}
+
+uint16_t TestCommandInteraction::GetResponseProtocolCode(nlTestSuite * apSuite, CommandHandler & aCommandHandler)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    System::PacketBufferHandle commandPacket;
+    chip::System::PacketBufferTLVReader reader;
+    TLV::TLVReader commandListReader;
+    InvokeCommand::Parser invokeCommandParser;
+    CommandList::Parser commandListParser;
+    CommandDataElement::Parser commandElementParser;
+    StatusElement::Parser statusElementParser;
+    Protocols::SecureChannel::GeneralStatusCode generalCode;
+    uint32_t protocolId   = 0;
+    uint16_t protocolCode = 0;
+
+    // The response holds the status of the only command of the request.
+    err = aCommandHandler.FinalizeCommandsMessage(commandPacket);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    reader.Init(std::move(commandPacket));
+    NL_TEST_ASSERT(apSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, invokeCommandParser.Init(reader) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, invokeCommandParser.GetCommandList(&commandListParser) == CHIP_NO_ERROR);
+    commandListParser.GetReader(&commandListReader);
+    NL_TEST_ASSERT(apSuite, commandListReader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, commandElementParser.Init(commandListReader) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, commandElementParser.GetStatusElement(&statusElementParser) == CHIP_NO_ERROR);
+    err = statusElementParser.DecodeStatusElement(&generalCode, &protocolId, &protocolCode);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    return protocolCode;
+}
+
 void TestCommandInteraction::TestCommandHandlerWithProcessReceivedEmptyDataMsg(nlTestSuite * apSuite, void * apContext)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -460,6 +513,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestCommandHandlerWithSendSimpleStatusCode", chip::app::TestCommandInteraction::TestCommandHandlerWithSendSimpleStatusCode),
     NL_TEST_DEF("TestCommandHandlerWithProcessReceivedMsg", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedMsg),
     NL_TEST_DEF("TestCommandHandlerWithProcessReceivedNotExistCommand", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedNotExistCommand),
+    NL_TEST_DEF("TestCommandHandlerWithProcessReceivedUnsupportedCommand", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedUnsupportedCommand),
     NL_TEST_DEF("TestCommandHandlerWithProcessReceivedEmptyDataMsg", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedEmptyDataMsg),
     NL_TEST_SENTINEL()
 };
@@ -0,0 +1,82 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the command ID set used by the
+ *      generated command dispatch.
+ */
+
+#include <app/util/command-set.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+namespace chip {
+namespace app {
+namespace {
+
+// Sets are filled at compile time, the way the generated dispatch declares them.
+constexpr CommandSet kEmptySet = {};
+constexpr CommandSet kSet      = { 0x00, 0x05, 0x1F, 0x20, 0x40, CommandSet::kMaxCommandId };
+
+static_assert(kEmptySet.IsEmpty(), "An empty set must have no commands");
+static_assert(!kSet.IsEmpty() && kSet.Contains(0x05), "A set must be queryable at compile time");
+
+void TestContains(nlTestSuite * inSuite, void * inContext)
+{
+    for (CommandId commandId = 0; commandId <= CommandSet::kMaxCommandId; commandId++)
+    {
+        const bool expected = commandId == 0x00 || commandId == 0x05 || commandId == 0x1F || commandId == 0x20 ||
+            commandId == 0x40 || commandId == CommandSet::kMaxCommandId;
+        NL_TEST_ASSERT(inSuite, kSet.Contains(commandId) == expected);
+        NL_TEST_ASSERT(inSuite, !kEmptySet.Contains(commandId));
+    }
+
+    NL_TEST_ASSERT(inSuite, !kSet.Contains(CommandSet::kMaxCommandId + 1));
+    NL_TEST_ASSERT(inSuite, !kSet.Contains(0x00000105));
+    NL_TEST_ASSERT(inSuite, !kSet.Contains(UINT32_MAX));
+}
+
+} // namespace
+} // namespace app
+} // namespace chip
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestContains", chip::app::TestContains), //
+    NL_TEST_SENTINEL(),                                   //
+};
+
+int TestCommandSet()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+	{
+        "TestCommandSet",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestCommandSet)
@@ -290,12 +290,252 @@ static void CheckLogEventWithDiscardLowEvent(nlTestSuite * apSuite, void * apCon
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
     CheckLogState(apSuite, logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+static uint64_t FetchFirstEventSystemTimestamp(nlTestSuite * apSuite, chip::app::EventManagement & aLogMgmt,
+                                               chip::app::PriorityLevel aPriority, chip::EventNumber aStartingEventNumber,
+                                               chip::app::ClusterInfo * apClusterInfo)
+{
+    CHIP_ERROR err;
+    chip::TLV::TLVReader reader;
+    chip::TLV::TLVWriter writer;
+    chip::TLV::TLVType containerType;
+    uint8_t backingStore[1024];
+    uint64_t timestamp = 0;
+
+    writer.Init(backingStore, sizeof(backingStore));
+    err = aLogMgmt.FetchEventsSince(writer, apClusterInfo, aPriority, aStartingEventNumber);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV);
+
+    reader.Init(backingStore, writer.GetLengthWritten());
+    NL_TEST_ASSERT(apSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, reader.EnterContainer(containerType) == CHIP_NO_ERROR);
+    while (reader.Next() == CHIP_NO_ERROR)
+    {
+        if (reader.GetTag() == chip::TLV::ContextTag(chip::app::EventDataElement::kCsTag_SystemTimestamp))
+        {
+            NL_TEST_ASSERT(apSuite, reader.Get(timestamp) == CHIP_NO_ERROR);
+        }
+    }
+    return timestamp;
+}
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+
+static void CheckLogReadOutFromIndex(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::EventNumber debugEid = 0, infoEid1 = 0, infoEid2 = 0;
+    chip::app::EventSchema debugSchema = { kTestDeviceNodeId1, kTestEndpointId, kLivenessClusterId, kLivenessChangeEvent,
+                                           chip::app::PriorityLevel::Debug };
+    chip::app::EventSchema infoSchema  = { kTestDeviceNodeId2, kTestEndpointId, kLivenessClusterId, kLivenessChangeEvent,
+                                          chip::app::PriorityLevel::Info };
+    chip::app::EventOptions debugOptions;
+    chip::app::EventOptions infoOptions;
+    TestEventGenerator testEventGenerator;
+
+    debugOptions.mpEventSchema           = &debugSchema;
+    infoOptions.mpEventSchema            = &infoSchema;
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    // Interleave debug and info events, so that the buffers keep evicting, dropping and promoting events, and the reads
+    // below start from indexed events in the middle of the buffers.
+    for (uint64_t timestamp = 1000; timestamp < 1200; timestamp += 20)
+    {
+        debugOptions.mTimestamp = chip::app::Timestamp::System(timestamp);
+        infoOptions.mTimestamp  = chip::app::Timestamp::System(timestamp + 10);
+        testEventGenerator.SetStatus(static_cast<int32_t>(timestamp));
+
+        infoEid1 = infoEid2;
+        err      = logMgmt.LogEvent(&testEventGenerator, debugOptions, debugEid);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = logMgmt.LogEvent(&testEventGenerator, infoOptions, infoEid2);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    }
+
+    chip::app::ClusterInfo debugClusterInfo;
+    debugClusterInfo.mNodeId     = kTestDeviceNodeId1;
+    debugClusterInfo.mEndpointId = kTestEndpointId;
+    debugClusterInfo.mClusterId  = kLivenessClusterId;
+    debugClusterInfo.mEventId    = kLivenessChangeEvent;
+    chip::app::ClusterInfo infoClusterInfo;
+    infoClusterInfo.mNodeId     = kTestDeviceNodeId2;
+    infoClusterInfo.mEndpointId = kTestEndpointId;
+    infoClusterInfo.mClusterId  = kLivenessClusterId;
+    infoClusterInfo.mEventId    = kLivenessChangeEvent;
+
+    CheckLogReadOut(apSuite, logMgmt, chip::app::PriorityLevel::Info, infoEid1, 2, &infoClusterInfo);
+    CheckLogReadOut(apSuite, logMgmt, chip::app::PriorityLevel::Info, infoEid2, 1, &infoClusterInfo);
+    CheckLogReadOut(apSuite, logMgmt, chip::app::PriorityLevel::Debug, debugEid, 1, &debugClusterInfo);
+
+    // The first event read out carries its absolute timestamp, which has to be rebuilt from the indexed state. Without the
+    // index, reading starts at the head of the buffer, as it used to.
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    NL_TEST_ASSERT(apSuite,
+                   FetchFirstEventSystemTimestamp(apSuite, logMgmt, chip::app::PriorityLevel::Info, infoEid1, &infoClusterInfo) ==
+                       1170);
+    NL_TEST_ASSERT(apSuite,
+                   FetchFirstEventSystemTimestamp(apSuite, logMgmt, chip::app::PriorityLevel::Info, infoEid2, &infoClusterInfo) ==
+                       1190);
+    NL_TEST_ASSERT(apSuite,
+                   FetchFirstEventSystemTimestamp(apSuite, logMgmt, chip::app::PriorityLevel::Debug, debugEid, &debugClusterInfo) ==
+                       1180);
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+}
+
+static void CheckLogReadOutWithPathFilter(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::EventNumber eid;
+    chip::EventNumber firstNewEid = 0;
+    chip::app::ClusterInfo paths[4];
+    chip::app::EventOptions options;
+    TestEventGenerator testEventGenerator;
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        paths[i].mNodeId     = kTestDeviceNodeId1;
+        paths[i].mEndpointId = static_cast<chip::EndpointId>(1 + i % 2);
+        paths[i].mClusterId  = static_cast<chip::ClusterId>(kLivenessClusterId + i / 2);
+        paths[i].mEventId    = kLivenessChangeEvent;
+    }
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        chip::app::ClusterInfo & path = paths[i % 4];
+        chip::app::EventSchema schema = { path.mNodeId, path.mEndpointId, path.mClusterId, path.mEventId,
+                                          chip::app::PriorityLevel::Info };
+        options.mpEventSchema         = &schema;
+        testEventGenerator.SetStatus(static_cast<int32_t>(i));
+        err = logMgmt.LogEvent(&testEventGenerator, options, eid);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        if (i == 4)
+        {
+            firstNewEid = eid;
+        }
+    }
+
+    // Only the events of the requested paths are read out.
+    CheckLogReadOut(apSuite, logMgmt, chip::app::PriorityLevel::Info, firstNewEid, 1, &paths[0]);
+    paths[0].mpNext = &paths[3];
+    CheckLogReadOut(apSuite, logMgmt, chip::app::PriorityLevel::Info, firstNewEid, 2, &paths[0]);
+    paths[0].mpNext = nullptr;
+
+    // Once the log has been read out, the next read starts after the last event, whatever its path.
+    chip::TLV::TLVWriter writer;
+    uint8_t backingStore[1024];
+    chip::EventNumber eventNumber = firstNewEid;
+    writer.Init(backingStore, sizeof(backingStore));
+    err = logMgmt.FetchEventsSince(writer, &paths[1], chip::app::PriorityLevel::Info, eventNumber);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, eventNumber == logMgmt.GetLastEventNumber(chip::app::PriorityLevel::Info) + 1);
+}
+
+static size_t CountFetchedEvents(nlTestSuite * apSuite, const uint8_t * apBuffer, uint32_t aLength)
+{
+    chip::TLV::TLVReader reader;
+    size_t count = 0;
+
+    reader.Init(apBuffer, aLength);
+    NL_TEST_ASSERT(apSuite, chip::TLV::Utilities::Count(reader, count, false) == CHIP_NO_ERROR);
+    return count;
+}
+
+// Many subscribers, each with one path, and one subscriber with all of them, fetch the events logged since their last fetch;
+// the single-path subscribers get exactly the events of their path, and the all-path subscriber gets every event.
+static void CheckFetchEventsWithManyPathFilters(nlTestSuite * apSuite, void * apContext)
+{
+    constexpr size_t kSources        = 64;
+    constexpr size_t kRounds         = 20;
+    constexpr size_t kEventsPerRound = 64;
+    static uint8_t sDebugBuffer[32768];
+    static uint8_t sInfoBuffer[65536];
+    static uint8_t sCritBuffer[32768];
+    static chip::app::CircularEventBuffer sCircularEventBuffer[3];
+    static uint8_t sReport[8192];
+    chip::app::LogStorageResources logStorageResources[] = {
+        { &sDebugBuffer[0], sizeof(sDebugBuffer), nullptr, 0, nullptr, chip::app::PriorityLevel::Debug },
+        { &sInfoBuffer[0], sizeof(sInfoBuffer), nullptr, 0, nullptr, chip::app::PriorityLevel::Info },
+        { &sCritBuffer[0], sizeof(sCritBuffer), nullptr, 0, nullptr, chip::app::PriorityLevel::Critical },
+    };
+    chip::app::ClusterInfo paths[kSources];
+    chip::EventNumber nextEventNumber[kSources] = {};
+    chip::EventNumber allNextEventNumber        = 0;
+    TestEventGenerator testEventGenerator;
+    size_t allFetched = 0;
+
+    chip::app::EventManagement::DestroyEventManagement();
+    chip::app::EventManagement::CreateEventManagement(&gExchangeManager, 3, sCircularEventBuffer, logStorageResources);
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    // Each source is the path of one subscriber, and a last subscriber wants all of them.
+    for (size_t i = 0; i < kSources; i++)
+    {
+        paths[i].mNodeId     = kTestDeviceNodeId1;
+        paths[i].mEndpointId = static_cast<chip::EndpointId>(i % 8);
+        paths[i].mClusterId  = static_cast<chip::ClusterId>(0x100 + i / 8);
+        paths[i].mEventId    = kLivenessChangeEvent;
+    }
+
+    for (size_t round = 0; round < kRounds; round++)
+    {
+        size_t logged[kSources] = {};
+        for (size_t i = 0; i < kEventsPerRound; i++)
+        {
+            const size_t source           = (round * 7 + i * 13) % kSources;
+            chip::app::ClusterInfo & path = paths[source];
+            chip::app::EventSchema schema = { path.mNodeId, path.mEndpointId, path.mClusterId, path.mEventId,
+                                              chip::app::PriorityLevel::Info };
+            chip::app::EventOptions options;
+            chip::EventNumber eid;
+            options.mpEventSchema = &schema;
+            testEventGenerator.SetStatus(static_cast<int32_t>(i));
+            NL_TEST_ASSERT(apSuite, logMgmt.LogEvent(&testEventGenerator, options, eid) == CHIP_NO_ERROR);
+            logged[source]++;
+        }
+
+        for (size_t i = 0; i < kSources; i++)
+        {
+            chip::TLV::TLVWriter writer;
+            writer.Init(sReport, sizeof(sReport));
+            NL_TEST_ASSERT(apSuite,
+                           logMgmt.FetchEventsSince(writer, &paths[i], chip::app::PriorityLevel::Info, nextEventNumber[i]) ==
+                               CHIP_NO_ERROR);
+            NL_TEST_ASSERT(apSuite, CountFetchedEvents(apSuite, sReport, writer.GetLengthWritten()) == logged[i]);
+        }
+
+        for (size_t i = 0; i + 1 < kSources; i++)
+        {
+            paths[i].mpNext = &paths[i + 1];
+        }
+        chip::TLV::TLVWriter writer;
+        writer.Init(sReport, sizeof(sReport));
+        NL_TEST_ASSERT(apSuite,
+                       logMgmt.FetchEventsSince(writer, &paths[0], chip::app::PriorityLevel::Info, allNextEventNumber) ==
+                           CHIP_NO_ERROR);
+        allFetched += CountFetchedEvents(apSuite, sReport, writer.GetLengthWritten());
+        for (size_t i = 0; i < kSources; i++)
+        {
+            paths[i].mpNext = nullptr;
+        }
+    }
+
+    NL_TEST_ASSERT(apSuite, allFetched == kRounds * kEventsPerRound);
+
+    chip::app::EventManagement::DestroyEventManagement();
+    InitializeEventLogging();
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
 
 const nlTest sTests[] = { NL_TEST_DEF("CheckLogEventWithEvictToNextBuffer", CheckLogEventWithEvictToNextBuffer),
-                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent), NL_TEST_SENTINEL() };
+                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent),
+                          NL_TEST_DEF("CheckLogReadOutFromIndex", CheckLogReadOutFromIndex),
+                          NL_TEST_DEF("CheckLogReadOutWithPathFilter", CheckLogReadOutWithPathFilter),
+                          NL_TEST_DEF("CheckFetchEventsWithManyPathFilters", CheckFetchEventsWithManyPathFilters),
+                          NL_TEST_SENTINEL() };
 } // namespace
 
 int TestEventLogging()
@@ -0,0 +1,162 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the cache that attribute storage
+ *      keeps of externally stored attribute values.
+ */
+
+#include <app/util/external-attribute-cache.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+namespace chip {
+namespace app {
+namespace {
+
+using TestCache = ExternalAttributeCache<16, 4>;
+
+void TestHitAndMiss(nlTestSuite * inSuite, void * inContext)
+{
+    TestCache cache;
+    uint8_t value[2]  = { 0x12, 0x34 };
+    uint8_t buffer[2] = {};
+
+    NL_TEST_ASSERT(inSuite, !cache.Read(1, 6, 0, buffer, sizeof(buffer)));
+
+    cache.Fill(1, 6, 0, value, sizeof(value), cache.GetVersion());
+    NL_TEST_ASSERT(inSuite, cache.Read(1, 6, 0, buffer, sizeof(buffer)));
+    NL_TEST_ASSERT(inSuite, buffer[0] == 0x12 && buffer[1] == 0x34);
+
+    // The key and the length must both match.
+    NL_TEST_ASSERT(inSuite, !cache.Read(2, 6, 0, buffer, sizeof(buffer)));
+    NL_TEST_ASSERT(inSuite, !cache.Read(1, 6, 0, buffer, 1));
+
+    const ExternalAttributeCacheStatistics & statistics = cache.GetStatistics();
+    NL_TEST_ASSERT(inSuite, statistics.mHits == 1);
+    NL_TEST_ASSERT(inSuite, statistics.mMisses == 3);
+    NL_TEST_ASSERT(inSuite, statistics.mFills == 1);
+
+    cache.ResetStatistics();
+    NL_TEST_ASSERT(inSuite, cache.GetStatistics().mHits == 0 && cache.GetStatistics().mMisses == 0);
+}
+
+void TestInvalidate(nlTestSuite * inSuite, void * inContext)
+{
+    TestCache cache;
+    uint8_t value  = 1;
+    uint8_t buffer = 0;
+
+    cache.Fill(1, 6, 0, &value, 1, cache.GetVersion());
+    cache.Fill(2, 6, 0, &value, 1, cache.GetVersion());
+    cache.Invalidate(1, 6, 0);
+    NL_TEST_ASSERT(inSuite, !cache.Read(1, 6, 0, &buffer, 1));
+    NL_TEST_ASSERT(inSuite, cache.Read(2, 6, 0, &buffer, 1));
+
+    cache.Fill(1, 6, 0, &value, 1, cache.GetVersion());
+    cache.InvalidateEndpoint(2);
+    NL_TEST_ASSERT(inSuite, cache.Read(1, 6, 0, &buffer, 1));
+    NL_TEST_ASSERT(inSuite, !cache.Read(2, 6, 0, &buffer, 1));
+
+    cache.Clear();
+    NL_TEST_ASSERT(inSuite, !cache.Read(1, 6, 0, &buffer, 1));
+    NL_TEST_ASSERT(inSuite, cache.GetStatistics().mInvalidations == 2);
+}
+
+void TestFillAfterChange(nlTestSuite * inSuite, void * inContext)
+{
+    TestCache cache;
+    uint8_t value  = 1;
+    uint8_t buffer = 0;
+
+    // The attribute changes while its old value is being read from the application: that value must not be cached.
+    DataVersion version = cache.GetVersion();
+    cache.Invalidate(1, 6, 0);
+    cache.Fill(1, 6, 0, &value, 1, version);
+    NL_TEST_ASSERT(inSuite, !cache.Read(1, 6, 0, &buffer, 1));
+    NL_TEST_ASSERT(inSuite, cache.GetStatistics().mFills == 0);
+
+    cache.Fill(1, 6, 0, &value, 1, cache.GetVersion());
+    NL_TEST_ASSERT(inSuite, cache.Read(1, 6, 0, &buffer, 1));
+}
+
+void TestValueSize(nlTestSuite * inSuite, void * inContext)
+{
+    TestCache cache;
+    uint8_t value[TestCache::kMaxValueSize + 1]  = { 1, 2, 3, 4, 5 };
+    uint8_t buffer[TestCache::kMaxValueSize + 1] = {};
+
+    cache.Fill(1, 6, 0, value, sizeof(value), cache.GetVersion());
+    NL_TEST_ASSERT(inSuite, !cache.Read(1, 6, 0, buffer, sizeof(buffer)));
+
+    cache.Fill(1, 6, 0, value, TestCache::kMaxValueSize, cache.GetVersion());
+    NL_TEST_ASSERT(inSuite, cache.Read(1, 6, 0, buffer, TestCache::kMaxValueSize));
+    NL_TEST_ASSERT(inSuite, buffer[3] == 4);
+}
+
+void TestEviction(nlTestSuite * inSuite, void * inContext)
+{
+    ExternalAttributeCache<1, 1> cache;
+    uint8_t first  = 1;
+    uint8_t second = 2;
+    uint8_t buffer = 0;
+
+    // With a single slot every attribute maps to the same entry, and the last one filled wins.
+    cache.Fill(1, 6, 0, &first, 1, cache.GetVersion());
+    cache.Fill(1, 8, 0, &second, 1, cache.GetVersion());
+    NL_TEST_ASSERT(inSuite, !cache.Read(1, 6, 0, &buffer, 1));
+    NL_TEST_ASSERT(inSuite, cache.Read(1, 8, 0, &buffer, 1) && buffer == 2);
+
+    // Invalidating the evicted attribute leaves the other one cached.
+    cache.Invalidate(1, 6, 0);
+    NL_TEST_ASSERT(inSuite, cache.Read(1, 8, 0, &buffer, 1));
+}
+
+} // namespace
+} // namespace app
+} // namespace chip
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestHitAndMiss", chip::app::TestHitAndMiss),           //
+    NL_TEST_DEF("TestInvalidate", chip::app::TestInvalidate),           //
+    NL_TEST_DEF("TestFillAfterChange", chip::app::TestFillAfterChange), //
+    NL_TEST_DEF("TestValueSize", chip::app::TestValueSize),             //
+    NL_TEST_DEF("TestEviction", chip::app::TestEviction),               //
+    NL_TEST_SENTINEL(),                                                 //
+};
+
+int TestExternalAttributeCache()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+	{
+        "TestExternalAttributeCache",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestExternalAttributeCache)
@@ -57,6 +57,7 @@ class TestInteractionModelEngine
 {
 public:
     static void TestClusterInfoPushRelease(nlTestSuite * apSuite, void * apContext);
+    static void TestPoolSizes(nlTestSuite * apSuite, void * apContext);
     static int GetClusterInfoListLength(ClusterInfo * apClusterInfoList);
 };
 
@@ -77,6 +78,8 @@ void TestInteractionModelEngine::TestClusterInfoPushRelease(nlTestSuite * apSuit
     CHIP_ERROR err = CHIP_NO_ERROR;
     err            = InteractionModelEngine::GetInstance()->Init(&gExchangeManager, nullptr);
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    TransactionArena arena;
+    size_t numPaths               = 0;
     ClusterInfo * clusterInfoList = nullptr;
     ClusterInfo clusterInfo1;
     ClusterInfo clusterInfo2;
@@ -86,20 +89,85 @@ void TestInteractionModelEngine::TestClusterInfoPushRelease(nlTestSuite * apSuit
     clusterInfo2.mEndpointId = 2;
     clusterInfo3.mEndpointId = 3;
 
-    InteractionModelEngine::GetInstance()->PushFront(clusterInfoList, clusterInfo1);
+    InteractionModelEngine::GetInstance()->PushFront(arena, numPaths, clusterInfoList, clusterInfo1);
     NL_TEST_ASSERT(apSuite, clusterInfoList != nullptr && clusterInfo1.mEndpointId == clusterInfoList->mEndpointId);
     NL_TEST_ASSERT(apSuite, GetClusterInfoListLength(clusterInfoList) == 1);
 
-    InteractionModelEngine::GetInstance()->PushFront(clusterInfoList, clusterInfo2);
+    InteractionModelEngine::GetInstance()->PushFront(arena, numPaths, clusterInfoList, clusterInfo2);
     NL_TEST_ASSERT(apSuite, clusterInfoList != nullptr && clusterInfo2.mEndpointId == clusterInfoList->mEndpointId);
     NL_TEST_ASSERT(apSuite, GetClusterInfoListLength(clusterInfoList) == 2);
 
-    InteractionModelEngine::GetInstance()->PushFront(clusterInfoList, clusterInfo3);
+    InteractionModelEngine::GetInstance()->PushFront(arena, numPaths, clusterInfoList, clusterInfo3);
     NL_TEST_ASSERT(apSuite, clusterInfoList != nullptr && clusterInfo3.mEndpointId == clusterInfoList->mEndpointId);
     NL_TEST_ASSERT(apSuite, GetClusterInfoListLength(clusterInfoList) == 3);
 
-    InteractionModelEngine::GetInstance()->ReleaseClusterInfoList(clusterInfoList);
-    NL_TEST_ASSERT(apSuite, GetClusterInfoListLength(clusterInfoList) == 0);
+    NL_TEST_ASSERT(apSuite, arena.Allocations() == 3 && numPaths == 3);
+    NL_TEST_ASSERT(apSuite, InteractionModelEngine::GetInstance()->GetNumPaths() == 3);
+
+    InteractionModelEngine::GetInstance()->ReleaseClusterInfos(arena, numPaths);
+    NL_TEST_ASSERT(apSuite, arena.Allocations() == 0 && numPaths == 0);
+    NL_TEST_ASSERT(apSuite, InteractionModelEngine::GetInstance()->GetNumPaths() == 0);
+}
+
+void TestInteractionModelEngine::TestPoolSizes(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err                  = CHIP_NO_ERROR;
+    InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+    ClusterInfo * clusterInfoList   = nullptr;
+    InteractionModelPoolSizes sizes;
+    ClusterInfo clusterInfo;
+    TransactionArena arena;
+    TransactionArena otherArena;
+    size_t numPaths      = 0;
+    size_t otherNumPaths = 0;
+
+    sizes.mNumCommandHandlers = 2;
+    sizes.mNumReadHandlers    = 64;
+    sizes.mNumPathGroups      = 3;
+
+    engine->Shutdown();
+    err = engine->Init(&gExchangeManager, nullptr, sizes);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, engine->GetCommandHandlerPool().Capacity() == 2);
+    NL_TEST_ASSERT(apSuite, engine->GetReadHandlerPool().Capacity() == 64);
+    NL_TEST_ASSERT(apSuite, engine->GetReadHandlerPool().Allocated() == 0);
+    NL_TEST_ASSERT(apSuite, engine->GetMaxPaths() == 3);
+
+    // The limit holds over all arenas.
+    for (int i = 0; i < 2; i++)
+    {
+        err = engine->PushFront(arena, numPaths, clusterInfoList, clusterInfo);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    }
+    err = engine->PushFront(otherArena, otherNumPaths, clusterInfoList, clusterInfo);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = engine->PushFront(arena, numPaths, clusterInfoList, clusterInfo);
+    NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_NO_MEMORY);
+    NL_TEST_ASSERT(apSuite, engine->GetNumPaths() == 3);
+
+    engine->ReleaseClusterInfos(arena, numPaths);
+    NL_TEST_ASSERT(apSuite, engine->GetNumPaths() == 1);
+    NL_TEST_ASSERT(apSuite, engine->GetPathsHighWaterMark() == 3);
+
+    // Only the paths of an arena are given back, whatever else it holds.
+    clusterInfoList = nullptr;
+    NL_TEST_ASSERT(apSuite, arena.Allocate(8) != nullptr);
+    err = engine->PushFront(arena, numPaths, clusterInfoList, clusterInfo);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, engine->GetNumPaths() == 2);
+    NL_TEST_ASSERT(apSuite, engine->GetPathsHighWaterMark() == 3);
+    engine->ReleaseClusterInfos(arena, numPaths);
+    NL_TEST_ASSERT(apSuite, engine->GetNumPaths() == 1);
+    engine->ReleaseClusterInfos(otherArena, otherNumPaths);
+    NL_TEST_ASSERT(apSuite, engine->GetNumPaths() == 0);
+
+    // Handlers that were not allocated by the engine are not taken into its pool.
+    ReadHandler readHandler;
+    engine->ReleaseReadHandler(&readHandler);
+    NL_TEST_ASSERT(apSuite, engine->GetReadHandlerPool().Allocated() == 0);
+
+    engine->Shutdown();
+    NL_TEST_ASSERT(apSuite, engine->GetReadHandlerPool().Capacity() == 0);
 }
 } // namespace app
 } // namespace chip
@@ -133,6 +201,7 @@ void InitializeChip(nlTestSuite * apSuite)
 const nlTest sTests[] =
         {
                 NL_TEST_DEF("TestClusterInfoPushRelease", chip::app::TestInteractionModelEngine::TestClusterInfoPushRelease),
+                NL_TEST_DEF("TestPoolSizes", chip::app::TestInteractionModelEngine::TestPoolSizes),
                 NL_TEST_SENTINEL()
         };
 // clang-format on
@@ -86,6 +86,8 @@ class TestReportingEngine
 {
 public:
     static void TestBuildAndSendSingleReportData(nlTestSuite * apSuite, void * apContext);
+    static void TestDirtyAttributePaths(nlTestSuite * apSuite, void * apContext);
+    static void TestChunkedReport(nlTestSuite * apSuite, void * apContext);
 };
 
 class TestExchangeDelegate : public Messaging::ExchangeDelegate
@@ -139,6 +141,176 @@ void TestReportingEngine::TestBuildAndSendSingleReportData(nlTestSuite * apSuite
     err = reportingEngine.BuildAndSendSingleReportData(&readHandler);
     NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_NOT_CONNECTED);
 }
+
+void TestReportingEngine::TestDirtyAttributePaths(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    app::ReadHandler readHandler;
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferHandle readRequestbuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    ReadRequest::Builder readRequestBuilder;
+    AttributePathList::Builder attributePathListBuilder;
+    AttributePath::Builder attributePathBuilder;
+    ClusterInfo * clusterInfo = nullptr;
+    size_t numDirty           = 0;
+
+    err = InteractionModelEngine::GetInstance()->Init(&gExchangeManager, nullptr);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    Engine & reportingEngine                 = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    Messaging::ExchangeContext * exchangeCtx = gExchangeManager.NewContext({ 0, 0, 0 }, nullptr);
+    TestExchangeDelegate delegate;
+    exchangeCtx->SetDelegate(&delegate);
+
+    // Read one attribute of the test cluster, and the whole cluster.
+    writer.Init(std::move(readRequestbuf));
+    err = readRequestBuilder.Init(&writer);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    attributePathListBuilder = readRequestBuilder.CreateAttributePathListBuilder();
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+    attributePathBuilder = attributePathListBuilder.CreateAttributePathBuilder();
+    attributePathBuilder.NodeId(1)
+        .EndpointId(kTestEndpointId)
+        .ClusterId(kTestClusterId)
+        .FieldId(kTestFieldId1)
+        .EndOfAttributePath();
+    NL_TEST_ASSERT(apSuite, attributePathBuilder.GetError() == CHIP_NO_ERROR);
+    attributePathBuilder = attributePathListBuilder.CreateAttributePathBuilder();
+    attributePathBuilder.NodeId(1).EndpointId(kTestEndpointId).ClusterId(kTestClusterId).EndOfAttributePath();
+    NL_TEST_ASSERT(apSuite, attributePathBuilder.GetError() == CHIP_NO_ERROR);
+    attributePathListBuilder.EndOfAttributePathList();
+    readRequestBuilder.EndOfReadRequest();
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+    err = writer.Finalize(&readRequestbuf);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    err = readHandler.OnReadRequest(exchangeCtx, std::move(readRequestbuf));
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // All requested paths are queued for the initial report.
+    while ((clusterInfo = readHandler.PopDirtyAttributeClusterInfo()) != nullptr)
+    {
+        clusterInfo->ClearDirty();
+        numDirty++;
+    }
+    NL_TEST_ASSERT(apSuite, numDirty == 2);
+
+    // Repeated changes to the same attribute are merged; changes nobody is interested in are dropped.
+    reportingEngine.SetDirty(kTestEndpointId, kTestClusterId, kTestFieldId2);
+    reportingEngine.SetDirty(kTestEndpointId, kTestClusterId, kTestFieldId2);
+    reportingEngine.SetDirty(kTestEndpointId, kTestClusterId + 1, kTestFieldId1);
+    NL_TEST_ASSERT(apSuite, reportingEngine.mNumDirtyPaths == 2);
+    NL_TEST_ASSERT(apSuite, reportingEngine.GetDirtyVersion() == 3);
+    NL_TEST_ASSERT(apSuite, reportingEngine.mDirtyPaths[0].mAttributeId == kTestFieldId2);
+
+    reportingEngine.ProcessDirtyPaths();
+    NL_TEST_ASSERT(apSuite, reportingEngine.mNumDirtyPaths == 0);
+    clusterInfo = readHandler.PopDirtyAttributeClusterInfo();
+    NL_TEST_ASSERT(apSuite, clusterInfo != nullptr && !clusterInfo->mFlags.Has(ClusterInfo::Flags::kFieldIdValid));
+    NL_TEST_ASSERT(apSuite, readHandler.PopDirtyAttributeClusterInfo() == nullptr);
+    clusterInfo->ClearDirty();
+
+    // A change to the attribute read on its own is reported through both paths.
+    reportingEngine.SetDirty(kTestEndpointId, kTestClusterId, kTestFieldId1);
+    reportingEngine.ProcessDirtyPaths();
+    numDirty = 0;
+    clusterInfo = readHandler.GetDirtyAttributeClusterInfolist();
+    while (clusterInfo != nullptr)
+    {
+        numDirty++;
+        clusterInfo = clusterInfo->mpNextDirty;
+    }
+    NL_TEST_ASSERT(apSuite, numDirty == 2);
+
+    // Once the handler is gone, its paths are no longer matched.
+    readHandler.Shutdown();
+    for (ClusterInfo * bucket : reportingEngine.mInterestBuckets)
+    {
+        NL_TEST_ASSERT(apSuite, bucket == nullptr);
+    }
+}
+
+void TestReportingEngine::TestChunkedReport(nlTestSuite * apSuite, void * apContext)
+{
+    constexpr size_t kNumPaths = 64;
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    app::ReadHandler readHandler;
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferHandle readRequestbuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    ReadRequest::Builder readRequestBuilder;
+    AttributePathList::Builder attributePathListBuilder;
+    InteractionModelPoolSizes sizes;
+    size_t numChunks     = 0;
+    size_t numAttributes = 0;
+    bool moreChunks      = true;
+
+    sizes.mNumPathGroups = kNumPaths;
+    err                  = InteractionModelEngine::GetInstance()->Init(&gExchangeManager, nullptr, sizes);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    Engine & reportingEngine                 = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    Messaging::ExchangeContext * exchangeCtx = gExchangeManager.NewContext({ 0, 0, 0 }, nullptr);
+    TestExchangeDelegate delegate;
+    exchangeCtx->SetDelegate(&delegate);
+
+    // Read more attributes than fit in one message.
+    writer.Init(std::move(readRequestbuf));
+    err = readRequestBuilder.Init(&writer);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    attributePathListBuilder = readRequestBuilder.CreateAttributePathListBuilder();
+    for (size_t i = 0; i < kNumPaths; i++)
+    {
+        AttributePath::Builder attributePathBuilder = attributePathListBuilder.CreateAttributePathBuilder();
+        attributePathBuilder.NodeId(1)
+            .EndpointId(kTestEndpointId)
+            .ClusterId(kTestClusterId)
+            .FieldId(static_cast<FieldId>(i))
+            .EndOfAttributePath();
+        NL_TEST_ASSERT(apSuite, attributePathBuilder.GetError() == CHIP_NO_ERROR);
+    }
+    attributePathListBuilder.EndOfAttributePathList();
+    readRequestBuilder.EndOfReadRequest();
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+    err = writer.Finalize(&readRequestbuf);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    err = readHandler.OnReadRequest(exchangeCtx, std::move(readRequestbuf));
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // Each chunk fits in a message and says whether another follows; together they hold every attribute once.
+    while (moreChunks && numChunks <= kNumPaths)
+    {
+        System::PacketBufferHandle report;
+        System::PacketBufferTLVReader reader;
+        ReportData::Parser reportParser;
+        AttributeDataList::Parser attributeDataListParser;
+        TLV::TLVReader attributeDataListReader;
+
+        err = reportingEngine.BuildSingleReportData(&readHandler, report);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, report->TotalLength() <= Engine::kMaxReportDataLengthBytes);
+        numChunks++;
+
+        reader.Init(std::move(report));
+        NL_TEST_ASSERT(apSuite, reader.Next() == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, reportParser.Init(reader) == CHIP_NO_ERROR);
+        moreChunks = false;
+        err        = reportParser.GetMoreChunkedMessages(&moreChunks);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV);
+        NL_TEST_ASSERT(apSuite, moreChunks == reportingEngine.mMoreChunkedMessages);
+
+        NL_TEST_ASSERT(apSuite, reportParser.GetAttributeDataList(&attributeDataListParser) == CHIP_NO_ERROR);
+        attributeDataListParser.GetReader(&attributeDataListReader);
+        while (attributeDataListReader.Next() == CHIP_NO_ERROR)
+        {
+            numAttributes++;
+        }
+    }
+    NL_TEST_ASSERT(apSuite, numChunks > 1);
+    NL_TEST_ASSERT(apSuite, numAttributes == kNumPaths);
+    NL_TEST_ASSERT(apSuite, readHandler.GetDirtyAttributeClusterInfolist() == nullptr);
+
+    readHandler.Shutdown();
+}
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -173,6 +345,8 @@ void InitializeChip(nlTestSuite * apSuite)
 const nlTest sTests[] =
         {
                 NL_TEST_DEF("CheckBuildAndSendSingleReportData", chip::app::reporting::TestReportingEngine::TestBuildAndSendSingleReportData),
+                NL_TEST_DEF("CheckDirtyAttributePaths", chip::app::reporting::TestReportingEngine::TestDirtyAttributePaths),
+                NL_TEST_DEF("CheckChunkedReport", chip::app::reporting::TestReportingEngine::TestChunkedReport),
                 NL_TEST_SENTINEL()
         };
 // clang-format on
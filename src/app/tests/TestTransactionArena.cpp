@@ -0,0 +1,160 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the arena that Interaction Model
+ *      handlers allocate the state of an interaction from.
+ */
+
+#include <app/TransactionArena.h>
+#include <support/CHIPMem.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+namespace {
+
+struct TestObject
+{
+    uint64_t mValue;
+    uint8_t mTag;
+};
+
+void TestAllocate(nlTestSuite * inSuite, void * inContext)
+{
+    TransactionArena arena(64);
+
+    uint8_t * byte = static_cast<uint8_t *>(arena.Allocate(1, 1));
+    NL_TEST_ASSERT(inSuite, byte != nullptr);
+
+    // Later allocations are aligned as asked, after the earlier ones.
+    uint64_t * word = static_cast<uint64_t *>(arena.Allocate(sizeof(uint64_t), alignof(uint64_t)));
+    NL_TEST_ASSERT(inSuite, word != nullptr && reinterpret_cast<uintptr_t>(word) % alignof(uint64_t) == 0);
+    NL_TEST_ASSERT(inSuite, reinterpret_cast<uint8_t *>(word) > byte);
+
+    TestObject * object = arena.New(TestObject{ 42, 7 });
+    NL_TEST_ASSERT(inSuite, object != nullptr && object->mValue == 42 && object->mTag == 7);
+
+    NL_TEST_ASSERT(inSuite, arena.Allocations() == 3);
+    NL_TEST_ASSERT(inSuite, arena.BytesAllocated() == 1 + sizeof(uint64_t) + sizeof(TestObject));
+
+    NL_TEST_ASSERT(inSuite, arena.Allocate(1, 3) == nullptr);
+    NL_TEST_ASSERT(inSuite, arena.Allocations() == 3);
+}
+
+void TestReset(nlTestSuite * inSuite, void * inContext)
+{
+    TransactionArena arena(64);
+    void * first[4];
+    void * again[4];
+
+    // Fill more than one block.
+    for (void *& p : first)
+    {
+        p = arena.Allocate(40);
+        NL_TEST_ASSERT(inSuite, p != nullptr);
+    }
+    NL_TEST_ASSERT(inSuite, arena.HighWaterMark() == 160);
+
+    // After a reset, the same blocks are handed out again in the same order.
+    arena.Reset();
+    NL_TEST_ASSERT(inSuite, arena.Allocations() == 0 && arena.BytesAllocated() == 0);
+    for (void *& p : again)
+    {
+        p = arena.Allocate(40);
+    }
+    for (size_t i = 0; i < 4; i++)
+    {
+        NL_TEST_ASSERT(inSuite, again[i] == first[i]);
+    }
+
+    arena.Reset();
+    NL_TEST_ASSERT(inSuite, arena.Allocate(8) == first[0]);
+    NL_TEST_ASSERT(inSuite, arena.HighWaterMark() == 160);
+
+    arena.Release();
+    NL_TEST_ASSERT(inSuite, arena.Allocations() == 0);
+    NL_TEST_ASSERT(inSuite, arena.Allocate(8) != nullptr);
+}
+
+void TestLargeAllocation(nlTestSuite * inSuite, void * inContext)
+{
+    TransactionArena arena(64);
+
+    void * small = arena.Allocate(16);
+    NL_TEST_ASSERT(inSuite, small != nullptr);
+
+    // An allocation larger than a block gets a block of its own.
+    uint8_t * large = static_cast<uint8_t *>(arena.Allocate(1000));
+    NL_TEST_ASSERT(inSuite, large != nullptr);
+    memset(large, 0xA5, 1000);
+
+    void * next = arena.Allocate(16);
+    NL_TEST_ASSERT(inSuite, next != nullptr && (next < large || next >= large + 1000));
+
+    // The small block and the large one both serve allocations after a reset.
+    arena.Reset();
+    NL_TEST_ASSERT(inSuite, arena.Allocate(16) == small);
+    NL_TEST_ASSERT(inSuite, arena.Allocate(1000) == large);
+}
+
+int TestSetup(void * inContext)
+{
+    return (Platform::MemoryInit() == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int TestTeardown(void * inContext)
+{
+    Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+} // namespace app
+} // namespace chip
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestAllocate", chip::app::TestAllocate),               //
+    NL_TEST_DEF("TestReset", chip::app::TestReset),                     //
+    NL_TEST_DEF("TestLargeAllocation", chip::app::TestLargeAllocation), //
+    NL_TEST_SENTINEL(),                                                 //
+};
+
+int TestTransactionArena()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+	{
+        "TestTransactionArena",
+        &sTests[0],
+        chip::app::TestSetup,
+        chip::app::TestTeardown
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestTransactionArena)
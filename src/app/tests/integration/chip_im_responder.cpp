@@ -50,6 +50,11 @@ bool ServerClusterCommandExists(chip::ClusterId aClusterId, chip::CommandId aCom
     return (aEndPointId == kTestEndpointId && aClusterId == kTestClusterId && aCommandId == kTestCommandId);
 }
 
+bool ServerClusterAcceptsCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId)
+{
+    return (aClusterId == kTestClusterId && aCommandId == kTestCommandId);
+}
+
 void DispatchSingleClusterCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId, chip::EndpointId aEndPointId,
                                   chip::TLV::TLVReader & aReader, CommandHandler * apCommandObj)
 {
@@ -121,6 +126,13 @@ exit:
     return err;
 }
 
+CHIP_ERROR ReadClusterData(ClusterInfo & aClusterInfo, AttributeDataList::Builder & aAttributeDataList, size_t & aNumElements)
+{
+    // No whole-cluster reads are expected, report no attributes.
+    aNumElements = 0;
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR WriteSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVReader & aReader, WriteHandler * apWriteHandler)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -0,0 +1,91 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the AttributeIndex class.
+ */
+
+#include <app/util/attribute-index.h>
+
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/HashUtils.h>
+
+namespace chip {
+namespace app {
+
+CHIP_ERROR AttributeIndex::Init(size_t capacity)
+{
+    Shutdown();
+
+    // Keep at least half of the slots empty, so that probe sequences stay short.
+    size_t slotCount = 1;
+    while (slotCount < 2 * capacity + 1)
+    {
+        slotCount <<= 1;
+    }
+
+    mSlots = static_cast<Entry *>(Platform::MemoryCalloc(slotCount, sizeof(Entry)));
+    VerifyOrReturnError(mSlots != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    for (size_t i = 0; i < slotCount; i++)
+    {
+        mSlots[i].mEndpointIndex = kInvalidIndex;
+    }
+    mMask     = slotCount - 1;
+    mCapacity = capacity;
+    return CHIP_NO_ERROR;
+}
+
+void AttributeIndex::Shutdown()
+{
+    Platform::MemoryFree(mSlots);
+    mSlots    = nullptr;
+    mMask     = 0;
+    mCapacity = 0;
+    mCount    = 0;
+}
+
+CHIP_ERROR AttributeIndex::Add(const Entry & entry)
+{
+    VerifyOrReturnError(mSlots != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mCount < mCapacity, CHIP_ERROR_NO_MEMORY);
+
+    // Entries are never removed, so the first empty slot is after every entry with the same key.
+    size_t i = Hash(entry.mEndpointId, entry.mClusterId, entry.mAttributeId) & mMask;
+    while (mSlots[i].mEndpointIndex != kInvalidIndex)
+    {
+        i = (i + 1) & mMask;
+    }
+
+    mSlots[i] = entry;
+    mCount++;
+    return CHIP_NO_ERROR;
+}
+
+uint32_t AttributeIndex::Hash(EndpointId endpoint, ClusterId cluster, AttributeId attribute)
+{
+    uint64_t key = (static_cast<uint64_t>(cluster) << 32) | attribute;
+    key ^= static_cast<uint64_t>(endpoint) * 0x9E3779B97F4A7C15ULL;
+
+    // Mix the key, so that every key bit affects the low bits used to pick a slot.
+    return static_cast<uint32_t>(MixBits64(key));
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,130 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the index that attribute storage uses to find the
+ *      metadata and storage offset of an attribute without walking all
+ *      endpoints and clusters.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <app/util/basic-types.h>
+#include <core/CHIPError.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * @class AttributeIndex
+ *
+ * @brief
+ *  An open-addressing hash table of the attributes of all endpoints, keyed by (endpoint, cluster, attribute).
+ *
+ *  Each entry records where the attribute's metadata lives in the endpoint table and where its value lives in attribute
+ *  storage. Several entries may share a key, e.g. the client and server side of a cluster, or manufacturer-specific
+ *  attributes with the same ID; Find() hands them to the caller in the order they were added, so that the caller can apply
+ *  the cluster mask and manufacturer code checks and keeps the first match.
+ *
+ *  Entries cannot be removed; the index is cleared and refilled when the endpoint table changes in other ways than by
+ *  adding endpoints.
+ */
+class AttributeIndex
+{
+public:
+    static constexpr uint16_t kInvalidIndex = UINT16_MAX;
+
+    struct Entry
+    {
+        EndpointId mEndpointId;
+        ClusterId mClusterId;
+        AttributeId mAttributeId;
+        uint16_t mEndpointIndex; ///< Index into the endpoint table; kInvalidIndex marks an empty slot.
+        uint16_t mAttributeIndex;
+        uint16_t mOffset; ///< Offset of the value in attribute storage, for attributes stored there.
+        uint8_t mClusterIndex;
+    };
+
+    AttributeIndex() = default;
+
+    AttributeIndex(const AttributeIndex &) = delete;
+    AttributeIndex & operator=(const AttributeIndex &) = delete;
+
+    /**
+     * Allocate an empty index with room for @p capacity entries. Any entries already in the index are dropped.
+     *
+     * @retval CHIP_ERROR_NO_MEMORY The slots could not be allocated; the index is left uninitialized.
+     */
+    CHIP_ERROR Init(size_t capacity);
+
+    /**
+     * Free the slots. The index must be initialized again before it is used.
+     */
+    void Shutdown();
+
+    /**
+     * Add @p entry, after all entries with the same key that are already in the index.
+     *
+     * @retval CHIP_ERROR_INCORRECT_STATE The index is not initialized.
+     * @retval CHIP_ERROR_NO_MEMORY       The index already holds as many entries as it was initialized for.
+     */
+    CHIP_ERROR Add(const Entry & entry);
+
+    /**
+     * Call @p function on each entry indexed under (@p endpoint, @p cluster, @p attribute), in the order they were added,
+     * until it returns true.
+     *
+     * @return The entry for which @p function returned true, or nullptr.
+     */
+    template <typename Function>
+    const Entry * Find(EndpointId endpoint, ClusterId cluster, AttributeId attribute, Function && function) const
+    {
+        if (mSlots == nullptr)
+        {
+            return nullptr;
+        }
+
+        for (size_t i = Hash(endpoint, cluster, attribute) & mMask; mSlots[i].mEndpointIndex != kInvalidIndex; i = (i + 1) & mMask)
+        {
+            const Entry & entry = mSlots[i];
+            if (entry.mEndpointId == endpoint && entry.mClusterId == cluster && entry.mAttributeId == attribute && function(entry))
+            {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    bool IsInitialized() const { return mSlots != nullptr; }
+    size_t Capacity() const { return mCapacity; }
+    size_t Count() const { return mCount; }
+
+private:
+    static uint32_t Hash(EndpointId endpoint, ClusterId cluster, AttributeId attribute);
+
+    Entry * mSlots   = nullptr;
+    size_t mMask     = 0;
+    size_t mCapacity = 0;
+    size_t mCount    = 0;
+};
+
+} // namespace app
+} // namespace chip
@@ -41,12 +41,14 @@
 
 #include "app/util/common.h"
 #include <app/util/af.h>
+#include <app/util/attribute-index.h>
 #include <app/util/attribute-storage.h>
 
 #include <app/common/gen/attribute-type.h>
 #include <app/common/gen/callback.h>
 
 using namespace chip;
+using chip::app::AttributeIndex;
 
 //------------------------------------------------------------------------------
 // Globals
@@ -71,6 +73,20 @@ uint8_t singletonAttributeData[ACTUAL_SINGLETONS_SIZE];
 
 uint16_t emberEndpointCount = 0;
 
+#if CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX
+// Finds attributes by (endpoint, cluster, attribute) for emAfReadOrWriteAttribute. While it is not initialized, that
+// function walks the endpoint table instead.
+static AttributeIndex sAttributeIndex;
+#endif
+
+#if CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_SIZE > 0
+static chip::app::ExternalAttributeCache<CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_SIZE,
+                                         CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_MAX_VALUE_SIZE>
+    sExternalAttributeCache;
+#else
+static const chip::app::ExternalAttributeCacheStatistics sExternalAttributeCacheStatistics;
+#endif
+
 // If we have attributes that are more than 2 bytes, then
 // we need this data block for the defaults
 #if (defined(GENERATED_DEFAULTS) && GENERATED_DEFAULTS_COUNT)
@@ -115,6 +131,13 @@ const uint16_t attributeManufacturerCodeCount                   = GENERATED_ATTR
 // Returns endpoint index within a given cluster
 static uint16_t findClusterEndpointIndex(EndpointId endpoint, ClusterId clusterId, uint8_t mask, uint16_t manufacturerCode);
 
+static uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints);
+
+#if CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX
+static void rebuildAttributeIndex(size_t minCapacity);
+static CHIP_ERROR addEndpointToAttributeIndex(uint16_t endpointIndex);
+#endif
+
 #ifdef ZCL_USING_DESCRIPTOR_CLUSTER_SERVER
 void emberAfPluginDescriptorServerInitCallback(void);
 #endif
@@ -152,6 +175,24 @@ void emberAfEndpointConfigure(void)
                sizeof(EmberAfDefinedEndpoint) * (MAX_ENDPOINT_COUNT - FIXED_ENDPOINT_COUNT));
     }
 #endif
+
+#if CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX
+    rebuildAttributeIndex(0);
+#endif
+}
+
+void emAfShutdownAttributeIndex(void)
+{
+#if CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX
+    sAttributeIndex.Shutdown();
+#endif
+}
+
+void emAfRebuildAttributeIndex(void)
+{
+#if CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX
+    rebuildAttributeIndex(0);
+#endif
 }
 
 void emberAfSetDynamicEndpointCount(uint16_t dynamicEndpointCount)
@@ -198,6 +239,18 @@ EmberAfStatus emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, EmberAfEn
     emAfEndpoints[index].networkIndex  = 0;
     emAfEndpoints[index].bitmask       = EMBER_AF_ENDPOINT_ENABLED;
 
+#if CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_SIZE > 0
+    sExternalAttributeCache.InvalidateEndpoint(id);
+#endif
+
+#if CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX
+    if (addEndpointToAttributeIndex(index) != CHIP_NO_ERROR)
+    {
+        // Grow the index geometrically, so that adding many endpoints one by one does not rebuild it each time.
+        rebuildAttributeIndex(2 * sAttributeIndex.Capacity());
+    }
+#endif
+
     emberAfSetDynamicEndpointCount(MAX_ENDPOINT_COUNT - FIXED_ENDPOINT_COUNT);
     emberAfSetDeviceEnabled(id, true);
 
@@ -223,6 +276,12 @@ EndpointId emberAfClearDynamicEndpoint(uint16_t index)
             emberAfSetDeviceEnabled(ep, false);
             emAfEndpoints[index].endpoint = 0;
             emAfEndpoints[index].bitmask  = 0;
+#if CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX
+            rebuildAttributeIndex(sAttributeIndex.Capacity());
+#endif
+#if CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_SIZE > 0
+            sExternalAttributeCache.InvalidateEndpoint(ep);
+#endif
         }
 
 #ifdef ZCL_USING_DESCRIPTOR_CLUSTER_SERVER
@@ -593,6 +652,208 @@ bool emAfMatchAttribute(EmberAfCluster * cluster, EmberAfAttributeMetadata * am,
              (emAfGetManufacturerCodeForAttribute(cluster, am) == attRecord->manufacturerCode)));
 }
 
+// Offset in attribute storage of the first attribute of the endpoint at endpointIndex. Only fixed endpoints take up
+// storage, so all dynamic endpoints start after the last fixed one.
+static uint16_t endpointStorageOffset(uint16_t endpointIndex)
+{
+    uint16_t offset = 0;
+    for (uint16_t i = 0; i < endpointIndex && i < emberAfFixedEndpointCount(); i++)
+    {
+        offset = static_cast<uint16_t>(offset + emAfEndpoints[i].endpointType->endpointSize);
+    }
+    return offset;
+}
+
+#if CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX
+static CHIP_ERROR addEndpointToAttributeIndex(uint16_t endpointIndex)
+{
+    EmberAfEndpointType * endpointType = emAfEndpoints[endpointIndex].endpointType;
+    uint16_t clusterOffset             = endpointStorageOffset(endpointIndex);
+
+    for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    {
+        EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+        uint16_t attributeOffset = clusterOffset;
+        for (uint16_t attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+        {
+            EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+            AttributeIndex::Entry entry;
+            entry.mEndpointId     = emAfEndpoints[endpointIndex].endpoint;
+            entry.mClusterId      = cluster->clusterId;
+            entry.mAttributeId    = am->attributeId;
+            entry.mEndpointIndex  = endpointIndex;
+            entry.mAttributeIndex = attrIndex;
+            entry.mOffset         = attributeOffset;
+            entry.mClusterIndex   = clusterIndex;
+            ReturnErrorOnFailure(sAttributeIndex.Add(entry));
+
+            // Externally stored and singleton attributes do not take up space in the endpoint's storage.
+            if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
+            {
+                attributeOffset = static_cast<uint16_t>(attributeOffset + emberAfAttributeSize(am));
+            }
+        }
+        clusterOffset = static_cast<uint16_t>(clusterOffset + cluster->clusterSize);
+    }
+    return CHIP_NO_ERROR;
+}
+
+// Refills the attribute index from the endpoint table, with room for at least minCapacity attributes. If that fails,
+// the index is left uninitialized and attributes are found by walking the endpoint table.
+static void rebuildAttributeIndex(size_t minCapacity)
+{
+    size_t attributeCount = 0;
+    for (uint16_t i = 0; i < MAX_ENDPOINT_COUNT; i++)
+    {
+        EmberAfEndpointType * endpointType = emAfEndpoints[i].endpointType;
+        if (endpointType == NULL || (i >= emberAfFixedEndpointCount() && emAfEndpoints[i].endpoint == 0))
+        {
+            continue;
+        }
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+        {
+            attributeCount += endpointType->cluster[clusterIndex].attributeCount;
+        }
+    }
+
+    CHIP_ERROR err = sAttributeIndex.Init(attributeCount > minCapacity ? attributeCount : minCapacity);
+    for (uint16_t i = 0; err == CHIP_NO_ERROR && i < MAX_ENDPOINT_COUNT; i++)
+    {
+        if (emAfEndpoints[i].endpointType != NULL && (i < emberAfFixedEndpointCount() || emAfEndpoints[i].endpoint != 0))
+        {
+            err = addEndpointToAttributeIndex(i);
+        }
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Zcl, "Failed to index %u attributes: %s", static_cast<unsigned>(attributeCount), chip::ErrorStr(err));
+        sAttributeIndex.Shutdown();
+    }
+}
+
+// Whether the indexed attribute is the one attRecord asks for, as the walk in emAfReadOrWriteAttribute would decide.
+static bool attributeIndexEntryMatches(const AttributeIndex::Entry & entry, EmberAfAttributeSearchRecord * attRecord)
+{
+    if (entry.mEndpointIndex >= emberAfEndpointCount() || !emberAfEndpointIndexIsEnabled(entry.mEndpointIndex) ||
+        emAfEndpoints[entry.mEndpointIndex].endpoint != attRecord->endpoint)
+    {
+        return false;
+    }
+
+    EmberAfCluster * cluster = &(emAfEndpoints[entry.mEndpointIndex].endpointType->cluster[entry.mClusterIndex]);
+    return emAfMatchCluster(cluster, attRecord) &&
+        emAfMatchAttribute(cluster, &(cluster->attributes[entry.mAttributeIndex]), attRecord);
+}
+#endif // CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX
+
+static EmberAfStatus readExternalAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfCluster * cluster,
+                                           EmberAfAttributeMetadata * am, uint8_t * buffer, int32_t index)
+{
+    const uint16_t manufacturerCode = emAfGetManufacturerCodeForAttribute(cluster, am);
+    const uint16_t size             = emberAfAttributeSize(am);
+
+#if CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_SIZE > 0
+    // Only whole values of standard attributes are cached, as emberAfExternalAttributeChanged does not take a list index or
+    // manufacturer code.
+    if (index == -1 && manufacturerCode == EMBER_AF_NULL_MANUFACTURER_CODE &&
+        size <= decltype(sExternalAttributeCache)::kMaxValueSize)
+    {
+        if (sExternalAttributeCache.Read(attRecord->endpoint, attRecord->clusterId, am->attributeId, buffer, size))
+        {
+            return EMBER_ZCL_STATUS_SUCCESS;
+        }
+
+        const DataVersion version = sExternalAttributeCache.GetVersion();
+        EmberAfStatus status      = emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am,
+                                                                         manufacturerCode, buffer, size, index);
+        if (status == EMBER_ZCL_STATUS_SUCCESS)
+        {
+            sExternalAttributeCache.Fill(attRecord->endpoint, attRecord->clusterId, am->attributeId, buffer, size, version);
+        }
+        return status;
+    }
+#endif
+
+    return emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am, manufacturerCode, buffer, size,
+                                                index);
+}
+
+static EmberAfStatus writeExternalAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfCluster * cluster,
+                                            EmberAfAttributeMetadata * am, uint8_t * buffer, int32_t index)
+{
+#if CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_SIZE > 0
+    // Drop the cached value even if the write fails, as the application may have changed part of it.
+    sExternalAttributeCache.Invalidate(attRecord->endpoint, attRecord->clusterId, am->attributeId);
+#endif
+
+    return emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am,
+                                                 emAfGetManufacturerCodeForAttribute(cluster, am), buffer, index);
+}
+
+void emberAfExternalAttributeChanged(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
+{
+#if CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_SIZE > 0
+    sExternalAttributeCache.Invalidate(endpoint, clusterId, attributeId);
+#endif
+}
+
+const chip::app::ExternalAttributeCacheStatistics & emberAfGetExternalAttributeCacheStatistics(void)
+{
+#if CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_SIZE > 0
+    return sExternalAttributeCache.GetStatistics();
+#else
+    return sExternalAttributeCacheStatistics;
+#endif
+}
+
+// Reads or writes the attribute am of cluster, stored at attributeOffsetIndex unless it is external or a singleton.
+static EmberAfStatus readOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfCluster * cluster,
+                                          EmberAfAttributeMetadata * am, uint16_t attributeOffsetIndex,
+                                          EmberAfAttributeMetadata ** metadata, uint8_t * buffer, uint16_t readLength, bool write,
+                                          int32_t index)
+{
+    // If passed metadata location is not null, populate
+    if (metadata != NULL)
+    {
+        *metadata = am;
+    }
+
+    uint8_t * attributeLocation =
+        (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am) : attributeData + attributeOffsetIndex);
+    uint8_t *src, *dst;
+    if (write)
+    {
+        src = buffer;
+        dst = attributeLocation;
+        if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
+                                                 emAfGetManufacturerCodeForAttribute(cluster, am), am->attributeId))
+        {
+            return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
+        }
+    }
+    else
+    {
+        if (buffer == NULL)
+        {
+            return EMBER_ZCL_STATUS_SUCCESS;
+        }
+
+        src = attributeLocation;
+        dst = buffer;
+        if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
+                                                emAfGetManufacturerCodeForAttribute(cluster, am), am->attributeId))
+        {
+            return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
+        }
+    }
+
+    return (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE
+                ? (write) ? writeExternalAttribute(attRecord, cluster, am, buffer, index)
+                          : readExternalAttribute(attRecord, cluster, am, buffer, index)
+                : typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength, index));
+}
+
 // When reading non-string attributes, this function returns an error when destination
 // buffer isn't large enough to accommodate the attribute type.  For strings, the
 // function will copy at most readLength bytes.  This means the resulting string
@@ -612,6 +873,23 @@ EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord,
     uint8_t i;
     uint16_t attributeOffsetIndex = 0;
 
+#if CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX
+    if (sAttributeIndex.IsInitialized())
+    {
+        const AttributeIndex::Entry * entry = sAttributeIndex.Find(
+            attRecord->endpoint, attRecord->clusterId, attRecord->attributeId,
+            [attRecord](const AttributeIndex::Entry & candidate) { return attributeIndexEntryMatches(candidate, attRecord); });
+        if (entry == nullptr)
+        {
+            return EMBER_ZCL_STATUS_UNSUPPORTED_ATTRIBUTE; // Sorry, attribute was not found.
+        }
+
+        EmberAfCluster * cluster = &(emAfEndpoints[entry->mEndpointIndex].endpointType->cluster[entry->mClusterIndex]);
+        return readOrWriteAttribute(attRecord, cluster, &(cluster->attributes[entry->mAttributeIndex]), entry->mOffset, metadata,
+                                    buffer, readLength, write, index);
+    }
+#endif
+
     for (i = 0; i < emberAfEndpointCount(); i++)
     {
         if (emAfEndpoints[i].endpoint == attRecord->endpoint)
@@ -633,55 +911,8 @@ EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord,
                         EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
                         if (emAfMatchAttribute(cluster, am, attRecord))
                         { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != NULL)
-                            {
-                                *metadata = am;
-                            }
-
-                            {
-                                uint8_t * attributeLocation =
-                                    (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am)
-                                                                         : attributeData + attributeOffsetIndex);
-                                uint8_t *src, *dst;
-                                if (write)
-                                {
-                                    src = buffer;
-                                    dst = attributeLocation;
-                                    if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                             emAfGetManufacturerCodeForAttribute(cluster, am),
-                                                                             am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
-                                    }
-                                }
-                                else
-                                {
-                                    if (buffer == NULL)
-                                    {
-                                        return EMBER_ZCL_STATUS_SUCCESS;
-                                    }
-
-                                    src = attributeLocation;
-                                    dst = buffer;
-                                    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                            emAfGetManufacturerCodeForAttribute(cluster, am),
-                                                                            am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
-                                    }
-                                }
-
-                                return (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE
-                                            ? (write) ? emberAfExternalAttributeWriteCallback(
-                                                            attRecord->endpoint, attRecord->clusterId, am,
-                                                            emAfGetManufacturerCodeForAttribute(cluster, am), buffer, index)
-                                                      : emberAfExternalAttributeReadCallback(
-                                                            attRecord->endpoint, attRecord->clusterId, am,
-                                                            emAfGetManufacturerCodeForAttribute(cluster, am), buffer,
-                                                            emberAfAttributeSize(am), index)
-                                            : typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength, index));
-                            }
+                            return readOrWriteAttribute(attRecord, cluster, am, attributeOffsetIndex, metadata, buffer, readLength,
+                                                        write, index);
                         }
                         else
                         { // Not the attribute we are looking for
@@ -711,6 +942,61 @@ EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord,
     return EMBER_ZCL_STATUS_UNSUPPORTED_ATTRIBUTE; // Sorry, attribute was not found.
 }
 
+EmberAfStatus emberAfReadServerClusterAttributes(EndpointId endpoint, ClusterId clusterId, uint16_t startIndex, uint8_t * buffer,
+                                                 uint16_t bufferSize, EmberAfClusterAttributeCallback callback, void * context)
+{
+    EmberAfAttributeSearchRecord record;
+    record.endpoint         = endpoint;
+    record.clusterId        = clusterId;
+    record.clusterMask      = CLUSTER_MASK_SERVER;
+    record.attributeId      = 0;
+    record.manufacturerCode = EMBER_AF_NULL_MANUFACTURER_CODE;
+
+    uint16_t endpointIndex = findIndexFromEndpoint(endpoint, true /* ignoreDisabledEndpoints */);
+    if (endpointIndex == 0xFFFF)
+    {
+        return EMBER_ZCL_STATUS_UNSUPPORTED_CLUSTER;
+    }
+
+    EmberAfEndpointType * endpointType = emAfEndpoints[endpointIndex].endpointType;
+    EmberAfCluster * cluster           = NULL;
+    uint16_t attributeOffset           = endpointStorageOffset(endpointIndex);
+    for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    {
+        if (emAfMatchCluster(&(endpointType->cluster[clusterIndex]), &record))
+        {
+            cluster = &(endpointType->cluster[clusterIndex]);
+            break;
+        }
+        attributeOffset = static_cast<uint16_t>(attributeOffset + endpointType->cluster[clusterIndex].clusterSize);
+    }
+    if (cluster == NULL)
+    {
+        return EMBER_ZCL_STATUS_UNSUPPORTED_CLUSTER;
+    }
+
+    for (uint16_t attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+    {
+        EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+        record.attributeId            = am->attributeId;
+        if (attrIndex >= startIndex && emAfMatchAttribute(cluster, am, &record))
+        {
+            EmberAfStatus status = readOrWriteAttribute(&record, cluster, am, attributeOffset, NULL, buffer, bufferSize, false, -1);
+            if (!callback(context, attrIndex, am, status))
+            {
+                break;
+            }
+        }
+
+        // Externally stored and singleton attributes do not take up space in the endpoint's storage.
+        if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
+        {
+            attributeOffset = static_cast<uint16_t>(attributeOffset + emberAfAttributeSize(am));
+        }
+    }
+    return EMBER_ZCL_STATUS_SUCCESS;
+}
+
 // Check if a cluster is implemented or not. If yes, the cluster is returned.
 // If the cluster is not manufacturerSpecific [ClusterId < FC00] then
 // manufacturerCode argument is ignored otherwise checked.
@@ -73,6 +73,7 @@
 #endif
 
 #include <app/common/gen/attribute-type.h>
+#include <app/util/external-attribute-cache.h>
 
 #define DECLARE_DYNAMIC_ENDPOINT(endpointName, clusterList)                                                                        \
     EmberAfEndpointType endpointName = { clusterList, sizeof(clusterList) / sizeof(EmberAfCluster), 0 }
@@ -119,12 +120,33 @@ void emAfCallInits(void);
 
 // Initial configuration
 void emberAfEndpointConfigure(void);
+
+// Frees the attribute index, if there is one. Until the endpoint table changes next, emAfReadOrWriteAttribute finds
+// attributes by walking the endpoint table. Call this before Platform::MemoryShutdown().
+void emAfShutdownAttributeIndex(void);
+
+// Refills the attribute index from the endpoint table, after emAfShutdownAttributeIndex().
+void emAfRebuildAttributeIndex(void);
 bool emberAfExtractCommandIds(bool outgoing, EmberAfClusterCommand * cmd, chip::ClusterId clusterId, uint8_t * buffer,
                               uint16_t bufferLength, uint16_t * bufferIndex, uint8_t startId, uint8_t maxIdCount);
 
 EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
                                        uint8_t * buffer, uint16_t readLength, bool write, int32_t index = -1);
 
+// Called by emberAfReadServerClusterAttributes for each attribute it reads, with the attribute's index in the cluster's
+// metadata and the status of the read. Returns whether to go on with the next attribute.
+typedef bool (*EmberAfClusterAttributeCallback)(void * context, uint16_t attributeIndex, EmberAfAttributeMetadata * metadata,
+                                                EmberAfStatus status);
+
+// Reads the attributes of the server cluster clusterId on endpoint into buffer one after the other, in the order of the
+// cluster's metadata and starting at the attribute at startIndex, and hands each one to callback. The endpoint, the cluster
+// and the storage location of the values are looked up once for the whole cluster. Manufacturer-specific attributes are
+// skipped, as emberAfReadAttribute does not find them either. Returns EMBER_ZCL_STATUS_UNSUPPORTED_CLUSTER if the enabled
+// endpoint has no such server cluster, and EMBER_ZCL_STATUS_SUCCESS otherwise.
+EmberAfStatus emberAfReadServerClusterAttributes(chip::EndpointId endpoint, chip::ClusterId clusterId, uint16_t startIndex,
+                                                 uint8_t * buffer, uint16_t bufferSize, EmberAfClusterAttributeCallback callback,
+                                                 void * context);
+
 bool emAfMatchCluster(EmberAfCluster * cluster, EmberAfAttributeSearchRecord * attRecord);
 bool emAfMatchAttribute(EmberAfCluster * cluster, EmberAfAttributeMetadata * am, EmberAfAttributeSearchRecord * attRecord);
 
@@ -254,3 +276,11 @@ EmberAfStatus emberAfSetDynamicEndpoint(uint16_t index, chip::EndpointId id, Emb
                                         uint8_t deviceVersion);
 chip::EndpointId emberAfClearDynamicEndpoint(uint16_t index);
 uint16_t emberAfGetDynamicIndexFromEndpoint(chip::EndpointId id);
+
+// Tells attribute storage that the value of an externally stored attribute changed other than through
+// emberAfExternalAttributeWriteCallback, e.g. on a bridged device, so that a cached copy of it is no longer used.
+// Does nothing unless CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_SIZE is non-zero.
+void emberAfExternalAttributeChanged(chip::EndpointId endpoint, chip::ClusterId clusterId, chip::AttributeId attributeId);
+
+// Returns the hit and miss counts of the external attribute cache; all counts stay 0 while it is disabled.
+const chip::app::ExternalAttributeCacheStatistics & emberAfGetExternalAttributeCacheStatistics(void);
@@ -50,6 +50,7 @@
 #include <app/common/gen/callback.h>
 #include <app/util/af-main.h>
 
+#include <app/InteractionModelEngine.h>
 #include <app/reporting/reporting.h>
 
 using namespace chip;
@@ -601,6 +602,10 @@ EmberAfStatus emAfWriteAttribute(EndpointId endpoint, ClusterId cluster, Attribu
         emAfSaveAttributeToToken(data, endpoint, cluster, metadata);
 
         emberAfReportingAttributeChangeCallback(endpoint, cluster, attributeID, mask, manufacturerCode, dataType, data);
+        if (mask == CLUSTER_MASK_SERVER && manufacturerCode == EMBER_AF_NULL_MANUFACTURER_CODE)
+        {
+            chip::app::InteractionModelReportingAttributeChangeCallback(endpoint, cluster, attributeID);
+        }
 
         // Post write attribute callback for all attributes changes, regardless
         // of cluster.
@@ -0,0 +1,91 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the set of command IDs that the generated command
+ *      dispatch uses to tell which commands a cluster accepts.
+ */
+
+#pragma once
+
+#include <initializer_list>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <app/util/basic-types.h>
+#include <support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * @class CommandSet
+ *
+ * @brief
+ *  A bitmap of the command IDs from 0 to kMaxCommandId, which can be filled at compile time and answers membership in
+ *  constant time.
+ *
+ *  A constexpr set that is given a command ID above kMaxCommandId does not compile, so generated tables cannot silently
+ *  drop a command.
+ */
+class CommandSet
+{
+public:
+    static constexpr CommandId kMaxCommandId = 0xFF;
+
+    constexpr CommandSet() : mWords{} {}
+
+    constexpr CommandSet(std::initializer_list<CommandId> commandIds) : mWords{}
+    {
+        for (CommandId commandId : commandIds)
+        {
+            if (commandId > kMaxCommandId)
+            {
+                // Not a constant expression, so this fails the build when it happens while filling a constexpr set.
+                chipDie();
+            }
+            mWords[commandId / kBitsPerWord] |= static_cast<uint32_t>(1u << (commandId % kBitsPerWord));
+        }
+    }
+
+    constexpr bool Contains(CommandId commandId) const
+    {
+        return commandId <= kMaxCommandId && (mWords[commandId / kBitsPerWord] & (1u << (commandId % kBitsPerWord))) != 0;
+    }
+
+    constexpr bool IsEmpty() const
+    {
+        for (uint32_t word : mWords)
+        {
+            if (word != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    static constexpr size_t kBitsPerWord = 32;
+    static constexpr size_t kWordCount   = (kMaxCommandId + 1) / kBitsPerWord;
+
+    uint32_t mWords[kWordCount];
+};
+
+} // namespace app
+} // namespace chip
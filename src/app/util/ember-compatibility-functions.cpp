@@ -184,92 +184,71 @@ bool ServerClusterCommandExists(chip::ClusterId aClusterId, chip::CommandId aCom
     return emberAfContainsServer(aEndPointId, aClusterId);
 }
 
-CHIP_ERROR ReadSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVWriter * apWriter, bool * apDataExists)
+namespace {
+// Writes the value of an attribute that was read successfully, followed by its data version, as the fields of an attribute
+// data element. Types that cannot be encoded are reported with a status instead.
+CHIP_ERROR EncodeAttributeValue(TLV::TLVWriter & aWriter, ClusterId aClusterId, AttributeId aAttributeId,
+                                EmberAfAttributeType attributeType, uint8_t * data)
 {
-    static uint8_t data[kAttributeReadBufferSize];
-
-    ChipLogDetail(DataManagement,
-                  "Received Cluster Command: Cluster=%" PRIx32 " NodeId=0x" ChipLogFormatX64 " Endpoint=%" PRIx16
-                  " FieldId=%" PRIx32 " ListIndex=%" PRIx16,
-                  aClusterInfo.mClusterId, ChipLogValueX64(aClusterInfo.mNodeId), aClusterInfo.mEndpointId, aClusterInfo.mFieldId,
-                  aClusterInfo.mListIndex);
-
-    EmberAfAttributeType attributeType;
-    EmberAfStatus status;
-    status = emberAfReadAttribute(aClusterInfo.mEndpointId, aClusterInfo.mClusterId, aClusterInfo.mFieldId, CLUSTER_MASK_SERVER,
-                                  data, sizeof(data), &attributeType);
-
-    if (apDataExists != nullptr)
-    {
-        *apDataExists = (EMBER_ZCL_STATUS_SUCCESS == status);
-    }
-
-    VerifyOrReturnError(apWriter != nullptr, CHIP_NO_ERROR);
-    if (status != EMBER_ZCL_STATUS_SUCCESS)
-    {
-        return apWriter->Put(chip::TLV::ContextTag(AttributeDataElement::kCsTag_Status),
-                             chip::to_underlying(ToInteractionModelProtocolCode(status)));
-    }
-
     // TODO: ZCL_STRUCT_ATTRIBUTE_TYPE is not included in this switch case currently, should add support for structures.
     switch (BaseType(attributeType))
     {
     case ZCL_NO_DATA_ATTRIBUTE_TYPE: // No data
-        ReturnErrorOnFailure(apWriter->PutNull(TLV::ContextTag(AttributeDataElement::kCsTag_Data)));
+        ReturnErrorOnFailure(aWriter.PutNull(TLV::ContextTag(AttributeDataElement::kCsTag_Data)));
         break;
     case ZCL_BOOLEAN_ATTRIBUTE_TYPE: // Boolean
-        ReturnErrorOnFailure(apWriter->PutBoolean(TLV::ContextTag(AttributeDataElement::kCsTag_Data), !!data[0]));
+        ReturnErrorOnFailure(aWriter.PutBoolean(TLV::ContextTag(AttributeDataElement::kCsTag_Data), !!data[0]));
         break;
     case ZCL_INT8U_ATTRIBUTE_TYPE: // Unsigned 8-bit integer
-        ReturnErrorOnFailure(apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), data[0]));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), data[0]));
         break;
     case ZCL_INT16U_ATTRIBUTE_TYPE: // Unsigned 16-bit integer
     {
         uint16_t uint16_data;
         memcpy(&uint16_data, data, sizeof(uint16_data));
-        ReturnErrorOnFailure(apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), uint16_data));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), uint16_data));
         break;
     }
     case ZCL_INT32U_ATTRIBUTE_TYPE: // Unsigned 32-bit integer
     {
         uint32_t uint32_data;
         memcpy(&uint32_data, data, sizeof(uint32_data));
-        ReturnErrorOnFailure(apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), uint32_data));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), uint32_data));
         break;
     }
     case ZCL_INT64U_ATTRIBUTE_TYPE: // Unsigned 64-bit integer
     {
         uint64_t uint64_data;
         memcpy(&uint64_data, data, sizeof(uint64_data));
-        ReturnErrorOnFailure(apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), uint64_data));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), uint64_data));
         break;
     }
     case ZCL_INT8S_ATTRIBUTE_TYPE: // Signed 8-bit integer
     {
         int8_t int8_data;
         memcpy(&int8_data, data, sizeof(int8_data));
-        ReturnErrorOnFailure(apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), int8_data));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), int8_data));
         break;
     }
     case ZCL_INT16S_ATTRIBUTE_TYPE: // Signed 16-bit integer
     {
         int16_t int16_data;
         memcpy(&int16_data, data, sizeof(int16_data));
-        ReturnErrorOnFailure(apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), int16_data));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), int16_data));
         break;
     }
     case ZCL_INT32S_ATTRIBUTE_TYPE: // Signed 32-bit integer
     {
         int32_t int32_data;
         memcpy(&int32_data, data, sizeof(int32_data));
-        ReturnErrorOnFailure(apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), int32_data));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), int32_data));
         break;
     }
     case ZCL_INT64S_ATTRIBUTE_TYPE: // Signed 64-bit integer
     {
         int64_t int64_data;
         memcpy(&int64_data, data, sizeof(int64_data));
-        ReturnErrorOnFailure(apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), int64_data));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), int64_data));
         break;
     }
     case ZCL_CHAR_STRING_ATTRIBUTE_TYPE: // Char string
@@ -280,7 +259,7 @@ CHIP_ERROR ReadSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVWriter * ap
         {
             dataLength = 0;
         }
-        ReturnErrorOnFailure(apWriter->PutString(TLV::ContextTag(AttributeDataElement::kCsTag_Data), actualData, dataLength));
+        ReturnErrorOnFailure(aWriter.PutString(TLV::ContextTag(AttributeDataElement::kCsTag_Data), actualData, dataLength));
         break;
     }
     case ZCL_LONG_CHAR_STRING_ATTRIBUTE_TYPE: {
@@ -291,7 +270,7 @@ CHIP_ERROR ReadSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVWriter * ap
         {
             dataLength = 0;
         }
-        ReturnErrorOnFailure(apWriter->PutString(TLV::ContextTag(AttributeDataElement::kCsTag_Data), actualData, dataLength));
+        ReturnErrorOnFailure(aWriter.PutString(TLV::ContextTag(AttributeDataElement::kCsTag_Data), actualData, dataLength));
         break;
     }
     case ZCL_OCTET_STRING_ATTRIBUTE_TYPE: // Octet string
@@ -303,7 +282,7 @@ CHIP_ERROR ReadSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVWriter * ap
             dataLength = 0;
         }
         ReturnErrorOnFailure(
-            apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), chip::ByteSpan(actualData, dataLength)));
+            aWriter.Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), chip::ByteSpan(actualData, dataLength)));
         break;
     }
     case ZCL_LONG_OCTET_STRING_ATTRIBUTE_TYPE: {
@@ -315,30 +294,157 @@ CHIP_ERROR ReadSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVWriter * ap
             dataLength = 0;
         }
         ReturnErrorOnFailure(
-            apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), chip::ByteSpan(actualData, dataLength)));
+            aWriter.Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), chip::ByteSpan(actualData, dataLength)));
         break;
     }
     case ZCL_ARRAY_ATTRIBUTE_TYPE: {
         TLV::TLVType containerType;
         ReturnErrorOnFailure(
-            apWriter->StartContainer(TLV::ContextTag(AttributeDataElement::kCsTag_Data), TLV::kTLVType_List, containerType));
+            aWriter.StartContainer(TLV::ContextTag(AttributeDataElement::kCsTag_Data), TLV::kTLVType_List, containerType));
         // TODO: Encode data in TLV, now raw buffers
         ReturnErrorOnFailure(
-            apWriter->PutBytes(TLV::AnonymousTag, data,
-                               emberAfAttributeValueSize(aClusterInfo.mClusterId, aClusterInfo.mFieldId, attributeType, data)));
-        ReturnErrorOnFailure(apWriter->EndContainer(containerType));
+            aWriter.PutBytes(TLV::AnonymousTag, data, emberAfAttributeValueSize(aClusterId, aAttributeId, attributeType, data)));
+        ReturnErrorOnFailure(aWriter.EndContainer(containerType));
         break;
     }
     default:
         ChipLogError(DataManagement, "Attribute type 0x%x not handled", static_cast<int>(attributeType));
-        return apWriter->Put(chip::TLV::ContextTag(AttributeDataElement::kCsTag_Status),
-                             chip::to_underlying(Protocols::InteractionModel::ProtocolCode::UnsupportedRead));
+        return aWriter.Put(chip::TLV::ContextTag(AttributeDataElement::kCsTag_Status),
+                           chip::to_underlying(Protocols::InteractionModel::ProtocolCode::UnsupportedRead));
     }
 
     // TODO: Add DataVersion support
-    ReturnErrorOnFailure(apWriter->Put(chip::TLV::ContextTag(AttributeDataElement::kCsTag_DataVersion), kTemporaryDataVersion));
+    ReturnErrorOnFailure(aWriter.Put(chip::TLV::ContextTag(AttributeDataElement::kCsTag_DataVersion), kTemporaryDataVersion));
     return CHIP_NO_ERROR;
 }
 
+// Where ReadClusterData writes the attributes of a cluster, and how far it got.
+struct ClusterReadState
+{
+    ClusterInfo * mpClusterInfo;
+    AttributeDataList::Builder * mpAttributeDataList;
+    uint8_t * mpData;
+    size_t mNumElements;
+    CHIP_ERROR mError;
+};
+
+// Writes the element of an attribute of the cluster, or of the cluster itself if apMetadata is null.
+CHIP_ERROR WriteAttributeDataElement(ClusterReadState & aState, EmberAfAttributeMetadata * apMetadata, EmberAfStatus aStatus)
+{
+    const ClusterInfo & clusterInfo              = *aState.mpClusterInfo;
+    AttributeDataElement::Builder elementBuilder = aState.mpAttributeDataList->CreateAttributeDataElementBuilder();
+    ReturnErrorOnFailure(aState.mpAttributeDataList->GetError());
+
+    AttributePath::Builder attributePathBuilder = elementBuilder.CreateAttributePathBuilder();
+    attributePathBuilder.NodeId(clusterInfo.mNodeId).EndpointId(clusterInfo.mEndpointId).ClusterId(clusterInfo.mClusterId);
+    if (apMetadata != nullptr)
+    {
+        attributePathBuilder.FieldId(apMetadata->attributeId);
+    }
+    attributePathBuilder.EndOfAttributePath();
+    ReturnErrorOnFailure(attributePathBuilder.GetError());
+
+    TLV::TLVWriter * writer = elementBuilder.GetWriter();
+    if (aStatus != EMBER_ZCL_STATUS_SUCCESS)
+    {
+        ReturnErrorOnFailure(writer->Put(chip::TLV::ContextTag(AttributeDataElement::kCsTag_Status),
+                                         chip::to_underlying(ToInteractionModelProtocolCode(aStatus))));
+    }
+    else
+    {
+        ReturnErrorOnFailure(EncodeAttributeValue(*writer, clusterInfo.mClusterId, apMetadata->attributeId,
+                                                  apMetadata->attributeType, aState.mpData));
+    }
+
+    elementBuilder.MoreClusterData(false);
+    elementBuilder.EndOfAttributeDataElement();
+    return elementBuilder.GetError();
+}
+
+// Appends the element of one attribute. If it does not fit, the partial element is rolled back and the walk stops at that
+// attribute, so that the next chunk starts with it.
+bool AppendAttributeDataElement(ClusterReadState & aState, uint16_t aAttributeIndex, EmberAfAttributeMetadata * apMetadata,
+                                EmberAfStatus aStatus)
+{
+    TLV::TLVWriter backup;
+    AttributeDataList::Builder attributeDataListBackup = *aState.mpAttributeDataList;
+    aState.mpAttributeDataList->Checkpoint(backup);
+
+    aState.mError = WriteAttributeDataElement(aState, apMetadata, aStatus);
+    if (aState.mError != CHIP_NO_ERROR)
+    {
+        *aState.mpAttributeDataList = attributeDataListBackup;
+        aState.mpAttributeDataList->Rollback(backup);
+        aState.mpClusterInfo->mResumeAttributeIndex = aAttributeIndex;
+        return false;
+    }
+
+    aState.mNumElements++;
+    return true;
+}
+
+bool OnClusterAttributeRead(void * context, uint16_t attributeIndex, EmberAfAttributeMetadata * metadata, EmberAfStatus status)
+{
+    return AppendAttributeDataElement(*static_cast<ClusterReadState *>(context), attributeIndex, metadata, status);
+}
+} // namespace
+
+CHIP_ERROR ReadSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVWriter * apWriter, bool * apDataExists)
+{
+    static uint8_t data[kAttributeReadBufferSize];
+
+    ChipLogDetail(DataManagement,
+                  "Received Cluster Command: Cluster=%" PRIx32 " NodeId=0x" ChipLogFormatX64 " Endpoint=%" PRIx16
+                  " FieldId=%" PRIx32 " ListIndex=%" PRIx16,
+                  aClusterInfo.mClusterId, ChipLogValueX64(aClusterInfo.mNodeId), aClusterInfo.mEndpointId, aClusterInfo.mFieldId,
+                  aClusterInfo.mListIndex);
+
+    EmberAfAttributeType attributeType;
+    EmberAfStatus status;
+    status = emberAfReadAttribute(aClusterInfo.mEndpointId, aClusterInfo.mClusterId, aClusterInfo.mFieldId, CLUSTER_MASK_SERVER,
+                                  data, sizeof(data), &attributeType);
+
+    if (apDataExists != nullptr)
+    {
+        *apDataExists = (EMBER_ZCL_STATUS_SUCCESS == status);
+    }
+
+    VerifyOrReturnError(apWriter != nullptr, CHIP_NO_ERROR);
+    if (status != EMBER_ZCL_STATUS_SUCCESS)
+    {
+        return apWriter->Put(chip::TLV::ContextTag(AttributeDataElement::kCsTag_Status),
+                             chip::to_underlying(ToInteractionModelProtocolCode(status)));
+    }
+
+    return EncodeAttributeValue(*apWriter, aClusterInfo.mClusterId, aClusterInfo.mFieldId, attributeType, data);
+}
+
+CHIP_ERROR ReadClusterData(ClusterInfo & aClusterInfo, AttributeDataList::Builder & aAttributeDataList, size_t & aNumElements)
+{
+    static uint8_t data[kAttributeReadBufferSize];
+    ClusterReadState state = { &aClusterInfo, &aAttributeDataList, data, 0, CHIP_NO_ERROR };
+
+    ChipLogDetail(DataManagement,
+                  "Received Cluster Read: Cluster=%" PRIx32 " NodeId=0x" ChipLogFormatX64 " Endpoint=%" PRIx16
+                  " From Attribute #%" PRIu16,
+                  aClusterInfo.mClusterId, ChipLogValueX64(aClusterInfo.mNodeId), aClusterInfo.mEndpointId,
+                  aClusterInfo.mResumeAttributeIndex);
+
+    EmberAfStatus status = emberAfReadServerClusterAttributes(aClusterInfo.mEndpointId, aClusterInfo.mClusterId,
+                                                              aClusterInfo.mResumeAttributeIndex, data, sizeof(data),
+                                                              OnClusterAttributeRead, &state);
+    if (status != EMBER_ZCL_STATUS_SUCCESS && aClusterInfo.mResumeAttributeIndex == 0)
+    {
+        AppendAttributeDataElement(state, 0, nullptr, status);
+    }
+
+    aNumElements = state.mNumElements;
+    if (state.mError == CHIP_NO_ERROR)
+    {
+        aClusterInfo.mResumeAttributeIndex = 0;
+    }
+    return state.mError;
+}
+
 } // namespace app
 } // namespace chip
@@ -0,0 +1,193 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the cache that attribute storage keeps of values
+ *      read through emberAfExternalAttributeReadCallback.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <app/util/basic-types.h>
+#include <support/HashUtils.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Counters of an ExternalAttributeCache.
+ */
+struct ExternalAttributeCacheStatistics
+{
+    uint32_t mHits          = 0; ///< Reads served from the cache.
+    uint32_t mMisses        = 0; ///< Reads that had to go to the application.
+    uint32_t mFills         = 0; ///< Values stored after a miss.
+    uint32_t mInvalidations = 0; ///< Invalidate() and InvalidateEndpoint() calls.
+};
+
+/**
+ * @class ExternalAttributeCache
+ *
+ * @brief
+ *  A direct-mapped cache of up to @p N externally stored attribute values of at most @p MaxValueSize bytes each, keyed by
+ *  (endpoint, cluster, attribute).
+ *
+ *  Values are only dropped when the application says they changed, through Invalidate() or InvalidateEndpoint(), or when
+ *  another attribute maps to the same slot. Every invalidation advances the cache version: a value read from the
+ *  application is stored by Fill() only if no invalidation happened since the version was taken before the read, so a
+ *  change that races with a read never leaves a stale value behind.
+ */
+template <size_t N, size_t MaxValueSize>
+class ExternalAttributeCache
+{
+public:
+    static_assert(N > 0, "ExternalAttributeCache needs at least one entry");
+
+    static constexpr size_t kMaxValueSize = MaxValueSize;
+
+    ExternalAttributeCache() { Clear(); }
+
+    ExternalAttributeCache(const ExternalAttributeCache &) = delete;
+    ExternalAttributeCache & operator=(const ExternalAttributeCache &) = delete;
+
+    /**
+     * Copy the cached value of the attribute, which must be @p length bytes long, to @p buffer.
+     *
+     * @return Whether the value was cached.
+     */
+    bool Read(EndpointId endpoint, ClusterId cluster, AttributeId attribute, uint8_t * buffer, uint16_t length)
+    {
+        const Entry & entry = mEntries[Slot(endpoint, cluster, attribute)];
+        if (entry.mValid && entry.Matches(endpoint, cluster, attribute) && entry.mLength == length)
+        {
+            memcpy(buffer, entry.mValue, length);
+            mStatistics.mHits++;
+            return true;
+        }
+        mStatistics.mMisses++;
+        return false;
+    }
+
+    /**
+     * Returns the version to pass to Fill() for a value that is about to be read from the application.
+     */
+    DataVersion GetVersion() const { return mVersion; }
+
+    /**
+     * Cache @p value, read from the application after GetVersion() returned @p version. Does nothing if the attribute was
+     * invalidated since then, or if the value is longer than kMaxValueSize.
+     */
+    void Fill(EndpointId endpoint, ClusterId cluster, AttributeId attribute, const uint8_t * value, uint16_t length,
+              DataVersion version)
+    {
+        if (version != mVersion || length > kMaxValueSize)
+        {
+            return;
+        }
+
+        Entry & entry      = mEntries[Slot(endpoint, cluster, attribute)];
+        entry.mEndpointId  = endpoint;
+        entry.mClusterId   = cluster;
+        entry.mAttributeId = attribute;
+        entry.mLength      = length;
+        entry.mValid       = true;
+        memcpy(entry.mValue, value, length);
+        mStatistics.mFills++;
+    }
+
+    /**
+     * Drop the cached value of the attribute, if any.
+     */
+    void Invalidate(EndpointId endpoint, ClusterId cluster, AttributeId attribute)
+    {
+        Entry & entry = mEntries[Slot(endpoint, cluster, attribute)];
+        if (entry.Matches(endpoint, cluster, attribute))
+        {
+            entry.mValid = false;
+        }
+        mVersion++;
+        mStatistics.mInvalidations++;
+    }
+
+    /**
+     * Drop the cached values of all attributes of @p endpoint.
+     */
+    void InvalidateEndpoint(EndpointId endpoint)
+    {
+        for (Entry & entry : mEntries)
+        {
+            if (entry.mEndpointId == endpoint)
+            {
+                entry.mValid = false;
+            }
+        }
+        mVersion++;
+        mStatistics.mInvalidations++;
+    }
+
+    /**
+     * Drop all cached values. The statistics are kept.
+     */
+    void Clear()
+    {
+        for (Entry & entry : mEntries)
+        {
+            entry.mValid = false;
+        }
+        mVersion++;
+    }
+
+    const ExternalAttributeCacheStatistics & GetStatistics() const { return mStatistics; }
+    void ResetStatistics() { mStatistics = ExternalAttributeCacheStatistics(); }
+
+private:
+    struct Entry
+    {
+        bool Matches(EndpointId endpoint, ClusterId cluster, AttributeId attribute) const
+        {
+            return mEndpointId == endpoint && mClusterId == cluster && mAttributeId == attribute;
+        }
+
+        EndpointId mEndpointId   = 0;
+        ClusterId mClusterId     = 0;
+        AttributeId mAttributeId = 0;
+        uint16_t mLength         = 0;
+        bool mValid              = false;
+        uint8_t mValue[kMaxValueSize];
+    };
+
+    static size_t Slot(EndpointId endpoint, ClusterId cluster, AttributeId attribute)
+    {
+        uint64_t key = (static_cast<uint64_t>(cluster) << 32) | attribute;
+        key ^= static_cast<uint64_t>(endpoint) * 0x9E3779B97F4A7C15ULL;
+
+        // Mix the key, so that every key bit affects the slot.
+        return static_cast<size_t>(MixBits64(key) % N);
+    }
+
+    Entry mEntries[N];
+    DataVersion mVersion = 0;
+    ExternalAttributeCacheStatistics mStatistics;
+};
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,262 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests checking that attribute storage finds
+ *      the same attribute metadata and storage offset through the attribute
+ *      index as by walking the endpoint table, as dynamic endpoints are added
+ *      and removed.
+ */
+
+#include <app/common/gen/attribute-type.h>
+#include <app/util/af.h>
+#include <app/util/attribute-storage.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <string.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr EndpointId kFirstDynamicEndpointId = 100;
+constexpr uint16_t kDynamicEndpointCount     = 12;
+constexpr ClusterId kSharedClusterId         = 0xFC00;
+constexpr ClusterId kOtherClusterId          = 0xFC01;
+constexpr AttributeId kMissingAttributeId    = 0x00F0;
+constexpr size_t kMaxLookups                 = 1024;
+constexpr size_t kMaxValueSize               = 8;
+
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(serverAttrs)
+DECLARE_DYNAMIC_ATTRIBUTE(0x0000, INT8U, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE(0x0001, INT16U, 2, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE(0x0002, INT32U, 4, 0) DECLARE_DYNAMIC_ATTRIBUTE_LIST_END(0x0001);
+
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(otherAttrs)
+DECLARE_DYNAMIC_ATTRIBUTE(0x0002, INT8U, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE(0x0003, INT8U, 1, 0) DECLARE_DYNAMIC_ATTRIBUTE_LIST_END(0x0002);
+
+// A server and a client cluster with the same ID, which index entries with the same key.
+EmberAfCluster serverAndClientClusters[] = {
+    DECLARE_DYNAMIC_CLUSTER(kSharedClusterId, serverAttrs),
+    { kSharedClusterId, otherAttrs, ArraySize(otherAttrs), 0, ZAP_CLUSTER_MASK(CLIENT), NULL },
+    DECLARE_DYNAMIC_CLUSTER(kOtherClusterId, otherAttrs),
+};
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(otherClusters)
+DECLARE_DYNAMIC_CLUSTER(kOtherClusterId, serverAttrs) DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(serverAndClientEndpoint, serverAndClientClusters);
+DECLARE_DYNAMIC_ENDPOINT(otherEndpoint, otherClusters);
+
+struct Lookup
+{
+    EndpointId mEndpointId;
+    ClusterId mClusterId;
+    AttributeId mAttributeId;
+    uint8_t mClusterMask;
+
+    EmberAfStatus mStatus;
+    EmberAfAttributeMetadata * mMetadata;
+    uint8_t mValue[kMaxValueSize];
+};
+
+Lookup sLookups[kMaxLookups];
+size_t sLookupCount;
+
+void AddLookup(nlTestSuite * inSuite, EndpointId endpoint, ClusterId cluster, AttributeId attribute, uint8_t clusterMask)
+{
+    NL_TEST_ASSERT(inSuite, sLookupCount < kMaxLookups);
+    if (sLookupCount < kMaxLookups)
+    {
+        sLookups[sLookupCount++] = { endpoint, cluster, attribute, clusterMask, EMBER_ZCL_STATUS_SUCCESS, nullptr, {} };
+    }
+}
+
+// Looks up every attribute of the enabled endpoints, with both cluster masks, and attributes that do not exist.
+void AddLookups(nlTestSuite * inSuite)
+{
+    sLookupCount = 0;
+    for (uint16_t i = 0; i < emberAfEndpointCount(); i++)
+    {
+        EmberAfEndpointType * endpointType = emAfEndpoints[i].endpointType;
+        if (endpointType == nullptr || !emberAfEndpointIndexIsEnabled(i))
+        {
+            continue;
+        }
+
+        const EndpointId endpoint = emAfEndpoints[i].endpoint;
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+        {
+            const EmberAfCluster & cluster = endpointType->cluster[clusterIndex];
+            for (uint16_t attrIndex = 0; attrIndex < cluster.attributeCount; attrIndex++)
+            {
+                AddLookup(inSuite, endpoint, cluster.clusterId, cluster.attributes[attrIndex].attributeId, CLUSTER_MASK_SERVER);
+                AddLookup(inSuite, endpoint, cluster.clusterId, cluster.attributes[attrIndex].attributeId, CLUSTER_MASK_CLIENT);
+            }
+            AddLookup(inSuite, endpoint, cluster.clusterId, kMissingAttributeId, CLUSTER_MASK_SERVER);
+        }
+    }
+
+    // All dynamic endpoint IDs, including those of removed endpoints.
+    for (uint16_t i = 0; i < kDynamicEndpointCount; i++)
+    {
+        AddLookup(inSuite, static_cast<EndpointId>(kFirstDynamicEndpointId + i), kSharedClusterId, 0x0002, CLUSTER_MASK_SERVER);
+    }
+}
+
+// Finds the attribute of lookup, and reads its value if it is held in attribute storage.
+void DoLookup(Lookup & lookup)
+{
+    EmberAfAttributeSearchRecord record;
+    record.endpoint         = lookup.mEndpointId;
+    record.clusterId        = lookup.mClusterId;
+    record.clusterMask      = lookup.mClusterMask;
+    record.attributeId      = lookup.mAttributeId;
+    record.manufacturerCode = EMBER_AF_NULL_MANUFACTURER_CODE;
+
+    lookup.mMetadata = nullptr;
+    memset(lookup.mValue, 0, sizeof(lookup.mValue));
+    lookup.mStatus = emAfReadOrWriteAttribute(&record, &lookup.mMetadata, nullptr, 0, false);
+
+    // The value shows the storage offset the lookup found.
+    const EmberAfAttributeMetadata * metadata = lookup.mMetadata;
+    if (lookup.mStatus == EMBER_ZCL_STATUS_SUCCESS && !(metadata->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) &&
+        !emberAfIsStringAttributeType(metadata->attributeType) && !emberAfIsLongStringAttributeType(metadata->attributeType) &&
+        emberAfAttributeSize(metadata) <= sizeof(lookup.mValue))
+    {
+        lookup.mStatus = emAfReadOrWriteAttribute(&record, nullptr, lookup.mValue, sizeof(lookup.mValue), false);
+    }
+}
+
+void CheckIndexMatchesWalk(nlTestSuite * inSuite)
+{
+    AddLookups(inSuite);
+
+    for (size_t i = 0; i < sLookupCount; i++)
+    {
+        DoLookup(sLookups[i]);
+    }
+
+    emAfShutdownAttributeIndex();
+    size_t numFound = 0;
+    for (size_t i = 0; i < sLookupCount; i++)
+    {
+        Lookup walked = sLookups[i];
+        DoLookup(walked);
+
+        NL_TEST_ASSERT(inSuite, walked.mStatus == sLookups[i].mStatus);
+        NL_TEST_ASSERT(inSuite, walked.mMetadata == sLookups[i].mMetadata);
+        NL_TEST_ASSERT(inSuite, memcmp(walked.mValue, sLookups[i].mValue, sizeof(walked.mValue)) == 0);
+        numFound += (walked.mStatus == EMBER_ZCL_STATUS_SUCCESS);
+    }
+    emAfRebuildAttributeIndex();
+
+    // Both misses and hits were compared.
+    NL_TEST_ASSERT(inSuite, numFound > 0 && numFound < sLookupCount);
+}
+
+void TestIndexMatchesWalk(nlTestSuite * inSuite, void * inContext)
+{
+    // Give every byte of attribute storage a different value, so that reading an attribute shows where it is stored.
+    uint16_t storageSize = 0;
+    for (uint16_t i = 0; i < emberAfFixedEndpointCount(); i++)
+    {
+        storageSize = static_cast<uint16_t>(storageSize + emAfEndpoints[i].endpointType->endpointSize);
+    }
+    for (uint16_t i = 0; i < storageSize; i++)
+    {
+        attributeData[i] = static_cast<uint8_t>(i * 7 + 1);
+    }
+
+    CheckIndexMatchesWalk(inSuite);
+
+    for (uint16_t i = 0; i < kDynamicEndpointCount; i++)
+    {
+        EmberAfEndpointType * endpointType = (i % 3 == 2) ? &otherEndpoint : &serverAndClientEndpoint;
+        NL_TEST_ASSERT(inSuite,
+                       emberAfSetDynamicEndpoint(i, static_cast<EndpointId>(kFirstDynamicEndpointId + i), endpointType, 0, 1) ==
+                           EMBER_ZCL_STATUS_SUCCESS);
+    }
+    CheckIndexMatchesWalk(inSuite);
+
+    // Removing endpoints refills the index.
+    for (uint16_t i = 0; i < kDynamicEndpointCount; i += 2)
+    {
+        NL_TEST_ASSERT(inSuite, emberAfClearDynamicEndpoint(i) == kFirstDynamicEndpointId + i);
+    }
+    CheckIndexMatchesWalk(inSuite);
+
+    // Endpoints added after a removal go into the free slots, with other endpoint types.
+    for (uint16_t i = 0; i < kDynamicEndpointCount; i += 4)
+    {
+        NL_TEST_ASSERT(inSuite,
+                       emberAfSetDynamicEndpoint(i, static_cast<EndpointId>(kFirstDynamicEndpointId + i), &otherEndpoint, 0, 1) ==
+                           EMBER_ZCL_STATUS_SUCCESS);
+    }
+    CheckIndexMatchesWalk(inSuite);
+
+    for (uint16_t i = 0; i < kDynamicEndpointCount; i++)
+    {
+        emberAfClearDynamicEndpoint(i);
+    }
+    CheckIndexMatchesWalk(inSuite);
+}
+
+int TestSetup(void * inContext)
+{
+    VerifyOrReturnError(Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
+    emberAfEndpointConfigure();
+    return SUCCESS;
+}
+
+int TestTeardown(void * inContext)
+{
+    emAfShutdownAttributeIndex();
+    Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestIndexMatchesWalk", TestIndexMatchesWalk), //
+    NL_TEST_SENTINEL(),                                        //
+};
+
+} // namespace
+
+int TestAttributeStorage()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "TestAttributeStorage",
+        &sTests[0],
+        TestSetup,
+        TestTeardown
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestAttributeStorage)
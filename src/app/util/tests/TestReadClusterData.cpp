@@ -0,0 +1,209 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for ReadClusterData, which reports
+ *      every attribute of a cluster read with a wildcard field ID, over as
+ *      many chunks as it takes.
+ */
+
+#include <app/InteractionModelEngine.h>
+#include <app/common/gen/attribute-type.h>
+#include <app/util/af.h>
+#include <app/util/attribute-storage.h>
+#include <core/CHIPTLV.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+constexpr EndpointId kEndpointId         = 100;
+constexpr ClusterId kClusterId           = 0xFC00;
+constexpr AttributeId kAttributeCount    = 16;
+constexpr AttributeId kClusterRevisionId = 0xFFFD;
+constexpr uint32_t kValueOffset          = 1000;
+// Room for a few attribute data elements, so that reading the cluster takes several chunks.
+constexpr size_t kChunkSize = 128;
+constexpr size_t kMaxChunks = 2 * kAttributeCount;
+
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(testAttrs)
+DECLARE_DYNAMIC_ATTRIBUTE(0x0000, INT32U, 4, 0), DECLARE_DYNAMIC_ATTRIBUTE(0x0001, INT32U, 4, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE(0x0002, INT32U, 4, 0), DECLARE_DYNAMIC_ATTRIBUTE(0x0003, INT32U, 4, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE(0x0004, INT32U, 4, 0), DECLARE_DYNAMIC_ATTRIBUTE(0x0005, INT32U, 4, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE(0x0006, INT32U, 4, 0), DECLARE_DYNAMIC_ATTRIBUTE(0x0007, INT32U, 4, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE(0x0008, INT32U, 4, 0), DECLARE_DYNAMIC_ATTRIBUTE(0x0009, INT32U, 4, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE(0x000A, INT32U, 4, 0), DECLARE_DYNAMIC_ATTRIBUTE(0x000B, INT32U, 4, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE(0x000C, INT32U, 4, 0), DECLARE_DYNAMIC_ATTRIBUTE(0x000D, INT32U, 4, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE(0x000E, INT32U, 4, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE(0x000F, INT32U, 4, 0) DECLARE_DYNAMIC_ATTRIBUTE_LIST_END(0x0001);
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(testClusters)
+DECLARE_DYNAMIC_CLUSTER(kClusterId, testAttrs) DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(testEndpoint, testClusters);
+
+// How many times each attribute was reported; the last counter is for the cluster revision.
+size_t sNumReported[kAttributeCount + 1];
+
+// Counts the attribute data elements of a chunk, checking the value of each.
+size_t CountReportedAttributes(nlTestSuite * inSuite, const uint8_t * buffer, uint32_t length)
+{
+    TLV::TLVReader reader;
+    TLV::TLVType containerType;
+    size_t numElements = 0;
+
+    reader.Init(buffer, length);
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.EnterContainer(containerType) == CHIP_NO_ERROR);
+    while (reader.Next() == CHIP_NO_ERROR)
+    {
+        AttributeDataElement::Parser element;
+        AttributePath::Parser path;
+        TLV::TLVReader data;
+        AttributeId attributeId;
+        uint32_t value = 0;
+
+        NL_TEST_ASSERT(inSuite, element.Init(reader) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, element.GetAttributePath(&path) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, path.GetFieldId(&attributeId) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, element.GetData(&data) == CHIP_NO_ERROR);
+        if (attributeId == kClusterRevisionId)
+        {
+            sNumReported[kAttributeCount]++;
+        }
+        else if (attributeId < kAttributeCount)
+        {
+            NL_TEST_ASSERT(inSuite, data.Get(value) == CHIP_NO_ERROR && value == kValueOffset + attributeId);
+            sNumReported[attributeId]++;
+        }
+        else
+        {
+            NL_TEST_ASSERT(inSuite, false);
+        }
+        numElements++;
+    }
+    NL_TEST_ASSERT(inSuite, reader.ExitContainer(containerType) == CHIP_NO_ERROR);
+    return numElements;
+}
+
+void TestReadClusterInChunks(nlTestSuite * inSuite, void * inContext)
+{
+    ClusterInfo clusterInfo;
+    size_t numChunks = 0;
+    CHIP_ERROR err   = CHIP_NO_ERROR;
+
+    NL_TEST_ASSERT(inSuite, emberAfSetDynamicEndpoint(0, kEndpointId, &testEndpoint, 0, 1) == EMBER_ZCL_STATUS_SUCCESS);
+    memset(sNumReported, 0, sizeof(sNumReported));
+
+    clusterInfo.mEndpointId = kEndpointId;
+    clusterInfo.mClusterId  = kClusterId;
+
+    // Each chunk is a fresh list, as in a report message; the path remembers where the next one starts.
+    do
+    {
+        uint8_t buffer[kChunkSize];
+        TLV::TLVWriter writer;
+        AttributeDataList::Builder attributeDataList;
+        size_t numElements = 0;
+
+        writer.Init(buffer, sizeof(buffer));
+        NL_TEST_ASSERT(inSuite, attributeDataList.Init(&writer) == CHIP_NO_ERROR);
+        err = ReadClusterData(clusterInfo, attributeDataList, numElements);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR || err == CHIP_ERROR_BUFFER_TOO_SMALL || err == CHIP_ERROR_NO_MEMORY);
+        NL_TEST_ASSERT(inSuite, (err == CHIP_NO_ERROR) == (clusterInfo.mResumeAttributeIndex == 0));
+
+        attributeDataList.EndOfAttributeDataList();
+        NL_TEST_ASSERT(inSuite, attributeDataList.GetError() == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, numElements > 0);
+        NL_TEST_ASSERT(inSuite, CountReportedAttributes(inSuite, buffer, writer.GetLengthWritten()) == numElements);
+        numChunks++;
+    } while (err != CHIP_NO_ERROR && numChunks < kMaxChunks);
+
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, numChunks > 1);
+
+    // Resuming neither skipped nor repeated an attribute.
+    for (size_t i = 0; i <= kAttributeCount; i++)
+    {
+        NL_TEST_ASSERT(inSuite, sNumReported[i] == 1);
+    }
+
+    emberAfClearDynamicEndpoint(0);
+}
+
+int TestSetup(void * inContext)
+{
+    VerifyOrReturnError(Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
+    emberAfEndpointConfigure();
+    return SUCCESS;
+}
+
+int TestTeardown(void * inContext)
+{
+    emAfShutdownAttributeIndex();
+    Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestReadClusterInChunks", TestReadClusterInChunks), //
+    NL_TEST_SENTINEL(),                                              //
+};
+
+} // namespace
+
+// The attributes of the test cluster are stored by the test, each holding its ID plus kValueOffset.
+EmberAfStatus emberAfExternalAttributeReadCallback(EndpointId endpoint, ClusterId clusterId,
+                                                   EmberAfAttributeMetadata * attributeMetadata, uint16_t manufacturerCode,
+                                                   uint8_t * buffer, uint16_t maxReadLength, int32_t index)
+{
+    uint32_t value = kValueOffset + attributeMetadata->attributeId;
+    VerifyOrReturnError(endpoint == kEndpointId && clusterId == kClusterId, EMBER_ZCL_STATUS_FAILURE);
+    VerifyOrReturnError(maxReadLength >= sizeof(value), EMBER_ZCL_STATUS_INSUFFICIENT_SPACE);
+    memcpy(buffer, &value, sizeof(value));
+    return EMBER_ZCL_STATUS_SUCCESS;
+}
+
+int TestReadClusterData()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "TestReadClusterData",
+        &sTests[0],
+        TestSetup,
+        TestTeardown
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestReadClusterData)
@@ -0,0 +1,134 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of finding attributes in attribute
+ *      storage with emberAfLocateAttributeMetadata, through the attribute
+ *      index and by walking the endpoint table, as the number of dynamic
+ *      endpoints grows.
+ */
+
+#include <app/common/gen/attribute-type.h>
+#include <app/util/af.h>
+#include <app/util/attribute-storage.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <system/SystemClock.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr EndpointId kFirstDynamicEndpointId = 100;
+constexpr uint32_t kIterations               = 100000;
+constexpr AttributeId kAttributeCount        = 9;
+constexpr ClusterId kClusterIds[]            = { 0xFC00, 0xFC01, 0xFC02, 0xFC03, 0xFC04 };
+
+// Endpoint type of the endpoints the benchmark adds: five clusters of ten external attributes, counting the cluster
+// revision, much like the endpoints of a bridge.
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(benchmarkAttrs)
+DECLARE_DYNAMIC_ATTRIBUTE(0x0000, INT8U, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE(0x0001, INT8U, 1, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE(0x0002, INT8U, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE(0x0003, INT8U, 1, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE(0x0004, INT8U, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE(0x0005, INT8U, 1, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE(0x0006, INT8U, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE(0x0007, INT8U, 1, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE(0x0008, INT8U, 1, 0) DECLARE_DYNAMIC_ATTRIBUTE_LIST_END(0x0001);
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(benchmarkClusters)
+DECLARE_DYNAMIC_CLUSTER(kClusterIds[0], benchmarkAttrs), DECLARE_DYNAMIC_CLUSTER(kClusterIds[1], benchmarkAttrs),
+    DECLARE_DYNAMIC_CLUSTER(kClusterIds[2], benchmarkAttrs), DECLARE_DYNAMIC_CLUSTER(kClusterIds[3], benchmarkAttrs),
+    DECLARE_DYNAMIC_CLUSTER(kClusterIds[4], benchmarkAttrs) DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(benchmarkEndpoint, benchmarkClusters);
+
+// Looks up attributes spread over all endpoints, clusters and attributes. Returns the time it took, in nanoseconds per
+// lookup, or a negative number if an attribute was not found.
+double TimeLookups(uint16_t endpointCount)
+{
+    size_t found   = 0;
+    uint64_t start = System::Clock::GetMonotonicMicroseconds();
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        EndpointId endpoint = static_cast<EndpointId>(kFirstDynamicEndpointId + (i * 7919u) % endpointCount);
+        found += (emberAfLocateAttributeMetadata(endpoint, kClusterIds[i % ArraySize(kClusterIds)],
+                                                 static_cast<AttributeId>(i % kAttributeCount), CLUSTER_MASK_SERVER,
+                                                 EMBER_AF_NULL_MANUFACTURER_CODE) != nullptr);
+    }
+    uint64_t elapsedUs = System::Clock::GetMonotonicMicroseconds() - start;
+
+    return found == kIterations ? static_cast<double>(elapsedUs) * 1000.0 / kIterations : -1.0;
+}
+
+bool BenchmarkLookup(uint16_t endpointCount)
+{
+    for (uint16_t i = 0; i < endpointCount; i++)
+    {
+        if (emberAfSetDynamicEndpoint(i, static_cast<EndpointId>(kFirstDynamicEndpointId + i), &benchmarkEndpoint, 0, 1) !=
+            EMBER_ZCL_STATUS_SUCCESS)
+        {
+            return false;
+        }
+    }
+
+    double indexedNs = TimeLookups(endpointCount);
+    emAfShutdownAttributeIndex();
+    double walkedNs = TimeLookups(endpointCount);
+    emAfRebuildAttributeIndex();
+
+    for (uint16_t i = 0; i < endpointCount; i++)
+    {
+        emberAfClearDynamicEndpoint(i);
+    }
+
+    printf("  %4u endpoints: %8.1f ns/lookup through the index, %8.1f ns/lookup walking the endpoint table\n",
+           static_cast<unsigned>(endpointCount), indexedNs, walkedNs);
+    return indexedNs >= 0 && walkedNs >= 0;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    bool found = true;
+
+    if (Platform::MemoryInit() != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to initialize memory\n");
+        return EXIT_FAILURE;
+    }
+    emberAfEndpointConfigure();
+
+    printf("Attribute lookup cost vs dynamic endpoint count%s:\n",
+           CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX ? "" : " (the attribute index is disabled, so every lookup walks)");
+    found = BenchmarkLookup(2) && found;
+    found = BenchmarkLookup(20) && found;
+    found = BenchmarkLookup(DYNAMIC_ENDPOINT_COUNT) && found;
+
+    emAfShutdownAttributeIndex();
+    Platform::MemoryShutdown();
+
+    if (!found)
+    {
+        fprintf(stderr, "An attribute of an added endpoint was not found\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
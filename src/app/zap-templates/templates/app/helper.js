@@ -282,6 +282,39 @@ function asPrintFormat(type)
   return templateUtil.templatePromise(this.global, promise)
 }
 
+// Types that TLV::ContextStructCodec encodes in a fixed width.
+const kFixedWidthTlvTypes = [ 'int8_t', 'uint8_t', 'int16_t', 'uint16_t', 'int32_t', 'uint32_t', 'int64_t', 'uint64_t' ];
+
+/**
+ * Returns the TLV::ContextStructCodec type for the arguments of the given command
+ * if they all have a fixed-width encoding, and an empty string otherwise.
+ */
+function asTlvCommandCodec(commandId)
+{
+  const db = this.global.db;
+
+  function fn(pkgId)
+  {
+    const options = { 'hash' : {} };
+    return zclQuery.selectCommandArgumentsByCommandId(db, commandId, pkgId).then(commandArguments => {
+      if (commandArguments.length == 0 || commandArguments.find(argument => argument.isArray)) {
+        return '';
+      }
+
+      const types = commandArguments.map(argument => zclHelper.asUnderlyingZclType.call(this, argument.type, options));
+      return Promise.all(types).then(zclTypes => {
+        if (zclTypes.find(zclType => !kFixedWidthTlvTypes.includes(ChipTypesHelper.asBasicType(zclType)))) {
+          return '';
+        }
+        return 'TLV::ContextStructCodec<' + zclTypes.join(', ') + '>';
+      });
+    });
+  }
+
+  const promise = templateUtil.ensureZclPackageId(this).then(fn.bind(this)).catch(err => console.log(err));
+  return templateUtil.templatePromise(this.global, promise)
+}
+
 function asTypeLiteralSuffix(type)
 {
   switch (type) {
@@ -331,6 +364,7 @@ exports.asReadTypeLength                  = asReadTypeLength;
 exports.chip_endpoint_generated_functions = chip_endpoint_generated_functions
 exports.chip_endpoint_cluster_list        = chip_endpoint_cluster_list
 exports.asTypeLiteralSuffix               = asTypeLiteralSuffix;
+exports.asTlvCommandCodec                 = asTlvCommandCodec;
 exports.asLowerCamelCase                  = asLowerCamelCase;
 exports.asUpperCamelCase                  = asUpperCamelCase;
 exports.hasSpecificAttributes             = hasSpecificAttributes;
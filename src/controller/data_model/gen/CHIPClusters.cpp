@@ -22,6 +22,7 @@
 
 #include "chip-zcl-zpro-codec-api.h"
 #include <gen/CHIPClientCallbacks.h>
+#include <lib/core/CHIPTLVCodec.h>
 #include <lib/support/Span.h>
 
 namespace chip {
@@ -158,9 +159,11 @@ CHIP_ERROR ApplicationBasicCluster::ChangeStatus(Callback::Cancelable * onSucces
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // status: applicationBasicStatus
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), status));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, status));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -449,9 +452,11 @@ CHIP_ERROR AudioOutputCluster::SelectOutput(Callback::Cancelable * onSuccessCall
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // index: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), index));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, index));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -1077,15 +1082,14 @@ CHIP_ERROR BindingCluster::Bind(Callback::Cancelable * onSuccessCallback, Callba
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<chip::NodeId, chip::GroupId, chip::EndpointId, chip::ClusterId>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // nodeId: nodeId
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), nodeId));
     // groupId: groupId
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), groupId));
     // endpointId: endpointNo
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), endpointId));
     // clusterId: clusterId
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), clusterId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, nodeId, groupId, endpointId, clusterId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -1125,15 +1129,14 @@ CHIP_ERROR BindingCluster::Unbind(Callback::Cancelable * onSuccessCallback, Call
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<chip::NodeId, chip::GroupId, chip::EndpointId, chip::ClusterId>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // nodeId: nodeId
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), nodeId));
     // groupId: groupId
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), groupId));
     // endpointId: endpointNo
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), endpointId));
     // clusterId: clusterId
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), clusterId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, nodeId, groupId, endpointId, clusterId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -1390,21 +1393,18 @@ CHIP_ERROR ColorControlCluster::ColorLoopSet(Callback::Cancelable * onSuccessCal
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint16_t, uint16_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // updateFlags: colorLoopUpdateFlags
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), updateFlags));
     // action: colorLoopAction
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), action));
     // direction: colorLoopDirection
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), direction));
     // time: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), time));
     // startHue: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), startHue));
     // optionsMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsMask));
     // optionsOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, updateFlags, action, direction, time, startHue, optionsMask,
+                                               optionsOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -1443,15 +1443,14 @@ CHIP_ERROR ColorControlCluster::EnhancedMoveHue(Callback::Cancelable * onSuccess
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // moveMode: hueMoveMode
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), moveMode));
     // rate: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), rate));
     // optionsMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsMask));
     // optionsOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, moveMode, rate, optionsMask, optionsOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -1592,17 +1591,15 @@ CHIP_ERROR ColorControlCluster::EnhancedStepHue(Callback::Cancelable * onSuccess
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint16_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // stepMode: hueStepMode
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), stepMode));
     // stepSize: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), stepSize));
     // transitionTime: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), transitionTime));
     // optionsMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsMask));
     // optionsOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, stepMode, stepSize, transitionTime, optionsMask, optionsOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -1641,15 +1638,14 @@ CHIP_ERROR ColorControlCluster::MoveColor(Callback::Cancelable * onSuccessCallba
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<int16_t, int16_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // rateX: int16s
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), rateX));
     // rateY: int16s
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), rateY));
     // optionsMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsMask));
     // optionsOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, rateX, rateY, optionsMask, optionsOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -1741,15 +1737,14 @@ CHIP_ERROR ColorControlCluster::MoveHue(Callback::Cancelable * onSuccessCallback
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // moveMode: hueMoveMode
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), moveMode));
     // rate: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), rate));
     // optionsMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsMask));
     // optionsOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, moveMode, rate, optionsMask, optionsOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -1788,15 +1783,14 @@ CHIP_ERROR ColorControlCluster::MoveSaturation(Callback::Cancelable * onSuccessC
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // moveMode: saturationMoveMode
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), moveMode));
     // rate: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), rate));
     // optionsMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsMask));
     // optionsOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, moveMode, rate, optionsMask, optionsOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -1836,17 +1830,15 @@ CHIP_ERROR ColorControlCluster::MoveToColor(Callback::Cancelable * onSuccessCall
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint16_t, uint16_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // colorX: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), colorX));
     // colorY: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), colorY));
     // transitionTime: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), transitionTime));
     // optionsMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsMask));
     // optionsOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, colorX, colorY, transitionTime, optionsMask, optionsOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -1934,17 +1926,15 @@ CHIP_ERROR ColorControlCluster::MoveToHue(Callback::Cancelable * onSuccessCallba
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint16_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // hue: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), hue));
     // direction: hueDirection
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), direction));
     // transitionTime: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), transitionTime));
     // optionsMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsMask));
     // optionsOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, hue, direction, transitionTime, optionsMask, optionsOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -2034,15 +2024,14 @@ CHIP_ERROR ColorControlCluster::MoveToSaturation(Callback::Cancelable * onSucces
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // saturation: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), saturation));
     // transitionTime: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), transitionTime));
     // optionsMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsMask));
     // optionsOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, saturation, transitionTime, optionsMask, optionsOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -2082,17 +2071,15 @@ CHIP_ERROR ColorControlCluster::StepColor(Callback::Cancelable * onSuccessCallba
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<int16_t, int16_t, uint16_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // stepX: int16s
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), stepX));
     // stepY: int16s
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), stepY));
     // transitionTime: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), transitionTime));
     // optionsMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsMask));
     // optionsOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, stepX, stepY, transitionTime, optionsMask, optionsOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -2187,17 +2174,15 @@ CHIP_ERROR ColorControlCluster::StepHue(Callback::Cancelable * onSuccessCallback
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // stepMode: hueStepMode
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), stepMode));
     // stepSize: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), stepSize));
     // transitionTime: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), transitionTime));
     // optionsMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsMask));
     // optionsOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, stepMode, stepSize, transitionTime, optionsMask, optionsOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -2237,17 +2222,15 @@ CHIP_ERROR ColorControlCluster::StepSaturation(Callback::Cancelable * onSuccessC
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // stepMode: saturationStepMode
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), stepMode));
     // stepSize: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), stepSize));
     // transitionTime: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), transitionTime));
     // optionsMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsMask));
     // optionsOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, stepMode, stepSize, transitionTime, optionsMask, optionsOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -2286,11 +2269,12 @@ CHIP_ERROR ColorControlCluster::StopMoveStep(Callback::Cancelable * onSuccessCal
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // optionsMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsMask));
     // optionsOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionsOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, optionsMask, optionsOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -3466,9 +3450,11 @@ CHIP_ERROR DoorLockCluster::ClearHolidaySchedule(Callback::Cancelable * onSucces
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // scheduleId: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), scheduleId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, scheduleId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -3507,9 +3493,11 @@ CHIP_ERROR DoorLockCluster::ClearPin(Callback::Cancelable * onSuccessCallback, C
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // userId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), userId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, userId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -3548,9 +3536,11 @@ CHIP_ERROR DoorLockCluster::ClearRfid(Callback::Cancelable * onSuccessCallback,
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // userId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), userId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, userId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -3589,11 +3579,12 @@ CHIP_ERROR DoorLockCluster::ClearWeekdaySchedule(Callback::Cancelable * onSucces
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // scheduleId: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), scheduleId));
     // userId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), userId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, scheduleId, userId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -3632,11 +3623,12 @@ CHIP_ERROR DoorLockCluster::ClearYeardaySchedule(Callback::Cancelable * onSucces
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // scheduleId: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), scheduleId));
     // userId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), userId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, scheduleId, userId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -3675,9 +3667,11 @@ CHIP_ERROR DoorLockCluster::GetHolidaySchedule(Callback::Cancelable * onSuccessC
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // scheduleId: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), scheduleId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, scheduleId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -3716,9 +3710,11 @@ CHIP_ERROR DoorLockCluster::GetLogRecord(Callback::Cancelable * onSuccessCallbac
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // logIndex: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), logIndex));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, logIndex));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -3757,9 +3753,11 @@ CHIP_ERROR DoorLockCluster::GetPin(Callback::Cancelable * onSuccessCallback, Cal
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // userId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), userId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, userId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -3798,9 +3796,11 @@ CHIP_ERROR DoorLockCluster::GetRfid(Callback::Cancelable * onSuccessCallback, Ca
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // userId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), userId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, userId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -3839,9 +3839,11 @@ CHIP_ERROR DoorLockCluster::GetUserType(Callback::Cancelable * onSuccessCallback
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // userId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), userId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, userId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -3880,11 +3882,12 @@ CHIP_ERROR DoorLockCluster::GetWeekdaySchedule(Callback::Cancelable * onSuccessC
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // scheduleId: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), scheduleId));
     // userId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), userId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, scheduleId, userId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -3923,11 +3926,12 @@ CHIP_ERROR DoorLockCluster::GetYeardaySchedule(Callback::Cancelable * onSuccessC
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // scheduleId: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), scheduleId));
     // userId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), userId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, scheduleId, userId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -4008,15 +4012,14 @@ CHIP_ERROR DoorLockCluster::SetHolidaySchedule(Callback::Cancelable * onSuccessC
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint32_t, uint32_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // scheduleId: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), scheduleId));
     // localStartTime: int32u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), localStartTime));
     // localEndTime: int32u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), localEndTime));
     // operatingModeDuringHoliday: enum8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), operatingModeDuringHoliday));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, scheduleId, localStartTime, localEndTime, operatingModeDuringHoliday));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -4149,11 +4152,12 @@ CHIP_ERROR DoorLockCluster::SetUserType(Callback::Cancelable * onSuccessCallback
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // userId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), userId));
     // userType: doorLockUserType
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), userType));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, userId, userType));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -4193,21 +4197,17 @@ CHIP_ERROR DoorLockCluster::SetWeekdaySchedule(Callback::Cancelable * onSuccessC
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // scheduleId: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), scheduleId));
     // userId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), userId));
     // daysMask: doorLockDayOfWeek
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), daysMask));
     // startHour: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), startHour));
     // startMinute: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), startMinute));
     // endHour: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), endHour));
     // endMinute: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), endMinute));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, scheduleId, userId, daysMask, startHour, startMinute, endHour, endMinute));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -4246,15 +4246,14 @@ CHIP_ERROR DoorLockCluster::SetYeardaySchedule(Callback::Cancelable * onSuccessC
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint32_t, uint32_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // scheduleId: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), scheduleId));
     // userId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), userId));
     // localStartTime: int32u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), localStartTime));
     // localEndTime: int32u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), localEndTime));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, scheduleId, userId, localStartTime, localEndTime));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -5172,11 +5171,12 @@ CHIP_ERROR GroupsCluster::GetGroupMembership(Callback::Cancelable * onSuccessCal
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // groupCount: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), groupCount));
     // groupList: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), groupList));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, groupCount, groupList));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -5253,9 +5253,11 @@ CHIP_ERROR GroupsCluster::RemoveGroup(Callback::Cancelable * onSuccessCallback,
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // groupId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), groupId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, groupId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -5294,9 +5296,11 @@ CHIP_ERROR GroupsCluster::ViewGroup(Callback::Cancelable * onSuccessCallback, Ca
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // groupId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), groupId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, groupId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -5367,9 +5371,11 @@ CHIP_ERROR IdentifyCluster::Identify(Callback::Cancelable * onSuccessCallback, C
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // identifyTime: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), identifyTime));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, identifyTime));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -5486,9 +5492,11 @@ CHIP_ERROR KeypadInputCluster::SendKey(Callback::Cancelable * onSuccessCallback,
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // keyCode: keypadInputCecKeyCode
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), keyCode));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, keyCode));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -5548,15 +5556,14 @@ CHIP_ERROR LevelControlCluster::Move(Callback::Cancelable * onSuccessCallback, C
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // moveMode: moveMode
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), moveMode));
     // rate: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), rate));
     // optionMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionMask));
     // optionOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, moveMode, rate, optionMask, optionOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -5595,15 +5602,14 @@ CHIP_ERROR LevelControlCluster::MoveToLevel(Callback::Cancelable * onSuccessCall
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // level: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), level));
     // transitionTime: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), transitionTime));
     // optionMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionMask));
     // optionOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, level, transitionTime, optionMask, optionOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -5686,11 +5692,12 @@ CHIP_ERROR LevelControlCluster::MoveWithOnOff(Callback::Cancelable * onSuccessCa
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // moveMode: moveMode
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), moveMode));
     // rate: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), rate));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, moveMode, rate));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -5730,17 +5737,15 @@ CHIP_ERROR LevelControlCluster::Step(Callback::Cancelable * onSuccessCallback, C
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint16_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // stepMode: stepMode
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), stepMode));
     // stepSize: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), stepSize));
     // transitionTime: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), transitionTime));
     // optionMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionMask));
     // optionOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, stepMode, stepSize, transitionTime, optionMask, optionOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -5779,13 +5784,13 @@ CHIP_ERROR LevelControlCluster::StepWithOnOff(Callback::Cancelable * onSuccessCa
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // stepMode: stepMode
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), stepMode));
     // stepSize: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), stepSize));
     // transitionTime: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), transitionTime));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, stepMode, stepSize, transitionTime));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -5824,11 +5829,12 @@ CHIP_ERROR LevelControlCluster::Stop(Callback::Cancelable * onSuccessCallback, C
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // optionMask: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionMask));
     // optionOverride: bitmap8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), optionOverride));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, optionMask, optionOverride));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -6092,9 +6098,11 @@ CHIP_ERROR MediaInputCluster::SelectInput(Callback::Cancelable * onSuccessCallba
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // index: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), index));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, index));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -6444,9 +6452,11 @@ CHIP_ERROR MediaPlaybackCluster::MediaSeek(Callback::Cancelable * onSuccessCallb
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint64_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // position: int64u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), position));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, position));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -7380,11 +7390,12 @@ CHIP_ERROR OnOffCluster::OffWithEffect(Callback::Cancelable * onSuccessCallback,
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // effectId: onOffEffectIdentifier
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), effectId));
     // effectVariant: enum8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), effectVariant));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, effectId, effectVariant));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -7499,13 +7510,13 @@ CHIP_ERROR OnOffCluster::OnWithTimedOff(Callback::Cancelable * onSuccessCallback
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint16_t, uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // onOffControl: onOffControl
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), onOffControl));
     // onTime: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), onTime));
     // offWaitTime: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), offWaitTime));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, onOffControl, onTime, offWaitTime));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -8411,9 +8422,11 @@ CHIP_ERROR ScenesCluster::GetSceneMembership(Callback::Cancelable * onSuccessCal
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // groupId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), groupId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, groupId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -8452,13 +8465,13 @@ CHIP_ERROR ScenesCluster::RecallScene(Callback::Cancelable * onSuccessCallback,
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint8_t, uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // groupId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), groupId));
     // sceneId: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), sceneId));
     // transitionTime: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), transitionTime));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, groupId, sceneId, transitionTime));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -8497,9 +8510,11 @@ CHIP_ERROR ScenesCluster::RemoveAllScenes(Callback::Cancelable * onSuccessCallba
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // groupId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), groupId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, groupId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -8538,11 +8553,12 @@ CHIP_ERROR ScenesCluster::RemoveScene(Callback::Cancelable * onSuccessCallback,
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // groupId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), groupId));
     // sceneId: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), sceneId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, groupId, sceneId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -8581,11 +8597,12 @@ CHIP_ERROR ScenesCluster::StoreScene(Callback::Cancelable * onSuccessCallback, C
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // groupId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), groupId));
     // sceneId: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), sceneId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, groupId, sceneId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -8624,11 +8641,12 @@ CHIP_ERROR ScenesCluster::ViewScene(Callback::Cancelable * onSuccessCallback, Ca
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // groupId: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), groupId));
     // sceneId: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), sceneId));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, groupId, sceneId));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -8963,9 +8981,11 @@ CHIP_ERROR TvChannelCluster::SkipChannel(Callback::Cancelable * onSuccessCallbac
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // count: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), count));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, count));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -9896,11 +9916,12 @@ CHIP_ERROR ThermostatCluster::GetWeeklySchedule(Callback::Cancelable * onSuccess
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // daysToReturn: dayOfWeek
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), daysToReturn));
     // modeToReturn: modeForSequence
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), modeToReturn));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, daysToReturn, modeToReturn));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -9940,15 +9961,15 @@ CHIP_ERROR ThermostatCluster::SetWeeklySchedule(Callback::Cancelable * onSuccess
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, uint8_t, uint8_t, uint8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // numberOfTransitionsForSequence: enum8
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), numberOfTransitionsForSequence));
     // dayOfWeekForSequence: dayOfWeek
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), dayOfWeekForSequence));
     // modeForSequence: modeForSequence
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), modeForSequence));
     // payload: int8u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), payload));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, numberOfTransitionsForSequence, dayOfWeekForSequence, modeForSequence,
+                                               payload));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -9987,11 +10008,12 @@ CHIP_ERROR ThermostatCluster::SetpointRaiseLower(Callback::Cancelable * onSucces
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint8_t, int8_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // mode: setpointAdjustMode
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), mode));
     // amount: int8s
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), amount));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, mode, amount));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -11135,9 +11157,11 @@ CHIP_ERROR WindowCoveringCluster::GoToLiftValue(Callback::Cancelable * onSuccess
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // liftValue: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), liftValue));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, liftValue));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -11220,9 +11244,11 @@ CHIP_ERROR WindowCoveringCluster::GoToTiltValue(Callback::Cancelable * onSuccess
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
+    using ArgumentsCodec = TLV::ContextStructCodec<uint16_t>;
+
     VerifyOrExit((writer = sender->GetCommandDataElementTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     // tiltValue: int16u
-    SuccessOrExit(err = writer->Put(TLV::ContextTag(argSeqNumber++), tiltValue));
+    SuccessOrExit(err = ArgumentsCodec::Encode(*writer, tiltValue));
 
     SuccessOrExit(err = sender->FinishCommand());
 
@@ -179,6 +179,229 @@ using HKDF_sha_crypto = HKDF_shaHSM;
 using HKDF_sha_crypto = HKDF_sha;
 #endif
 
+AES_CCM_Context::AES_CCM_Context() : mKeyLength(0), mCipherReady(false), mStream() {}
+
+AES_CCM_Context::AES_CCM_Context(const AES_CCM_Context & other) : mKeyLength(0), mCipherReady(false), mStream()
+{
+    *this = other;
+}
+
+AES_CCM_Context & AES_CCM_Context::operator=(const AES_CCM_Context & other)
+{
+    if (this != &other)
+    {
+        Clear();
+        // Cipher state is not shared between copies; this one is set up on first use.
+        memcpy(mKey, other.mKey, other.mKeyLength);
+        mKeyLength = other.mKeyLength;
+    }
+    return *this;
+}
+
+AES_CCM_Context::~AES_CCM_Context()
+{
+    Clear();
+}
+
+CHIP_ERROR AES_CCM_Context::Init(const uint8_t * key, size_t key_length)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(key_length == kAES_CCM128_Key_Length || key_length == kAES_CCM256_Key_Length, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Clear();
+    memcpy(mKey, key, key_length);
+    mKeyLength = key_length;
+
+    const CHIP_ERROR err = PrepareCipher();
+    if (err != CHIP_NO_ERROR)
+    {
+        Clear();
+    }
+
+    return err;
+}
+
+CHIP_ERROR AES_CCM_Context::PrepareCipher()
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    if (!mCipherReady)
+    {
+        ReturnErrorOnFailure(SetupCipher());
+        mCipherReady = true;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void AES_CCM_Context::Clear()
+{
+    if (mCipherReady)
+    {
+        ReleaseCipher();
+        mCipherReady = false;
+    }
+    ClearSecretData(mKey, sizeof(mKey));
+    ClearSecretData(reinterpret_cast<uint8_t *>(&mStream), sizeof(mStream));
+    mKeyLength = 0;
+}
+
+CHIP_ERROR AES_CCM_Context::BeginEncrypt(size_t plaintext_length, const uint8_t * aad, size_t aad_length, const uint8_t * iv,
+                                         size_t iv_length, size_t tag_length)
+{
+    mStream.mActive = false;
+
+    VerifyOrReturnError(plaintext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length >= 7 && iv_length <= 13, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag_length == 8 || tag_length == 12 || tag_length == 16, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The block index, and the message length in the first MAC block, take the bytes that the IV leaves.
+    const size_t counterLength = kAES_CCM_Block_Length - 1 - iv_length;
+    uint64_t length            = plaintext_length;
+    VerifyOrReturnError(counterLength >= sizeof(length) || (length >> (8 * counterLength)) == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(PrepareCipher());
+
+    // The first MAC block holds flags, the IV and the message length.
+    uint8_t * const mac = mStream.mMac;
+    mac[0]              = static_cast<uint8_t>((aad_length > 0 ? 0x40 : 0) | (((tag_length - 2) / 2) << 3) | (counterLength - 1));
+    memcpy(&mac[1], iv, iv_length);
+    for (size_t i = kAES_CCM_Block_Length - 1; i > iv_length; i--)
+    {
+        mac[i] = static_cast<uint8_t>(length);
+        length >>= 8;
+    }
+    ReturnErrorOnFailure(EncryptBlock(mac, mac));
+    mStream.mMacUsed = 0;
+
+    if (aad_length > 0)
+    {
+        // The AAD is preceded by its length, encoded in 2, 6 or 10 bytes.
+        uint8_t aadHeader[10];
+        size_t aadHeaderLength = 2;
+        size_t aadLengthStart  = 0;
+        uint64_t aadLength     = aad_length;
+        if (aadLength >= 0xFF00)
+        {
+            aadHeader[0]    = 0xFF;
+            aadHeader[1]    = (aadLength <= UINT32_MAX) ? 0xFE : 0xFF;
+            aadHeaderLength = (aadLength <= UINT32_MAX) ? 6 : 10;
+            aadLengthStart  = 2;
+        }
+        for (size_t i = aadHeaderLength; i > aadLengthStart; i--)
+        {
+            aadHeader[i - 1] = static_cast<uint8_t>(aadLength);
+            aadLength >>= 8;
+        }
+
+        ReturnErrorOnFailure(AddToMac(aadHeader, aadHeaderLength));
+        ReturnErrorOnFailure(AddToMac(aad, aad_length));
+        ReturnErrorOnFailure(PadMac());
+    }
+
+    // Counter blocks hold flags, the IV and the block index; block 0 encrypts the tag and the message starts at block 1.
+    uint8_t * const counter = mStream.mCounter;
+    counter[0]              = static_cast<uint8_t>(counterLength - 1);
+    memcpy(&counter[1], iv, iv_length);
+    memset(&counter[1 + iv_length], 0, counterLength);
+
+    mStream.mRemaining     = plaintext_length;
+    mStream.mTagLength     = tag_length;
+    mStream.mKeyStreamUsed = kAES_CCM_Block_Length;
+    mStream.mCounterLength = static_cast<uint8_t>(counterLength);
+    mStream.mActive        = true;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM_Context::EncryptData(const uint8_t * plaintext, size_t length, uint8_t * ciphertext)
+{
+    VerifyOrReturnError(mStream.mActive, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(length <= mStream.mRemaining, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(length == 0 || (plaintext != nullptr && ciphertext != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
+
+    mStream.mActive = false;
+
+    // The MAC covers the plaintext, so it is taken in before the plaintext is overwritten when encrypting in place.
+    for (size_t i = 0; i < length; i++)
+    {
+        const uint8_t byte = plaintext[i];
+
+        mStream.mMac[mStream.mMacUsed++] ^= byte;
+        if (mStream.mMacUsed == kAES_CCM_Block_Length)
+        {
+            ReturnErrorOnFailure(EncryptBlock(mStream.mMac, mStream.mMac));
+            mStream.mMacUsed = 0;
+        }
+
+        if (mStream.mKeyStreamUsed == kAES_CCM_Block_Length)
+        {
+            // The index cannot overflow into the IV, as BeginEncrypt() checked that the message length fits.
+            for (size_t j = kAES_CCM_Block_Length - 1; ++mStream.mCounter[j] == 0; j--)
+            {
+            }
+            ReturnErrorOnFailure(EncryptBlock(mStream.mCounter, mStream.mKeyStream));
+            mStream.mKeyStreamUsed = 0;
+        }
+        ciphertext[i] = static_cast<uint8_t>(byte ^ mStream.mKeyStream[mStream.mKeyStreamUsed++]);
+    }
+
+    mStream.mRemaining -= length;
+    mStream.mActive = true;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM_Context::FinishEncrypt(uint8_t * tag, size_t tag_length)
+{
+    VerifyOrReturnError(mStream.mActive, CHIP_ERROR_INCORRECT_STATE);
+    mStream.mActive = false;
+
+    VerifyOrReturnError(mStream.mRemaining == 0, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag_length == mStream.mTagLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(PadMac());
+
+    // The tag is the MAC encrypted with counter block 0.
+    memset(&mStream.mCounter[kAES_CCM_Block_Length - mStream.mCounterLength], 0, mStream.mCounterLength);
+    ReturnErrorOnFailure(EncryptBlock(mStream.mCounter, mStream.mKeyStream));
+    for (size_t i = 0; i < tag_length; i++)
+    {
+        tag[i] = static_cast<uint8_t>(mStream.mMac[i] ^ mStream.mKeyStream[i]);
+    }
+
+    ClearSecretData(reinterpret_cast<uint8_t *>(&mStream), sizeof(mStream));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM_Context::AddToMac(const uint8_t * data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        mStream.mMac[mStream.mMacUsed++] ^= data[i];
+        if (mStream.mMacUsed == kAES_CCM_Block_Length)
+        {
+            ReturnErrorOnFailure(EncryptBlock(mStream.mMac, mStream.mMac));
+            mStream.mMacUsed = 0;
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM_Context::PadMac()
+{
+    // XORing in zeros leaves the block as it is.
+    if (mStream.mMacUsed > 0)
+    {
+        ReturnErrorOnFailure(EncryptBlock(mStream.mMac, mStream.mMac));
+        mStream.mMacUsed = 0;
+    }
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR Spake2p::InternalHash(const uint8_t * in, size_t in_len)
 {
     const uint64_t u64_len = in_len;
@@ -58,6 +58,10 @@ constexpr size_t CHIP_CRYPTO_HASH_LEN_BYTES = kSHA256_Hash_Length;
 constexpr size_t kMin_Salt_Length = 8;
 constexpr size_t kMax_Salt_Length = 16;
 
+constexpr size_t kAES_CCM128_Key_Length = 16;
+constexpr size_t kAES_CCM256_Key_Length = 32;
+constexpr size_t kAES_CCM_Block_Length  = 16;
+
 constexpr size_t kP256_PrivateKey_Length = CHIP_CRYPTO_GROUP_SIZE_BYTES;
 constexpr size_t kP256_PublicKey_Length  = CHIP_CRYPTO_PUBLIC_KEY_SIZE_BYTES;
 
@@ -68,6 +72,7 @@ constexpr size_t kP256_PublicKey_Length  = CHIP_CRYPTO_PUBLIC_KEY_SIZE_BYTES;
 constexpr size_t kMAX_Spake2p_Context_Size     = 1024;
 constexpr size_t kMAX_Hash_SHA256_Context_Size = 296;
 constexpr size_t kMAX_P256Keypair_Context_Size = 512;
+constexpr size_t kMAX_AES_CCM_Context_Size     = 384;
 
 /*
  * Overhead to encode a raw ECDSA signature in X9.62 format in ASN.1 DER
@@ -439,6 +444,123 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                            const uint8_t * tag, size_t tag_length, const uint8_t * key, size_t key_length, const uint8_t * iv,
                            size_t iv_length, uint8_t * plaintext);
 
+struct alignas(size_t) AESCCMOpaqueContext
+{
+    uint8_t mOpaque[kMAX_AES_CCM_Context_Size];
+};
+
+/**
+ * @brief AES-CCM encryption and decryption under a single key.
+ *
+ * AES_CCM_encrypt() and AES_CCM_decrypt() set up a cipher and expand the key for every message. A context
+ * does that once, in Init(), and afterwards only resets the per-message state, which makes it the better fit
+ * for a key that protects many messages. Results are identical to those of the one-shot functions given the
+ * same arguments, and the input and output buffers may be the same buffer to process a message in place.
+ * A context is cheapest when kept to one direction and one IV and tag length, as the cipher may have to be
+ * set up again when those change from one message to the next.
+ *
+ * A copy holds the same key as the original, and sets up its own cipher state the first time it is used.
+ */
+class AES_CCM_Context
+{
+public:
+    AES_CCM_Context();
+    AES_CCM_Context(const AES_CCM_Context & other);
+    AES_CCM_Context & operator=(const AES_CCM_Context & other);
+    ~AES_CCM_Context();
+
+    /**
+     * @brief Load a key and prepare the cipher for it, replacing any previous key.
+     *
+     * @param key Encryption key
+     * @param key_length Length of encryption key (in bytes), kAES_CCM128_Key_Length or kAES_CCM256_Key_Length
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR Init(const uint8_t * key, size_t key_length);
+
+    /** @brief Whether a key has been loaded with Init(). */
+    bool IsInitialized() const { return mKeyLength != 0; }
+
+    /**
+     * @brief Encrypt a message with the loaded key, as AES_CCM_encrypt() does.
+     *
+     * @a ciphertext may be the same buffer as @a plaintext.
+     **/
+    CHIP_ERROR Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * iv, size_t iv_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length);
+
+    /**
+     * @brief Decrypt and verify a message with the loaded key, as AES_CCM_decrypt() does.
+     *
+     * @a plaintext may be the same buffer as @a ciphertext.
+     **/
+    CHIP_ERROR Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * tag, size_t tag_length, const uint8_t * iv, size_t iv_length, uint8_t * plaintext);
+
+    /**
+     * @brief Start encrypting a message that is passed in parts to EncryptData(), e.g. one that is spread over several buffers.
+     *
+     * The ciphertext and tag are identical to those that Encrypt() produces for the whole message with the same arguments.
+     * The message is complete once EncryptData() has been given @a plaintext_length bytes in total, after which
+     * FinishEncrypt() produces the tag. Starting another message abandons the one in progress, as does any error.
+     **/
+    CHIP_ERROR BeginEncrypt(size_t plaintext_length, const uint8_t * aad, size_t aad_length, const uint8_t * iv, size_t iv_length,
+                            size_t tag_length);
+
+    /**
+     * @brief Encrypt the next @a length bytes of the message started with BeginEncrypt().
+     *
+     * @a ciphertext may be the same buffer as @a plaintext.
+     **/
+    CHIP_ERROR EncryptData(const uint8_t * plaintext, size_t length, uint8_t * ciphertext);
+
+    /**
+     * @brief Complete the message started with BeginEncrypt() and output its tag of the length given there.
+     **/
+    CHIP_ERROR FinishEncrypt(uint8_t * tag, size_t tag_length);
+
+    /** @brief Forget the key and release the cipher state. */
+    void Clear();
+
+private:
+    // State of a message encrypted in parts: CCM computes a CBC-MAC over the message and encrypts it in counter mode.
+    struct StreamState
+    {
+        uint8_t mMac[kAES_CCM_Block_Length];       // The MAC so far, with the input of the current block XORed in.
+        uint8_t mCounter[kAES_CCM_Block_Length];   // The counter block of the key stream block in use.
+        uint8_t mKeyStream[kAES_CCM_Block_Length]; // The key stream block in use.
+        size_t mRemaining;                         // Bytes of the message still to come.
+        size_t mTagLength;
+        uint8_t mMacUsed;       // Bytes of the current block already in mMac.
+        uint8_t mKeyStreamUsed; // Bytes of mKeyStream already used.
+        uint8_t mCounterLength; // Bytes at the end of a counter block that hold the block index.
+        bool mActive;
+    };
+
+    // Makes sure the cipher state exists for the loaded key, setting it up for a copied context.
+    CHIP_ERROR PrepareCipher();
+
+    // Adds @a length bytes of input to the MAC of the message in progress.
+    CHIP_ERROR AddToMac(const uint8_t * data, size_t length);
+
+    // Completes the MAC block in progress, padding it with zeros.
+    CHIP_ERROR PadMac();
+
+    // Implemented by the crypto backend.
+    CHIP_ERROR SetupCipher();
+    void ReleaseCipher();
+
+    // Encrypts a single block of kAES_CCM_Block_Length bytes with the loaded key, after PrepareCipher(); implemented by the
+    // crypto backend. @a output may be the same buffer as @a input.
+    CHIP_ERROR EncryptBlock(const uint8_t * input, uint8_t * output);
+
+    uint8_t mKey[kAES_CCM256_Key_Length];
+    size_t mKeyLength;
+    bool mCipherReady;
+    StreamState mStream;
+    AESCCMOpaqueContext mContext;
+};
+
 /**
  * @brief Verify the Certificate Signing Request (CSR). If successfully verified, it outputs the public key from the CSR.
  * @param csr CSR in DER format
@@ -280,6 +280,233 @@ exit:
     return error;
 }
 
+typedef struct AES_CCM_CipherContext
+{
+    EVP_CIPHER_CTX * cipher;
+    // AES-ECB under the same key, for the single blocks of messages encrypted in parts; set up on first use.
+    EVP_CIPHER_CTX * block_cipher;
+    // OpenSSL fixes the direction and the IV and tag lengths when the key is set, so the key is set again
+    // whenever a message differs from the previous one in any of them.
+    int encrypt;
+    size_t iv_length;
+    size_t tag_length;
+} AES_CCM_CipherContext;
+
+static inline AES_CCM_CipherContext * to_inner_aes_ccm_context(AESCCMOpaqueContext * context)
+{
+    return SafePointerCast<AES_CCM_CipherContext *>(context);
+}
+
+CHIP_ERROR AES_CCM_Context::SetupCipher()
+{
+    AES_CCM_CipherContext * const context = to_inner_aes_ccm_context(&mContext);
+    int result                            = 1;
+
+    // 16 bytes key for AES-CCM-128
+    const EVP_CIPHER * type = (mKeyLength == kAES_CCM128_Key_Length) ? EVP_aes_128_ccm() : EVP_aes_256_ccm();
+
+    context->cipher       = EVP_CIPHER_CTX_new();
+    context->block_cipher = nullptr;
+    context->encrypt      = -1;
+    context->iv_length    = 0;
+    context->tag_length   = 0;
+    VerifyOrReturnError(context->cipher != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    result = EVP_EncryptInit_ex(context->cipher, type, nullptr, nullptr, nullptr);
+    if (result != 1)
+    {
+        ReleaseCipher();
+        return CHIP_ERROR_INTERNAL;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void AES_CCM_Context::ReleaseCipher()
+{
+    AES_CCM_CipherContext * const context = to_inner_aes_ccm_context(&mContext);
+
+    // Freeing the contexts also clears the expanded keys.
+    EVP_CIPHER_CTX_free(context->cipher);
+    EVP_CIPHER_CTX_free(context->block_cipher);
+    context->cipher       = nullptr;
+    context->block_cipher = nullptr;
+}
+
+CHIP_ERROR AES_CCM_Context::EncryptBlock(const uint8_t * input, uint8_t * output)
+{
+    AES_CCM_CipherContext * const context = to_inner_aes_ccm_context(&mContext);
+    int bytesWritten                      = 0;
+    int result                            = 1;
+
+    if (context->block_cipher == nullptr)
+    {
+        const EVP_CIPHER * type = (mKeyLength == kAES_CCM128_Key_Length) ? EVP_aes_128_ecb() : EVP_aes_256_ecb();
+
+        context->block_cipher = EVP_CIPHER_CTX_new();
+        VerifyOrReturnError(context->block_cipher != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        result = EVP_EncryptInit_ex(context->block_cipher, type, nullptr, Uint8::to_const_uchar(mKey), nullptr);
+        if (result == 1)
+        {
+            result = EVP_CIPHER_CTX_set_padding(context->block_cipher, 0);
+        }
+        if (result != 1)
+        {
+            EVP_CIPHER_CTX_free(context->block_cipher);
+            context->block_cipher = nullptr;
+            return CHIP_ERROR_INTERNAL;
+        }
+    }
+
+    // ECB does not chain blocks, so the context can be reused for every block without resetting it.
+    result = EVP_EncryptUpdate(context->block_cipher, Uint8::to_uchar(output), &bytesWritten, Uint8::to_const_uchar(input),
+                               static_cast<int>(kAES_CCM_Block_Length));
+    VerifyOrReturnError(result == 1 && bytesWritten == static_cast<int>(kAES_CCM_Block_Length), CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR _setupAESCCMCipher(AES_CCM_CipherContext * context, const uint8_t * key, int encrypt, size_t iv_length,
+                                     size_t tag_length)
+{
+    int result = 1;
+
+    if (context->encrypt == encrypt && context->iv_length == iv_length && context->tag_length == tag_length)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    // Invalidate until the key has been set with the new parameters.
+    context->encrypt    = -1;
+    context->iv_length  = 0;
+    context->tag_length = 0;
+
+    // Casts are safe because the callers checked with CanCastTo and _isValidTagLength.
+    result = EVP_CIPHER_CTX_ctrl(context->cipher, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(iv_length), nullptr);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    result = EVP_CIPHER_CTX_ctrl(context->cipher, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    result = EVP_CipherInit_ex(context->cipher, nullptr, nullptr, Uint8::to_const_uchar(key), nullptr, encrypt);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    context->encrypt    = encrypt;
+    context->iv_length  = iv_length;
+    context->tag_length = tag_length;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM_Context::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                    const uint8_t * iv, size_t iv_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length)
+{
+    int bytesWritten = 0;
+    int result       = 1;
+
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(plaintext_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(iv_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(PrepareCipher());
+
+    AES_CCM_CipherContext * const context = to_inner_aes_ccm_context(&mContext);
+    ReturnErrorOnFailure(_setupAESCCMCipher(context, mKey, 1, iv_length, tag_length));
+
+    // Pass in iv; the expanded key is kept from the previous message.
+    result = EVP_EncryptInit_ex(context->cipher, nullptr, nullptr, nullptr, Uint8::to_const_uchar(iv));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in plain text length
+    result = EVP_EncryptUpdate(context->cipher, nullptr, &bytesWritten, nullptr, static_cast<int>(plaintext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in AAD
+    if (aad_length > 0 && aad != nullptr)
+    {
+        result =
+            EVP_EncryptUpdate(context->cipher, nullptr, &bytesWritten, Uint8::to_const_uchar(aad), static_cast<int>(aad_length));
+        VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    }
+
+    // Encrypt. CCM does not buffer, so all of the ciphertext is output here and finalization only produces the tag.
+    result = EVP_EncryptUpdate(context->cipher, Uint8::to_uchar(ciphertext), &bytesWritten, Uint8::to_const_uchar(plaintext),
+                               static_cast<int>(plaintext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(bytesWritten >= 0 && static_cast<size_t>(bytesWritten) == plaintext_length, CHIP_ERROR_INTERNAL);
+
+    result = EVP_EncryptFinal_ex(context->cipher, ciphertext + plaintext_length, &bytesWritten);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(bytesWritten == 0, CHIP_ERROR_INTERNAL);
+
+    // Get tag
+    result = EVP_CIPHER_CTX_ctrl(context->cipher, EVP_CTRL_CCM_GET_TAG, static_cast<int>(tag_length), Uint8::to_uchar(tag));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM_Context::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                    const uint8_t * tag, size_t tag_length, const uint8_t * iv, size_t iv_length,
+                                    uint8_t * plaintext)
+{
+    int bytesOutput = 0;
+    int result      = 1;
+
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(ciphertext_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(iv_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(PrepareCipher());
+
+    AES_CCM_CipherContext * const context = to_inner_aes_ccm_context(&mContext);
+    ReturnErrorOnFailure(_setupAESCCMCipher(context, mKey, 0, iv_length, tag_length));
+
+    // Pass in iv, then the expected tag, which can only be set while decrypting.
+    result = EVP_DecryptInit_ex(context->cipher, nullptr, nullptr, nullptr, Uint8::to_const_uchar(iv));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Removing "const" from |tag| here should hopefully be safe as
+    // we're writing the tag, not reading.
+    result = EVP_CIPHER_CTX_ctrl(context->cipher, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
+                                 const_cast<void *>(static_cast<const void *>(tag)));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in cipher text length
+    result = EVP_DecryptUpdate(context->cipher, nullptr, &bytesOutput, nullptr, static_cast<int>(ciphertext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in aad
+    if (aad_length > 0 && aad != nullptr)
+    {
+        result =
+            EVP_DecryptUpdate(context->cipher, nullptr, &bytesOutput, Uint8::to_const_uchar(aad), static_cast<int>(aad_length));
+        VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    }
+
+    // Pass in ciphertext. We wont get anything if validation fails.
+    result = EVP_DecryptUpdate(context->cipher, Uint8::to_uchar(plaintext), &bytesOutput, Uint8::to_const_uchar(ciphertext),
+                               static_cast<int>(ciphertext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     // zero data length hash is supported.
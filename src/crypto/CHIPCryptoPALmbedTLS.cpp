@@ -26,6 +26,7 @@
 
 #include <mbedtls/bignum.h>
 #include <mbedtls/ccm.h>
+#include <mbedtls/cipher.h>
 #include <mbedtls/ctr_drbg.h>
 #include <mbedtls/ecdh.h>
 #include <mbedtls/ecdsa.h>
@@ -179,6 +180,132 @@ exit:
     return error;
 }
 
+// The CCM context computes whole messages; the AES-ECB cipher context encrypts the single blocks of the streaming API.
+struct AES_CCM_BackendContext
+{
+    mbedtls_ccm_context ccm;
+    mbedtls_cipher_context_t block;
+};
+
+static inline AES_CCM_BackendContext * to_inner_aes_ccm_context(AESCCMOpaqueContext * context)
+{
+    return SafePointerCast<AES_CCM_BackendContext *>(context);
+}
+
+CHIP_ERROR AES_CCM_Context::SetupCipher()
+{
+    AES_CCM_BackendContext * const context = to_inner_aes_ccm_context(&mContext);
+    CHIP_ERROR error                       = CHIP_NO_ERROR;
+    int result                             = 0;
+
+    // Size of key = key_length * number of bits in a byte (8)
+    // Cast is safe because Init() only accepts 16 or 32 byte keys.
+    const int keyBits = static_cast<int>(mKeyLength * 8);
+    const mbedtls_cipher_info_t * const blockCipher =
+        mbedtls_cipher_info_from_values(MBEDTLS_CIPHER_ID_AES, keyBits, MBEDTLS_MODE_ECB);
+
+    mbedtls_ccm_init(&context->ccm);
+    mbedtls_cipher_init(&context->block);
+    VerifyOrExit(blockCipher != nullptr, error = CHIP_ERROR_INTERNAL);
+
+    result =
+        mbedtls_ccm_setkey(&context->ccm, MBEDTLS_CIPHER_ID_AES, Uint8::to_const_uchar(mKey), static_cast<unsigned int>(keyBits));
+    _log_mbedTLS_error(result);
+    VerifyOrExit(result == 0, error = CHIP_ERROR_INTERNAL);
+
+    result = mbedtls_cipher_setup(&context->block, blockCipher);
+    _log_mbedTLS_error(result);
+    VerifyOrExit(result == 0, error = CHIP_ERROR_INTERNAL);
+
+    result = mbedtls_cipher_setkey(&context->block, Uint8::to_const_uchar(mKey), keyBits, MBEDTLS_ENCRYPT);
+    _log_mbedTLS_error(result);
+    VerifyOrExit(result == 0, error = CHIP_ERROR_INTERNAL);
+
+exit:
+    if (error != CHIP_NO_ERROR)
+    {
+        mbedtls_cipher_free(&context->block);
+        mbedtls_ccm_free(&context->ccm);
+    }
+    return error;
+}
+
+void AES_CCM_Context::ReleaseCipher()
+{
+    AES_CCM_BackendContext * const context = to_inner_aes_ccm_context(&mContext);
+
+    mbedtls_cipher_free(&context->block);
+    mbedtls_ccm_free(&context->ccm);
+}
+
+CHIP_ERROR AES_CCM_Context::EncryptBlock(const uint8_t * input, uint8_t * output)
+{
+    size_t outputLength = 0;
+
+    const int result = mbedtls_cipher_update(&to_inner_aes_ccm_context(&mContext)->block, Uint8::to_const_uchar(input),
+                                             kAES_CCM_Block_Length, Uint8::to_uchar(output), &outputLength);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0 && outputLength == kAES_CCM_Block_Length, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM_Context::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                    const uint8_t * iv, size_t iv_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length)
+{
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+    if (aad_length > 0)
+    {
+        VerifyOrReturnError(aad != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    ReturnErrorOnFailure(PrepareCipher());
+
+    // The key schedule was computed by mbedtls_ccm_setkey(); every call starts a new message.
+    const int result = mbedtls_ccm_encrypt_and_tag(&to_inner_aes_ccm_context(&mContext)->ccm, plaintext_length,
+                                                   Uint8::to_const_uchar(iv), iv_length, Uint8::to_const_uchar(aad), aad_length,
+                                                   Uint8::to_const_uchar(plaintext), Uint8::to_uchar(ciphertext),
+                                                   Uint8::to_uchar(tag), tag_length);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM_Context::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                    const uint8_t * tag, size_t tag_length, const uint8_t * iv, size_t iv_length,
+                                    uint8_t * plaintext)
+{
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    if (aad_length > 0)
+    {
+        VerifyOrReturnError(aad != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    ReturnErrorOnFailure(PrepareCipher());
+
+    const int result = mbedtls_ccm_auth_decrypt(&to_inner_aes_ccm_context(&mContext)->ccm, ciphertext_length,
+                                                Uint8::to_const_uchar(iv), iv_length, Uint8::to_const_uchar(aad), aad_length,
+                                                Uint8::to_const_uchar(ciphertext), Uint8::to_uchar(plaintext),
+                                                Uint8::to_const_uchar(tag), tag_length);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     // zero data length hash is supported.
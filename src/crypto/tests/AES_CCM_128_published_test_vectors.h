@@ -0,0 +1,129 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file - This file contains AES-CCM test vectors from RFC 3610 and NIST SP 800-38C.
+ */
+
+#pragma once
+
+#include "AES_CCM_128_test_vectors.h"
+
+// RFC 3610, Packet Vector #1
+static const uint8_t rfc3610_packet_1_key[] = { 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd,
+                                                0xce, 0xcf };
+static const uint8_t rfc3610_packet_1_iv[] = { 0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5 };
+static const uint8_t rfc3610_packet_1_aad[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+static const uint8_t rfc3610_packet_1_pt[] = { 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+                                               0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e };
+static const uint8_t rfc3610_packet_1_ct[] = { 0x58, 0x8c, 0x97, 0x9a, 0x61, 0xc6, 0x63, 0xd2, 0xf0, 0x66, 0xd0, 0xc2, 0xc0, 0xf9,
+                                               0x89, 0x80, 0x6d, 0x5f, 0x6b, 0x61, 0xda, 0xc3, 0x84 };
+static const uint8_t rfc3610_packet_1_tag[] = { 0x17, 0xe8, 0xd1, 0x2c, 0xfd, 0xf9, 0x26, 0xe0 };
+static const struct ccm_128_test_vector rfc3610_packet_1_test_vector = { .pt      = rfc3610_packet_1_pt,
+                                                                         .pt_len  = 23,
+                                                                         .aad     = rfc3610_packet_1_aad,
+                                                                         .aad_len = 8,
+                                                                         .key     = rfc3610_packet_1_key,
+                                                                         .key_len = 16,
+                                                                         .iv      = rfc3610_packet_1_iv,
+                                                                         .iv_len  = 13,
+                                                                         .ct      = rfc3610_packet_1_ct,
+                                                                         .ct_len  = 23,
+                                                                         .tag     = rfc3610_packet_1_tag,
+                                                                         .tag_len = 8,
+                                                                         .tcId    = 1,
+                                                                         .result  = CHIP_NO_ERROR };
+
+// RFC 3610, Packet Vector #2
+static const uint8_t rfc3610_packet_2_key[] = { 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd,
+                                                0xce, 0xcf };
+static const uint8_t rfc3610_packet_2_iv[] = { 0x00, 0x00, 0x00, 0x04, 0x03, 0x02, 0x01, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5 };
+static const uint8_t rfc3610_packet_2_aad[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+static const uint8_t rfc3610_packet_2_pt[] = { 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+                                               0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+static const uint8_t rfc3610_packet_2_ct[] = { 0x72, 0xc9, 0x1a, 0x36, 0xe1, 0x35, 0xf8, 0xcf, 0x29, 0x1c, 0xa8, 0x94, 0x08, 0x5c,
+                                               0x87, 0xe3, 0xcc, 0x15, 0xc4, 0x39, 0xc9, 0xe4, 0x3a, 0x3b };
+static const uint8_t rfc3610_packet_2_tag[] = { 0xa0, 0x91, 0xd5, 0x6e, 0x10, 0x40, 0x09, 0x16 };
+static const struct ccm_128_test_vector rfc3610_packet_2_test_vector = { .pt      = rfc3610_packet_2_pt,
+                                                                         .pt_len  = 24,
+                                                                         .aad     = rfc3610_packet_2_aad,
+                                                                         .aad_len = 8,
+                                                                         .key     = rfc3610_packet_2_key,
+                                                                         .key_len = 16,
+                                                                         .iv      = rfc3610_packet_2_iv,
+                                                                         .iv_len  = 13,
+                                                                         .ct      = rfc3610_packet_2_ct,
+                                                                         .ct_len  = 24,
+                                                                         .tag     = rfc3610_packet_2_tag,
+                                                                         .tag_len = 8,
+                                                                         .tcId    = 2,
+                                                                         .result  = CHIP_NO_ERROR };
+
+// RFC 3610, Packet Vector #3
+static const uint8_t rfc3610_packet_3_key[] = { 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd,
+                                                0xce, 0xcf };
+static const uint8_t rfc3610_packet_3_iv[] = { 0x00, 0x00, 0x00, 0x05, 0x04, 0x03, 0x02, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5 };
+static const uint8_t rfc3610_packet_3_aad[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+static const uint8_t rfc3610_packet_3_pt[] = { 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+                                               0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20 };
+static const uint8_t rfc3610_packet_3_ct[] = { 0x51, 0xb1, 0xe5, 0xf4, 0x4a, 0x19, 0x7d, 0x1d, 0xa4, 0x6b, 0x0f, 0x8e, 0x2d, 0x28,
+                                               0x2a, 0xe8, 0x71, 0xe8, 0x38, 0xbb, 0x64, 0xda, 0x85, 0x96, 0x57 };
+static const uint8_t rfc3610_packet_3_tag[] = { 0x4a, 0xda, 0xa7, 0x6f, 0xbd, 0x9f, 0xb0, 0xc5 };
+static const struct ccm_128_test_vector rfc3610_packet_3_test_vector = { .pt      = rfc3610_packet_3_pt,
+                                                                         .pt_len  = 25,
+                                                                         .aad     = rfc3610_packet_3_aad,
+                                                                         .aad_len = 8,
+                                                                         .key     = rfc3610_packet_3_key,
+                                                                         .key_len = 16,
+                                                                         .iv      = rfc3610_packet_3_iv,
+                                                                         .iv_len  = 13,
+                                                                         .ct      = rfc3610_packet_3_ct,
+                                                                         .ct_len  = 25,
+                                                                         .tag     = rfc3610_packet_3_tag,
+                                                                         .tag_len = 8,
+                                                                         .tcId    = 3,
+                                                                         .result  = CHIP_NO_ERROR };
+
+// NIST SP 800-38C, Appendix C.3
+static const uint8_t sp800_38c_example_3_key[] = { 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c,
+                                                   0x4d, 0x4e, 0x4f };
+static const uint8_t sp800_38c_example_3_iv[] = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b };
+static const uint8_t sp800_38c_example_3_aad[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c,
+                                                   0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13 };
+static const uint8_t sp800_38c_example_3_pt[] = { 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c,
+                                                  0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37 };
+static const uint8_t sp800_38c_example_3_ct[] = { 0xe3, 0xb2, 0x01, 0xa9, 0xf5, 0xb7, 0x1a, 0x7a, 0x9b, 0x1c, 0xea, 0xec, 0xcd,
+                                                  0x97, 0xe7, 0x0b, 0x61, 0x76, 0xaa, 0xd9, 0xa4, 0x42, 0x8a, 0xa5 };
+static const uint8_t sp800_38c_example_3_tag[] = { 0x48, 0x43, 0x92, 0xfb, 0xc1, 0xb0, 0x99, 0x51 };
+static const struct ccm_128_test_vector sp800_38c_example_3_test_vector = { .pt      = sp800_38c_example_3_pt,
+                                                                            .pt_len  = 24,
+                                                                            .aad     = sp800_38c_example_3_aad,
+                                                                            .aad_len = 20,
+                                                                            .key     = sp800_38c_example_3_key,
+                                                                            .key_len = 16,
+                                                                            .iv      = sp800_38c_example_3_iv,
+                                                                            .iv_len  = 12,
+                                                                            .ct      = sp800_38c_example_3_ct,
+                                                                            .ct_len  = 24,
+                                                                            .tag     = sp800_38c_example_3_tag,
+                                                                            .tag_len = 8,
+                                                                            .tcId    = 4,
+                                                                            .result  = CHIP_NO_ERROR };
+
+static const struct ccm_128_test_vector * ccm_128_published_test_vectors[] = {
+    &rfc3610_packet_1_test_vector, &rfc3610_packet_2_test_vector, &rfc3610_packet_3_test_vector, &sp800_38c_example_3_test_vector
+};
@@ -17,6 +17,7 @@
 
 #include "TestCryptoLayer.h"
 
+#include "AES_CCM_128_published_test_vectors.h"
 #include "AES_CCM_128_test_vectors.h"
 #include "AES_CCM_256_test_vectors.h"
 #include "DerSigConversion_test_vectors.h"
@@ -45,6 +46,7 @@
 #include <support/ScopedBuffer.h>
 #include <support/UnitTestRegistration.h>
 
+#include <algorithm>
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -604,6 +606,259 @@ static void TestAES_CCM_128DecryptInvalidIVLen(nlTestSuite * inSuite, void * inC
     NL_TEST_ASSERT(inSuite, numOfTestsRan > 0);
 }
 
+static void TestAES_CCM_128ContextTestVectors(nlTestSuite * inSuite, void * inContext)
+{
+    int numOfTestVectors = ArraySize(ccm_128_test_vectors);
+    int numOfTestsRan    = 0;
+    for (int vectorIndex = 0; vectorIndex < numOfTestVectors; vectorIndex++)
+    {
+        const ccm_128_test_vector * vector = ccm_128_test_vectors[vectorIndex];
+        if (vector->pt_len > 0 && vector->result == CHIP_NO_ERROR)
+        {
+            numOfTestsRan++;
+            chip::Platform::ScopedMemoryBuffer<uint8_t> buffer;
+            buffer.Alloc(vector->pt_len);
+            NL_TEST_ASSERT(inSuite, buffer);
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_tag;
+            out_tag.Alloc(vector->tag_len);
+            NL_TEST_ASSERT(inSuite, out_tag);
+
+            AES_CCM_Context context;
+            NL_TEST_ASSERT(inSuite, context.Init(vector->key, vector->key_len) == CHIP_NO_ERROR);
+
+            // The second round reuses the cipher state left by the first.
+            for (int round = 0; round < 2; round++)
+            {
+                memcpy(buffer.Get(), vector->pt, vector->pt_len);
+                CHIP_ERROR err = context.Encrypt(buffer.Get(), vector->pt_len, vector->aad, vector->aad_len, vector->iv,
+                                                 vector->iv_len, buffer.Get(), out_tag.Get(), vector->tag_len);
+                NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+                NL_TEST_ASSERT(inSuite, memcmp(buffer.Get(), vector->ct, vector->ct_len) == 0);
+                NL_TEST_ASSERT(inSuite, memcmp(out_tag.Get(), vector->tag, vector->tag_len) == 0);
+
+                err = context.Decrypt(buffer.Get(), vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                      vector->iv, vector->iv_len, buffer.Get());
+                NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+                NL_TEST_ASSERT(inSuite, memcmp(buffer.Get(), vector->pt, vector->pt_len) == 0);
+            }
+
+            // A copy sets up its own cipher state for the same key.
+            AES_CCM_Context copy(context);
+            context.Clear();
+            memcpy(buffer.Get(), vector->ct, vector->ct_len);
+            CHIP_ERROR err = copy.Decrypt(buffer.Get(), vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                          vector->iv, vector->iv_len, buffer.Get());
+            NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, memcmp(buffer.Get(), vector->pt, vector->pt_len) == 0);
+        }
+    }
+    NL_TEST_ASSERT(inSuite, numOfTestsRan > 0);
+}
+
+static void TestAES_CCM_ContextMatchesOneShot(nlTestSuite * inSuite, void * inContext)
+{
+    const uint8_t key[kAES_CCM128_Key_Length] = { 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08,
+                                                  0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00 };
+    const uint8_t iv[13]                      = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c };
+    const uint8_t aad[8]                      = { 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27 };
+    uint8_t plaintext[40];
+    uint8_t expected_ct[sizeof(plaintext)];
+    uint8_t expected_tag[16];
+    uint8_t buffer[sizeof(plaintext)];
+    uint8_t tag[16];
+
+    for (size_t i = 0; i < sizeof(plaintext); i++)
+    {
+        plaintext[i] = static_cast<uint8_t>(i);
+    }
+
+    AES_CCM_Context context;
+    NL_TEST_ASSERT(inSuite,
+                   context.Encrypt(plaintext, sizeof(plaintext), aad, sizeof(aad), iv, sizeof(iv), buffer, tag, sizeof(tag)) ==
+                       CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(inSuite, context.Init(key, 24) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, context.Init(key, sizeof(key)) == CHIP_NO_ERROR);
+
+    // Switching IV and tag lengths between messages must not disturb the cached cipher state.
+    const size_t kLengths[][2] = { { 13, 16 }, { 12, 8 }, { 13, 16 }, { 7, 12 }, { 12, 16 } };
+    for (const auto & lengths : kLengths)
+    {
+        const size_t iv_length  = lengths[0];
+        const size_t tag_length = lengths[1];
+
+        NL_TEST_ASSERT(inSuite,
+                       AES_CCM_encrypt(plaintext, sizeof(plaintext), aad, sizeof(aad), key, sizeof(key), iv, iv_length, expected_ct,
+                                       expected_tag, tag_length) == CHIP_NO_ERROR);
+
+        memcpy(buffer, plaintext, sizeof(plaintext));
+        NL_TEST_ASSERT(inSuite,
+                       context.Encrypt(buffer, sizeof(buffer), aad, sizeof(aad), iv, iv_length, buffer, tag, tag_length) ==
+                           CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(buffer, expected_ct, sizeof(buffer)) == 0);
+        NL_TEST_ASSERT(inSuite, memcmp(tag, expected_tag, tag_length) == 0);
+
+        // A message that fails authentication leaves the context usable for the next one.
+        tag[0] ^= 0x01;
+        CHIP_ERROR err =
+            context.Decrypt(expected_ct, sizeof(expected_ct), aad, sizeof(aad), tag, tag_length, iv, iv_length, buffer);
+        NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INTERNAL);
+        tag[0] ^= 0x01;
+
+        memcpy(buffer, expected_ct, sizeof(buffer));
+        NL_TEST_ASSERT(inSuite,
+                       context.Decrypt(buffer, sizeof(buffer), aad, sizeof(aad), tag, tag_length, iv, iv_length, buffer) ==
+                           CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(buffer, plaintext, sizeof(buffer)) == 0);
+    }
+
+    context.Clear();
+    NL_TEST_ASSERT(inSuite, !context.IsInitialized());
+    NL_TEST_ASSERT(inSuite,
+                   context.Decrypt(expected_ct, sizeof(expected_ct), aad, sizeof(aad), tag, sizeof(tag), iv, sizeof(iv), buffer) ==
+                       CHIP_ERROR_INCORRECT_STATE);
+}
+
+static void TestAES_CCM_ContextEncryptInParts(nlTestSuite * inSuite, void * inContext)
+{
+    int numOfTestVectors = ArraySize(ccm_128_test_vectors);
+    int numOfTestsRan    = 0;
+    for (int vectorIndex = 0; vectorIndex < numOfTestVectors; vectorIndex++)
+    {
+        const ccm_128_test_vector * vector = ccm_128_test_vectors[vectorIndex];
+        if (vector->pt_len > 0 && vector->result == CHIP_NO_ERROR)
+        {
+            numOfTestsRan++;
+            chip::Platform::ScopedMemoryBuffer<uint8_t> buffer;
+            buffer.Alloc(vector->pt_len);
+            NL_TEST_ASSERT(inSuite, buffer);
+            uint8_t out_tag[16];
+
+            AES_CCM_Context context;
+            NL_TEST_ASSERT(inSuite, context.Init(vector->key, vector->key_len) == CHIP_NO_ERROR);
+
+            // Parts that end inside, at and across block boundaries give the same result as the whole message.
+            for (size_t partLength : { size_t(1), size_t(5), size_t(16), size_t(17), size_t(vector->pt_len) })
+            {
+                memcpy(buffer.Get(), vector->pt, vector->pt_len);
+                NL_TEST_ASSERT(inSuite,
+                               context.BeginEncrypt(vector->pt_len, vector->aad, vector->aad_len, vector->iv, vector->iv_len,
+                                                    vector->tag_len) == CHIP_NO_ERROR);
+                for (size_t offset = 0; offset < vector->pt_len; offset += partLength)
+                {
+                    const size_t length = std::min(partLength, vector->pt_len - offset);
+                    NL_TEST_ASSERT(inSuite,
+                                   context.EncryptData(buffer.Get() + offset, length, buffer.Get() + offset) == CHIP_NO_ERROR);
+                }
+                NL_TEST_ASSERT(inSuite, context.FinishEncrypt(out_tag, vector->tag_len) == CHIP_NO_ERROR);
+                NL_TEST_ASSERT(inSuite, memcmp(buffer.Get(), vector->ct, vector->ct_len) == 0);
+                NL_TEST_ASSERT(inSuite, memcmp(out_tag, vector->tag, vector->tag_len) == 0);
+            }
+        }
+    }
+    NL_TEST_ASSERT(inSuite, numOfTestsRan > 0);
+
+    // An AAD too long for a two-byte length, under a 256-bit key.
+    const uint8_t key[kAES_CCM256_Key_Length] = { 0x01 };
+    const uint8_t iv[13]                      = { 0x02 };
+    chip::Platform::ScopedMemoryBuffer<uint8_t> aad;
+    aad.Calloc(0x10000);
+    NL_TEST_ASSERT(inSuite, aad);
+    uint8_t plaintext[37] = { 0x03 };
+    uint8_t expected_ct[sizeof(plaintext)];
+    uint8_t expected_tag[16];
+    uint8_t ciphertext[sizeof(plaintext)];
+    uint8_t tag[16];
+
+    NL_TEST_ASSERT(inSuite,
+                   AES_CCM_encrypt(plaintext, sizeof(plaintext), aad.Get(), 0x10000, key, sizeof(key), iv, sizeof(iv), expected_ct,
+                                   expected_tag, sizeof(expected_tag)) == CHIP_NO_ERROR);
+
+    AES_CCM_Context context;
+    NL_TEST_ASSERT(inSuite, context.EncryptData(plaintext, sizeof(plaintext), ciphertext) == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(inSuite, context.Init(key, sizeof(key)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   context.BeginEncrypt(sizeof(plaintext), aad.Get(), 0x10000, iv, sizeof(iv), sizeof(tag)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, context.EncryptData(plaintext, 20, ciphertext) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, context.FinishEncrypt(tag, sizeof(tag)) == CHIP_ERROR_INCORRECT_STATE);
+
+    // The failed FinishEncrypt() abandoned the message.
+    NL_TEST_ASSERT(inSuite,
+                   context.EncryptData(plaintext + 20, sizeof(plaintext) - 20, ciphertext + 20) == CHIP_ERROR_INCORRECT_STATE);
+
+    NL_TEST_ASSERT(inSuite,
+                   context.BeginEncrypt(sizeof(plaintext), aad.Get(), 0x10000, iv, sizeof(iv), sizeof(tag)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, context.EncryptData(plaintext, 20, ciphertext) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, context.EncryptData(plaintext + 20, sizeof(plaintext), ciphertext + 20) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, context.EncryptData(plaintext + 20, sizeof(plaintext) - 20, ciphertext + 20) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, context.FinishEncrypt(tag, 8) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite,
+                   context.BeginEncrypt(sizeof(plaintext), aad.Get(), 0x10000, iv, sizeof(iv), sizeof(tag)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, context.EncryptData(plaintext, sizeof(plaintext), ciphertext) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, context.FinishEncrypt(tag, sizeof(tag)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(ciphertext, expected_ct, sizeof(ciphertext)) == 0);
+    NL_TEST_ASSERT(inSuite, memcmp(tag, expected_tag, sizeof(tag)) == 0);
+
+    // The IV leaves two bytes for the message length.
+    NL_TEST_ASSERT(inSuite, context.BeginEncrypt(0x10000, nullptr, 0, iv, sizeof(iv), sizeof(tag)) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, context.BeginEncrypt(0xFFFF, nullptr, 0, iv, sizeof(iv), sizeof(tag)) == CHIP_NO_ERROR);
+}
+
+static void TestAES_CCM_128PublishedTestVectors(nlTestSuite * inSuite, void * inContext)
+{
+    for (const ccm_128_test_vector * vector : ccm_128_published_test_vectors)
+    {
+        uint8_t buffer[32];
+        uint8_t out_tag[16];
+        NL_TEST_ASSERT(inSuite, vector->pt_len <= sizeof(buffer) && vector->tag_len <= sizeof(out_tag));
+
+        NL_TEST_ASSERT(inSuite,
+                       AES_CCM_encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->key, vector->key_len,
+                                       vector->iv, vector->iv_len, buffer, out_tag, vector->tag_len) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(buffer, vector->ct, vector->ct_len) == 0);
+        NL_TEST_ASSERT(inSuite, memcmp(out_tag, vector->tag, vector->tag_len) == 0);
+
+        AES_CCM_Context context;
+        NL_TEST_ASSERT(inSuite, context.Init(vector->key, vector->key_len) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite,
+                       context.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->iv, vector->iv_len,
+                                       buffer, out_tag, vector->tag_len) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(buffer, vector->ct, vector->ct_len) == 0);
+        NL_TEST_ASSERT(inSuite, memcmp(out_tag, vector->tag, vector->tag_len) == 0);
+
+        // Split the message in two at every offset, which includes the block boundaries, then into whole blocks.
+        for (size_t split = 0; split <= vector->pt_len + 1; split++)
+        {
+            memcpy(buffer, vector->pt, vector->pt_len);
+            memset(out_tag, 0, sizeof(out_tag));
+            NL_TEST_ASSERT(inSuite,
+                           context.BeginEncrypt(vector->pt_len, vector->aad, vector->aad_len, vector->iv, vector->iv_len,
+                                                vector->tag_len) == CHIP_NO_ERROR);
+            if (split <= vector->pt_len)
+            {
+                NL_TEST_ASSERT(inSuite, context.EncryptData(buffer, split, buffer) == CHIP_NO_ERROR);
+                NL_TEST_ASSERT(inSuite,
+                               context.EncryptData(buffer + split, vector->pt_len - split, buffer + split) == CHIP_NO_ERROR);
+            }
+            else
+            {
+                for (size_t offset = 0; offset < vector->pt_len; offset += kAES_CCM_Block_Length)
+                {
+                    const size_t length = std::min(kAES_CCM_Block_Length, vector->pt_len - offset);
+                    NL_TEST_ASSERT(inSuite, context.EncryptData(buffer + offset, length, buffer + offset) == CHIP_NO_ERROR);
+                }
+            }
+            NL_TEST_ASSERT(inSuite, context.FinishEncrypt(out_tag, vector->tag_len) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, memcmp(buffer, vector->ct, vector->ct_len) == 0);
+            NL_TEST_ASSERT(inSuite, memcmp(out_tag, vector->tag, vector->tag_len) == 0);
+        }
+
+        NL_TEST_ASSERT(inSuite,
+                       context.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                       vector->iv, vector->iv_len, buffer) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(buffer, vector->pt, vector->pt_len) == 0);
+    }
+}
+
 static void TestAsn1Conversions(nlTestSuite * inSuite, void * inContext)
 {
     static_assert(sizeof(kDerSigConvDerCase4) == (sizeof(kDerSigConvRawCase4) + chip::Crypto::kMax_ECDSA_X9Dot62_Asn1_Overhead),
@@ -1590,6 +1845,10 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test decrypting AES-CCM-256 invalid key", TestAES_CCM_256DecryptInvalidKey),
     NL_TEST_DEF("Test decrypting AES-CCM-256 invalid IV", TestAES_CCM_256DecryptInvalidIVLen),
     NL_TEST_DEF("Test decrypting AES-CCM-256 invalid vectors", TestAES_CCM_256DecryptInvalidTestVectors),
+    NL_TEST_DEF("Test AES-CCM-128 context with test vectors", TestAES_CCM_128ContextTestVectors),
+    NL_TEST_DEF("Test AES-CCM context matches one-shot functions", TestAES_CCM_ContextMatchesOneShot),
+    NL_TEST_DEF("Test AES-CCM context encrypting messages in parts", TestAES_CCM_ContextEncryptInParts),
+    NL_TEST_DEF("Test AES-CCM-128 against RFC 3610 and NIST test vectors", TestAES_CCM_128PublishedTestVectors),
     NL_TEST_DEF("Test ASN.1 signature conversion routines", TestAsn1Conversions),
     NL_TEST_DEF("Test ECDSA signing and validation message using SHA256", TestECDSA_Signing_SHA256_Msg),
     NL_TEST_DEF("Test ECDSA signing and validation SHA256 Hash", TestECDSA_Signing_SHA256_Hash),
@@ -125,19 +125,26 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartChipTimer(int64_t
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::_PostEvent(const ChipDeviceEvent * event)
 {
-    mChipEventQueue.Push(*event);
+    mChipEventQueue.Post(*event);
 
+    if (!mEventLoopWakePending.exchange(true, std::memory_order_acq_rel))
+    {
 #if CHIP_SYSTEM_CONFIG_USE_IO_THREAD
-    SystemLayer.WakeIOThread(); // Trigger wake select on CHIP thread
-#endif                          // CHIP_SYSTEM_CONFIG_USE_IO_THREAD
+        SystemLayer.WakeIOThread(); // Trigger wake select on CHIP thread
+#endif                              // CHIP_SYSTEM_CONFIG_USE_IO_THREAD
+    }
 }
 
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::ProcessDeviceEvents()
 {
-    while (!mChipEventQueue.Empty())
+    ChipDeviceEvent event;
+
+    // Events posted from now on wake the event loop up again, for the next batch.
+    mEventLoopWakePending.exchange(false, std::memory_order_acq_rel);
+
+    while (mChipEventQueue.Take(event))
     {
-        const ChipDeviceEvent event = mChipEventQueue.PopFront();
         Impl()->DispatchEvent(&event);
     }
 }
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <platform/DeviceEventRing.h>
 #include <platform/DeviceSafeQueue.h>
 #include <platform/internal/GenericPlatformManagerImpl.h>
 
@@ -109,7 +110,13 @@ private:
 
     void ProcessDeviceEvents();
 
-    DeviceSafeQueue mChipEventQueue;
+    // Events are posted to a lock-free ring, and to a locked queue while it is full.
+    DeviceEventRingWithOverflow mChipEventQueue;
+
+    // Whether the event loop has been woken up for events it has not processed yet: only the first event posted after it
+    // last started processing events wakes it up.
+    std::atomic<bool> mEventLoopWakePending{ false };
+
     std::atomic<bool> mShouldRunEventLoop;
     static void * EventLoopTaskMain(void * arg);
 };
@@ -37,7 +37,9 @@
 #include <inet/InetLayer.h>
 
 #include <support/CodeUtils.h>
+#include <support/ErrorStr.h>
 #include <support/SafeInt.h>
+#include <system/SystemStats.h>
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
 #if INET_CONFIG_ENABLE_IPV4
@@ -106,6 +108,21 @@ union PeerSockAddr
     sockaddr_in in;
     sockaddr_in6 in6;
 };
+
+/** Storage for the sendmsg() header of one outbound datagram. */
+struct IPEndPointBasis::SendMsgHeader
+{
+    struct msghdr mHeader;
+    struct iovec mIOV[INET_CONFIG_DATAGRAM_SEND_MAX_BUFFERS];
+    size_t mLength; // Of the whole datagram.
+    PeerSockAddr mPeerSockAddr;
+    // Large enough for a single IP_PKTINFO or IPV6_PKTINFO control message.
+    alignas(struct cmsghdr) uint8_t mControlData[64];
+
+#ifdef IPV6_PKTINFO
+    static_assert(CMSG_SPACE(sizeof(struct in6_pktinfo)) <= sizeof(mControlData), "Control data buffer too small");
+#endif // IPV6_PKTINFO
+};
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
 
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
@@ -589,6 +606,16 @@ void IPEndPointBasis::Init(InetLayer * aInetLayer)
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS
     mBoundIntfId = INET_NULL_INTERFACEID;
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+#if INET_DATAGRAM_RECV_BATCHING
+    mRecvBatchSize = 1;
+#endif // INET_DATAGRAM_RECV_BATCHING
+
+#if INET_DATAGRAM_SEND_BATCHING
+    mSendQueueLength         = 0;
+    mSendQueueFlushScheduled = false;
+    mSendQueueError          = CHIP_NO_ERROR;
+#endif // INET_DATAGRAM_SEND_BATCHING
 }
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
@@ -791,41 +818,102 @@ CHIP_ERROR IPEndPointBasis::BindInterface(IPAddressType aAddressType, InterfaceI
 }
 
 CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System::PacketBufferHandle && aBuffer, uint16_t aSendFlags)
+{
+    SendMsgHeader header;
+    ReturnErrorOnFailure(BuildSendMsgHeader(*aPktInfo, aBuffer, header));
+
+#if INET_DATAGRAM_SEND_BATCHING
+    if (mSendQueueLength == INET_CONFIG_DATAGRAM_SEND_BATCH_SIZE)
+    {
+        FlushSendQueue();
+    }
+
+    // Report what the kernel rejected since the previous call, as sendmsg() reports an earlier asynchronous error; the
+    // message is not queued.
+    ReturnErrorOnFailure(TakeSendQueueError());
+
+    // The kernel's send buffer is full, and the queue still holds the datagrams it could not take.
+    VerifyOrReturnError(mSendQueueLength < INET_CONFIG_DATAGRAM_SEND_BATCH_SIZE, chip::System::MapErrorPOSIX(EAGAIN));
+
+    QueuedDatagram & queued = mSendQueue[mSendQueueLength++];
+    queued.mBuffer          = std::move(aBuffer);
+    queued.mSrcAddress      = aPktInfo->SrcAddress;
+    queued.mDestAddress     = aPktInfo->DestAddress;
+    queued.mInterface       = aPktInfo->Interface;
+    queued.mDestPort        = aPktInfo->DestPort;
+
+    // Send the queue once the current CHIP event completes, so that everything sent while handling it shares a syscall.
+    if (!mSendQueueFlushScheduled)
+    {
+        mSendQueueFlushScheduled = (SystemLayer().ScheduleWork(HandleSendQueueFlush, this) == CHIP_NO_ERROR);
+        if (!mSendQueueFlushScheduled)
+        {
+            FlushSendQueue();
+            return TakeSendQueueError();
+        }
+    }
+    return CHIP_NO_ERROR;
+#else  // !INET_DATAGRAM_SEND_BATCHING
+    // Send IP packet.
+    const ssize_t lenSent = sendmsg(mSocket.GetFD(), &header.mHeader, 0);
+    if (lenSent == -1)
+        return chip::System::MapErrorPOSIX(errno);
+    if (static_cast<size_t>(lenSent) != header.mLength)
+        return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
+    return CHIP_NO_ERROR;
+#endif // !INET_DATAGRAM_SEND_BATCHING
+}
+
+/**
+ *  Validate an outbound datagram and describe it in @p aHeader, which must outlive any use of the header.
+ */
+CHIP_ERROR IPEndPointBasis::BuildSendMsgHeader(const IPPacketInfo & aPktInfo, const System::PacketBufferHandle & aBuffer,
+                                               SendMsgHeader & aHeader)
 {
     // Ensure the destination address type is compatible with the endpoint address type.
-    VerifyOrReturnError(mAddrType == aPktInfo->DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mAddrType == aPktInfo.DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
 
-    // For now the entire message must fit within a single buffer.
-    VerifyOrReturnError(!aBuffer->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
+    // Each buffer of a chain is gathered from where it is, so the message is never copied into one buffer.
+    size_t iovCount = 0;
+    aHeader.mLength = 0;
+    for (System::PacketBufferHandle buffer = aBuffer.Retain(); !buffer.IsNull(); buffer.Advance())
+    {
+        if (buffer->DataLength() == 0)
+        {
+            continue;
+        }
+        VerifyOrReturnError(iovCount < INET_CONFIG_DATAGRAM_SEND_MAX_BUFFERS, CHIP_ERROR_MESSAGE_TOO_LONG);
+        aHeader.mLength += buffer->DataLength();
 
-    struct iovec msgIOV;
-    msgIOV.iov_base = aBuffer->Start();
-    msgIOV.iov_len  = aBuffer->DataLength();
+        aHeader.mIOV[iovCount].iov_base = buffer->Start();
+        aHeader.mIOV[iovCount].iov_len  = buffer->DataLength();
+        iovCount++;
+    }
 
-    struct msghdr msgHeader;
+    struct msghdr & msgHeader = aHeader.mHeader;
     memset(&msgHeader, 0, sizeof(msgHeader));
-    msgHeader.msg_iov    = &msgIOV;
-    msgHeader.msg_iovlen = 1;
+    msgHeader.msg_iov    = aHeader.mIOV;
+    msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(iovCount);
 
     // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
-    PeerSockAddr peerSockAddr;
+    PeerSockAddr & peerSockAddr = aHeader.mPeerSockAddr;
     memset(&peerSockAddr, 0, sizeof(peerSockAddr));
     msgHeader.msg_name = &peerSockAddr;
     if (mAddrType == kIPAddressType_IPv6)
     {
         peerSockAddr.in6.sin6_family = AF_INET6;
-        peerSockAddr.in6.sin6_port   = htons(aPktInfo->DestPort);
-        peerSockAddr.in6.sin6_addr   = aPktInfo->DestAddress.ToIPv6();
-        VerifyOrReturnError(CanCastTo<decltype(peerSockAddr.in6.sin6_scope_id)>(aPktInfo->Interface), CHIP_ERROR_INCORRECT_STATE);
-        peerSockAddr.in6.sin6_scope_id = static_cast<decltype(peerSockAddr.in6.sin6_scope_id)>(aPktInfo->Interface);
+        peerSockAddr.in6.sin6_port   = htons(aPktInfo.DestPort);
+        peerSockAddr.in6.sin6_addr   = aPktInfo.DestAddress.ToIPv6();
+        VerifyOrReturnError(CanCastTo<decltype(peerSockAddr.in6.sin6_scope_id)>(aPktInfo.Interface), CHIP_ERROR_INCORRECT_STATE);
+        peerSockAddr.in6.sin6_scope_id = static_cast<decltype(peerSockAddr.in6.sin6_scope_id)>(aPktInfo.Interface);
         msgHeader.msg_namelen          = sizeof(sockaddr_in6);
     }
 #if INET_CONFIG_ENABLE_IPV4
     else
     {
         peerSockAddr.in.sin_family = AF_INET;
-        peerSockAddr.in.sin_port   = htons(aPktInfo->DestPort);
-        peerSockAddr.in.sin_addr   = aPktInfo->DestAddress.ToIPv4();
+        peerSockAddr.in.sin_port   = htons(aPktInfo.DestPort);
+        peerSockAddr.in.sin_addr   = aPktInfo.DestAddress.ToIPv4();
         msgHeader.msg_namelen      = sizeof(sockaddr_in);
     }
 #endif // INET_CONFIG_ENABLE_IPV4
@@ -836,7 +924,7 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
     // for messages to multicast addresses, which under Linux
     // don't seem to get sent out the correct interface, despite
     // the socket being bound.
-    InterfaceId intfId = aPktInfo->Interface;
+    InterfaceId intfId = aPktInfo.Interface;
     if (intfId == INET_NULL_INTERFACEID)
         intfId = mBoundIntfId;
 
@@ -844,13 +932,12 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
     // address, construct an IP_PKTINFO/IPV6_PKTINFO "control message" to that effect
     // add add it to the message header.  If the local OS doesn't support IP_PKTINFO/IPV6_PKTINFO
     // fail with an error.
-    if (intfId != INET_NULL_INTERFACEID || aPktInfo->SrcAddress.Type() != kIPAddressType_Any)
+    if (intfId != INET_NULL_INTERFACEID || aPktInfo.SrcAddress.Type() != kIPAddressType_Any)
     {
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-        uint8_t controlData[256];
-        memset(controlData, 0, sizeof(controlData));
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+        memset(aHeader.mControlData, 0, sizeof(aHeader.mControlData));
+        msgHeader.msg_control    = aHeader.mControlData;
+        msgHeader.msg_controllen = sizeof(aHeader.mControlData);
 
         struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader);
 
@@ -870,7 +957,7 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
             }
 
             pktInfo->ipi_ifindex  = static_cast<decltype(pktInfo->ipi_ifindex)>(intfId);
-            pktInfo->ipi_spec_dst = aPktInfo->SrcAddress.ToIPv4();
+            pktInfo->ipi_spec_dst = aPktInfo.SrcAddress.ToIPv4();
 
             msgHeader.msg_controllen = CMSG_SPACE(sizeof(in_pktinfo));
 #else  // !defined(IP_PKTINFO)
@@ -893,7 +980,7 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
                 return CHIP_ERROR_UNEXPECTED_EVENT;
             }
             pktInfo->ipi6_ifindex = static_cast<decltype(pktInfo->ipi6_ifindex)>(intfId);
-            pktInfo->ipi6_addr    = aPktInfo->SrcAddress.ToIPv6();
+            pktInfo->ipi6_addr    = aPktInfo.SrcAddress.ToIPv6();
 
             msgHeader.msg_controllen = CMSG_SPACE(sizeof(in6_pktinfo));
 #else  // !defined(IPV6_PKTINFO)
@@ -906,15 +993,163 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
 #endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
     }
 
-    // Send IP packet.
-    const ssize_t lenSent = sendmsg(mSocket.GetFD(), &msgHeader, 0);
-    if (lenSent == -1)
-        return chip::System::MapErrorPOSIX(errno);
-    if (lenSent != aBuffer->DataLength())
-        return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
     return CHIP_NO_ERROR;
 }
 
+#if INET_DATAGRAM_SEND_BATCHING
+/**
+ *  Hand all queued outbound datagrams to the kernel with as few sendmmsg() calls as possible.
+ *
+ *  A datagram the kernel rejects is dropped, its error is kept for the next SendMsg() to return, and sending continues
+ *  with the next one. When the kernel's send buffer is full, the remaining datagrams stay queued, and are sent once the
+ *  socket is writable.
+ */
+void IPEndPointBasis::FlushSendQueue()
+{
+    SendMsgHeader headers[INET_CONFIG_DATAGRAM_SEND_BATCH_SIZE];
+    struct mmsghdr msgs[INET_CONFIG_DATAGRAM_SEND_BATCH_SIZE];
+    size_t queueIndex[INET_CONFIG_DATAGRAM_SEND_BATCH_SIZE];
+    unsigned int count = 0;
+
+    for (size_t i = 0; i < mSendQueueLength; i++)
+    {
+        QueuedDatagram & queued = mSendQueue[i];
+        IPPacketInfo pktInfo;
+
+        pktInfo.Clear();
+        pktInfo.SrcAddress  = queued.mSrcAddress;
+        pktInfo.DestAddress = queued.mDestAddress;
+        pktInfo.Interface   = queued.mInterface;
+        pktInfo.DestPort    = queued.mDestPort;
+
+        // Already validated when queued; rebuilt here because the header points into per-call storage.
+        const CHIP_ERROR err = BuildSendMsgHeader(pktInfo, queued.mBuffer, headers[count]);
+        if (err != CHIP_NO_ERROR)
+        {
+            RecordSendQueueError(err);
+            continue;
+        }
+        msgs[count].msg_hdr = headers[count].mHeader;
+        msgs[count].msg_len = 0;
+        queueIndex[count]   = i;
+        count++;
+    }
+
+    SYSTEM_STATS_RECORD_BATCH_SIZE(chip::System::Stats::kInetLayer_DatagramSendBatch, count);
+
+    unsigned int sent = 0;
+    while (sent < count && mSocket.HasFD())
+    {
+        const int res = sendmmsg(mSocket.GetFD(), &msgs[sent], count - sent, 0);
+        if (res <= 0)
+        {
+            const int lErrno = errno;
+            if (lErrno == EAGAIN || lErrno == EWOULDBLOCK)
+            {
+                // Keep the rest for when the socket is writable.
+                mSocket.RequestCallbackOnPendingWrite();
+                break;
+            }
+
+            // The first remaining datagram failed; skip it.
+            const CHIP_ERROR err = chip::System::MapErrorPOSIX(lErrno);
+            ChipLogError(Inet, "sendmmsg failed: %s", ErrorStr(err));
+            RecordSendQueueError(err);
+            sent++;
+            continue;
+        }
+        for (unsigned int i = sent; i < sent + static_cast<unsigned int>(res); i++)
+        {
+            if (msgs[i].msg_len != headers[i].mLength)
+            {
+                ChipLogError(Inet, "sendmmsg truncated datagram: %s", ErrorStr(CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG));
+                RecordSendQueueError(CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG);
+            }
+        }
+        sent += static_cast<unsigned int>(res);
+    }
+
+    // Move the datagrams that were not sent to the front of the queue, in order, and release the others.
+    size_t kept = 0;
+    for (unsigned int i = sent; i < count && mSocket.HasFD(); i++)
+    {
+        if (queueIndex[i] != kept)
+        {
+            mSendQueue[kept] = std::move(mSendQueue[queueIndex[i]]);
+        }
+        kept++;
+    }
+    for (size_t i = kept; i < mSendQueueLength; i++)
+    {
+        mSendQueue[i].mBuffer = nullptr;
+    }
+    mSendQueueLength = kept;
+}
+
+/**
+ *  Send anything still queued and stop the pending flush; called before the socket is closed.
+ */
+void IPEndPointBasis::CloseSendQueue()
+{
+    FlushSendQueue();
+
+    if (mSendQueueLength > 0)
+    {
+        ChipLogError(Inet, "Dropping %u datagrams the kernel could not take before close", static_cast<unsigned>(mSendQueueLength));
+        for (size_t i = 0; i < mSendQueueLength; i++)
+        {
+            mSendQueue[i].mBuffer = nullptr;
+        }
+        mSendQueueLength = 0;
+    }
+    if (mSocket.HasFD())
+    {
+        mSocket.ClearCallbackOnPendingWrite();
+    }
+    mSendQueueError = CHIP_NO_ERROR;
+
+    if (mSendQueueFlushScheduled)
+    {
+        SystemLayer().CancelTimer(HandleSendQueueFlush, this);
+        mSendQueueFlushScheduled = false;
+    }
+}
+
+/**
+ *  Send the datagrams kept after the kernel's send buffer filled up, now that the socket is writable.
+ */
+void IPEndPointBasis::HandlePendingWrite()
+{
+    mSocket.ClearCallbackOnPendingWrite();
+    FlushSendQueue();
+}
+
+/**
+ *  Keep @p aError for the next SendMsg() to return, unless an earlier error is already waiting.
+ */
+void IPEndPointBasis::RecordSendQueueError(CHIP_ERROR aError)
+{
+    if (mSendQueueError == CHIP_NO_ERROR)
+    {
+        mSendQueueError = aError;
+    }
+}
+
+CHIP_ERROR IPEndPointBasis::TakeSendQueueError()
+{
+    const CHIP_ERROR err = mSendQueueError;
+    mSendQueueError      = CHIP_NO_ERROR;
+    return err;
+}
+
+void IPEndPointBasis::HandleSendQueueFlush(chip::System::Layer * aLayer, void * aAppState, CHIP_ERROR aError)
+{
+    IPEndPointBasis * const endPoint  = static_cast<IPEndPointBasis *>(aAppState);
+    endPoint->mSendQueueFlushScheduled = false;
+    endPoint->FlushSendQueue();
+}
+#endif // INET_DATAGRAM_SEND_BATCHING
+
 CHIP_ERROR IPEndPointBasis::GetSocket(IPAddressType aAddressType, int aType, int aProtocol)
 {
     if (!mSocket.HasFD())
@@ -1026,6 +1261,74 @@ CHIP_ERROR IPEndPointBasis::GetSocket(IPAddressType aAddressType, int aType, int
     return CHIP_NO_ERROR;
 }
 
+namespace {
+
+/**
+ *  Fill in the source address and, from IP_PKTINFO/IPV6_PKTINFO control messages, the destination address and
+ *  interface of a datagram received with recvmsg()/recvmmsg().
+ */
+CHIP_ERROR ParseRecvMsgHeader(struct msghdr & aMsgHeader, IPPacketInfo & aPacketInfo)
+{
+    const PeerSockAddr & lPeerSockAddr = *static_cast<const PeerSockAddr *>(aMsgHeader.msg_name);
+
+    if (lPeerSockAddr.any.sa_family == AF_INET6)
+    {
+        aPacketInfo.SrcAddress = IPAddress::FromIPv6(lPeerSockAddr.in6.sin6_addr);
+        aPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (lPeerSockAddr.any.sa_family == AF_INET)
+    {
+        aPacketInfo.SrcAddress = IPAddress::FromIPv4(lPeerSockAddr.in.sin_addr);
+        aPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&aMsgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&aMsgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            struct in_pktinfo * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId>(inPktInfo->ipi_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            aPacketInfo.Interface   = static_cast<InterfaceId>(inPktInfo->ipi_ifindex);
+            aPacketInfo.DestAddress = IPAddress::FromIPv4(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            struct in6_pktinfo * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId>(in6PktInfo->ipi6_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            aPacketInfo.Interface   = static_cast<InterfaceId>(in6PktInfo->ipi6_ifindex);
+            aPacketInfo.DestAddress = IPAddress::FromIPv6(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+} // anonymous namespace
+
+#if !INET_DATAGRAM_RECV_BATCHING
+
 void IPEndPointBasis::HandlePendingIO(uint16_t aPort)
 {
     CHIP_ERROR lStatus = CHIP_NO_ERROR;
@@ -1071,62 +1374,7 @@ void IPEndPointBasis::HandlePendingIO(uint16_t aPort)
         else
         {
             lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
-
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress::FromIPv6(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress::FromIPv4(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
-            }
-        }
-
-        if (lStatus == CHIP_NO_ERROR)
-        {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    struct in_pktinfo * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = static_cast<InterfaceId>(inPktInfo->ipi_ifindex);
-                    lPacketInfo.DestAddress = IPAddress::FromIPv4(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
-
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    struct in6_pktinfo * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = static_cast<InterfaceId>(in6PktInfo->ipi6_ifindex);
-                    lPacketInfo.DestAddress = IPAddress::FromIPv6(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
-            }
+            lStatus = ParseRecvMsgHeader(msgHeader, lPacketInfo);
         }
     }
     else
@@ -1147,6 +1395,113 @@ void IPEndPointBasis::HandlePendingIO(uint16_t aPort)
         }
     }
 }
+
+#else // INET_DATAGRAM_RECV_BATCHING
+
+void IPEndPointBasis::HandlePendingIO(uint16_t aPort)
+{
+    constexpr unsigned int kBatchSize = INET_CONFIG_DATAGRAM_RECV_BATCH_SIZE;
+
+    System::PacketBufferHandle lBuffers[kBatchSize];
+    struct mmsghdr lMsgs[kBatchSize];
+    struct iovec lIOVs[kBatchSize];
+    PeerSockAddr lPeerSockAddrs[kBatchSize];
+    alignas(struct cmsghdr) uint8_t lControlData[kBatchSize][128];
+    unsigned int lCount;
+
+    // Only allocate as many buffers as the previous wakeup needed, so that an endpoint receiving one datagram at a
+    // time does not allocate a whole batch of them for every datagram.
+    for (lCount = 0; lCount < mRecvBatchSize; lCount++)
+    {
+        lBuffers[lCount] = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+        if (lBuffers[lCount].IsNull())
+        {
+            break;
+        }
+
+        lIOVs[lCount].iov_base = lBuffers[lCount]->Start();
+        lIOVs[lCount].iov_len  = lBuffers[lCount]->AvailableDataLength();
+
+        memset(&lPeerSockAddrs[lCount], 0, sizeof(lPeerSockAddrs[lCount]));
+        memset(&lMsgs[lCount], 0, sizeof(lMsgs[lCount]));
+
+        struct msghdr & msgHeader = lMsgs[lCount].msg_hdr;
+        msgHeader.msg_name        = &lPeerSockAddrs[lCount];
+        msgHeader.msg_namelen     = sizeof(lPeerSockAddrs[lCount]);
+        msgHeader.msg_iov         = &lIOVs[lCount];
+        msgHeader.msg_iovlen      = 1;
+        msgHeader.msg_control     = lControlData[lCount];
+        msgHeader.msg_controllen  = sizeof(lControlData[lCount]);
+    }
+
+    if (lCount == 0)
+    {
+        if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, CHIP_ERROR_NO_MEMORY, nullptr);
+        }
+        return;
+    }
+
+    const int lReceived = recvmmsg(mSocket.GetFD(), lMsgs, lCount, MSG_DONTWAIT, nullptr);
+    if (lReceived < 0)
+    {
+        const CHIP_ERROR lStatus = chip::System::MapErrorPOSIX(errno);
+        if (OnReceiveError != nullptr && lStatus != chip::System::MapErrorPOSIX(EAGAIN))
+        {
+            OnReceiveError(this, lStatus, nullptr);
+        }
+        return;
+    }
+
+    SYSTEM_STATS_RECORD_BATCH_SIZE(chip::System::Stats::kInetLayer_DatagramRecvBatch, static_cast<size_t>(lReceived));
+
+    // Grow the next batch while batches come back full, and shrink it to what was received otherwise.
+    if (static_cast<unsigned int>(lReceived) == lCount)
+    {
+        mRecvBatchSize = (lCount > kBatchSize / 2) ? kBatchSize : 2 * lCount;
+    }
+    else
+    {
+        mRecvBatchSize = (lReceived > 0) ? static_cast<unsigned int>(lReceived) : 1;
+    }
+
+    // A callback may close or free this endpoint; hold a reference and stop delivering once it is no longer listening.
+    Retain();
+
+    for (int i = 0; i < lReceived && mState == kState_Listening && OnMessageReceived != nullptr; i++)
+    {
+        CHIP_ERROR lStatus = CHIP_NO_ERROR;
+        IPPacketInfo lPacketInfo;
+
+        lPacketInfo.Clear();
+        lPacketInfo.DestPort = aPort;
+
+        if (lMsgs[i].msg_len > lBuffers[i]->AvailableDataLength())
+        {
+            lStatus = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
+        }
+        else
+        {
+            lBuffers[i]->SetDataLength(static_cast<uint16_t>(lMsgs[i].msg_len));
+            lStatus = ParseRecvMsgHeader(lMsgs[i].msg_hdr, lPacketInfo);
+        }
+
+        if (lStatus == CHIP_NO_ERROR)
+        {
+            lBuffers[i].RightSize();
+            OnMessageReceived(this, std::move(lBuffers[i]), &lPacketInfo);
+        }
+        else if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, lStatus, nullptr);
+        }
+    }
+
+    Release();
+}
+
+#endif // INET_DATAGRAM_RECV_BATCHING
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
 
 #if CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
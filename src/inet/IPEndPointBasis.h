@@ -35,6 +35,18 @@
 #include <lwip/netif.h>
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP
 
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && HAVE_RECVMMSG && INET_CONFIG_DATAGRAM_RECV_BATCH_SIZE > 1
+#define INET_DATAGRAM_RECV_BATCHING 1
+#else
+#define INET_DATAGRAM_RECV_BATCHING 0
+#endif
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && HAVE_SENDMMSG && INET_CONFIG_DATAGRAM_SEND_BATCH_SIZE > 1
+#define INET_DATAGRAM_SEND_BATCHING 1
+#else
+#define INET_DATAGRAM_SEND_BATCHING 0
+#endif
+
 namespace chip {
 namespace Inet {
 
@@ -139,6 +151,44 @@ protected:
     CHIP_ERROR SendMsg(const IPPacketInfo * aPktInfo, chip::System::PacketBufferHandle && aBuffer, uint16_t aSendFlags);
     CHIP_ERROR GetSocket(IPAddressType aAddressType, int aType, int aProtocol);
     void HandlePendingIO(uint16_t aPort);
+
+#if INET_DATAGRAM_SEND_BATCHING
+    void FlushSendQueue();
+    void CloseSendQueue();
+    void HandlePendingWrite();
+#endif // INET_DATAGRAM_SEND_BATCHING
+
+private:
+    struct SendMsgHeader;
+
+    CHIP_ERROR BuildSendMsgHeader(const IPPacketInfo & aPktInfo, const chip::System::PacketBufferHandle & aBuffer,
+                                  SendMsgHeader & aHeader);
+
+#if INET_DATAGRAM_RECV_BATCHING
+    unsigned int mRecvBatchSize; ///< Number of receive buffers HandlePendingIO() allocates for the next recvmmsg().
+#endif // INET_DATAGRAM_RECV_BATCHING
+
+#if INET_DATAGRAM_SEND_BATCHING
+    /** A validated outbound datagram waiting for the next FlushSendQueue(). */
+    struct QueuedDatagram
+    {
+        chip::System::PacketBufferHandle mBuffer;
+        IPAddress mSrcAddress;
+        IPAddress mDestAddress;
+        InterfaceId mInterface;
+        uint16_t mDestPort;
+    };
+
+    static void HandleSendQueueFlush(chip::System::Layer * aLayer, void * aAppState, CHIP_ERROR aError);
+
+    void RecordSendQueueError(CHIP_ERROR aError);
+    CHIP_ERROR TakeSendQueueError();
+
+    QueuedDatagram mSendQueue[INET_CONFIG_DATAGRAM_SEND_BATCH_SIZE];
+    size_t mSendQueueLength;
+    bool mSendQueueFlushScheduled;
+    CHIP_ERROR mSendQueueError; ///< First error the kernel reported for a queued datagram, returned by the next SendMsg().
+#endif // INET_DATAGRAM_SEND_BATCHING
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
 
 #if CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
@@ -445,4 +445,63 @@
 #ifndef INET_CONFIG_IP_MULTICAST_HOP_LIMIT
 #define INET_CONFIG_IP_MULTICAST_HOP_LIMIT                 (64)
 #endif // INET_CONFIG_IP_MULTICAST_HOP_LIMIT
+
+/**
+ *  @def INET_CONFIG_DATAGRAM_RECV_BATCH_SIZE
+ *
+ *  @brief
+ *    The maximum number of datagrams a UDP or raw endpoint reads
+ *    per readiness event.
+ *
+ *  @details
+ *    Values greater than 1 drain the socket with a single
+ *    recvmmsg() call per wakeup instead of one recvmsg() call per
+ *    datagram. Each wakeup allocates as many receive buffers as the
+ *    previous one received datagrams, doubling while the batches
+ *    come back full, up to this many. Requires HAVE_RECVMMSG;
+ *    ignored otherwise.
+ */
+#ifndef INET_CONFIG_DATAGRAM_RECV_BATCH_SIZE
+#define INET_CONFIG_DATAGRAM_RECV_BATCH_SIZE               1
+#endif // INET_CONFIG_DATAGRAM_RECV_BATCH_SIZE
+
+/**
+ *  @def INET_CONFIG_DATAGRAM_SEND_BATCH_SIZE
+ *
+ *  @brief
+ *    The maximum number of outbound datagrams a UDP or raw endpoint
+ *    queues before handing them to the kernel.
+ *
+ *  @details
+ *    Values greater than 1 make SendMsg() validate and queue the
+ *    message, and send the queue with a single sendmmsg() call once
+ *    it is full or when the current CHIP event completes, whichever
+ *    comes first. An error the kernel reports for a queued datagram
+ *    is returned by the next SendMsg(), which then does not queue its
+ *    message. When the kernel's send buffer is full, the queue is kept
+ *    and sent once the socket is writable, and SendMsg() fails with
+ *    EAGAIN while the queue stays full. Requires HAVE_SENDMMSG;
+ *    ignored otherwise.
+ */
+#ifndef INET_CONFIG_DATAGRAM_SEND_BATCH_SIZE
+#define INET_CONFIG_DATAGRAM_SEND_BATCH_SIZE               1
+#endif // INET_CONFIG_DATAGRAM_SEND_BATCH_SIZE
+
+/**
+ *  @def INET_CONFIG_DATAGRAM_SEND_MAX_BUFFERS
+ *
+ *  @brief
+ *    The maximum number of packet buffers in a chain that a UDP or
+ *    raw endpoint sends as a single datagram.
+ *
+ *  @details
+ *    With sockets, each buffer of the chain becomes one element of
+ *    the scatter-gather list given to sendmsg(), so that a message
+ *    written across several buffers is sent without first being
+ *    copied into one. Longer chains are rejected. LwIP sends chains
+ *    of any length natively.
+ */
+#ifndef INET_CONFIG_DATAGRAM_SEND_MAX_BUFFERS
+#define INET_CONFIG_DATAGRAM_SEND_MAX_BUFFERS              8
+#endif // INET_CONFIG_DATAGRAM_SEND_MAX_BUFFERS
 // clang-format on
@@ -466,6 +466,10 @@ void RawEndPoint::Close()
 
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS
 
+#if INET_DATAGRAM_SEND_BATCHING
+        CloseSendQueue();
+#endif // INET_DATAGRAM_SEND_BATCHING
+
         if (mSocket.HasFD())
         {
             mSocket.Close();
@@ -1020,7 +1024,15 @@ CHIP_ERROR RawEndPoint::GetSocket(IPAddressType aAddressType)
         return INET_ERROR_WRONG_ADDRESS_TYPE;
     }
 
-    return IPEndPointBasis::GetSocket(aAddressType, lType, lProtocol);
+    ReturnErrorOnFailure(IPEndPointBasis::GetSocket(aAddressType, lType, lProtocol));
+
+#if INET_DATAGRAM_SEND_BATCHING
+    // A queued send waits for the socket to be writable when the kernel's send buffer is full, whether or not the endpoint
+    // listens.
+    mSocket.SetCallback(HandlePendingIO, reinterpret_cast<intptr_t>(this));
+#endif // INET_DATAGRAM_SEND_BATCHING
+
+    return CHIP_NO_ERROR;
 }
 
 // static
@@ -1031,6 +1043,13 @@ void RawEndPoint::HandlePendingIO(System::WatchableSocket & socket)
 
 void RawEndPoint::HandlePendingIO()
 {
+#if INET_DATAGRAM_SEND_BATCHING
+    if (mSocket.HasPendingWrite())
+    {
+        IPEndPointBasis::HandlePendingWrite();
+    }
+#endif // INET_DATAGRAM_SEND_BATCHING
+
     if (mState == kState_Listening && OnMessageReceived != nullptr && mSocket.HasPendingRead())
     {
         const uint16_t lPort = 0;
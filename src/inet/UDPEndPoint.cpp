@@ -392,6 +392,10 @@ void UDPEndPoint::Close()
 
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS
 
+#if INET_DATAGRAM_SEND_BATCHING
+        CloseSendQueue();
+#endif // INET_DATAGRAM_SEND_BATCHING
+
         if (mSocket.HasFD())
         {
             mSocket.Close();
@@ -903,7 +907,15 @@ CHIP_ERROR UDPEndPoint::GetSocket(IPAddressType aAddressType)
     constexpr int lType     = (SOCK_DGRAM | SOCK_FLAGS);
     constexpr int lProtocol = 0;
 
-    return IPEndPointBasis::GetSocket(aAddressType, lType, lProtocol);
+    ReturnErrorOnFailure(IPEndPointBasis::GetSocket(aAddressType, lType, lProtocol));
+
+#if INET_DATAGRAM_SEND_BATCHING
+    // A queued send waits for the socket to be writable when the kernel's send buffer is full, whether or not the endpoint
+    // listens.
+    mSocket.SetCallback(HandlePendingIO, reinterpret_cast<intptr_t>(this));
+#endif // INET_DATAGRAM_SEND_BATCHING
+
+    return CHIP_NO_ERROR;
 }
 
 // static
@@ -914,6 +926,13 @@ void UDPEndPoint::HandlePendingIO(System::WatchableSocket & socket)
 
 void UDPEndPoint::HandlePendingIO()
 {
+#if INET_DATAGRAM_SEND_BATCHING
+    if (mSocket.HasPendingWrite())
+    {
+        IPEndPointBasis::HandlePendingWrite();
+    }
+#endif // INET_DATAGRAM_SEND_BATCHING
+
     if (mState == kState_Listening && OnMessageReceived != nullptr && mSocket.HasPendingRead())
     {
         const uint16_t lPort = mBoundPort;
@@ -1199,6 +1199,11 @@
  *  @brief
  *    Maximum number of simultaneously active exchange contexts.
  *
+ *    Received messages are matched to their exchange through a hash index,
+ *    so the cost of receiving a message does not grow with this value. Each
+ *    context costs its pool slot, at least two index slots, and by default
+ *    an entry in the RMP retransmission table and the MCSP receive table.
+ *
  */
 #ifndef CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
 #define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS 16
@@ -2319,6 +2324,38 @@
 #define CHIP_PEER_CONNECTION_TIMEOUT_CHECK_FREQUENCY_MS 5000
 #endif // CHIP_PEER_CONNECTION_TIMEOUT_CHECK_FREQUENCY_MS
 
+/**
+ * @def CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS
+ *
+ * @brief Maximum number of worker threads SecureSessionMgr can use to
+ * verify message counters and decrypt received secure messages (see
+ * SecureSessionMgr::StartReceivePipeline()). Sessions are sharded across
+ * the workers by local key ID.
+ *
+ * The pipeline needs POSIX threads and the sockets event loop; setting
+ * this to 0 compiles it out.
+ */
+#ifndef CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && CHIP_SYSTEM_CONFIG_USE_SOCKETS
+#define CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS 8
+#else
+#define CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS 0
+#endif
+#endif // CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS
+
+/**
+ * @def CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_QUEUE_SIZE
+ *
+ * @brief Number of received messages each receive pipeline worker can
+ * hold between the event thread handing them over and their delivery to
+ * the exchange layer. When a worker's queue is full of messages it has
+ * not processed yet, further messages for its sessions are dropped and
+ * reported with CHIP_ERROR_NO_MEMORY; the event thread never waits.
+ */
+#ifndef CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_QUEUE_SIZE
+#define CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_QUEUE_SIZE 64
+#endif // CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_QUEUE_SIZE
+
 /**
  *  @def CHIP_CONFIG_MAX_BINDINGS
  *
@@ -2346,6 +2383,78 @@
 #define CHIP_CONFIG_MAX_DEVICE_ADMINS 16
 #endif // CHIP_CONFIG_MAX_DEVICE_ADMINS
 
+/**
+ *  @def CHIP_CONFIG_IM_MAX_DIRTY_ATTRIBUTE_PATHS
+ *
+ *  @brief
+ *    Maximum number of distinct changed attribute paths the reporting engine
+ *    records between two runs. When more attributes change, the recorded
+ *    changes are matched against the read handlers early to make room.
+ */
+#ifndef CHIP_CONFIG_IM_MAX_DIRTY_ATTRIBUTE_PATHS
+#define CHIP_CONFIG_IM_MAX_DIRTY_ATTRIBUTE_PATHS 16
+#endif // CHIP_CONFIG_IM_MAX_DIRTY_ATTRIBUTE_PATHS
+
+/**
+ *  @def CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_BUCKETS
+ *
+ *  @brief
+ *    Number of hash buckets of the reporting engine's index from attribute
+ *    path to the read handlers interested in it. Must be a power of two.
+ */
+#ifndef CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_BUCKETS
+#define CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_BUCKETS 16
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_BUCKETS
+
+/**
+ *  @def CHIP_CONFIG_IM_TRANSACTION_ARENA_BLOCK_SIZE
+ *
+ *  @brief
+ *    Size, in bytes, of the blocks of memory an interaction model read
+ *    handler allocates the paths of a request from. A handler keeps its
+ *    blocks from one request to the next.
+ */
+#ifndef CHIP_CONFIG_IM_TRANSACTION_ARENA_BLOCK_SIZE
+#define CHIP_CONFIG_IM_TRANSACTION_ARENA_BLOCK_SIZE 512
+#endif // CHIP_CONFIG_IM_TRANSACTION_ARENA_BLOCK_SIZE
+
+/**
+ *  @def CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX
+ *
+ *  @brief
+ *    Enable (1) or disable (0) the hash index attribute storage uses to find
+ *    attributes by endpoint, cluster and attribute ID. The index takes 40 to
+ *    80 bytes of heap per attribute of all endpoints; without it, attribute
+ *    storage walks the endpoint table for each lookup.
+ */
+#ifndef CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX
+#define CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX 0
+#endif // CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX
+
+/**
+ *  @def CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_SIZE
+ *
+ *  @brief
+ *    Number of values read through emberAfExternalAttributeReadCallback that
+ *    attribute storage caches until the application reports a change with
+ *    emberAfExternalAttributeChanged. 0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_SIZE
+#define CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_SIZE 0
+#endif // CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_SIZE
+
+/**
+ *  @def CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_MAX_VALUE_SIZE
+ *
+ *  @brief
+ *    Size in bytes of the largest externally stored attribute value that the
+ *    external attribute cache holds. Larger values are always read from the
+ *    application.
+ */
+#ifndef CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_MAX_VALUE_SIZE
+#define CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_MAX_VALUE_SIZE 8
+#endif // CHIP_CONFIG_EXTERNAL_ATTRIBUTE_CACHE_MAX_VALUE_SIZE
+
 /**
  * @def CHIP_NON_PRODUCTION_MARKER
  *
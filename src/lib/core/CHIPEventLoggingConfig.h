@@ -46,6 +46,23 @@
 #define CHIP_CONFIG_EVENT_SIZE_INCREMENT 8
 #endif /* CHIP_CONFIG_EVENT_SIZE_INCREMENT */
 
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+ *
+ * @brief
+ *   The number of entries in the event number index of each event
+ *   buffer, or 0 to disable the index.  Fetching events starts from
+ *   the newest indexed event preceding the requested ones, so at most
+ *   about 1/N of a buffer is scanned before the first event to be
+ *   fetched.  Each entry takes 64 bytes of RAM in every event buffer,
+ *   so the index is disabled by default and enabled on Linux and
+ *   Darwin; without it, fetching events scans each buffer from its
+ *   head.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE 0
+#endif
+
 /**
  * @def CHIP_CONFIG_EVENT_LOGGING_MAXIMUM_UPLOAD_SECONDS
  *
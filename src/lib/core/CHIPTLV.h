@@ -405,6 +405,44 @@ public:
      */
     CHIP_ERROR Get(float & v);
 
+    /**
+     * Get the value of the current byte string element as a span over the encoded data, without copying it.
+     *
+     * The span points into the underlying input buffer and stays valid for as long as that buffer does; for a message,
+     * until the handler that received it returns. Like GetDataPtr(), this requires the entire value to be present in a
+     * single buffer.
+     *
+     * @param[out]  v                       Receives the value associated with current TLV element.
+     *
+     * @retval #CHIP_NO_ERROR              If the method succeeded.
+     * @retval #CHIP_ERROR_WRONG_TLV_TYPE  If the current element is not a TLV byte string, or the reader is not
+     *                                      positioned on an element.
+     * @retval #CHIP_ERROR_TLV_UNDERRUN    If the underlying TLV encoding ended prematurely or the value of the current
+     *                                      element is not contained within a single contiguous buffer.
+     * @retval other                        Other CHIP or platform error codes returned by the configured
+     *                                      TLVBackingStore.
+     *
+     */
+    CHIP_ERROR Get(ByteSpan & v);
+
+    /**
+     * Get the value of the current UTF8 string element as a span over the encoded characters, without copying it.
+     *
+     * The span is not null-terminated, and is valid under the same conditions as for Get(ByteSpan &).
+     *
+     * @param[out]  v                       Receives the value associated with current TLV element.
+     *
+     * @retval #CHIP_NO_ERROR              If the method succeeded.
+     * @retval #CHIP_ERROR_WRONG_TLV_TYPE  If the current element is not a TLV UTF8 string, or the reader is not
+     *                                      positioned on an element.
+     * @retval #CHIP_ERROR_TLV_UNDERRUN    If the underlying TLV encoding ended prematurely or the value of the current
+     *                                      element is not contained within a single contiguous buffer.
+     * @retval other                        Other CHIP or platform error codes returned by the configured
+     *                                      TLVBackingStore.
+     *
+     */
+    CHIP_ERROR Get(CharSpan & v);
+
     /**
      * Get the value of the current byte or UTF8 string element.
      *
@@ -523,6 +561,38 @@ public:
      */
     CHIP_ERROR GetDataPtr(const uint8_t *& data);
 
+    /**
+     * Get a pointer to the next @p len bytes of encoding, for decoders that match the members of the current structure or
+     * list against a fixed layout themselves.
+     *
+     * The reader must be positioned between two members of a structure or list, e.g. right after EnterContainer(). The
+     * reader is not advanced; once the members have been decoded, call SkipPreEncodedMembers() to move past them.
+     *
+     * @param[out] data                     A reference to a const pointer that will receive a pointer to the encoding.
+     * @param[in]  len                      The number of bytes that must be present in the current input buffer.
+     *
+     * @retval #CHIP_NO_ERROR              If the method succeeded.
+     * @retval #CHIP_ERROR_INCORRECT_STATE If the reader is not positioned between the members of a structure or list.
+     * @retval #CHIP_ERROR_TLV_UNDERRUN    If fewer than @p len bytes are left in the current input buffer.
+     * @retval other                        Other CHIP or platform error codes returned by the configured
+     *                                      TLVBackingStore.
+     *
+     */
+    CHIP_ERROR GetPreEncodedMembers(const uint8_t *& data, uint32_t len);
+
+    /**
+     * Advance the reader past @p len bytes of members returned by GetPreEncodedMembers().
+     *
+     * The caller is responsible for @p len covering whole elements; the reader is left between two members, so that Next()
+     * reads the element that follows.
+     *
+     * @retval #CHIP_NO_ERROR              If the method succeeded.
+     * @retval #CHIP_ERROR_INCORRECT_STATE If the reader is not positioned between the members of a structure or list.
+     * @retval #CHIP_ERROR_TLV_UNDERRUN    If fewer than @p len bytes are left in the current input buffer.
+     *
+     */
+    CHIP_ERROR SkipPreEncodedMembers(uint32_t len);
+
     /**
      * Prepares a TLVReader object for reading the members of TLV container element.
      *
@@ -802,6 +872,7 @@ protected:
     void ClearElementState();
     CHIP_ERROR SkipData();
     CHIP_ERROR SkipToEndOfContainer();
+    void SkipElementsInBuffer(uint32_t & nestLevel, TLVType outerContainerType);
     CHIP_ERROR VerifyElement();
     uint64_t ReadTag(TLVTagControl tagControl, const uint8_t *& p);
     CHIP_ERROR EnsureData(CHIP_ERROR noDataErr);
@@ -1653,6 +1724,31 @@ public:
      */
     CHIP_ERROR PutPreEncodedContainer(uint64_t tag, TLVType containerType, const uint8_t * data, uint32_t dataLen);
 
+    /**
+     * Encodes a set of pre-encoded member elements into the structure or list being written.
+     *
+     * The PutPreEncodedMembers() method copies @p data, which is expected to contain zero or more fully encoded TLV
+     * elements with context or fully-qualified tags, as is. It lets encoders that know the layout of their members ahead
+     * of time, such as TLV::ContextStructCodec, write all of them in one call instead of one element at a time.
+     *
+     * @param[in]   data            A pointer to a buffer containing zero of more encoded TLV elements.
+     * @param[in]   dataLen         The number of bytes in the @p data buffer.
+     *
+     * @retval #CHIP_NO_ERROR      If the method succeeded.
+     * @retval #CHIP_ERROR_INVALID_TLV_TAG
+     *                              If the writer is not writing the members of a structure or list.
+     * @retval #CHIP_ERROR_TLV_CONTAINER_OPEN
+     *                              If a container writer has been opened on the current writer and not
+     *                              yet closed.
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL
+     *                              If writing the members would exceed the limit on the maximum number of
+     *                              bytes specified when the writer was initialized.
+     * @retval other                Other CHIP or platform-specific errors returned by the configured
+     *                              TLVBackingStore.
+     *
+     */
+    CHIP_ERROR PutPreEncodedMembers(const uint8_t * data, uint32_t dataLen);
+
     /**
      * Copies a TLV container element from TLVReader object
      *
@@ -1819,6 +1915,25 @@ public:
      * @return the total remaining number of bytes.
      */
     uint32_t GetRemainingFreeLength() const { return mRemainingLen; }
+
+    /**
+     * Keep the last @p aBufferSize bytes of the writer's space free: writes fail with CHIP_ERROR_BUFFER_TOO_SMALL once they
+     * would reach into it, until UnreserveBuffer() gives the space back. This lets an encoder fill a buffer with optional
+     * elements and still have room for the ones that must end the encoding.
+     *
+     * @retval #CHIP_NO_ERROR              If the space was reserved.
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL If fewer than @p aBufferSize bytes are left.
+     */
+    CHIP_ERROR ReserveBuffer(uint32_t aBufferSize);
+
+    /**
+     * Give back @p aBufferSize bytes reserved by ReserveBuffer().
+     *
+     * @retval #CHIP_NO_ERROR              If the space was given back.
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT If fewer than @p aBufferSize bytes are reserved.
+     */
+    CHIP_ERROR UnreserveBuffer(uint32_t aBufferSize);
+
     /**
      * The profile id of tags that should be encoded in implicit form.
      *
@@ -1849,6 +1964,7 @@ protected:
     uint32_t mRemainingLen;
     uint32_t mLenWritten;
     uint32_t mMaxLen;
+    uint32_t mReservedSize;
     TLVType mContainerType;
 
 private:
@@ -2185,6 +2301,8 @@ public:
     CHIP_ERROR Get(uint64_t & v) { return mUpdaterReader.Get(v); }
     CHIP_ERROR Get(float & v) { return mUpdaterReader.Get(v); }
     CHIP_ERROR Get(double & v) { return mUpdaterReader.Get(v); }
+    CHIP_ERROR Get(ByteSpan & v) { return mUpdaterReader.Get(v); }
+    CHIP_ERROR Get(CharSpan & v) { return mUpdaterReader.Get(v); }
     CHIP_ERROR GetBytes(uint8_t * buf, uint32_t bufSize) { return mUpdaterReader.GetBytes(buf, bufSize); }
     CHIP_ERROR DupBytes(uint8_t *& buf, uint32_t & dataLen) { return mUpdaterReader.DupBytes(buf, dataLen); }
     CHIP_ERROR GetString(char * buf, uint32_t bufSize) { return mUpdaterReader.GetString(buf, bufSize); }
@@ -0,0 +1,195 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines codecs for CHIP TLV structures whose members all have
+ *      a fixed-width encoding, such as the arguments of most cluster commands.
+ */
+
+#pragma once
+
+#include <core/CHIPEncoding.h>
+#include <core/CHIPError.h>
+#include <core/CHIPTLV.h>
+#include <support/CodeUtils.h>
+
+#include <initializer_list>
+#include <stdint.h>
+#include <type_traits>
+
+namespace chip {
+namespace TLV {
+
+namespace Internal {
+
+constexpr uint32_t SumOfLengths(std::initializer_list<uint32_t> lengths)
+{
+    uint32_t sum = 0;
+    for (uint32_t length : lengths)
+    {
+        sum += length;
+    }
+    return sum;
+}
+
+} // namespace Internal
+
+/**
+ * The encoding of an integer of type @p T as a context-tagged member that always uses the full width of @p T, so that its
+ * control byte is known at compile time.
+ */
+template <typename T>
+struct FixedWidthContextField
+{
+    static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value, "Only integers have a fixed-width encoding");
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8, "Unsupported integer width");
+
+    using UnsignedType = typename std::make_unsigned<T>::type;
+
+    static constexpr uint8_t kControlByte = static_cast<uint8_t>(
+        static_cast<uint8_t>(TLVTagControl::ContextSpecific) |
+        static_cast<uint8_t>(static_cast<uint8_t>(std::is_signed<T>::value ? TLVElementType::Int8 : TLVElementType::UInt8) +
+                             (sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1 : sizeof(T) == 4 ? 2 : 3)));
+
+    // Control byte, context tag, value.
+    static constexpr uint32_t kEncodedLength = 2 + sizeof(T);
+
+    static void Encode(uint8_t * p, uint8_t tag, T value)
+    {
+        p[0] = kControlByte;
+        p[1] = tag;
+        Put(p + 2, static_cast<UnsignedType>(value));
+    }
+
+    static bool Matches(const uint8_t * p, uint8_t tag) { return p[0] == kControlByte && p[1] == tag; }
+
+    static T Decode(const uint8_t * p)
+    {
+        UnsignedType value;
+        Get(p + 2, value);
+        return static_cast<T>(value);
+    }
+
+private:
+    static void Put(uint8_t * p, uint8_t v) { Encoding::Put8(p, v); }
+    static void Put(uint8_t * p, uint16_t v) { Encoding::LittleEndian::Put16(p, v); }
+    static void Put(uint8_t * p, uint32_t v) { Encoding::LittleEndian::Put32(p, v); }
+    static void Put(uint8_t * p, uint64_t v) { Encoding::LittleEndian::Put64(p, v); }
+
+    static void Get(const uint8_t * p, uint8_t & v) { v = Encoding::Get8(p); }
+    static void Get(const uint8_t * p, uint16_t & v) { v = Encoding::LittleEndian::Get16(p); }
+    static void Get(const uint8_t * p, uint32_t & v) { v = Encoding::LittleEndian::Get32(p); }
+    static void Get(const uint8_t * p, uint64_t & v) { v = Encoding::LittleEndian::Get64(p); }
+};
+
+/**
+ * @class ContextStructCodec
+ *
+ * @brief
+ *  Encodes and decodes the members of a structure whose members are integers of types @p Fields, with context tags 0, 1,
+ *  2... in that order; this is the layout of cluster command arguments.
+ *
+ *  The encoding of all members is fixed apart from their values: every member uses the full width of its type. Encode()
+ *  therefore fills in a buffer whose control and tag bytes are known at compile time and writes it with a single
+ *  TLVWriter::PutPreEncodedMembers() call, and Decode() matches those bytes directly against the input instead of going
+ *  through TLVReader::Next() and Get() for each member.
+ *
+ *  Decode() only accepts exactly that layout, followed by the end of the structure. Other valid encodings of the same
+ *  members, e.g. with integers in fewer bytes, different member order or additional members, make it fail without
+ *  consuming anything, so that callers can fall back to reading the members one by one.
+ */
+template <typename... Fields>
+class ContextStructCodec
+{
+public:
+    static_assert(sizeof...(Fields) > 0, "A codec needs at least one member");
+    static_assert(sizeof...(Fields) <= UINT8_MAX + 1u, "Members must have one-byte context tags");
+
+    static constexpr uint32_t kEncodedLength = Internal::SumOfLengths({ FixedWidthContextField<Fields>::kEncodedLength... });
+
+    /**
+     * Write @p values as the members of the structure or list that @p writer is writing.
+     */
+    static CHIP_ERROR Encode(TLVWriter & writer, const Fields &... values)
+    {
+        uint8_t buf[kEncodedLength];
+        EncodeFields<0>(buf, values...);
+        return writer.PutPreEncodedMembers(buf, kEncodedLength);
+    }
+
+    /**
+     * Read the members of the structure that @p reader has just entered into @p values.
+     *
+     * On success the reader is positioned before the end of the structure. Otherwise it has not moved and @p values are
+     * unspecified.
+     *
+     * @retval #CHIP_ERROR_UNEXPECTED_TLV_ELEMENT If the members are not encoded in the layout of this codec.
+     * @retval other                              Errors from TLVReader::GetPreEncodedMembers().
+     */
+    static CHIP_ERROR Decode(TLVReader & reader, Fields &... values)
+    {
+        const uint8_t * data;
+
+        // The byte after the members must end the structure.
+        ReturnErrorOnFailure(reader.GetPreEncodedMembers(data, kEncodedLength + 1));
+        bool matches = MatchFields<0, Fields...>(data) && data[kEncodedLength] == kEndOfContainerControlByte;
+        VerifyOrReturnError(matches, CHIP_ERROR_UNEXPECTED_TLV_ELEMENT);
+
+        DecodeFields(data, values...);
+        return reader.SkipPreEncodedMembers(kEncodedLength);
+    }
+
+private:
+    static constexpr uint8_t kEndOfContainerControlByte = static_cast<uint8_t>(TLVElementType::EndOfContainer);
+
+    template <uint32_t Tag>
+    static void EncodeFields(uint8_t * p)
+    {}
+
+    template <uint32_t Tag, typename T, typename... Rest>
+    static void EncodeFields(uint8_t * p, const T & value, const Rest &... rest)
+    {
+        FixedWidthContextField<T>::Encode(p, static_cast<uint8_t>(Tag), value);
+        EncodeFields<Tag + 1>(p + FixedWidthContextField<T>::kEncodedLength, rest...);
+    }
+
+    template <uint32_t Tag>
+    static bool MatchFields(const uint8_t * p)
+    {
+        return true;
+    }
+
+    template <uint32_t Tag, typename T, typename... Rest>
+    static bool MatchFields(const uint8_t * p)
+    {
+        return FixedWidthContextField<T>::Matches(p, static_cast<uint8_t>(Tag)) &&
+            MatchFields<Tag + 1, Rest...>(p + FixedWidthContextField<T>::kEncodedLength);
+    }
+
+    static void DecodeFields(const uint8_t * p) {}
+
+    template <typename T, typename... Rest>
+    static void DecodeFields(const uint8_t * p, T & value, Rest &... rest)
+    {
+        value = FixedWidthContextField<T>::Decode(p);
+        DecodeFields(p + FixedWidthContextField<T>::kEncodedLength, rest...);
+    }
+};
+
+} // namespace TLV
+} // namespace chip
@@ -36,7 +36,51 @@ namespace TLV {
 
 using namespace chip::Encoding;
 
-static const uint8_t sTagSizes[] = { 0, 1, 2, 4, 2, 4, 6, 8 };
+static constexpr uint8_t sTagSizes[] = { 0, 1, 2, 4, 2, 4, 6, 8 };
+
+namespace {
+
+/**
+ * The size of the head of every element, indexed by control byte, so that SkipToEndOfContainer() can step over elements
+ * without decoding them. Control bytes that ReadElement() rejects, and the end of container with a tag, have a head of
+ * size 0.
+ */
+struct ElementHeadSizes
+{
+    constexpr ElementHeadSizes() : mHeadBytes{}, mLengthBytes{}
+    {
+        for (uint32_t controlByte = 0; controlByte <= UINT8_MAX; controlByte++)
+        {
+            const uint32_t type     = controlByte & kTLVTypeMask;
+            const uint32_t tagBytes = sTagSizes[controlByte >> kTLVTagControlShift];
+            const uint32_t size     = 1u << (type & kTLVTypeSizeMask);
+
+            if (type <= static_cast<uint32_t>(TLVElementType::UInt64) ||
+                type == static_cast<uint32_t>(TLVElementType::FloatingPointNumber32) ||
+                type == static_cast<uint32_t>(TLVElementType::FloatingPointNumber64))
+            {
+                mHeadBytes[controlByte] = static_cast<uint8_t>(1 + tagBytes + size);
+            }
+            else if (type >= static_cast<uint32_t>(TLVElementType::UTF8String_1ByteLength) &&
+                     type <= static_cast<uint32_t>(TLVElementType::ByteString_8ByteLength))
+            {
+                mHeadBytes[controlByte]   = static_cast<uint8_t>(1 + tagBytes + size);
+                mLengthBytes[controlByte] = static_cast<uint8_t>(size);
+            }
+            else if (type < static_cast<uint32_t>(TLVElementType::EndOfContainer))
+            {
+                mHeadBytes[controlByte] = static_cast<uint8_t>(1 + tagBytes);
+            }
+        }
+    }
+
+    uint8_t mHeadBytes[UINT8_MAX + 1];   ///< Control byte, tag, and length or value.
+    uint8_t mLengthBytes[UINT8_MAX + 1]; ///< Size of the length of strings, 0 for other elements.
+};
+
+constexpr ElementHeadSizes sElementHeadSizes;
+
+} // namespace
 
 void TLVReader::Init(const uint8_t * data, uint32_t dataLen)
 {
@@ -237,6 +281,49 @@ CHIP_ERROR TLVReader::Get(double & v)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TLVReader::Get(ByteSpan & v)
+{
+    if (GetType() != kTLVType_ByteString)
+        return CHIP_ERROR_WRONG_TLV_TYPE;
+
+    // An empty value may sit at the very end of the input, where GetDataPtr() would look for more data.
+    if (GetLength() == 0)
+    {
+        v = ByteSpan();
+        return CHIP_NO_ERROR;
+    }
+
+    const uint8_t * data;
+    CHIP_ERROR err = GetDataPtr(data);
+    if (err != CHIP_NO_ERROR)
+        return err;
+
+    v = ByteSpan(data, GetLength());
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVReader::Get(CharSpan & v)
+{
+    if (GetType() != kTLVType_UTF8String)
+        return CHIP_ERROR_WRONG_TLV_TYPE;
+
+    if (GetLength() == 0)
+    {
+        v = CharSpan();
+        return CHIP_NO_ERROR;
+    }
+
+    const uint8_t * data;
+    CHIP_ERROR err = GetDataPtr(data);
+    if (err != CHIP_NO_ERROR)
+        return err;
+
+    v = CharSpan(reinterpret_cast<const char *>(data), GetLength());
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR TLVReader::GetBytes(uint8_t * buf, uint32_t bufSize)
 {
     if (!TLVTypeIsString(ElementType()))
@@ -339,6 +426,42 @@ CHIP_ERROR TLVReader::GetDataPtr(const uint8_t *& data)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TLVReader::GetPreEncodedMembers(const uint8_t *& data, uint32_t len)
+{
+    CHIP_ERROR err;
+
+    if ((mContainerType != kTLVType_Structure && mContainerType != kTLVType_List) ||
+        ElementType() != TLVElementType::NotSpecified)
+        return CHIP_ERROR_INCORRECT_STATE;
+
+    err = EnsureData(CHIP_ERROR_TLV_UNDERRUN);
+    if (err != CHIP_NO_ERROR)
+        return err;
+
+    // The members must all be in the current buffer, as for GetDataPtr().
+    if (static_cast<uint32_t>(mBufEnd - mReadPoint) < len)
+        return CHIP_ERROR_TLV_UNDERRUN;
+
+    data = mReadPoint;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVReader::SkipPreEncodedMembers(uint32_t len)
+{
+    if ((mContainerType != kTLVType_Structure && mContainerType != kTLVType_List) ||
+        ElementType() != TLVElementType::NotSpecified)
+        return CHIP_ERROR_INCORRECT_STATE;
+
+    if (static_cast<uint32_t>(mBufEnd - mReadPoint) < len)
+        return CHIP_ERROR_TLV_UNDERRUN;
+
+    mReadPoint += len;
+    mLenRead += len;
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR TLVReader::OpenContainer(TLVReader & containerReader)
 {
     TLVElementType elemType = ElementType();
@@ -558,12 +681,104 @@ CHIP_ERROR TLVReader::SkipToEndOfContainer()
         if (err != CHIP_NO_ERROR)
             return err;
 
+        SkipElementsInBuffer(nestLevel, outerContainerType);
+
         err = ReadElement();
         if (err != CHIP_NO_ERROR)
             return err;
     }
 }
 
+/**
+ * Fast path of SkipToEndOfContainer(): steps over the elements that lie entirely in the current input buffer using only
+ * their control bytes and lengths, and tracks the nesting as SkipToEndOfContainer() does.
+ *
+ * It stops before the end of the container being skipped, at the end of the buffer, and before any element that
+ * ReadElement() or VerifyElement() would reject, so that SkipToEndOfContainer() reads those itself and reports the same
+ * errors as without the fast path.
+ */
+void TLVReader::SkipElementsInBuffer(uint32_t & nestLevel, TLVType outerContainerType)
+{
+    const uint8_t * p = mReadPoint;
+    if (p == nullptr)
+        return;
+
+    const uint8_t * end = mBufEnd;
+    if (static_cast<uint32_t>(end - p) > mMaxLen - mLenRead)
+        end = p + (mMaxLen - mLenRead);
+
+    TLVType containerType = mContainerType;
+
+    while (p < end)
+    {
+        const uint8_t controlByte = *p;
+
+        if (controlByte == static_cast<uint8_t>(TLVElementType::EndOfContainer))
+        {
+            if (nestLevel == 0)
+                break;
+
+            nestLevel--;
+            containerType = (nestLevel == 0) ? outerContainerType : kTLVType_UnknownContainer;
+            p++;
+            continue;
+        }
+
+        const uint8_t headBytes = sElementHeadSizes.mHeadBytes[controlByte];
+        if (headBytes == 0 || headBytes > end - p)
+            break;
+
+        // The tag rules of VerifyElement().
+        const TLVTagControl tagControl = static_cast<TLVTagControl>(controlByte & kTLVTagControlMask);
+        if (tagControl == TLVTagControl::Anonymous)
+        {
+            if (containerType == kTLVType_Structure)
+                break;
+        }
+        else if (containerType == kTLVType_Array ||
+                 (tagControl == TLVTagControl::ContextSpecific && containerType == kTLVType_NotSpecified) ||
+                 ((tagControl == TLVTagControl::ImplicitProfile_2Bytes || tagControl == TLVTagControl::ImplicitProfile_4Bytes) &&
+                  ImplicitProfileId == kProfileIdNotSpecified))
+        {
+            break;
+        }
+
+        uint64_t length           = 0;
+        const uint8_t * lengthPtr = p + headBytes - sElementHeadSizes.mLengthBytes[controlByte];
+        switch (sElementHeadSizes.mLengthBytes[controlByte])
+        {
+        case 1:
+            length = Read8(lengthPtr);
+            break;
+        case 2:
+            length = LittleEndian::Read16(lengthPtr);
+            break;
+        case 4:
+            length = LittleEndian::Read32(lengthPtr);
+            break;
+        case 8:
+            length = LittleEndian::Read64(lengthPtr);
+            break;
+        }
+        if (length > static_cast<uint64_t>(end - p - headBytes))
+            break;
+
+        p += headBytes + length;
+
+        TLVElementType elemType = static_cast<TLVElementType>(controlByte & kTLVTypeMask);
+        if (TLVTypeIsContainer(elemType))
+        {
+            nestLevel++;
+            containerType = static_cast<TLVType>(elemType);
+        }
+    }
+
+    mLenRead += static_cast<uint32_t>(p - mReadPoint);
+
+    mReadPoint     = p;
+    mContainerType = containerType;
+}
+
 CHIP_ERROR TLVReader::ReadElement()
 {
     CHIP_ERROR err;
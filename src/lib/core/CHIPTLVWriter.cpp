@@ -55,6 +55,7 @@ NO_INLINE void TLVWriter::Init(uint8_t * buf, uint32_t maxLen)
     mRemainingLen           = maxLen;
     mLenWritten             = 0;
     mMaxLen                 = maxLen;
+    mReservedSize           = 0;
     mContainerType          = kTLVType_NotSpecified;
     SetContainerOpen(false);
     SetCloseContainerReserved(true);
@@ -74,6 +75,7 @@ CHIP_ERROR TLVWriter::Init(TLVBackingStore & backingStore, uint32_t maxLen)
     mWritePoint    = mBufStart;
     mLenWritten    = 0;
     mMaxLen        = maxLen;
+    mReservedSize  = 0;
     mContainerType = kTLVType_NotSpecified;
     SetContainerOpen(false);
     SetCloseContainerReserved(true);
@@ -82,6 +84,22 @@ CHIP_ERROR TLVWriter::Init(TLVBackingStore & backingStore, uint32_t maxLen)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TLVWriter::ReserveBuffer(uint32_t aBufferSize)
+{
+    VerifyOrReturnError(mMaxLen >= mLenWritten && mMaxLen - mLenWritten >= aBufferSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+    mMaxLen -= aBufferSize;
+    mReservedSize += aBufferSize;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVWriter::UnreserveBuffer(uint32_t aBufferSize)
+{
+    VerifyOrReturnError(mReservedSize >= aBufferSize, CHIP_ERROR_INVALID_ARGUMENT);
+    mMaxLen += aBufferSize;
+    mReservedSize -= aBufferSize;
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR TLVWriter::Finalize()
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -474,6 +492,7 @@ CHIP_ERROR TLVWriter::OpenContainer(uint64_t tag, TLVType containerType, TLVWrit
     containerWriter.mRemainingLen  = mRemainingLen;
     containerWriter.mLenWritten    = 0;
     containerWriter.mMaxLen        = mMaxLen - mLenWritten;
+    containerWriter.mReservedSize  = 0;
     containerWriter.mContainerType = containerType;
     containerWriter.SetContainerOpen(false);
     containerWriter.SetCloseContainerReserved(IsCloseContainerReserved());
@@ -563,6 +582,17 @@ CHIP_ERROR TLVWriter::PutPreEncodedContainer(uint64_t tag, TLVType containerType
     return WriteData(data, dataLen);
 }
 
+CHIP_ERROR TLVWriter::PutPreEncodedMembers(const uint8_t * data, uint32_t dataLen)
+{
+    if (IsContainerOpen())
+        return CHIP_ERROR_TLV_CONTAINER_OPEN;
+
+    if (mContainerType != kTLVType_Structure && mContainerType != kTLVType_List)
+        return CHIP_ERROR_INVALID_TLV_TAG;
+
+    return WriteData(data, dataLen);
+}
+
 CHIP_ERROR TLVWriter::CopyContainer(TLVReader & container)
 {
     return CopyContainer(container.GetTag(), container);
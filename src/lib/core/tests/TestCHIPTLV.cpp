@@ -29,6 +29,7 @@
 #include <core/CHIPCircularTLVBuffer.h>
 #include <core/CHIPCore.h>
 #include <core/CHIPTLV.h>
+#include <core/CHIPTLVCodec.h>
 #include <core/CHIPTLVData.hpp>
 #include <core/CHIPTLVDebug.hpp>
 #include <core/CHIPTLVUtilities.hpp>
@@ -41,6 +42,7 @@
 
 #include <system/TLVPacketBufferBackingStore.h>
 
+#include <stdio.h>
 #include <string.h>
 
 using namespace chip;
@@ -1598,6 +1600,644 @@ void CheckCHIPTLVEmptyFind(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 }
 
+/**
+ *  Test reading strings as spans into the encoded data
+ */
+void CheckCHIPTLVGetSpan(nlTestSuite * inSuite, void * inContext)
+{
+    const uint8_t bytes[] = { 0x01, 0x02, 0x03 };
+    uint8_t buf[64];
+    TLVWriter writer;
+    TLVReader reader;
+    TLVType containerType;
+    ByteSpan byteSpan;
+    CharSpan charSpan;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    writer.Init(buf, sizeof(buf));
+    err = writer.StartContainer(AnonymousTag, kTLVType_Structure, containerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Put(ContextTag(0), ByteSpan(bytes));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.PutString(ContextTag(1), "hello");
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.PutString(ContextTag(2), "");
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Put(ContextTag(3), ByteSpan());
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.EndContainer(containerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // Leave out the end of the structure, so that the last value ends the input.
+    reader.Init(buf, writer.GetLengthWritten() - 1);
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.EnterContainer(containerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // The spans point into the encoding rather than into a copy.
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.Get(byteSpan);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, byteSpan.data_equal(ByteSpan(bytes)));
+    NL_TEST_ASSERT(inSuite, byteSpan.data() > buf && byteSpan.data() < buf + sizeof(buf));
+    err = reader.Get(charSpan);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_WRONG_TLV_TYPE);
+
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.Get(charSpan);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, charSpan.size() == 5 && memcmp(charSpan.data(), "hello", 5) == 0);
+    NL_TEST_ASSERT(inSuite, reinterpret_cast<const uint8_t *>(charSpan.data()) > buf);
+    err = reader.Get(byteSpan);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_WRONG_TLV_TYPE);
+
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.Get(charSpan);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR && charSpan.empty());
+
+    // An empty value at the very end of the encoding.
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.Get(byteSpan);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR && byteSpan.empty());
+}
+
+using TestStructCodec = ContextStructCodec<uint8_t, uint16_t, int16_t, uint32_t, uint64_t>;
+
+/**
+ *  Test the fixed-layout structure codec against the generic writer and reader
+ */
+void CheckCHIPTLVStructCodec(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[64];
+    TLVWriter writer;
+    TLVReader reader;
+    TLVType containerType;
+    uint8_t u8;
+    uint16_t u16;
+    int16_t i16;
+    uint32_t u32;
+    uint64_t u64;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    NL_TEST_ASSERT(inSuite, TestStructCodec::kEncodedLength == 3 + 4 + 4 + 6 + 10);
+    NL_TEST_ASSERT(inSuite, FixedWidthContextField<int16_t>::kControlByte == 0x21);
+    NL_TEST_ASSERT(inSuite, FixedWidthContextField<uint64_t>::kControlByte == 0x27);
+
+    // The codec writes a structure that the generic reader reads back.
+    writer.Init(buf, sizeof(buf));
+    err = writer.StartContainer(AnonymousTag, kTLVType_Structure, containerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = TestStructCodec::Encode(writer, 1, 2, -3, 4, 5);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.EndContainer(containerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.GetLengthWritten() == TestStructCodec::kEncodedLength + 2);
+
+    reader.Init(buf, writer.GetLengthWritten());
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.EnterContainer(containerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    TestNext<TLVReader>(inSuite, reader);
+    TestGet<TLVReader, uint8_t>(inSuite, reader, kTLVType_UnsignedInteger, ContextTag(0), 1);
+    TestNext<TLVReader>(inSuite, reader);
+    TestGet<TLVReader, uint16_t>(inSuite, reader, kTLVType_UnsignedInteger, ContextTag(1), 2);
+    TestNext<TLVReader>(inSuite, reader);
+    TestGet<TLVReader, int16_t>(inSuite, reader, kTLVType_SignedInteger, ContextTag(2), -3);
+    TestNext<TLVReader>(inSuite, reader);
+    TestGet<TLVReader, uint32_t>(inSuite, reader, kTLVType_UnsignedInteger, ContextTag(3), 4);
+    TestNext<TLVReader>(inSuite, reader);
+    TestGet<TLVReader, uint64_t>(inSuite, reader, kTLVType_UnsignedInteger, ContextTag(4), 5);
+    TestEndAndExitContainer<TLVReader>(inSuite, reader, containerType);
+
+    // The codec reads its own layout and leaves the reader before the end of the structure.
+    reader.Init(buf, writer.GetLengthWritten());
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = TestStructCodec::Decode(reader, u8, u16, i16, u32, u64);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INCORRECT_STATE);
+    err = reader.EnterContainer(containerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = TestStructCodec::Decode(reader, u8, u16, i16, u32, u64);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, u8 == 1 && u16 == 2 && i16 == -3 && u32 == 4 && u64 == 5);
+    TestEndAndExitContainer<TLVReader>(inSuite, reader, containerType);
+
+    // Integers in fewer bytes are not the codec's layout; the reader is left where it was for the generic path.
+    writer.Init(buf, sizeof(buf));
+    err = writer.StartContainer(AnonymousTag, kTLVType_Structure, containerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Put(ContextTag(0), static_cast<uint8_t>(1));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Put(ContextTag(1), static_cast<uint16_t>(2));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Put(ContextTag(2), static_cast<int16_t>(-3));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Put(ContextTag(3), static_cast<uint32_t>(4));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Put(ContextTag(4), static_cast<uint64_t>(5));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.EndContainer(containerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    reader.Init(buf, writer.GetLengthWritten());
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.EnterContainer(containerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = TestStructCodec::Decode(reader, u8, u16, i16, u32, u64);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_TLV_UNDERRUN || err == CHIP_ERROR_UNEXPECTED_TLV_ELEMENT);
+    TestNext<TLVReader>(inSuite, reader);
+    TestGet<TLVReader, uint8_t>(inSuite, reader, kTLVType_UnsignedInteger, ContextTag(0), 1);
+
+    // An additional member is not the codec's layout either.
+    writer.Init(buf, sizeof(buf));
+    err = writer.StartContainer(AnonymousTag, kTLVType_Structure, containerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = TestStructCodec::Encode(writer, 1, 2, -3, 4, 5);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.PutBoolean(ContextTag(5), true);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.EndContainer(containerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    reader.Init(buf, writer.GetLengthWritten());
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.EnterContainer(containerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = TestStructCodec::Decode(reader, u8, u16, i16, u32, u64);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_UNEXPECTED_TLV_ELEMENT);
+
+    // Members can only be written into a structure or list.
+    writer.Init(buf, sizeof(buf));
+    err = TestStructCodec::Encode(writer, 1, 2, -3, 4, 5);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INVALID_TLV_TAG);
+    err = writer.StartContainer(AnonymousTag, kTLVType_Array, containerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = TestStructCodec::Encode(writer, 1, 2, -3, 4, 5);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INVALID_TLV_TAG);
+
+    // Nor past the end of the buffer.
+    writer.Init(buf, TestStructCodec::kEncodedLength);
+    err = writer.StartContainer(AnonymousTag, kTLVType_Structure, containerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = TestStructCodec::Encode(writer, 1, 2, -3, 4, 5);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
+// Writes a structure with the members of TestStructCodec that have the given tags, in that order and in the full width
+// of their types, with the generic writer. Tag 5 is not a member of the codec.
+static CHIP_ERROR WriteStructMembers(TLVWriter & writer, const uint8_t * tags, size_t tagCount)
+{
+    TLVType containerType;
+
+    ReturnErrorOnFailure(writer.StartContainer(AnonymousTag, kTLVType_Structure, containerType));
+    for (size_t i = 0; i < tagCount; i++)
+    {
+        switch (tags[i])
+        {
+        case 0:
+            ReturnErrorOnFailure(writer.Put(ContextTag(0), static_cast<uint8_t>(1), true));
+            break;
+        case 1:
+            ReturnErrorOnFailure(writer.Put(ContextTag(1), static_cast<uint16_t>(2), true));
+            break;
+        case 2:
+            ReturnErrorOnFailure(writer.Put(ContextTag(2), static_cast<int16_t>(-3), true));
+            break;
+        case 3:
+            ReturnErrorOnFailure(writer.Put(ContextTag(3), static_cast<uint32_t>(4), true));
+            break;
+        case 4:
+            ReturnErrorOnFailure(writer.Put(ContextTag(4), static_cast<uint64_t>(5), true));
+            break;
+        default:
+            ReturnErrorOnFailure(writer.PutBoolean(ContextTag(tags[i]), true));
+            break;
+        }
+    }
+    ReturnErrorOnFailure(writer.EndContainer(containerType));
+    return writer.Finalize();
+}
+
+/**
+ *  Test that the fixed-layout structure codec and the generic writer and reader agree on the encoding of its members
+ */
+void CheckCHIPTLVStructCodecRoundTrip(nlTestSuite * inSuite, void * inContext)
+{
+    struct Values
+    {
+        uint8_t u8;
+        uint16_t u16;
+        int16_t i16;
+        uint32_t u32;
+        uint64_t u64;
+    };
+    const Values kValues[] = {
+        { 0, 0, 0, 0, 0 },
+        { 1, 2, -3, 4, 5 },
+        { UINT8_MAX, UINT16_MAX, INT16_MIN, UINT32_MAX, UINT64_MAX },
+        { 0x80, 0x100, INT16_MAX, 0x10000, UINT64_C(1) << 32 },
+    };
+
+    uint8_t codecBuf[64];
+    uint8_t genericBuf[64];
+    TLVWriter writer;
+    TLVReader reader;
+    TLVType containerType;
+    Values decoded;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    for (const Values & values : kValues)
+    {
+        writer.Init(codecBuf, sizeof(codecBuf));
+        err = writer.StartContainer(AnonymousTag, kTLVType_Structure, containerType);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = TestStructCodec::Encode(writer, values.u8, values.u16, values.i16, values.u32, values.u64);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.EndContainer(containerType);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.Finalize();
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        const uint32_t codecLength = writer.GetLengthWritten();
+
+        // The generic writer, keeping the width of each type, writes the same bytes.
+        writer.Init(genericBuf, sizeof(genericBuf));
+        err = writer.StartContainer(AnonymousTag, kTLVType_Structure, containerType);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.Put(ContextTag(0), values.u8, true);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.Put(ContextTag(1), values.u16, true);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.Put(ContextTag(2), values.i16, true);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.Put(ContextTag(3), values.u32, true);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.Put(ContextTag(4), values.u64, true);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.EndContainer(containerType);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.Finalize();
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        NL_TEST_ASSERT(inSuite, writer.GetLengthWritten() == codecLength);
+        NL_TEST_ASSERT(inSuite, memcmp(codecBuf, genericBuf, codecLength) == 0);
+
+        // The codec reads back what it wrote.
+        reader.Init(codecBuf, codecLength);
+        err = reader.Next();
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = reader.EnterContainer(containerType);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = TestStructCodec::Decode(reader, decoded.u8, decoded.u16, decoded.i16, decoded.u32, decoded.u64);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite,
+                       decoded.u8 == values.u8 && decoded.u16 == values.u16 && decoded.i16 == values.i16 &&
+                           decoded.u32 == values.u32 && decoded.u64 == values.u64);
+        TestEndAndExitContainer<TLVReader>(inSuite, reader, containerType);
+    }
+
+    // Missing, additional and out-of-order members are not the codec's layout. The reader is left before the first member.
+    struct Members
+    {
+        size_t count;
+        uint8_t tags[6];
+    };
+    const Members kRejected[] = {
+        { 4, { 0, 1, 2, 3 } },       { 4, { 0, 1, 3, 4 } },       { 4, { 1, 2, 3, 4 } }, { 0, {} },
+        { 6, { 0, 1, 2, 3, 4, 5 } }, { 6, { 5, 0, 1, 2, 3, 4 } }, { 5, { 0, 2, 1, 3, 4 } }, { 5, { 4, 3, 2, 1, 0 } },
+        { 5, { 0, 1, 2, 4, 3 } },
+    };
+    for (const Members & members : kRejected)
+    {
+        writer.Init(genericBuf, sizeof(genericBuf));
+        err = WriteStructMembers(writer, members.tags, members.count);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        reader.Init(genericBuf, writer.GetLengthWritten());
+        err = reader.Next();
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = reader.EnterContainer(containerType);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = TestStructCodec::Decode(reader, decoded.u8, decoded.u16, decoded.i16, decoded.u32, decoded.u64);
+        NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_UNEXPECTED_TLV_ELEMENT || err == CHIP_ERROR_TLV_UNDERRUN);
+
+        err = reader.Next();
+        if (members.count == 0)
+        {
+            NL_TEST_ASSERT(inSuite, err == CHIP_END_OF_TLV);
+        }
+        else
+        {
+            NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, reader.GetTag() == ContextTag(members.tags[0]));
+        }
+    }
+
+    // The members in order, written by the generic writer, are.
+    const uint8_t kInOrder[] = { 0, 1, 2, 3, 4 };
+    writer.Init(genericBuf, sizeof(genericBuf));
+    err = WriteStructMembers(writer, kInOrder, sizeof(kInOrder));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    reader.Init(genericBuf, writer.GetLengthWritten());
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.EnterContainer(containerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = TestStructCodec::Decode(reader, decoded.u8, decoded.u16, decoded.i16, decoded.u32, decoded.u64);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, decoded.u8 == 1 && decoded.u16 == 2 && decoded.i16 == -3 && decoded.u32 == 4 && decoded.u64 == 5);
+    TestEndAndExitContainer<TLVReader>(inSuite, reader, containerType);
+}
+
+/**
+ *  Backing store that hands out a contiguous encoding in chunks of a given size, so that elements straddle buffers
+ */
+class ChunkedBackingStore : public TLVBackingStore
+{
+public:
+    ChunkedBackingStore(const uint8_t * data, uint32_t dataLen, uint32_t chunkLen) :
+        mData(data), mDataLen(dataLen), mChunkLen(chunkLen)
+    {}
+
+    CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = mData;
+        bufLen   = (mDataLen < mChunkLen) ? mDataLen : mChunkLen;
+        return CHIP_NO_ERROR;
+    }
+
+    // Copies of a reader share the backing store, so the next chunk is found from the reader's position.
+    CHIP_ERROR GetNextBuffer(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        uint32_t offset = reader.GetLengthRead();
+        bufStart        = mData + offset;
+        bufLen          = (mDataLen - offset < mChunkLen) ? mDataLen - offset : mChunkLen;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnInit(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR GetNewBuffer(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    const uint8_t * mData;
+    uint32_t mDataLen;
+    uint32_t mChunkLen;
+};
+
+/**
+ *  Write a structure shaped like a report of @p count attribute data elements, followed by a boolean
+ */
+CHIP_ERROR WriteReportLikeStructure(TLVWriter & writer, uint32_t count)
+{
+    TLVType outer, list, element, path;
+
+    ReturnErrorOnFailure(writer.StartContainer(AnonymousTag, kTLVType_Structure, outer));
+    ReturnErrorOnFailure(writer.StartContainer(ContextTag(0), kTLVType_Array, list));
+    for (uint32_t i = 0; i < count; i++)
+    {
+        ReturnErrorOnFailure(writer.StartContainer(AnonymousTag, kTLVType_Structure, element));
+        ReturnErrorOnFailure(writer.StartContainer(ContextTag(0), kTLVType_List, path));
+        ReturnErrorOnFailure(writer.Put(ContextTag(1), static_cast<uint16_t>(i % 4)));
+        ReturnErrorOnFailure(writer.Put(ContextTag(2), static_cast<uint32_t>(0x0006 + i % 8)));
+        ReturnErrorOnFailure(writer.Put(ContextTag(3), i));
+        ReturnErrorOnFailure(writer.EndContainer(path));
+        ReturnErrorOnFailure(writer.Put(ContextTag(1), static_cast<uint64_t>(i) << 20));
+        switch (i % 3)
+        {
+        case 0:
+            ReturnErrorOnFailure(writer.Put(ContextTag(2), i));
+            break;
+        case 1:
+            ReturnErrorOnFailure(writer.PutString(ContextTag(2), "a string attribute value"));
+            break;
+        default: {
+            TLVType array;
+            ReturnErrorOnFailure(writer.StartContainer(ContextTag(2), kTLVType_Array, array));
+            ReturnErrorOnFailure(writer.PutBoolean(AnonymousTag, true));
+            ReturnErrorOnFailure(writer.PutNull(AnonymousTag));
+            ReturnErrorOnFailure(writer.Put(AnonymousTag, 1.5));
+            ReturnErrorOnFailure(writer.PutBytes(AnonymousTag, reinterpret_cast<const uint8_t *>("bytes"), 5));
+            ReturnErrorOnFailure(writer.EndContainer(array));
+            break;
+        }
+        }
+        ReturnErrorOnFailure(writer.EndContainer(element));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(list));
+    ReturnErrorOnFailure(writer.PutBoolean(ProfileTag(0x235A0000, 1), true));
+    ReturnErrorOnFailure(writer.EndContainer(outer));
+    return writer.Finalize();
+}
+
+/**
+ *  Skip the list of a report-like structure and find the element after it; returns the first error met
+ */
+CHIP_ERROR SkipReportLikeList(TLVReader & reader, uint32_t & elementCount)
+{
+    TLVType outer, list;
+    TLVReader found;
+    bool value = false;
+
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(reader.EnterContainer(outer));
+    ReturnErrorOnFailure(reader.FindElementWithTag(ProfileTag(0x235A0000, 1), found));
+    ReturnErrorOnFailure(found.Get(value));
+    VerifyOrReturnError(value, CHIP_ERROR_INTERNAL);
+
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(reader.EnterContainer(list));
+
+    elementCount = 0;
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        elementCount++;
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(reader.ExitContainer(list));
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(reader.Get(value));
+    VerifyOrReturnError(value, CHIP_ERROR_INTERNAL);
+    return reader.ExitContainer(outer);
+}
+
+/**
+ *  Test that skipping containers gives the same results whether or not the encoding is in one buffer
+ */
+void CheckCHIPTLVSkipContainers(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[2048];
+    TLVWriter writer;
+    TLVReader reader;
+    uint32_t elementCount = 0;
+    CHIP_ERROR err        = CHIP_NO_ERROR;
+
+    writer.Init(buf, sizeof(buf));
+    err = WriteReportLikeStructure(writer, 20);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    const uint32_t encodingLen = writer.GetLengthWritten();
+
+    reader.Init(buf, encodingLen);
+    err = SkipReportLikeList(reader, elementCount);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR && elementCount == 20);
+    NL_TEST_ASSERT(inSuite, reader.GetLengthRead() == encodingLen);
+
+    for (uint32_t chunkLen : { 1u, 2u, 7u, 16u, 100u })
+    {
+        ChunkedBackingStore store(buf, encodingLen, chunkLen);
+        err = reader.Init(store, encodingLen);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = SkipReportLikeList(reader, elementCount);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR && elementCount == 20);
+        NL_TEST_ASSERT(inSuite, reader.GetLengthRead() == encodingLen);
+    }
+
+    // Malformed encodings are reported the same way, whichever way they are read.
+    // clang-format off
+    const uint8_t malformed[][12] =
+    {
+        // End of container with a tag, inside a nested structure.
+        { 0x15, 0x35, 0x00, 0x24, 0x01, 0x07, 0x38, 0x01, 0x18, 0x18 },
+        // Anonymous member of a nested structure.
+        { 0x15, 0x35, 0x00, 0x04, 0x07, 0x18, 0x18 },
+        // Tagged member of a nested array.
+        { 0x15, 0x36, 0x00, 0x24, 0x01, 0x07, 0x18, 0x18 },
+        // Implicit profile tag without an implicit profile.
+        { 0x15, 0x37, 0x00, 0x84, 0x01, 0x00, 0x07, 0x18, 0x18 },
+        // Invalid element type.
+        { 0x15, 0x37, 0x00, 0x1F, 0x18, 0x18 },
+        // String longer than the encoding.
+        { 0x15, 0x37, 0x00, 0x0C, 0x20, 0x61, 0x18, 0x18 },
+        // Missing end of container.
+        { 0x15, 0x37, 0x00, 0x04, 0x07 },
+    };
+    // clang-format on
+
+    for (const uint8_t * encoding : malformed)
+    {
+        uint32_t len = 12;
+        while (len > 0 && encoding[len - 1] == 0)
+        {
+            len--;
+        }
+
+        TLVType outer;
+        reader.Init(encoding, len);
+        NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR && reader.EnterContainer(outer) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+        CHIP_ERROR contiguousErr = reader.Skip();
+        NL_TEST_ASSERT(inSuite, contiguousErr != CHIP_NO_ERROR);
+
+        ChunkedBackingStore store(encoding, len, 1);
+        NL_TEST_ASSERT(inSuite, reader.Init(store, len) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR && reader.EnterContainer(outer) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, reader.Skip() == contiguousErr);
+    }
+}
+
+/**
+ *  Test skipping the elements of a large report one at a time, with the encoding spread over 16-byte buffers, so that most
+ *  elements straddle a buffer boundary
+ */
+void CheckCHIPTLVSkipContainersChained(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint32_t kElements = 200;
+
+    chip::Platform::ScopedMemoryBuffer<uint8_t> buf;
+    NL_TEST_ASSERT(inSuite, buf.Alloc(kElements * 64));
+    if (buf.Get() == nullptr)
+    {
+        return;
+    }
+
+    TLVWriter writer;
+    writer.Init(buf.Get(), kElements * 64);
+    NL_TEST_ASSERT(inSuite, WriteReportLikeStructure(writer, kElements) == CHIP_NO_ERROR);
+    const uint32_t encodingLen = writer.GetLengthWritten();
+
+    // Walk the encoding in one buffer and in chained buffers side by side; both must stop at the same places.
+    TLVReader contiguous;
+    TLVReader chained;
+    ChunkedBackingStore store(buf.Get(), encodingLen, 16);
+    TLVType outer, list, element, chainedOuter, chainedList, chainedElement;
+
+    contiguous.Init(buf.Get(), encodingLen);
+    NL_TEST_ASSERT(inSuite, chained.Init(store, encodingLen) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, contiguous.Next() == CHIP_NO_ERROR && contiguous.EnterContainer(outer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, contiguous.Next() == CHIP_NO_ERROR && contiguous.EnterContainer(list) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, chained.Next() == CHIP_NO_ERROR && chained.EnterContainer(chainedOuter) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, chained.Next() == CHIP_NO_ERROR && chained.EnterContainer(chainedList) == CHIP_NO_ERROR);
+
+    for (uint32_t i = 0; i < kElements; i++)
+    {
+        NL_TEST_ASSERT(inSuite, contiguous.Next() == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, chained.Next() == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, chained.GetType() == kTLVType_Structure);
+        NL_TEST_ASSERT(inSuite, chained.GetLengthRead() == contiguous.GetLengthRead());
+
+        switch (i % 3)
+        {
+        case 0:
+            // Skip the whole element explicitly.
+            NL_TEST_ASSERT(inSuite, contiguous.Skip() == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, chained.Skip() == CHIP_NO_ERROR);
+            break;
+        case 1: {
+            // Skip the path, read the field after it, and leave the rest of the element to ExitContainer().
+            uint64_t value = 0;
+            NL_TEST_ASSERT(inSuite, contiguous.EnterContainer(element) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, contiguous.Next() == CHIP_NO_ERROR && contiguous.Skip() == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, contiguous.Next() == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, contiguous.ExitContainer(element) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, chained.EnterContainer(chainedElement) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, chained.Next() == CHIP_NO_ERROR && chained.Skip() == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, chained.Next() == CHIP_NO_ERROR && chained.Get(value) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, value == static_cast<uint64_t>(i) << 20);
+            NL_TEST_ASSERT(inSuite, chained.ExitContainer(chainedElement) == CHIP_NO_ERROR);
+            break;
+        }
+        default:
+            // Let the next call to Next() skip the element.
+            break;
+        }
+        NL_TEST_ASSERT(inSuite, chained.GetLengthRead() == contiguous.GetLengthRead());
+    }
+
+    NL_TEST_ASSERT(inSuite, contiguous.Next() == CHIP_END_OF_TLV);
+    NL_TEST_ASSERT(inSuite, chained.Next() == CHIP_END_OF_TLV);
+    NL_TEST_ASSERT(inSuite, chained.ExitContainer(chainedList) == CHIP_NO_ERROR);
+
+    // The element after the list is found where it was written.
+    bool value = false;
+    NL_TEST_ASSERT(inSuite, chained.Next() == CHIP_NO_ERROR && chained.GetTag() == ProfileTag(0x235A0000, 1));
+    NL_TEST_ASSERT(inSuite, chained.Get(value) == CHIP_NO_ERROR && value);
+    NL_TEST_ASSERT(inSuite, chained.ExitContainer(chainedOuter) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, chained.GetLengthRead() == encodingLen);
+}
+
 // clang-format off
 uint8_t Encoding2[] =
 {
@@ -2477,6 +3117,59 @@ void CheckBufferOverflow(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+/**
+ *  Test rolling back a writer over chained PacketBuffers to a checkpoint in an earlier buffer
+ */
+void CheckBufferRollback(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err;
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferTLVReader reader;
+    TLVWriter & baseWriter = writer;
+    TLVWriter checkpoint;
+    uint8_t filler[64] = {};
+
+    System::PacketBufferHandle buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+    buf->SetStart(buf->Start() + buf->MaxDataLength() - 10);
+
+    // Roll back data that went into the next buffer, then write more than fits in the first one again.
+    writer.Init(buf.Retain(), /* useChainedBuffers = */ true);
+    writer.ImplicitProfileId = TestProfile_2;
+    checkpoint               = writer;
+
+    err = writer.PutBytes(AnonymousTag, filler, sizeof(filler));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, buf->HasChainedBuffer());
+
+    baseWriter = checkpoint;
+    WriteEncoding1(inSuite, writer);
+
+    TestBufferContents(inSuite, buf, Encoding1, sizeof(Encoding1));
+
+    reader.Init(buf.Retain(), /* useChainedBuffers = */ true);
+    reader.ImplicitProfileId = TestProfile_2;
+
+    ReadEncoding1(inSuite, reader);
+
+    // Roll back data that went into the next buffer, then write less than fits in the first one.
+    buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+    buf->SetStart(buf->Start() + buf->MaxDataLength() - 10);
+
+    writer.Init(buf.Retain(), /* useChainedBuffers = */ true);
+    checkpoint = writer;
+
+    err = writer.PutBytes(AnonymousTag, filler, sizeof(filler));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    baseWriter = checkpoint;
+    err        = writer.Put(AnonymousTag, static_cast<uint8_t>(42));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.Finalize(&buf);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, buf->DataLength() == 2 && buf->TotalLength() == 2);
+}
+
 /**
  * Test case to verify the correctness of TLVReader::GetTag()
  *
@@ -3523,6 +4216,45 @@ static void CheckCloseContainerReserve(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+static void CheckReserveBuffer(nlTestSuite * inSuite, void * inContext)
+{
+    // A structure holding a context-tagged boolean takes 4 bytes, so it does not fit in 5 while 2 of them are reserved.
+    uint8_t buf[5];
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TLVWriter writer;
+    TLVType container;
+
+    writer.Init(buf, sizeof(buf));
+
+    err = writer.ReserveBuffer(sizeof(buf) + 1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    err = writer.ReserveBuffer(2);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.StartContainer(AnonymousTag, kTLVType_Structure, container);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.PutBoolean(ContextTag(1), true);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    err = writer.UnreserveBuffer(3);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INVALID_ARGUMENT);
+
+    err = writer.UnreserveBuffer(2);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.PutBoolean(ContextTag(1), true);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.EndContainer(container);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.GetLengthWritten() == 4);
+}
+
 static CHIP_ERROR ReadFuzzedEncoding1(nlTestSuite * inSuite, TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3751,6 +4483,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Simple Write Read Test",              CheckSimpleWriteRead),
     NL_TEST_DEF("Inet Buffer Test",                    CheckPacketBuffer),
     NL_TEST_DEF("Buffer Overflow Test",                CheckBufferOverflow),
+    NL_TEST_DEF("Buffer Rollback Test",                CheckBufferRollback),
     NL_TEST_DEF("Pretty Print Test",                   CheckPrettyPrinter),
     NL_TEST_DEF("Data Macro Test",                     CheckDataMacro),
     NL_TEST_DEF("Strict Aliasing Test",                CheckStrictAliasing),
@@ -3760,6 +4493,11 @@ static const nlTest sTests[] =
     NL_TEST_DEF("CHIP TLV Utilities",                  CheckCHIPTLVUtilities),
     NL_TEST_DEF("CHIP TLV Updater",                    CheckCHIPUpdater),
     NL_TEST_DEF("CHIP TLV Empty Find",                 CheckCHIPTLVEmptyFind),
+    NL_TEST_DEF("CHIP TLV Get Span",                   CheckCHIPTLVGetSpan),
+    NL_TEST_DEF("CHIP TLV Struct Codec",               CheckCHIPTLVStructCodec),
+    NL_TEST_DEF("CHIP TLV Struct Codec Round Trip",    CheckCHIPTLVStructCodecRoundTrip),
+    NL_TEST_DEF("CHIP TLV Skip Containers",            CheckCHIPTLVSkipContainers),
+    NL_TEST_DEF("CHIP TLV Skip Containers Chained",    CheckCHIPTLVSkipContainersChained),
     NL_TEST_DEF("CHIP Circular TLV buffer, simple",    CheckCircularTLVBufferSimple),
     NL_TEST_DEF("CHIP Circular TLV buffer, mid-buffer start", CheckCircularTLVBufferStartMidway),
     NL_TEST_DEF("CHIP Circular TLV buffer, straddle",  CheckCircularTLVBufferEvictStraddlingEvent),
@@ -3768,6 +4506,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("CHIP TLV Printf, Circular TLV buf",   CheckCHIPTLVPutStringFCircular),
     NL_TEST_DEF("CHIP TLV Skip non-contiguous",        CheckCHIPTLVSkipCircular),
     NL_TEST_DEF("CHIP TLV Check reserve",              CheckCloseContainerReserve),
+    NL_TEST_DEF("CHIP TLV Reserve buffer",             CheckReserveBuffer),
     NL_TEST_DEF("CHIP TLV Reader Fuzz Test",           TLVReaderFuzzTest),
 
     NL_TEST_SENTINEL()
@@ -0,0 +1,123 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of encoding and decoding a structure
+ *      of integers with TLV::ContextStructCodec, against the generic TLV
+ *      writer and reader.
+ */
+
+#include <core/CHIPTLV.h>
+#include <core/CHIPTLVCodec.h>
+#include <system/SystemClock.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace chip;
+using namespace chip::TLV;
+
+namespace {
+
+constexpr uint32_t kIterations = 200000;
+
+using BenchmarkStructCodec = ContextStructCodec<uint8_t, uint16_t, int16_t, uint32_t, uint64_t>;
+
+uint8_t sBuf[64];
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    TLVWriter writer;
+    TLVReader reader;
+    TLVType containerType;
+    uint8_t u8;
+    uint16_t u16;
+    int16_t i16;
+    uint32_t u32;
+    uint64_t u64;
+    uint64_t sum   = 0;
+    bool ok        = true;
+    uint64_t start = System::Clock::GetMonotonicMicroseconds();
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        writer.Init(sBuf, sizeof(sBuf));
+        ok = ok && writer.StartContainer(AnonymousTag, kTLVType_Structure, containerType) == CHIP_NO_ERROR;
+        ok = ok && writer.Put(ContextTag(0), static_cast<uint8_t>(i)) == CHIP_NO_ERROR;
+        ok = ok && writer.Put(ContextTag(1), static_cast<uint16_t>(i)) == CHIP_NO_ERROR;
+        ok = ok && writer.Put(ContextTag(2), static_cast<int16_t>(-1)) == CHIP_NO_ERROR;
+        ok = ok && writer.Put(ContextTag(3), i) == CHIP_NO_ERROR;
+        ok = ok && writer.Put(ContextTag(4), static_cast<uint64_t>(i) << 32) == CHIP_NO_ERROR;
+        ok = ok && writer.EndContainer(containerType) == CHIP_NO_ERROR;
+    }
+    uint64_t genericEncodeUs = System::Clock::GetMonotonicMicroseconds() - start;
+
+    start = System::Clock::GetMonotonicMicroseconds();
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        reader.Init(sBuf, writer.GetLengthWritten());
+        ok = ok && reader.Next() == CHIP_NO_ERROR && reader.EnterContainer(containerType) == CHIP_NO_ERROR;
+        ok = ok && reader.Next() == CHIP_NO_ERROR && reader.Get(u8) == CHIP_NO_ERROR;
+        ok = ok && reader.Next() == CHIP_NO_ERROR && reader.Get(u16) == CHIP_NO_ERROR;
+        ok = ok && reader.Next() == CHIP_NO_ERROR && reader.Get(i16) == CHIP_NO_ERROR;
+        ok = ok && reader.Next() == CHIP_NO_ERROR && reader.Get(u32) == CHIP_NO_ERROR;
+        ok = ok && reader.Next() == CHIP_NO_ERROR && reader.Get(u64) == CHIP_NO_ERROR;
+        ok  = ok && reader.ExitContainer(containerType) == CHIP_NO_ERROR;
+        sum = sum + u8 + u16 + u32 + u64;
+    }
+    uint64_t genericDecodeUs = System::Clock::GetMonotonicMicroseconds() - start;
+
+    start = System::Clock::GetMonotonicMicroseconds();
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        writer.Init(sBuf, sizeof(sBuf));
+        ok = ok && writer.StartContainer(AnonymousTag, kTLVType_Structure, containerType) == CHIP_NO_ERROR;
+        ok = ok &&
+            BenchmarkStructCodec::Encode(writer, static_cast<uint8_t>(i), static_cast<uint16_t>(i), -1, i,
+                                         static_cast<uint64_t>(i) << 32) == CHIP_NO_ERROR;
+        ok = ok && writer.EndContainer(containerType) == CHIP_NO_ERROR;
+    }
+    uint64_t codecEncodeUs = System::Clock::GetMonotonicMicroseconds() - start;
+
+    start = System::Clock::GetMonotonicMicroseconds();
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        reader.Init(sBuf, writer.GetLengthWritten());
+        ok = ok && reader.Next() == CHIP_NO_ERROR && reader.EnterContainer(containerType) == CHIP_NO_ERROR;
+        ok  = ok && BenchmarkStructCodec::Decode(reader, u8, u16, i16, u32, u64) == CHIP_NO_ERROR;
+        ok  = ok && reader.ExitContainer(containerType) == CHIP_NO_ERROR;
+        sum = sum + u8 + u16 + u32 + u64;
+    }
+    uint64_t codecDecodeUs = System::Clock::GetMonotonicMicroseconds() - start;
+
+    printf("Structure of 5 integers, generic writer/reader vs ContextStructCodec:\n");
+    printf("  encode: %6.1f ns generic, %6.1f ns codec\n", static_cast<double>(genericEncodeUs) * 1000.0 / kIterations,
+           static_cast<double>(codecEncodeUs) * 1000.0 / kIterations);
+    printf("  decode: %6.1f ns generic, %6.1f ns codec\n", static_cast<double>(genericDecodeUs) * 1000.0 / kIterations,
+           static_cast<double>(codecDecodeUs) * 1000.0 / kIterations);
+
+    // The decoded values are used, so that decoding is not optimized away.
+    if (!ok || sum == 0)
+    {
+        fprintf(stderr, "Encoding or decoding the structure failed\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
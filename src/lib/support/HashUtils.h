@@ -0,0 +1,46 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Utilities for hashing integer keys into hash tables.
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * Mixes the bits of @p key, using the 64-bit finalizer of MurmurHash3, so that
+ * every bit of the key affects every bit of the result.  This makes any subset
+ * of the result bits, e.g. the low bits of a power of two sized table, a good
+ * hash of keys packed from several identifiers.
+ */
+inline uint64_t MixBits64(uint64_t key)
+{
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    key *= 0xC4CEB9FE1A85EC53ULL;
+    key ^= key >> 33;
+    return key;
+}
+
+} // namespace chip
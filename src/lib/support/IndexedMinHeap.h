@@ -0,0 +1,146 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines IndexedMinHeap, a binary min-heap of objects that
+ *      record their own position in it.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#include <support/CodeUtils.h>
+
+namespace chip {
+
+/**
+ * @class IndexedMinHeap
+ *
+ * @brief
+ *  Binary min-heap of up to @p N objects of type @p T, ordered by @p Traits::IsBefore().
+ *
+ *  Each object records its own heap position, so removing an arbitrary object, or restoring the order after its key
+ *  changed, is O(log n) without searching. The heap does not own the objects; an object must be removed before it is
+ *  destroyed. @p Traits provides:
+ *
+ *      static bool IsBefore(const T & first, const T & second);
+ *      static size_t GetPosition(const T & item);
+ *      static void SetPosition(T & item, size_t position);
+ */
+template <typename T, size_t N, typename Traits>
+class IndexedMinHeap
+{
+public:
+    IndexedMinHeap() = default;
+
+    IndexedMinHeap(const IndexedMinHeap &) = delete;
+    IndexedMinHeap & operator=(const IndexedMinHeap &) = delete;
+
+    /** Adds @p item, which must not be in the heap. */
+    void Insert(T & item)
+    {
+        VerifyOrDie(mCount < N);
+        Place(item, mCount++);
+        SiftUp(Traits::GetPosition(item));
+    }
+
+    /** Removes @p item, which must be in the heap. Its recorded position is left as it was. */
+    void Remove(T & item)
+    {
+        const size_t position = Traits::GetPosition(item);
+        VerifyOrDie(position < mCount && mHeap[position] == &item);
+
+        if (position != --mCount)
+        {
+            // Move the last leaf into the hole, then restore the order in whichever direction it is violated.
+            T & moved = *mHeap[mCount];
+            Place(moved, position);
+            SiftUp(position);
+            SiftDown(Traits::GetPosition(moved));
+        }
+        mHeap[mCount] = nullptr;
+    }
+
+    /** Restores the order after the key of @p item, which must be in the heap, changed. */
+    void Update(T & item)
+    {
+        SiftUp(Traits::GetPosition(item));
+        SiftDown(Traits::GetPosition(item));
+    }
+
+    /** Returns the first object, or nullptr if the heap is empty. */
+    T * Top() const { return (mCount > 0) ? mHeap[0] : nullptr; }
+
+    /** Returns the object at @p position, which must be less than Count(). Positions follow heap order, not key order. */
+    T & At(size_t position) const { return *mHeap[position]; }
+
+    size_t Count() const { return mCount; }
+
+private:
+    void Place(T & item, size_t position)
+    {
+        mHeap[position] = &item;
+        Traits::SetPosition(item, position);
+    }
+
+    void SiftUp(size_t position)
+    {
+        T & item = *mHeap[position];
+        while (position > 0)
+        {
+            const size_t parent = (position - 1) / 2;
+            if (!Traits::IsBefore(item, *mHeap[parent]))
+            {
+                break;
+            }
+            Place(*mHeap[parent], position);
+            position = parent;
+        }
+        Place(item, position);
+    }
+
+    void SiftDown(size_t position)
+    {
+        T & item = *mHeap[position];
+        while (true)
+        {
+            size_t child = 2 * position + 1;
+            if (child >= mCount)
+            {
+                break;
+            }
+            if (child + 1 < mCount && Traits::IsBefore(*mHeap[child + 1], *mHeap[child]))
+            {
+                child++;
+            }
+            if (!Traits::IsBefore(*mHeap[child], item))
+            {
+                break;
+            }
+            Place(*mHeap[child], position);
+            position = child;
+        }
+        Place(item, position);
+    }
+
+    T * mHeap[N]  = {};
+    size_t mCount = 0;
+};
+
+} // namespace chip
@@ -175,6 +175,7 @@ inline bool Span<T>::data_equal(const FixedSpan<U, N> & other) const
 
 using ByteSpan        = Span<const uint8_t>;
 using MutableByteSpan = Span<uint8_t>;
+using CharSpan        = Span<const char>;
 template <size_t N>
 using FixedByteSpan = FixedSpan<const uint8_t, N>;
 
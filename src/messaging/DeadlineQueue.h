@@ -0,0 +1,128 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the deadline-ordered queue that ReliableMessageMgr
+ *      uses to schedule standalone acknowledgments and retransmissions.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <support/IndexedMinHeap.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace Messaging {
+
+/**
+ * The scheduling state of an object that can be queued in a DeadlineQueue.
+ */
+struct DeadlineQueueEntry
+{
+    static constexpr uint16_t kNotQueued = UINT16_MAX;
+
+    System::Clock::MonotonicMilliseconds mDeadline = 0;
+    uint16_t mPosition                             = kNotQueued; ///< Heap position while queued.
+};
+
+/**
+ * @class DeadlineQueue
+ *
+ * @brief
+ *  Queue of up to @p N objects of type @p T, ordered by the deadline held in their @p Entry member, kept in an
+ *  IndexedMinHeap.
+ *
+ *  Rescheduling or removing an arbitrary object is O(log n) without searching. The queue does not own the objects; an
+ *  object must be removed before it is destroyed.
+ */
+template <typename T, size_t N, DeadlineQueueEntry T::*Entry>
+class DeadlineQueue
+{
+public:
+    static_assert(N < DeadlineQueueEntry::kNotQueued, "DeadlineQueue too large for 16-bit positions");
+
+    DeadlineQueue() = default;
+
+    DeadlineQueue(const DeadlineQueue &) = delete;
+    DeadlineQueue & operator=(const DeadlineQueue &) = delete;
+
+    static bool IsQueued(const T & item) { return (item.*Entry).mPosition != DeadlineQueueEntry::kNotQueued; }
+    static System::Clock::MonotonicMilliseconds Deadline(const T & item) { return (item.*Entry).mDeadline; }
+
+    /** Queue @p item for @p deadline, or move it there if it is already queued. */
+    void Schedule(T & item, System::Clock::MonotonicMilliseconds deadline)
+    {
+        (item.*Entry).mDeadline = deadline;
+        if (IsQueued(item))
+        {
+            mHeap.Update(item);
+        }
+        else
+        {
+            mHeap.Insert(item);
+        }
+    }
+
+    /** Remove @p item from the queue. Does nothing if it is not queued. */
+    void Cancel(T & item)
+    {
+        if (IsQueued(item))
+        {
+            mHeap.Remove(item);
+            (item.*Entry).mPosition = DeadlineQueueEntry::kNotQueued;
+        }
+    }
+
+    /**
+     * Returns a queued object for which @p function returns true, or nullptr if there is none. The objects are visited in
+     * heap order, not in deadline order.
+     */
+    template <typename Function>
+    T * Find(Function && function) const
+    {
+        for (size_t i = 0; i < mHeap.Count(); i++)
+        {
+            if (function(mHeap.At(i)))
+            {
+                return &mHeap.At(i);
+            }
+        }
+        return nullptr;
+    }
+
+    /** Returns the object with the earliest deadline, or nullptr if the queue is empty. */
+    T * Earliest() const { return mHeap.Top(); }
+
+    size_t Count() const { return mHeap.Count(); }
+
+private:
+    struct HeapTraits
+    {
+        static bool IsBefore(const T & first, const T & second) { return (first.*Entry).mDeadline < (second.*Entry).mDeadline; }
+        static size_t GetPosition(const T & item) { return (item.*Entry).mPosition; }
+        static void SetPosition(T & item, size_t position) { (item.*Entry).mPosition = static_cast<uint16_t>(position); }
+    };
+
+    IndexedMinHeap<T, N, HeapTraits> mHeap;
+};
+
+} // namespace Messaging
+} // namespace chip
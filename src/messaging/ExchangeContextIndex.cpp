@@ -0,0 +1,105 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the ExchangeContextIndex class.
+ */
+
+#include <messaging/ExchangeContextIndex.h>
+
+#include <messaging/ExchangeContext.h>
+#include <support/CodeUtils.h>
+#include <support/HashUtils.h>
+
+namespace chip {
+namespace Messaging {
+
+void ExchangeContextIndex::Clear()
+{
+    for (Slot & slot : mSlots)
+    {
+        slot.mContext = nullptr;
+        slot.mHash    = 0;
+    }
+    mCount = 0;
+}
+
+uint32_t ExchangeContextIndex::Hash(const SecureSessionHandle & session, uint16_t exchangeId, bool initiator)
+{
+    uint64_t key = session.GetPeerNodeId();
+    key ^= (static_cast<uint64_t>(session.GetPeerKeyId()) << 16 | session.GetAdminId()) * 0x9E3779B97F4A7C15ULL;
+    key ^= (static_cast<uint64_t>(exchangeId) << 1 | (initiator ? 1u : 0u)) * 0xC2B2AE3D27D4EB4FULL;
+
+    // Every key bit affects the low bits used to pick a slot.
+    return static_cast<uint32_t>(MixBits64(key));
+}
+
+uint32_t ExchangeContextIndex::Hash(ExchangeContext * ec)
+{
+    return Hash(ec->GetSecureSession(), ec->GetExchangeId(), ec->IsInitiator());
+}
+
+void ExchangeContextIndex::Add(ExchangeContext * ec)
+{
+    VerifyOrDie(mCount < kSlotCount - 1);
+
+    const uint32_t hash = Hash(ec);
+    size_t i            = hash & kMask;
+    while (mSlots[i].mContext != nullptr)
+    {
+        i = (i + 1) & kMask;
+    }
+
+    mSlots[i].mContext = ec;
+    mSlots[i].mHash    = hash;
+    mCount++;
+}
+
+void ExchangeContextIndex::Remove(ExchangeContext * ec)
+{
+    size_t i = Hash(ec) & kMask;
+    while (mSlots[i].mContext != ec)
+    {
+        if (mSlots[i].mContext == nullptr)
+        {
+            return;
+        }
+        i = (i + 1) & kMask;
+    }
+
+    // Shift later entries of the probe run back into the hole, so that lookups never stop early at an emptied slot.
+    size_t hole = i;
+    for (size_t j = (hole + 1) & kMask; mSlots[j].mContext != nullptr; j = (j + 1) & kMask)
+    {
+        const size_t home = mSlots[j].mHash & kMask;
+
+        // The entry at j may move to the hole unless its home slot lies cyclically in (hole, j].
+        if (((j - home) & kMask) >= ((j - hole) & kMask))
+        {
+            mSlots[hole] = mSlots[j];
+            hole         = j;
+        }
+    }
+
+    mSlots[hole].mContext = nullptr;
+    mSlots[hole].mHash    = 0;
+    mCount--;
+}
+
+} // namespace Messaging
+} // namespace chip
@@ -0,0 +1,119 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the index that ExchangeManager uses to find the
+ *      ExchangeContext a received message belongs to.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <core/CHIPConfig.h>
+#include <transport/SecureSessionMgr.h>
+
+namespace chip {
+namespace Messaging {
+
+class ExchangeContext;
+
+namespace Internal {
+
+constexpr size_t RoundUpToPowerOfTwo(size_t value, size_t result = 1)
+{
+    return (result >= value) ? result : RoundUpToPowerOfTwo(value, result << 1);
+}
+
+} // namespace Internal
+
+/**
+ * @class ExchangeContextIndex
+ *
+ * @brief
+ *  An open-addressing hash table of the active exchange contexts, keyed by (session, exchange ID, initiator).
+ *
+ *  The table has at least twice as many slots as there can be exchange contexts, so it never fills up and probe sequences
+ *  stay short. Several contexts may share a key; Find() returns any of them and the caller narrows the match down.
+ *
+ *  A context's key must not change while it is in the index: remove it before changing its session, and add it back
+ *  afterwards if it should still be found.
+ */
+class ExchangeContextIndex
+{
+public:
+    ExchangeContextIndex() { Clear(); }
+
+    ExchangeContextIndex(const ExchangeContextIndex &) = delete;
+    ExchangeContextIndex & operator=(const ExchangeContextIndex &) = delete;
+
+    void Clear();
+
+    /**
+     * Add @p ec under its current key. @p ec must not already be in the index.
+     */
+    void Add(ExchangeContext * ec);
+
+    /**
+     * Remove @p ec, looking it up under its current key. Does nothing if @p ec is not in the index.
+     */
+    void Remove(ExchangeContext * ec);
+
+    /**
+     * Call @p function on each context that may be indexed under (@p session, @p exchangeId, @p initiator), until it returns
+     * true. Contexts whose key merely hashes alike are passed too, so @p function must check the key. It must not change the
+     * index.
+     *
+     * @return The context for which @p function returned true, or nullptr.
+     */
+    template <typename Function>
+    ExchangeContext * Find(const SecureSessionHandle & session, uint16_t exchangeId, bool initiator, Function && function)
+    {
+        const uint32_t hash = Hash(session, exchangeId, initiator);
+        for (size_t i = hash & kMask; mSlots[i].mContext != nullptr; i = (i + 1) & kMask)
+        {
+            if (mSlots[i].mHash == hash && function(mSlots[i].mContext))
+            {
+                return mSlots[i].mContext;
+            }
+        }
+        return nullptr;
+    }
+
+    size_t Count() const { return mCount; }
+
+private:
+    static constexpr size_t kSlotCount = Internal::RoundUpToPowerOfTwo(2 * CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS);
+    static constexpr size_t kMask      = kSlotCount - 1;
+
+    struct Slot
+    {
+        ExchangeContext * mContext;
+        uint32_t mHash;
+    };
+
+    static uint32_t Hash(const SecureSessionHandle & session, uint16_t exchangeId, bool initiator);
+    static uint32_t Hash(ExchangeContext * ec);
+
+    size_t mCount;
+    Slot mSlots[kSlotCount];
+};
+
+} // namespace Messaging
+} // namespace chip
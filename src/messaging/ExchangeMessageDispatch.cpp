@@ -54,8 +54,14 @@ CHIP_ERROR ExchangeMessageDispatch::SendMessage(SecureSessionHandle session, uin
     {
         payloadHeader.SetAckId(reliableMessageContext->TakePendingPeerAckId());
 
+        const bool isStandaloneAck = payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StandaloneAck);
+        if (reliableMessageContext->GetReliableMessageMgr() != nullptr)
+        {
+            reliableMessageContext->GetReliableMessageMgr()->RecordAckSent(!isStandaloneAck);
+        }
+
 #if !defined(NDEBUG)
-        if (!payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StandaloneAck))
+        if (!isStandaloneAck)
         {
             ChipLogDetail(ExchangeManager, "Piggybacking Ack for MsgId:%08" PRIX32 " with msg", payloadHeader.GetAckId().Value());
         }
@@ -59,7 +59,7 @@ namespace Messaging {
  *    prior to use.
  *
  */
-ExchangeManager::ExchangeManager() : mDelegate(nullptr), mReliableMessageMgr(mContextPool)
+ExchangeManager::ExchangeManager() : mDelegate(nullptr)
 {
     mState = State::kState_NotInitialized;
 }
@@ -116,7 +116,12 @@ CHIP_ERROR ExchangeManager::Shutdown()
 
 ExchangeContext * ExchangeManager::NewContext(SecureSessionHandle session, ExchangeDelegate * delegate)
 {
-    return mContextPool.CreateObject(this, mNextExchangeId++, session, true, delegate);
+    ExchangeContext * ec = mContextPool.CreateObject(this, mNextExchangeId++, session, true, delegate);
+    if (ec != nullptr)
+    {
+        mContextIndex.Add(ec);
+    }
+    return ec;
 }
 
 CHIP_ERROR ExchangeManager::RegisterUnsolicitedMessageHandlerForProtocol(Protocols::Id protocolId, ExchangeDelegate * delegate)
@@ -212,28 +217,22 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
         msgFlags.Set(MessageFlagValues::kDuplicateMessage);
     }
 
-    // Search for an existing exchange that the message applies to. If a match is found...
-    bool found = false;
-    mContextPool.ForEachActiveObject([&](auto * ec) {
-        if (ec->MatchExchange(session, packetHeader, payloadHeader))
+    // Search for an existing exchange that the message applies to. A message sent by an initiator belongs to an exchange
+    // this node responds on, and vice versa. If a match is found...
+    auto isMatch = [&](ExchangeContext * ec) { return ec->MatchExchange(session, packetHeader, payloadHeader); };
+    ExchangeContext * matchingEC =
+        mContextIndex.Find(session, payloadHeader.GetExchangeID(), !payloadHeader.IsInitiator(), isMatch);
+    if (matchingEC != nullptr)
+    {
+        // Found a matching exchange. Set flag for correct subsequent MRP
+        // retransmission timeout selection.
+        if (!matchingEC->HasRcvdMsgFromPeer())
         {
-            // Found a matching exchange. Set flag for correct subsequent MRP
-            // retransmission timeout selection.
-            if (!ec->HasRcvdMsgFromPeer())
-            {
-                ec->SetMsgRcvdFromPeer(true);
-            }
-
-            // Matched ExchangeContext; send to message handler.
-            ec->HandleMessage(packetHeader, payloadHeader, source, msgFlags, std::move(msgBuf));
-            found = true;
-            return false;
+            matchingEC->SetMsgRcvdFromPeer(true);
         }
-        return true;
-    });
 
-    if (found)
-    {
+        // Matched ExchangeContext; send to message handler.
+        matchingEC->HandleMessage(packetHeader, payloadHeader, source, msgFlags, std::move(msgBuf));
         ExitNow(err = CHIP_NO_ERROR);
     }
 
@@ -281,6 +280,7 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
             mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(), delegate);
 
         VerifyOrExit(ec != nullptr, err = CHIP_ERROR_NO_MEMORY);
+        mContextIndex.Add(ec);
 
         ChipLogDetail(ExchangeManager, "ec id: %d, Delegate: 0x%p", ec->GetExchangeId(), ec->GetDelegate());
 
@@ -312,6 +312,9 @@ void ExchangeManager::OnConnectionExpired(SecureSessionHandle session)
     mContextPool.ForEachActiveObject([&](auto * ec) {
         if (ec->mSecureSession == session)
         {
+            // The context's session is about to be cleared, after which no received message can match it, so it leaves
+            // the index for good.
+            mContextIndex.Remove(ec);
             ec->OnConnectionExpired();
             // Continue to iterate because there can be multiple exchanges
             // associated with the connection.
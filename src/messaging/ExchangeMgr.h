@@ -27,6 +27,7 @@
 #include <array>
 
 #include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeContextIndex.h>
 #include <messaging/ExchangeMgrDelegate.h>
 #include <messaging/ReliableMessageMgr.h>
 #include <protocols/Protocols.h>
@@ -102,7 +103,11 @@ public:
      */
     ExchangeContext * NewContext(SecureSessionHandle session, ExchangeDelegate * delegate);
 
-    void ReleaseContext(ExchangeContext * ec) { mContextPool.ReleaseObject(ec); }
+    void ReleaseContext(ExchangeContext * ec)
+    {
+        mContextIndex.Remove(ec);
+        mContextPool.ReleaseObject(ec);
+    }
 
     /**
      *  Register an unsolicited message handler for a given protocol identifier. This handler would be
@@ -235,6 +240,7 @@ private:
     Transport::AdminId mAdminId = 0;
 
     BitMapObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mContextPool;
+    ExchangeContextIndex mContextIndex; // Active contexts that received messages can match, by session and exchange ID.
 
     UnsolicitedMessageHandler UMHandlerPool[CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS];
 
@@ -39,7 +39,7 @@ namespace chip {
 namespace Messaging {
 
 ReliableMessageContext::ReliableMessageContext() :
-    mConfig(gDefaultReliableMessageProtocolConfig), mNextAckTimeTick(0), mPendingPeerAckId(0)
+    mConfig(gDefaultReliableMessageProtocolConfig), mPendingPeerAckId(0)
 {}
 
 void ReliableMessageContext::RetainContext()
@@ -80,6 +80,12 @@ void ReliableMessageContext::SetMsgRcvdFromPeer(bool inMsgRcvdFromPeer)
 void ReliableMessageContext::SetAckPending(bool inAckPending)
 {
     mFlags.Set(Flags::kFlagAckPending, inAckPending);
+
+    // An ack that is no longer pending must not be sent by the standalone ack timer.
+    if (!inAckPending && mNextAckTime.mPosition != DeadlineQueueEntry::kNotQueued)
+    {
+        GetReliableMessageMgr()->CancelStandaloneAck(this);
+    }
 }
 
 void ReliableMessageContext::SetDropAckDebug(bool inDropAckDebug)
@@ -187,9 +193,6 @@ CHIP_ERROR ReliableMessageContext::HandleNeedsAck(uint32_t MessageId, BitFlags<M
     if (ShouldDropAckDebug())
         return err;
 
-    // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
-    GetReliableMessageMgr()->ExpireTicks();
-
     // If the message IS a duplicate there will never be a response to it, so we
     // should not wait for one and just immediately send a standalone ack.
     if (MsgFlags.Has(MessageFlagValues::kDuplicateMessage))
@@ -200,8 +203,9 @@ CHIP_ERROR ReliableMessageContext::HandleNeedsAck(uint32_t MessageId, BitFlags<M
         // Is there pending ack for a different message id.
         bool wasAckPending = IsAckPending() && mPendingPeerAckId != MessageId;
 
-        // Temporary store currently pending ack id (even if there is none).
-        uint32_t tempAckId = mPendingPeerAckId;
+        // Temporary store currently pending ack id (even if there is none), and when it is due.
+        uint32_t tempAckId                               = mPendingPeerAckId;
+        System::Clock::MonotonicMilliseconds tempAckTime = mNextAckTime.mDeadline;
 
         // Set the pending ack id.
         SetPendingPeerAckId(MessageId);
@@ -214,6 +218,7 @@ CHIP_ERROR ReliableMessageContext::HandleNeedsAck(uint32_t MessageId, BitFlags<M
         {
             // Restore previously pending ack id.
             SetPendingPeerAckId(tempAckId);
+            GetReliableMessageMgr()->ScheduleStandaloneAck(this, tempAckTime);
         }
 
         SuccessOrExit(err);
@@ -234,9 +239,10 @@ CHIP_ERROR ReliableMessageContext::HandleNeedsAck(uint32_t MessageId, BitFlags<M
 
         // Replace the Pending ack id.
         SetPendingPeerAckId(MessageId);
-        mNextAckTimeTick =
-            static_cast<uint16_t>(CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT_TICK +
-                                  GetReliableMessageMgr()->GetTickCounterFromTimeDelta(System::Clock::GetMonotonicMilliseconds()));
+        GetReliableMessageMgr()->ScheduleStandaloneAck(
+            this,
+            System::Clock::GetMonotonicMilliseconds() +
+                GetReliableMessageMgr()->GetTimePeriodFromTickCounter(CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT_TICK));
     }
 
 exit:
@@ -26,6 +26,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <messaging/DeadlineQueue.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 
 #include <core/CHIPError.h>
@@ -240,7 +241,7 @@ private:
     friend class ExchangeMessageDispatch;
 
     ReliableMessageProtocolConfig mConfig;
-    uint16_t mNextAckTimeTick; // Next time for triggering Solo Ack
+    DeadlineQueueEntry mNextAckTime; // Next time for triggering Solo Ack
     uint32_t mPendingPeerAckId;
 };
 
@@ -32,16 +32,18 @@
 #include <support/BitFlags.h>
 #include <support/CHIPFaultInjection.h>
 #include <support/CodeUtils.h>
+#include <support/RandUtils.h>
 #include <support/logging/CHIPLogging.h>
 
 namespace chip {
 namespace Messaging {
 
-ReliableMessageMgr::RetransTableEntry::RetransTableEntry() : rc(nullptr), nextRetransTimeTick(0), sendCount(0) {}
+ReliableMessageMgr::RetransTableEntry::RetransTableEntry() : rc(nullptr), sendCount(0) {}
 
-ReliableMessageMgr::ReliableMessageMgr(BitMapObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool) :
-    mContextPool(contextPool), mSystemLayer(nullptr), mSessionMgr(nullptr), mCurrentTimerExpiry(0),
-    mTimerIntervalShift(CHIP_CONFIG_RMP_TIMER_DEFAULT_PERIOD_SHIFT)
+ReliableMessageMgr::ReliableMessageMgr() :
+    mSystemLayer(nullptr), mSessionMgr(nullptr), mCurrentTimerExpiry(0),
+    mTimerIntervalShift(CHIP_CONFIG_RMP_TIMER_DEFAULT_PERIOD_SHIFT), mAckCoalescingWindow(CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW),
+    mAckStats()
 {}
 
 ReliableMessageMgr::~ReliableMessageMgr() {}
@@ -51,7 +53,6 @@ void ReliableMessageMgr::Init(chip::System::Layer * systemLayer, SecureSessionMg
     mSystemLayer = systemLayer;
     mSessionMgr  = sessionMgr;
 
-    mTimeStampBase      = System::Clock::GetMonotonicMilliseconds();
     mCurrentTimerExpiry = 0;
 }
 
@@ -74,9 +75,27 @@ uint64_t ReliableMessageMgr::GetTickCounterFromTimePeriod(uint64_t period)
     return (period >> mTimerIntervalShift);
 }
 
-uint64_t ReliableMessageMgr::GetTickCounterFromTimeDelta(uint64_t newTime)
+uint64_t ReliableMessageMgr::GetTimePeriodFromTickCounter(uint64_t ticks)
 {
-    return GetTickCounterFromTimePeriod(newTime - mTimeStampBase);
+    return (ticks << mTimerIntervalShift);
+}
+
+uint64_t ReliableMessageMgr::GetRetransmitTimeout(ReliableMessageContext * rc, uint8_t sendCount)
+{
+    // The first retransmission waits for the initial interval, later ones for the active interval, which grows
+    // exponentially once more than CHIP_CONFIG_RMP_BACKOFF_THRESHOLD retransmissions have been sent.
+    uint64_t timeout = GetTimePeriodFromTickCounter(sendCount == 0 ? rc->GetInitialRetransmitTimeoutTick()
+                                                                   : rc->GetActiveRetransmitTimeoutTick());
+    for (uint8_t i = CHIP_CONFIG_RMP_BACKOFF_THRESHOLD; i < sendCount; i++)
+    {
+        timeout = timeout * CHIP_CONFIG_RMP_BACKOFF_BASE_PERCENT / 100;
+    }
+
+#if CHIP_CONFIG_RMP_BACKOFF_JITTER_PERCENT > 0
+    timeout += timeout * (GetRandU16() % (CHIP_CONFIG_RMP_BACKOFF_JITTER_PERCENT + 1)) / 100;
+#endif // CHIP_CONFIG_RMP_BACKOFF_JITTER_PERCENT > 0
+
+    return timeout;
 }
 
 #if defined(RMP_TICKLESS_DEBUG)
@@ -88,8 +107,8 @@ void ReliableMessageMgr::TicklessDebugDumpRetransTable(const char * log)
     {
         if (entry.rc)
         {
-            ChipLogDetail(ExchangeManager, "EC:%04" PRIX16 " MsgId:%08" PRIX32 " NextRetransTimeCtr:%04" PRIX16, entry.rc,
-                          entry.msgId, entry.nextRetransTimeTick);
+            ChipLogDetail(ExchangeManager, "EC:%p MsgId:%08" PRIX32 " NextRetransTime:%" PRIu64, entry.rc,
+                          entry.retainedBuf.GetMsgId(), entry.nextRetransTime.mDeadline);
         }
     }
 }
@@ -106,45 +125,60 @@ void ReliableMessageMgr::ExecuteActions()
     ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions");
 #endif
 
-    ExecuteForAllContext([](ReliableMessageContext * rc) {
-        if (rc->IsAckPending())
+    const System::Clock::MonotonicMilliseconds now = System::Clock::GetMonotonicMilliseconds();
+
+    ReliableMessageContext * rc;
+    while ((rc = mAckQueue.Earliest()) != nullptr && mAckQueue.Deadline(*rc) <= now)
+    {
+        SendStandaloneAck(rc, now);
+
+        if (mAckCoalescingWindow > 0)
         {
-            if (0 == rc->mNextAckTimeTick)
+            // Send the acks to the same peer that would fall due within the window along with this one.
+            const SecureSessionHandle session                  = rc->GetExchangeContext()->GetSecureSession();
+            const System::Clock::MonotonicMilliseconds horizon = now + mAckCoalescingWindow;
+            auto isCoalescable                                 = [&](ReliableMessageContext & other) {
+                return mAckQueue.Deadline(other) <= horizon && other.GetExchangeContext()->GetSecureSession() == session;
+            };
+
+            ReliableMessageContext * other;
+            while ((other = mAckQueue.Find(isCoalescable)) != nullptr)
             {
-#if defined(RMP_TICKLESS_DEBUG)
-                ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions sending ACK");
-#endif
-                // Send the Ack in a SecureChannel::StandaloneAck message
-                rc->SendStandaloneAckMessage();
+                SendStandaloneAck(other, now);
+                if (other->IsAckPending())
+                {
+                    // Sending failed and the ack has been rescheduled, possibly within the window again.
+                    break;
+                }
+                mAckStats.mCoalesced++;
             }
         }
-    });
+    }
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries before processing");
 
     // Retransmit / cancel anything in the retrans table whose retrans timeout
     // has expired
-    for (RetransTableEntry & entry : mRetransTable)
+    RetransTableEntry * entry;
+    while ((entry = mRetransQueue.Earliest()) != nullptr && mRetransQueue.Deadline(*entry) <= now)
     {
-        ReliableMessageContext * rc = entry.rc;
-        CHIP_ERROR err              = CHIP_NO_ERROR;
+        // The entry stays due while it is being resent, and is rescheduled afterwards.
+        CHIP_ERROR err = CHIP_NO_ERROR;
+        rc             = entry->rc;
 
-        if (!rc || entry.nextRetransTimeTick != 0)
-            continue;
-
-        if (entry.retainedBuf.IsNull())
+        if (entry->retainedBuf.IsNull())
         {
             // We generally try to prevent entries with a null buffer being in a table, but it could happen
             // if the message dispatch (which is supposed to fill in the buffer) fails to do so _and_ returns
             // success (so its caller doesn't clear out the bogus table entry).
             //
             // If that were to happen, we would crash in the code below.  Guard against it, just in case.
-            ClearRetransTable(entry);
+            ClearRetransTable(*entry);
             continue;
         }
 
-        uint8_t sendCount = entry.sendCount;
-        uint32_t msgId    = entry.retainedBuf.GetMsgId();
+        uint8_t sendCount = entry->sendCount;
+        uint32_t msgId    = entry->retainedBuf.GetMsgId();
 
         if (sendCount == CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS)
         {
@@ -154,19 +188,21 @@ void ReliableMessageMgr::ExecuteActions()
                          sendCount, CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS);
 
             // Remove from Table
-            ClearRetransTable(entry);
+            ClearRetransTable(*entry);
         }
 
         // Resend from Table (if the operation fails, the entry is cleared)
         if (err == CHIP_NO_ERROR)
-            err = SendFromRetransTable(&entry);
+            err = SendFromRetransTable(entry);
 
-        if (err == CHIP_NO_ERROR)
+        // The message may have been acknowledged, or retransmitted again, while it was being sent; only reschedule the entry
+        // if it still holds the message and is still due.
+        if (err == CHIP_NO_ERROR && entry->rc == rc && mRetransQueue.IsQueued(*entry) && mRetransQueue.Deadline(*entry) <= now)
         {
-            // If the retransmission was successful, update the passive timer
-            entry.nextRetransTimeTick = static_cast<uint16_t>(rc->GetActiveRetransmitTimeoutTick());
+            // If the retransmission was successful, schedule the next one
+            mRetransQueue.Schedule(*entry, now + GetRetransmitTimeout(rc, entry->sendCount));
 #if !defined(NDEBUG)
-            ChipLogDetail(ExchangeManager, "Retransmit MsgId:%08" PRIX32 " Send Cnt %d", msgId, entry.sendCount);
+            ChipLogDetail(ExchangeManager, "Retransmit MsgId:%08" PRIX32 " Send Cnt %d", msgId, entry->sendCount);
 #endif
         }
     }
@@ -174,64 +210,21 @@ void ReliableMessageMgr::ExecuteActions()
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
 
-static void TickProceed(uint16_t & time, uint64_t ticks)
+void ReliableMessageMgr::SendStandaloneAck(ReliableMessageContext * rc, System::Clock::MonotonicMilliseconds now)
 {
-    if (time >= ticks)
-    {
-        time = static_cast<uint16_t>(time - ticks);
-    }
-    else
-    {
-        time = 0;
-    }
-}
-
-void ReliableMessageMgr::ExpireTicks()
-{
-    uint64_t now = System::Clock::GetMonotonicMilliseconds();
-
-    // Number of full ticks elapsed since last timer processing.  We always round down
-    // to the previous tick.  If we are between tick boundaries, the extra time since the
-    // last virtual tick is not accounted for here (it will be accounted for when resetting
-    // the ReliableMessageProtocol timer)
-    uint64_t deltaTicks = GetTickCounterFromTimeDelta(now);
+    mAckQueue.Cancel(*rc);
 
 #if defined(RMP_TICKLESS_DEBUG)
-    ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExpireTicks at %" PRIu64 ", %" PRIu64 ", %u", now, mTimeStampBase,
-                  deltaTicks);
+    ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions sending ACK");
 #endif
+    // Send the Ack in a SecureChannel::StandaloneAck message
+    rc->SendStandaloneAckMessage();
 
-    ExecuteForAllContext([deltaTicks](ReliableMessageContext * rc) {
-        if (rc->IsAckPending())
-        {
-            // Decrement counter of Ack timestamp by the elapsed timer ticks
-            TickProceed(rc->mNextAckTimeTick, deltaTicks);
-#if defined(RMP_TICKLESS_DEBUG)
-            ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExpireTicks set mNextAckTimeTick to %u", rc->mNextAckTimeTick);
-#endif
-        }
-    });
-
-    for (RetransTableEntry & entry : mRetransTable)
+    // If that failed, try again after another ack timeout.
+    if (rc->IsAckPending())
     {
-        ReliableMessageContext * rc = entry.rc;
-        if (rc)
-        {
-            // Decrement Retransmit timeout by elapsed timeticks
-            TickProceed(entry.nextRetransTimeTick, deltaTicks);
-#if defined(RMP_TICKLESS_DEBUG)
-            ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExpireTicks set nextRetransTimeTick to %u",
-                          entry.nextRetransTimeTick);
-#endif
-        } // rc entry is allocated
+        mAckQueue.Schedule(*rc, now + GetTimePeriodFromTickCounter(CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT_TICK));
     }
-
-    // Re-Adjust the base time stamp to the most recent tick boundary
-    mTimeStampBase += (deltaTicks << mTimerIntervalShift);
-
-#if defined(RMP_TICKLESS_DEBUG)
-    ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExpireTicks mTimeStampBase to %" PRIu64, mTimeStampBase);
-#endif
 }
 
 void ReliableMessageMgr::Timeout(System::Layer * aSystemLayer, void * aAppState, CHIP_ERROR aError)
@@ -244,10 +237,10 @@ void ReliableMessageMgr::Timeout(System::Layer * aSystemLayer, void * aAppState,
     ChipLogDetail(ExchangeManager, "ReliableMessageMgr::Timeout\n");
 #endif
 
-    // Make sure all tick counts are sync'd to the current time
-    manager->ExpireTicks();
+    // The timer is no longer armed, so whatever StartTimer() computes next must be set.
+    manager->mCurrentTimerExpiry = 0;
 
-    // Execute any actions that are due this tick
+    // Execute any actions that are due
     manager->ExecuteActions();
 
     // Calculate next physical wakeup
@@ -266,13 +259,14 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
         // Check the exchContext pointer for finding an empty slot in Table
         if (!entry.rc)
         {
-            // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
-            ExpireTicks();
-
             entry.rc          = rc;
             entry.sendCount   = 0;
             entry.retainedBuf = EncryptedPacketBufferHandle();
 
+            // The entry is due right away until StartRetransmision() schedules its first retransmission, so that a
+            // message reported as lost while it is being sent is retransmitted by the next timeout.
+            mRetransQueue.Schedule(entry, System::Clock::GetMonotonicMilliseconds());
+
             *rEntry = &entry;
 
             // Increment the reference count
@@ -298,20 +292,50 @@ void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
     VerifyOrReturn(entry != nullptr && entry->rc != nullptr,
                    ChipLogError(ExchangeManager, "StartRetransmission was called for invalid entry"));
 
-    entry->nextRetransTimeTick = static_cast<uint16_t>(entry->rc->GetInitialRetransmitTimeoutTick() +
-                                                       GetTickCounterFromTimeDelta(System::Clock::GetMonotonicMilliseconds()));
+    mRetransQueue.Schedule(*entry, System::Clock::GetMonotonicMilliseconds() + GetRetransmitTimeout(entry->rc, 0));
 
     // Check if the timer needs to be started and start it.
     StartTimer();
 }
 
+void ReliableMessageMgr::ScheduleStandaloneAck(ReliableMessageContext * rc, System::Clock::MonotonicMilliseconds deadline)
+{
+    if (mAckCoalescingWindow > 0)
+    {
+        // Wait for an ack already scheduled for the same peer, if it is due within the window.
+        const SecureSessionHandle session = rc->GetExchangeContext()->GetSecureSession();
+        auto isJoinable                   = [&](ReliableMessageContext & other) {
+            const System::Clock::MonotonicMilliseconds otherDeadline = mAckQueue.Deadline(other);
+            return &other != rc && otherDeadline >= deadline && otherDeadline <= deadline + mAckCoalescingWindow &&
+                other.GetExchangeContext()->GetSecureSession() == session;
+        };
+
+        ReliableMessageContext * other = mAckQueue.Find(isJoinable);
+        if (other != nullptr)
+        {
+            deadline = mAckQueue.Deadline(*other);
+        }
+    }
+
+    mAckQueue.Schedule(*rc, deadline);
+}
+
+void ReliableMessageMgr::CancelStandaloneAck(ReliableMessageContext * rc)
+{
+    mAckQueue.Cancel(*rc);
+}
+
 void ReliableMessageMgr::PauseRetransmision(ReliableMessageContext * rc, uint32_t PauseTimeMillis)
 {
     for (RetransTableEntry & entry : mRetransTable)
     {
         if (entry.rc == rc)
         {
-            entry.nextRetransTimeTick = static_cast<uint16_t>(entry.nextRetransTimeTick + (PauseTimeMillis >> mTimerIntervalShift));
+            if (mRetransQueue.IsQueued(entry))
+            {
+                mRetransQueue.Schedule(entry, mRetransQueue.Deadline(entry) + PauseTimeMillis);
+                StartTimer();
+            }
             break;
         }
     }
@@ -323,7 +347,11 @@ void ReliableMessageMgr::ResumeRetransmision(ReliableMessageContext * rc)
     {
         if (entry.rc == rc)
         {
-            entry.nextRetransTimeTick = 0;
+            if (mRetransQueue.IsQueued(entry))
+            {
+                mRetransQueue.Schedule(entry, System::Clock::GetMonotonicMilliseconds());
+                StartTimer();
+            }
             break;
         }
     }
@@ -401,8 +429,7 @@ void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & rEntry)
     {
         VerifyOrDie(rEntry.rc->IsOccupied() == true);
 
-        // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
-        ExpireTicks();
+        mRetransQueue.Cancel(rEntry);
 
         rEntry.rc->ReleaseContext();
         rEntry.rc->SetOccupied(false);
@@ -431,52 +458,30 @@ void ReliableMessageMgr::FailRetransTableEntries(ReliableMessageContext * rc, CH
 
 void ReliableMessageMgr::StartTimer()
 {
-    CHIP_ERROR res            = CHIP_NO_ERROR;
-    uint64_t nextWakeTimeTick = UINT64_MAX;
-    bool foundWake            = false;
+    CHIP_ERROR res = CHIP_NO_ERROR;
 
-    // When do we need to next wake up to send an ACK?
+    // When do we need to next wake up to send an ACK or a retransmission?
+    ReliableMessageContext * rc = mAckQueue.Earliest();
+    RetransTableEntry * entry   = mRetransQueue.Earliest();
 
-    ExecuteForAllContext([&nextWakeTimeTick, &foundWake](ReliableMessageContext * rc) {
-        if (rc->IsAckPending() && rc->mNextAckTimeTick < nextWakeTimeTick)
+    if (rc != nullptr || entry != nullptr)
+    {
+        System::Clock::MonotonicMilliseconds timerExpiry = UINT64_MAX;
+        if (rc != nullptr)
         {
-            nextWakeTimeTick = rc->mNextAckTimeTick;
-            foundWake        = true;
-#if defined(RMP_TICKLESS_DEBUG)
-            ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer next ACK time %u", nextWakeTimeTick);
-#endif
+            timerExpiry = mAckQueue.Deadline(*rc);
         }
-    });
-
-    for (RetransTableEntry & entry : mRetransTable)
-    {
-        ReliableMessageContext * rc = entry.rc;
-        if (rc)
+        if (entry != nullptr && mRetransQueue.Deadline(*entry) < timerExpiry)
         {
-            // When do we need to next wake up for ReliableMessageProtocol retransmit?
-            if (entry.nextRetransTimeTick < nextWakeTimeTick)
-            {
-                nextWakeTimeTick = entry.nextRetransTimeTick;
-                foundWake        = true;
-#if defined(RMP_TICKLESS_DEBUG)
-                ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer RetransTime %u", nextWakeTimeTick);
-#endif
-            }
+            timerExpiry = mRetransQueue.Deadline(*entry);
         }
-    }
-
-    if (foundWake)
-    {
-        // Set timer for next tick boundary - subtract the elapsed time from the current tick
-        System::Clock::MonotonicMilliseconds timerExpiry = (nextWakeTimeTick << mTimerIntervalShift) + mTimeStampBase;
 
 #if defined(RMP_TICKLESS_DEBUG)
-        ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer wake at %" PRIu64 " ms (%" PRIu64 " %" PRIu64 ")",
-                      timerExpiry, nextWakeTimeTick, mTimeStampBase);
+        ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer wake at %" PRIu64 " ms", timerExpiry);
 #endif
         if (timerExpiry != mCurrentTimerExpiry)
         {
-            // If the tick boundary has expired in the past (delayed processing of event due to other system activity),
+            // If the deadline has passed (delayed processing of event due to other system activity),
             // expire the timer immediately
             uint64_t now           = System::Clock::GetMonotonicMilliseconds();
             uint64_t timerArmValue = (timerExpiry > now) ? timerExpiry - now : 0;
@@ -512,6 +517,7 @@ void ReliableMessageMgr::StartTimer()
 void ReliableMessageMgr::StopTimer()
 {
     mSystemLayer->CancelTimer(Timeout, this);
+    mCurrentTimerExpiry = 0;
 }
 
 #if CHIP_CONFIG_TEST
@@ -26,12 +26,12 @@
 #include <array>
 #include <stdint.h>
 
+#include <messaging/DeadlineQueue.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 
 #include <core/CHIPError.h>
 #include <support/BitFlags.h>
-#include <support/Pool.h>
 #include <system/SystemLayer.h>
 #include <system/SystemPacketBuffer.h>
 #include <system/SystemTimer.h>
@@ -62,12 +62,22 @@ public:
 
         ReliableMessageContext * rc;             /**< The context for the stored CHIP message. */
         EncryptedPacketBufferHandle retainedBuf; /**< The packet buffer holding the CHIP message. */
-        uint16_t nextRetransTimeTick;            /**< A counter representing the next retransmission time for the message. */
+        DeadlineQueueEntry nextRetransTime;      /**< The next retransmission time for the message, once it has been sent. */
         uint8_t sendCount;                       /**< A counter representing the number of times the message has been sent. */
     };
 
+    /**
+     *  Counts of the acknowledgments sent, to tell how often acknowledgments ride on other messages.
+     */
+    struct AckStats
+    {
+        uint32_t mPiggybacked; /**< Acknowledgments carried by another message of their exchange. */
+        uint32_t mStandalone;  /**< Acknowledgments sent in standalone acknowledgment messages. */
+        uint32_t mCoalesced;   /**< Standalone acknowledgments sent ahead of their timeout, with one to the same peer. */
+    };
+
 public:
-    ReliableMessageMgr(BitMapObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
+    ReliableMessageMgr();
     ~ReliableMessageMgr();
 
     void Init(chip::System::Layer * systemLayer, SecureSessionMgr * sessionMgr);
@@ -83,18 +93,17 @@ public:
     uint64_t GetTickCounterFromTimePeriod(uint64_t period);
 
     /**
-     * Return a tick counter value between the given time and the stored time.
+     * Return the time period covered by a tick count.
      *
-     * @param[in]  newTime        Timestamp value of in milliseconds.
+     * @param[in]  ticks         Tick count.
      *
-     * @return Tick count of the difference between the given time and the stored time.
+     * @return Time period in milliseconds.
      */
-    uint64_t GetTickCounterFromTimeDelta(uint64_t newTime);
+    uint64_t GetTimePeriodFromTickCounter(uint64_t ticks);
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.  If an
-     * action needs to be triggered by ReliableMessageProtocol time facilities,
-     * execute that action.
+     * Send the standalone acknowledgments and retransmissions whose deadlines
+     * have passed, taking them from the front of their deadline queues.
      */
     void ExecuteActions();
 
@@ -126,6 +135,47 @@ public:
      */
     void StartRetransmision(RetransTableEntry * entry);
 
+    /**
+     *  Schedule a standalone acknowledgment for the pending ack of the given ReliableMessageContext,
+     *  unless it is piggybacked on another message first.
+     *
+     *  @param[in]    rc          A pointer to the ReliableMessageContext object.
+     *
+     *  @param[in]    deadline    The monotonic time in milliseconds at which to send the acknowledgment.
+     */
+    void ScheduleStandaloneAck(ReliableMessageContext * rc, System::Clock::MonotonicMilliseconds deadline);
+
+    /**
+     *  Cancel the standalone acknowledgment scheduled for the given ReliableMessageContext, if any.
+     *
+     *  @param[in]    rc          A pointer to the ReliableMessageContext object.
+     */
+    void CancelStandaloneAck(ReliableMessageContext * rc);
+
+    /**
+     *  Set the window within which standalone acknowledgments to the same peer are sent together, or 0 to send every
+     *  acknowledgment at its own timeout. See CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW.
+     *
+     *  @param[in]    windowMillis    The coalescing window in milliseconds.
+     */
+    void SetAckCoalescingWindow(uint32_t windowMillis) { mAckCoalescingWindow = windowMillis; }
+
+    /**
+     *  Record that an acknowledgment has been sent.
+     *
+     *  @param[in]    piggybacked    Whether the acknowledgment was carried by another message of its exchange.
+     */
+    void RecordAckSent(bool piggybacked)
+    {
+        if (piggybacked)
+            mAckStats.mPiggybacked++;
+        else
+            mAckStats.mStandalone++;
+    }
+
+    const AckStats & GetAckStats() const { return mAckStats; }
+    void ResetAckStats() { mAckStats = AckStats(); }
+
     /**
      *  Pause retranmisttion of current exchange for specified period.
      *
@@ -194,10 +244,8 @@ public:
     void FailRetransTableEntries(ReliableMessageContext * rc, CHIP_ERROR err);
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.
-     * Determine how many ReliableMessageProtocol ticks we need to sleep before we
-     * need to physically wake the CPU to perform an action.  Set a timer to go off
-     * when we next need to wake the system.
+     * Set the timer to go off at the earliest standalone acknowledgment or
+     * retransmission deadline, or stop it if nothing is scheduled.
      *
      */
     void StartTimer();
@@ -208,45 +256,35 @@ public:
      */
     void StopTimer();
 
-    /**
-     * Calculate number of virtual ReliableMessageProtocol ticks that have expired
-     * since we last called this function. Iterate through active exchange contexts
-     * and retrans table entries, subtracting expired virtual ticks to synchronize
-     * wakeup times with the current system time. Do not perform any actions beyond
-     * updating tick counts, actions will be performed by the physical
-     * ReliableMessageProtocol timer tick expiry.
-     *
-     */
-    void ExpireTicks();
-
 #if CHIP_CONFIG_TEST
     // Functions for testing
     int TestGetCountRetransTable();
     void TestSetIntervalShift(uint16_t value) { mTimerIntervalShift = value; }
+    uint64_t TestGetRetransmitTimeout(ReliableMessageContext * rc, uint8_t sendCount)
+    {
+        return GetRetransmitTimeout(rc, sendCount);
+    }
 #endif // CHIP_CONFIG_TEST
 
 private:
-    BitMapObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
     chip::System::Layer * mSystemLayer;
     SecureSessionMgr * mSessionMgr;
-    uint64_t mTimeStampBase; // ReliableMessageProtocol timer base value to add offsets to evaluate timeouts
     System::Clock::MonotonicMilliseconds mCurrentTimerExpiry; // Tracks when the ReliableMessageProtocol timer will next expire
     uint16_t mTimerIntervalShift;                             // ReliableMessageProtocol Timer tick period shift
+    uint32_t mAckCoalescingWindow;                            // Window for sending acks to the same peer together, in msec
+    AckStats mAckStats;
 
-    /* Placeholder function to run a function for all exchanges */
-    template <typename Function>
-    void ExecuteForAllContext(Function function)
-    {
-        mContextPool.ForEachActiveObject([&](auto * ec) {
-            function(ec->GetReliableMessageContext());
-            return true;
-        });
-    }
+    uint64_t GetRetransmitTimeout(ReliableMessageContext * rc, uint8_t sendCount);
+    void SendStandaloneAck(ReliableMessageContext * rc, System::Clock::MonotonicMilliseconds now);
 
     void TicklessDebugDumpRetransTable(const char * log);
 
     // ReliableMessageProtocol Global tables for timer context
     RetransTableEntry mRetransTable[CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE];
+
+    // Contexts with a standalone acknowledgment to send, and retrans table entries awaiting retransmission, by deadline
+    DeadlineQueue<ReliableMessageContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS, &ReliableMessageContext::mNextAckTime> mAckQueue;
+    DeadlineQueue<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE, &RetransTableEntry::nextRetransTime> mRetransQueue;
 };
 
 } // namespace Messaging
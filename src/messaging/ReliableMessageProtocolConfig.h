@@ -82,12 +82,35 @@ namespace Messaging {
 #define CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT_TICK (1)
 #endif // CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT_TICK
 
+/**
+ *  @def CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW
+ *
+ *  @brief
+ *    The default window, in milliseconds, within which standalone
+ *    acknowledgments to the same peer are sent together.
+ *
+ *    A new acknowledgment may wait up to this long past its acknowledgment
+ *    timeout to go out with one already scheduled for the same peer, which
+ *    also leaves more time to piggyback it. When an acknowledgment is sent,
+ *    those for the same peer that fall due within the window are sent with it.
+ *    Set to 0 to send every acknowledgment at its own timeout.
+ *
+ */
+#ifndef CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW
+#define CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW (0)
+#endif // CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW
+
 /**
  *  @def CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE
  *
  *  @brief
  *    The default size of the ReliableMessageProtocol retransmission table.
  *
+ *    An exchange has at most one message awaiting acknowledgment, so by default the
+ *    table holds one entry per exchange context, limited by the packet buffer pool
+ *    where there is one. Retransmissions are kept in deadline order, so the table
+ *    size does not add to the work done when a retransmission falls due.
+ *
  */
 #ifndef CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE
 #ifdef PBUF_POOL_SIZE
@@ -110,6 +133,43 @@ namespace Messaging {
 #define CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS (3)
 #endif // CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS
 
+/**
+ *  @def CHIP_CONFIG_RMP_BACKOFF_BASE_PERCENT
+ *
+ *  @brief
+ *    The factor, in percent, by which the retransmission timeout grows with
+ *    each retransmission beyond CHIP_CONFIG_RMP_BACKOFF_THRESHOLD.
+ *
+ */
+#ifndef CHIP_CONFIG_RMP_BACKOFF_BASE_PERCENT
+#define CHIP_CONFIG_RMP_BACKOFF_BASE_PERCENT (160)
+#endif // CHIP_CONFIG_RMP_BACKOFF_BASE_PERCENT
+
+/**
+ *  @def CHIP_CONFIG_RMP_BACKOFF_THRESHOLD
+ *
+ *  @brief
+ *    The number of retransmissions that are sent at the unscaled active
+ *    retransmission interval before the exponential backoff starts.
+ *
+ */
+#ifndef CHIP_CONFIG_RMP_BACKOFF_THRESHOLD
+#define CHIP_CONFIG_RMP_BACKOFF_THRESHOLD (1)
+#endif // CHIP_CONFIG_RMP_BACKOFF_THRESHOLD
+
+/**
+ *  @def CHIP_CONFIG_RMP_BACKOFF_JITTER_PERCENT
+ *
+ *  @brief
+ *    The maximum random extension, in percent, applied to every retransmission
+ *    timeout, so that peers which lost messages at the same time do not
+ *    retransmit in lockstep. Set to 0 to disable jitter.
+ *
+ */
+#ifndef CHIP_CONFIG_RMP_BACKOFF_JITTER_PERCENT
+#define CHIP_CONFIG_RMP_BACKOFF_JITTER_PERCENT (25)
+#endif // CHIP_CONFIG_RMP_BACKOFF_JITTER_PERCENT
+
 /**
  *  @brief
  *    The ReliableMessageProtocol configuration.
@@ -89,6 +89,34 @@ public:
     bool IsOnResponseTimeoutCalled = false;
 };
 
+class ReplyDelegate : public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        return ec->SendMessage(Protocols::BDX::Id, kMsgType_TEST2, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                               SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+};
+
+class CountingDelegate : public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        ReceivedCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    int ReceivedCount = 0;
+};
+
 void CheckNewContextTest(nlTestSuite * inSuite, void * inContext)
 {
     TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
@@ -213,6 +241,57 @@ void CheckExchangeMessages(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 }
 
+void CheckExchangeLookup(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    // Each exchange below gets a responder on the same exchange manager, so use at most half of the pool.
+    constexpr size_t kExchangeCount = CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS / 2 - 1;
+
+    ReplyDelegate replyDelegate;
+    CHIP_ERROR err =
+        ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1, &replyDelegate);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    CountingDelegate delegates[kExchangeCount];
+    ExchangeContext * exchanges[kExchangeCount];
+    for (size_t i = 0; i < kExchangeCount; i++)
+    {
+        exchanges[i] = ctx.NewExchangeToPeer(&delegates[i]);
+        NL_TEST_ASSERT(inSuite, exchanges[i] != nullptr);
+    }
+
+    // Close every third exchange up front, so that lookups have to work around the slots they leave behind.
+    for (size_t i = 0; i < kExchangeCount; i += 3)
+    {
+        exchanges[i]->Close();
+        exchanges[i] = nullptr;
+    }
+
+    // Each reply must reach the exchange that sent the request, and only that one.
+    for (size_t i = kExchangeCount; i-- > 0;)
+    {
+        if (exchanges[i] == nullptr)
+        {
+            continue;
+        }
+
+        err = exchanges[i]->SendMessage(
+            Protocols::BDX::Id, kMsgType_TEST1, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+            SendFlags(Messaging::SendMessageFlags::kExpectResponse).Set(Messaging::SendMessageFlags::kNoAutoRequestAck));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        for (size_t j = 0; j < kExchangeCount; j++)
+        {
+            const bool replied = exchanges[j] != nullptr && j >= i;
+            NL_TEST_ASSERT(inSuite, delegates[j].ReceivedCount == (replied ? 1 : 0));
+        }
+    }
+
+    err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
 // Test Suite
 
 /**
@@ -224,6 +303,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("Test ExchangeMgr::NewContext",               CheckNewContextTest),
     NL_TEST_DEF("Test ExchangeMgr::CheckUmhRegistrationTest", CheckUmhRegistrationTest),
     NL_TEST_DEF("Test ExchangeMgr::CheckExchangeMessages",    CheckExchangeMessages),
+    NL_TEST_DEF("Test ExchangeMgr::CheckExchangeLookup",      CheckExchangeLookup),
     NL_TEST_DEF("Test OnConnectionExpired basics",            CheckSessionExpirationBasics),
     NL_TEST_DEF("Test OnConnectionExpired timeout handling",  CheckSessionExpirationTimeout),
 
@@ -25,6 +25,7 @@
 #include "TestMessagingLayer.h"
 
 #include <core/CHIPCore.h>
+#include <messaging/DeadlineQueue.h>
 #include <messaging/ReliableMessageContext.h>
 #include <messaging/ReliableMessageMgr.h>
 #include <protocols/Protocols.h>
@@ -56,6 +57,11 @@ using TestContext = chip::Test::MessagingContext;
 
 TestContext sContext;
 
+// Longest wait for a retransmission of a message sent with a 1 tick retry interval, before backoff kicks in: 1 tick is 64 ms,
+// plus up to CHIP_CONFIG_RMP_BACKOFF_JITTER_PERCENT of jitter.
+constexpr uint64_t kRetransmitWaitMs =
+    (1 << CHIP_CONFIG_RMP_TIMER_DEFAULT_PERIOD_SHIFT) * (100 + CHIP_CONFIG_RMP_BACKOFF_JITTER_PERCENT) / 100 + 1;
+
 const char PAYLOAD[] = "Hello!";
 
 TransportMgrBase gTransportMgr;
@@ -189,6 +195,93 @@ void test_os_sleep_ms(uint64_t millisecs)
     nanosleep(&sleep_time, nullptr);
 }
 
+void CheckDeadlineQueue(nlTestSuite * inSuite, void * inContext)
+{
+    struct Item
+    {
+        DeadlineQueueEntry mEntry;
+    };
+    using Queue = DeadlineQueue<Item, 8, &Item::mEntry>;
+
+    Item items[5];
+    Queue queue;
+
+    NL_TEST_ASSERT(inSuite, queue.Earliest() == nullptr);
+
+    const System::Clock::MonotonicMilliseconds deadlines[] = { 50, 10, 40, 30, 20 };
+    for (size_t i = 0; i < 5; i++)
+    {
+        queue.Schedule(items[i], deadlines[i]);
+    }
+    NL_TEST_ASSERT(inSuite, queue.Count() == 5);
+    NL_TEST_ASSERT(inSuite, queue.Earliest() == &items[1]);
+
+    // Move the earliest item to the back, bring another one to the front, and drop one from the middle.
+    queue.Schedule(items[1], 60);
+    queue.Schedule(items[0], 5);
+    queue.Cancel(items[3]);
+    NL_TEST_ASSERT(inSuite, !Queue::IsQueued(items[3]));
+    NL_TEST_ASSERT(inSuite, queue.Count() == 4);
+
+    Item * const expected[] = { &items[0], &items[4], &items[2], &items[1] };
+    for (Item * item : expected)
+    {
+        NL_TEST_ASSERT(inSuite, queue.Earliest() == item);
+        queue.Cancel(*item);
+    }
+    NL_TEST_ASSERT(inSuite, queue.Earliest() == nullptr);
+    NL_TEST_ASSERT(inSuite, queue.Count() == 0);
+}
+
+void CheckRetransmitBackoff(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    MockAppDelegate mockAppDelegate;
+    ExchangeContext * exchange = ctx.NewExchangeToPeer(&mockAppDelegate);
+    NL_TEST_ASSERT(inSuite, exchange != nullptr);
+
+    ReliableMessageMgr * rm     = ctx.GetExchangeManager().GetReliableMessageMgr();
+    ReliableMessageContext * rc = exchange->GetReliableMessageContext();
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+    NL_TEST_ASSERT(inSuite, rc != nullptr);
+
+    rc->SetConfig({
+        3, // CHIP_CONFIG_MRP_DEFAULT_INITIAL_RETRY_INTERVAL
+        5, // CHIP_CONFIG_MRP_DEFAULT_ACTIVE_RETRY_INTERVAL
+    });
+
+    // The first retransmission waits for the initial interval, the next CHIP_CONFIG_RMP_BACKOFF_THRESHOLD ones for the
+    // active interval, and every later one CHIP_CONFIG_RMP_BACKOFF_BASE_PERCENT of the one before.
+    constexpr uint8_t kSendCounts = CHIP_CONFIG_RMP_BACKOFF_THRESHOLD + 4;
+    constexpr int kSamples        = 100;
+    uint64_t base                 = rm->GetTimePeriodFromTickCounter(3);
+    for (uint8_t sendCount = 0; sendCount < kSendCounts; sendCount++)
+    {
+        if (sendCount == 1)
+        {
+            base = rm->GetTimePeriodFromTickCounter(5);
+        }
+        else if (sendCount > CHIP_CONFIG_RMP_BACKOFF_THRESHOLD)
+        {
+            base = base * CHIP_CONFIG_RMP_BACKOFF_BASE_PERCENT / 100;
+        }
+
+        // Jitter only ever extends the timeout, by at most CHIP_CONFIG_RMP_BACKOFF_JITTER_PERCENT.
+        const uint64_t maxTimeout = base + base * CHIP_CONFIG_RMP_BACKOFF_JITTER_PERCENT / 100;
+        bool jittered             = false;
+        for (int i = 0; i < kSamples; i++)
+        {
+            const uint64_t timeout = rm->TestGetRetransmitTimeout(rc, sendCount);
+            NL_TEST_ASSERT(inSuite, timeout >= base && timeout <= maxTimeout);
+            jittered = jittered || timeout != base;
+        }
+        NL_TEST_ASSERT(inSuite, jittered == (CHIP_CONFIG_RMP_BACKOFF_JITTER_PERCENT > 0));
+    }
+
+    exchange->Close();
+}
+
 void CheckAddClearRetrans(nlTestSuite * inSuite, void * inContext)
 {
     TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
@@ -278,8 +371,8 @@ void CheckResendApplicationMessage(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, gLoopback.mDroppedMessageCount == 1);
     NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 1);
 
-    // 1 tick is 64 ms, sleep 65 ms to trigger first re-transmit
-    test_os_sleep_ms(65);
+    // Wait for the first re-transmit
+    test_os_sleep_ms(kRetransmitWaitMs);
     ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm, CHIP_NO_ERROR);
 
     // Ensure the retransmit message was dropped, and is still there in the retransmit table
@@ -288,8 +381,8 @@ void CheckResendApplicationMessage(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, gLoopback.mDroppedMessageCount == 2);
     NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 1);
 
-    // sleep another 65 ms to trigger second re-transmit
-    test_os_sleep_ms(65);
+    // Wait for the second re-transmit
+    test_os_sleep_ms(kRetransmitWaitMs);
     ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm, CHIP_NO_ERROR);
 
     // Ensure the retransmit message was NOT dropped, and the retransmit table is empty, as we should have gotten an ack
@@ -344,8 +437,8 @@ void CheckCloseExchangeAndResendApplicationMessage(nlTestSuite * inSuite, void *
     NL_TEST_ASSERT(inSuite, gLoopback.mDroppedMessageCount == 1);
     NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 1);
 
-    // 1 tick is 64 ms, sleep 65 ms to trigger first re-transmit
-    test_os_sleep_ms(65);
+    // Wait for the first re-transmit
+    test_os_sleep_ms(kRetransmitWaitMs);
     ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm, CHIP_NO_ERROR);
 
     // Ensure the retransmit message was dropped, and is still there in the retransmit table
@@ -354,8 +447,8 @@ void CheckCloseExchangeAndResendApplicationMessage(nlTestSuite * inSuite, void *
     NL_TEST_ASSERT(inSuite, gLoopback.mDroppedMessageCount == 2);
     NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 1);
 
-    // sleep another 65 ms to trigger second re-transmit
-    test_os_sleep_ms(65);
+    // Wait for the second re-transmit
+    test_os_sleep_ms(kRetransmitWaitMs);
     ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm, CHIP_NO_ERROR);
 
     // Ensure the retransmit message was NOT dropped, and the retransmit table is empty, as we should have gotten an ack
@@ -409,8 +502,8 @@ void CheckFailedMessageRetainOnSend(nlTestSuite * inSuite, void * inContext)
     // Ensure the message was dropped
     NL_TEST_ASSERT(inSuite, gLoopback.mDroppedMessageCount == 1);
 
-    // 1 tick is 64 ms, sleep 65 ms to trigger first re-transmit
-    test_os_sleep_ms(65);
+    // Wait for the first re-transmit
+    test_os_sleep_ms(kRetransmitWaitMs);
     ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm, CHIP_NO_ERROR);
 
     // Ensure the retransmit table is empty, as we did not provide a message to retain
@@ -470,8 +563,8 @@ void CheckResendApplicationMessageWithPeerExchange(nlTestSuite * inSuite, void *
     NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 1);
     NL_TEST_ASSERT(inSuite, !mockReceiver.IsOnMessageReceivedCalled);
 
-    // 1 tick is 64 ms, sleep 65 ms to trigger first re-transmit
-    test_os_sleep_ms(65);
+    // Wait for the first re-transmit
+    test_os_sleep_ms(kRetransmitWaitMs);
     ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm, CHIP_NO_ERROR);
 
     // Ensure the retransmit message was not dropped, and is no longer in the retransmit table
@@ -547,8 +640,8 @@ void CheckDuplicateMessageClosedExchange(nlTestSuite * inSuite, void * inContext
     err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 
-    // 1 tick is 64 ms, sleep 65 ms to trigger first re-transmit
-    test_os_sleep_ms(65);
+    // Wait for the first re-transmit
+    test_os_sleep_ms(kRetransmitWaitMs);
     ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm, CHIP_NO_ERROR);
 
     // Ensure the retransmit message was sent and the ack was sent
@@ -620,8 +713,8 @@ void CheckResendSessionEstablishmentMessageWithPeerExchange(nlTestSuite * inSuit
     NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 1);
     NL_TEST_ASSERT(inSuite, !mockReceiver.IsOnMessageReceivedCalled);
 
-    // 1 tick is 64 ms, sleep 65 ms to trigger first re-transmit
-    test_os_sleep_ms(65);
+    // Wait for the first re-transmit
+    test_os_sleep_ms(kRetransmitWaitMs);
     ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm, CHIP_NO_ERROR);
 
     // Ensure the retransmit message was not dropped, and is no longer in the retransmit table
@@ -709,8 +802,8 @@ void CheckDuplicateMessage(nlTestSuite * inSuite, void * inContext)
     mockReceiver.mDropAckResponse = false;
     mockReceiver.mRetainExchange  = false;
 
-    // 1 tick is 64 ms, sleep 65 ms to trigger first re-transmit
-    test_os_sleep_ms(65);
+    // Wait for the first re-transmit
+    test_os_sleep_ms(kRetransmitWaitMs);
     ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm, CHIP_NO_ERROR);
 
     // Ensure the retransmit message was sent and the ack was sent
@@ -882,12 +975,15 @@ void CheckNoPiggybackAfterPiggyback(nlTestSuite * inSuite, void * inContext)
     buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
     NL_TEST_ASSERT(inSuite, !buffer.IsNull());
 
+    const uint32_t piggybackedAcks = rm->GetAckStats().mPiggybacked;
+
     mockReceiver.mExchange->SendMessage(Echo::MsgType::EchoResponse, std::move(buffer),
                                         SendFlags(SendMessageFlags::kExpectResponse).Set(SendMessageFlags::kNoAutoRequestAck));
 
-    // Ensure the response was sent.
+    // Ensure the response was sent, and counted as carrying an ack.
     NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount == 2);
     NL_TEST_ASSERT(inSuite, gLoopback.mDroppedMessageCount == 0);
+    NL_TEST_ASSERT(inSuite, rm->GetAckStats().mPiggybacked == piggybackedAcks + 1);
 
     // Ensure that we have received that response and it had a piggyback ack.
     NL_TEST_ASSERT(inSuite, mockSender.IsOnMessageReceivedCalled);
@@ -945,6 +1041,86 @@ void CheckNoPiggybackAfterPiggyback(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
 }
 
+void CheckAckCoalescing(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    ctx.GetInetLayer().SystemLayer()->Init(nullptr);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+
+    // Ensure the retransmit table is empty right now
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+
+    gLoopback.mSentMessageCount    = 0;
+    gLoopback.mNumMessagesToDrop   = 0;
+    gLoopback.mDroppedMessageCount = 0;
+
+    // Send two requests to the same peer, each on its own exchange, and keep the receiving exchanges open so that their
+    // acks stay pending.
+    MockAppDelegate mockSender;
+    MockAppDelegate mockReceivers[2];
+    ExchangeContext * exchanges[2];
+    for (size_t i = 0; i < 2; i++)
+    {
+        mockReceivers[i].mRetainExchange = true;
+
+        err = ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest, &mockReceivers[i]);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        exchanges[i] = ctx.NewExchangeToPeer(&mockSender);
+        NL_TEST_ASSERT(inSuite, exchanges[i] != nullptr);
+
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+        err = exchanges[i]->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer),
+                                        SendFlags(SendMessageFlags::kExpectResponse));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, mockReceivers[i].IsOnMessageReceivedCalled);
+        NL_TEST_ASSERT(inSuite, mockReceivers[i].mExchange->GetReliableMessageContext()->IsAckPending());
+
+        err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+
+    NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount == 2);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 2);
+
+    // Make the first ack due now, and the second one due later, but within the coalescing window.
+    ReliableMessageContext * firstRc  = mockReceivers[0].mExchange->GetReliableMessageContext();
+    ReliableMessageContext * secondRc = mockReceivers[1].mExchange->GetReliableMessageContext();
+
+    const System::Clock::MonotonicMilliseconds now = System::Clock::GetMonotonicMilliseconds();
+    rm->SetAckCoalescingWindow(0);
+    rm->ScheduleStandaloneAck(firstRc, now);
+    rm->ScheduleStandaloneAck(secondRc, now + 5000);
+    rm->SetAckCoalescingWindow(10000);
+    rm->ResetAckStats();
+
+    ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm, CHIP_NO_ERROR);
+
+    // Ensure both acks were sent, and both requests were acknowledged.
+    NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount == 4);
+    NL_TEST_ASSERT(inSuite, !firstRc->IsAckPending());
+    NL_TEST_ASSERT(inSuite, !secondRc->IsAckPending());
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+    NL_TEST_ASSERT(inSuite, rm->GetAckStats().mStandalone == 2);
+    NL_TEST_ASSERT(inSuite, rm->GetAckStats().mCoalesced == 1);
+    NL_TEST_ASSERT(inSuite, rm->GetAckStats().mPiggybacked == 0);
+
+    rm->SetAckCoalescingWindow(CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW);
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        mockReceivers[i].CloseExchangeIfNeeded();
+        exchanges[i]->Close();
+    }
+}
+
 void CheckSendUnsolicitedStandaloneAckMessage(nlTestSuite * inSuite, void * inContext)
 {
     /**
@@ -1147,6 +1323,8 @@ void CheckMessageAfterClosed(nlTestSuite * inSuite, void * inContext)
 // clang-format off
 const nlTest sTests[] =
 {
+    NL_TEST_DEF("Test DeadlineQueue ordering", CheckDeadlineQueue),
+    NL_TEST_DEF("Test ReliableMessageMgr::CheckRetransmitBackoff", CheckRetransmitBackoff),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckAddClearRetrans", CheckAddClearRetrans),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckFailRetrans", CheckFailRetrans),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckResendApplicationMessage", CheckResendApplicationMessage),
@@ -1158,6 +1336,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("Test ReliableMessageMgr::CheckDuplicateMessageClosedExchange", CheckDuplicateMessageClosedExchange),
     NL_TEST_DEF("Test that a reply after a standalone ack comes through correctly", CheckReceiveAfterStandaloneAck),
     NL_TEST_DEF("Test that a reply to a non-MRP message does not piggyback an ack even if there were MRP things happening on the context before", CheckNoPiggybackAfterPiggyback),
+    NL_TEST_DEF("Test that standalone acks to the same peer are sent together within the coalescing window", CheckAckCoalescing),
     NL_TEST_DEF("Test sending an unsolicited ack-soliciting 'standalone ack' message", CheckSendUnsolicitedStandaloneAckMessage),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckSendStandaloneAckMessage", CheckSendStandaloneAckMessage),
     NL_TEST_DEF("Test command, response, default response, with receiver closing exchange after sending response", CheckMessageAfterClosed),
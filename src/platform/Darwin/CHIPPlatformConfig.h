@@ -96,6 +96,14 @@
 #define CHIP_LOG_FILTERING 1
 #endif // CHIP_LOG_FILTERING
 
+#ifndef CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX
+#define CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX 1
+#endif // CHIP_CONFIG_ENABLE_ATTRIBUTE_INDEX
+
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE 16
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+
 #ifndef CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
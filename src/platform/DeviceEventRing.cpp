@@ -0,0 +1,144 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a bounded lock-free CHIP device event queue that
+ *      any number of threads post to and the CHIP event loop drains.
+ */
+
+#include <platform/DeviceEventRing.h>
+
+#include <stdint.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+static_assert((DeviceEventRing::kCapacity & (DeviceEventRing::kCapacity - 1)) == 0,
+              "Positions must wrap around at a multiple of the capacity");
+
+DeviceEventRing::DeviceEventRing() : mEnqueuePosition(0), mDequeuePosition(0)
+{
+    // Slot i is free for the producer that claims position i.
+    for (size_t i = 0; i < kCapacity; i++)
+    {
+        mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool DeviceEventRing::TryPush(const ChipDeviceEvent & event)
+{
+    size_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        Slot & slot       = mSlots[position & (kCapacity - 1)];
+        size_t sequence   = slot.mSequence.load(std::memory_order_acquire);
+        intptr_t distance = static_cast<intptr_t>(sequence - position);
+
+        if (distance == 0)
+        {
+            // The slot is free: claim it, unless another producer did first.
+            if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                slot.mEvent = event;
+                slot.mSequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (distance < 0)
+        {
+            // The slot still holds the event posted a lap ago.
+            return false;
+        }
+        else
+        {
+            // Another producer claimed the slot since the position was read.
+            position = mEnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool DeviceEventRing::TryPop(ChipDeviceEvent & event)
+{
+    Slot & slot     = mSlots[mDequeuePosition & (kCapacity - 1)];
+    size_t sequence = slot.mSequence.load(std::memory_order_acquire);
+
+    if (static_cast<intptr_t>(sequence - (mDequeuePosition + 1)) < 0)
+    {
+        return false;
+    }
+
+    event = slot.mEvent;
+
+    // Free the slot for the producer that claims it on the next lap.
+    slot.mSequence.store(mDequeuePosition + kCapacity, std::memory_order_release);
+    mDequeuePosition++;
+    return true;
+}
+
+void DeviceEventRingWithOverflow::Post(const ChipDeviceEvent & event)
+{
+    if (mOverflowLength.load(std::memory_order_acquire) != 0 || !mRing.TryPush(event))
+    {
+        mOverflow.Push(event);
+        mOverflowLength.fetch_add(1, std::memory_order_release);
+    }
+}
+
+bool DeviceEventRingWithOverflow::Take(ChipDeviceEvent & event)
+{
+    if (mRing.TryPop(event))
+    {
+        return true;
+    }
+
+    if (!mHasPendingOverflowEvent)
+    {
+        if (mOverflowLength.load(std::memory_order_acquire) == 0)
+        {
+            return false;
+        }
+
+        // Posting to the locked queue does not keep its length from dropping to zero, so that events keep going there
+        // until this one is taken.
+        mPendingOverflowEvent    = mOverflow.PopFront();
+        mHasPendingOverflowEvent = true;
+    }
+
+    // The producer of the pending event may have posted events to the ring before it, which taking it from the locked
+    // queue made visible; a producer that is still publishing one keeps the ring from being empty.
+    if (mRing.TryPop(event))
+    {
+        return true;
+    }
+    if (!mRing.IsEmpty())
+    {
+        return false;
+    }
+
+    event                    = mPendingOverflowEvent;
+    mHasPendingOverflowEvent = false;
+    mOverflowLength.fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
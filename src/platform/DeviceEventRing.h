@@ -0,0 +1,160 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares a bounded lock-free CHIP device event queue that
+ *      any number of threads post to and the CHIP event loop drains.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+
+#include <core/CHIPCore.h>
+#include <platform/CHIPDeviceConfig.h>
+#include <platform/CHIPDeviceEvent.h>
+#include <platform/DeviceSafeQueue.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+constexpr size_t RoundUpToPowerOfTwo(size_t value)
+{
+    size_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+/**
+ *  @class DeviceEventRing
+ *
+ *  @brief
+ *      A fixed-size ring of device events with many producers and a single consumer, which never takes a lock.
+ *
+ *      Every slot carries a sequence number that tells whether it is free for the producer whose turn it is, or holds
+ *      an event for the consumer. Producers claim slots with one compare-and-swap on the enqueue position and publish
+ *      them by advancing the slot sequence; the consumer, which is the only one to move the dequeue position, frees
+ *      them the same way. Producers therefore only contend with each other on that one compare-and-swap, and never
+ *      with the consumer.
+ *
+ *      The ring holds CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE events, rounded up to a power of two. TryPush() fails
+ *      instead of waiting when it is full.
+ */
+class DeviceEventRing
+{
+public:
+    static constexpr size_t kCapacity = RoundUpToPowerOfTwo(CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE);
+
+    DeviceEventRing();
+    ~DeviceEventRing() = default;
+
+    /**
+     * Add @p event at the end of the ring. May be called from any thread.
+     *
+     * @return Whether there was room for the event.
+     */
+    bool TryPush(const ChipDeviceEvent & event);
+
+    /**
+     * Take the event at the front of the ring into @p event. Must only be called from one thread at a time.
+     *
+     * @return Whether there was an event. An event whose producer has not finished posting it is not there yet, and
+     *         neither are the events after it.
+     */
+    bool TryPop(ChipDeviceEvent & event);
+
+    /**
+     * Whether every event pushed so far has been popped, counting those whose producer has not finished posting them.
+     * Must only be called from the thread that pops events.
+     */
+    bool IsEmpty() const { return mEnqueuePosition.load(std::memory_order_acquire) == mDequeuePosition; }
+
+private:
+    static constexpr size_t kCacheLineSize = 64;
+
+    struct Slot
+    {
+        std::atomic<size_t> mSequence;
+        ChipDeviceEvent mEvent;
+    };
+
+    Slot mSlots[kCapacity];
+
+    // The positions only grow, and wrap around together with the slot sequences; they are on cache lines of their own so
+    // that producers claiming slots do not slow down the consumer.
+    alignas(kCacheLineSize) std::atomic<size_t> mEnqueuePosition;
+    alignas(kCacheLineSize) size_t mDequeuePosition;
+
+    DeviceEventRing(const DeviceEventRing &) = delete;
+    DeviceEventRing & operator=(const DeviceEventRing &) = delete;
+};
+
+/**
+ *  @class DeviceEventRingWithOverflow
+ *
+ *  @brief
+ *      A device event queue that never drops an event: events go to a DeviceEventRing, and to a DeviceSafeQueue while
+ *      the ring is full.
+ *
+ *      Once an event went to the locked queue, all events go there until the consumer has taken it, and the consumer
+ *      only takes it once the ring is empty. The events each thread posts are therefore taken in the order it posted
+ *      them.
+ */
+class DeviceEventRingWithOverflow
+{
+public:
+    DeviceEventRingWithOverflow()  = default;
+    ~DeviceEventRingWithOverflow() = default;
+
+    /**
+     * Add @p event at the end of the queue. May be called from any thread.
+     */
+    void Post(const ChipDeviceEvent & event);
+
+    /**
+     * Take the event at the front of the queue into @p event. Must only be called from one thread at a time.
+     *
+     * @return Whether there was an event. As with DeviceEventRing::TryPop(), an event whose producer has not finished
+     *         posting it is not there yet, and neither are the events after it; the producer's wakeup is for them.
+     */
+    bool Take(ChipDeviceEvent & event);
+
+private:
+    DeviceEventRing mRing;
+    DeviceSafeQueue mOverflow;
+
+    // Events posted to mOverflow and not taken yet, counting mPendingOverflowEvent.
+    std::atomic<size_t> mOverflowLength{ 0 };
+
+    // The event the consumer took from mOverflow, held back until the events posted to the ring before it are taken.
+    ChipDeviceEvent mPendingOverflowEvent;
+    bool mHasPendingOverflowEvent = false;
+
+    DeviceEventRingWithOverflow(const DeviceEventRingWithOverflow &) = delete;
+    DeviceEventRingWithOverflow & operator=(const DeviceEventRingWithOverflow &) = delete;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,147 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares a harness that posts numbered device events to a
+ *      queue from several threads while one thread takes them, checking that
+ *      the events of each thread are taken in the order it posted them.
+ */
+
+#pragma once
+
+#include <core/CHIPCore.h>
+#include <platform/CHIPDeviceConfig.h>
+#include <platform/CHIPDeviceEvent.h>
+#include <system/SystemClock.h>
+
+#include <atomic>
+#include <pthread.h>
+#include <sched.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Test {
+
+constexpr size_t kMaxProducers      = 8;
+constexpr intptr_t kProducerShift   = 24;
+constexpr intptr_t kEventNumberMask = (intptr_t(1) << kProducerShift) - 1;
+
+inline ChipDeviceEvent MakeEvent(size_t producer, uint32_t number)
+{
+    ChipDeviceEvent event;
+    event.Type                    = DeviceEventType::kCallWorkFunct;
+    event.CallWorkFunct.WorkFunct = nullptr;
+    event.CallWorkFunct.Arg       = static_cast<intptr_t>(producer << kProducerShift) | static_cast<intptr_t>(number);
+    return event;
+}
+
+/**
+ * Posts a number of numbered events from each of several threads to a queue with Post() and Take() methods, while one
+ * thread takes them.
+ */
+template <typename Queue>
+class ContentionRun
+{
+public:
+    ContentionRun(Queue & queue, size_t producerCount, uint32_t eventsPerProducer) :
+        mQueue(queue), mProducerCount(producerCount), mEventsPerProducer(eventsPerProducer)
+    {}
+
+    // Returns the time it took for all events to be taken, in microseconds.
+    uint64_t Run()
+    {
+        pthread_t producers[kMaxProducers];
+        Producer producerArgs[kMaxProducers];
+
+        mStart.store(false);
+        for (size_t i = 0; i < mProducerCount; i++)
+        {
+            producerArgs[i] = { this, i };
+            pthread_create(&producers[i], nullptr, ProducerMain, &producerArgs[i]);
+        }
+
+        uint64_t start = System::Clock::GetMonotonicMicroseconds();
+        mStart.store(true);
+        Consume();
+        uint64_t elapsed = System::Clock::GetMonotonicMicroseconds() - start;
+
+        for (size_t i = 0; i < mProducerCount; i++)
+        {
+            pthread_join(producers[i], nullptr);
+        }
+        return elapsed;
+    }
+
+    bool mInOrder = true;
+
+private:
+    struct Producer
+    {
+        ContentionRun * mRun;
+        size_t mIndex;
+    };
+
+    static void * ProducerMain(void * arg)
+    {
+        Producer * producer = static_cast<Producer *>(arg);
+        while (!producer->mRun->mStart.load())
+        {
+            sched_yield();
+        }
+        for (uint32_t i = 0; i < producer->mRun->mEventsPerProducer; i++)
+        {
+            producer->mRun->mQueue.Post(MakeEvent(producer->mIndex, i));
+        }
+        return nullptr;
+    }
+
+    void Consume()
+    {
+        uint32_t next[kMaxProducers] = {};
+        uint64_t remaining           = static_cast<uint64_t>(mEventsPerProducer) * mProducerCount;
+        ChipDeviceEvent event;
+
+        while (remaining > 0)
+        {
+            if (!mQueue.Take(event))
+            {
+                sched_yield();
+                continue;
+            }
+
+            // Every producer's events arrive in the order it posted them.
+            size_t producer = static_cast<size_t>(event.CallWorkFunct.Arg >> kProducerShift);
+            uint32_t number = static_cast<uint32_t>(event.CallWorkFunct.Arg & kEventNumberMask);
+            mInOrder        = mInOrder && producer < mProducerCount && number == next[producer];
+            next[producer]  = number + 1;
+            remaining--;
+        }
+    }
+
+    Queue & mQueue;
+    size_t mProducerCount;
+    uint32_t mEventsPerProducer;
+    std::atomic<bool> mStart;
+};
+
+} // namespace Test
+} // namespace DeviceLayer
+} // namespace chip
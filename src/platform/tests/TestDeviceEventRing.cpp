@@ -0,0 +1,132 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the lock-free device event ring,
+ *      and for the queue that posts events to it and to the locked device
+ *      event queue while it is full.
+ */
+
+#include "DeviceEventContention.h"
+
+#include <platform/DeviceEventRing.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+using namespace chip::DeviceLayer::Internal;
+using namespace chip::DeviceLayer::Test;
+
+namespace {
+
+// Few enough events for the test to be quick, but enough for the ring to fill up and overflow.
+constexpr size_t kContentionProducers = 4;
+constexpr uint32_t kContentionEvents  = 20000;
+
+DeviceEventRing sRing;
+DeviceEventRingWithOverflow sRingWithOverflow;
+
+void TestPushPop(nlTestSuite * inSuite, void * inContext)
+{
+    ChipDeviceEvent event;
+
+    NL_TEST_ASSERT(inSuite, !sRing.TryPop(event));
+    NL_TEST_ASSERT(inSuite, sRing.IsEmpty());
+
+    // Go around the ring a few times, filling it up each time.
+    for (uint32_t lap = 0; lap < 3; lap++)
+    {
+        for (uint32_t i = 0; i < DeviceEventRing::kCapacity; i++)
+        {
+            NL_TEST_ASSERT(inSuite, sRing.TryPush(MakeEvent(lap, i)));
+        }
+        NL_TEST_ASSERT(inSuite, !sRing.TryPush(MakeEvent(lap, 0)));
+        NL_TEST_ASSERT(inSuite, !sRing.IsEmpty());
+
+        for (uint32_t i = 0; i < DeviceEventRing::kCapacity; i++)
+        {
+            NL_TEST_ASSERT(inSuite, sRing.TryPop(event));
+            NL_TEST_ASSERT(inSuite, event.CallWorkFunct.Arg == MakeEvent(lap, i).CallWorkFunct.Arg);
+        }
+        NL_TEST_ASSERT(inSuite, !sRing.TryPop(event));
+        NL_TEST_ASSERT(inSuite, sRing.IsEmpty());
+    }
+
+    // A slot freed by the consumer takes the next event.
+    NL_TEST_ASSERT(inSuite, sRing.TryPush(MakeEvent(0, 1)));
+    NL_TEST_ASSERT(inSuite, sRing.TryPop(event) && event.CallWorkFunct.Arg == 1);
+}
+
+void TestOverflowOrder(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint32_t kOverflowEvents = 3;
+    ChipDeviceEvent event;
+    uint32_t next = 0;
+
+    NL_TEST_ASSERT(inSuite, !sRingWithOverflow.Take(event));
+
+    // Fill the ring, and post a few more events to the locked queue.
+    for (uint32_t i = 0; i < DeviceEventRing::kCapacity + kOverflowEvents; i++)
+    {
+        sRingWithOverflow.Post(MakeEvent(0, i));
+    }
+
+    // Taking an event frees a slot in the ring, but events keep going to the locked queue after those already there.
+    NL_TEST_ASSERT(inSuite, sRingWithOverflow.Take(event) && event.CallWorkFunct.Arg == next++);
+    sRingWithOverflow.Post(MakeEvent(0, DeviceEventRing::kCapacity + kOverflowEvents));
+
+    while (sRingWithOverflow.Take(event))
+    {
+        NL_TEST_ASSERT(inSuite, event.CallWorkFunct.Arg == next++);
+    }
+    NL_TEST_ASSERT(inSuite, next == DeviceEventRing::kCapacity + kOverflowEvents + 1);
+
+    // Once the locked queue is drained, events go to the ring again.
+    sRingWithOverflow.Post(MakeEvent(0, next));
+    NL_TEST_ASSERT(inSuite, sRingWithOverflow.Take(event) && event.CallWorkFunct.Arg == next);
+    NL_TEST_ASSERT(inSuite, !sRingWithOverflow.Take(event));
+}
+
+void TestContention(nlTestSuite * inSuite, void * inContext)
+{
+    ContentionRun<DeviceEventRingWithOverflow> run(sRingWithOverflow, kContentionProducers, kContentionEvents);
+    run.Run();
+    NL_TEST_ASSERT(inSuite, run.mInOrder);
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestPushPop", TestPushPop),             //
+    NL_TEST_DEF("TestOverflowOrder", TestOverflowOrder), //
+    NL_TEST_DEF("TestContention", TestContention),       //
+    NL_TEST_SENTINEL(),                                  //
+};
+
+} // namespace
+
+int TestDeviceEventRing()
+{
+    nlTestSuite theSuite = { "DeviceEventRing tests", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestDeviceEventRing);
@@ -0,0 +1,95 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of posting device events from several
+ *      threads at once, to the lock-free device event ring and to the locked
+ *      device event queue, while one thread takes them.
+ */
+
+#include "../DeviceEventContention.h"
+
+#include <platform/DeviceEventRing.h>
+#include <platform/DeviceSafeQueue.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace chip::DeviceLayer;
+using namespace chip::DeviceLayer::Internal;
+using namespace chip::DeviceLayer::Test;
+
+namespace {
+
+constexpr uint32_t kEventsPerProducer = 200000;
+static_assert(kEventsPerProducer <= kEventNumberMask, "Event numbers must fit below the producer index");
+
+/**
+ * How PlatformManager posted events before the ring: all through the locked queue.
+ */
+struct LockedQueue
+{
+    void Post(const ChipDeviceEvent & event) { mQueue.Push(event); }
+
+    bool Take(ChipDeviceEvent & event)
+    {
+        if (mQueue.Empty())
+        {
+            return false;
+        }
+        event = mQueue.PopFront();
+        return true;
+    }
+
+    DeviceSafeQueue mQueue;
+};
+
+LockedQueue sLockedQueue;
+DeviceEventRingWithOverflow sRingWithOverflow;
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    bool inOrder = true;
+
+    printf("Posting %" PRIu32 " events per thread, while one thread takes them:\n", kEventsPerProducer);
+    for (size_t producerCount = 1; producerCount <= kMaxProducers; producerCount *= 2)
+    {
+        ContentionRun<LockedQueue> queueRun(sLockedQueue, producerCount, kEventsPerProducer);
+        uint64_t queueUs = queueRun.Run();
+
+        ContentionRun<DeviceEventRingWithOverflow> ringRun(sRingWithOverflow, producerCount, kEventsPerProducer);
+        uint64_t ringUs = ringRun.Run();
+
+        inOrder = inOrder && queueRun.mInOrder && ringRun.mInOrder;
+
+        double events = static_cast<double>(kEventsPerProducer) * static_cast<double>(producerCount);
+        printf("  %zu producer threads: %7.1f ns/event with the locked queue, %7.1f ns/event with the ring\n", producerCount,
+               static_cast<double>(queueUs) * 1000.0 / events, static_cast<double>(ringUs) * 1000.0 / events);
+    }
+
+    if (!inOrder)
+    {
+        fprintf(stderr, "Events of a thread were taken out of the order it posted them in\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -373,6 +373,76 @@
 
 #endif /* !CHIP_SYSTEM_CONFIG_USE_LWIP */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+ *
+ *  @brief
+ *      Allocate packet buffers from (1) heap-backed slabs with a few fixed size classes instead of (0) one
+ *      Platform::MemoryAlloc() call per buffer.
+ *
+ *      Only applies to sockets platforms where CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is 0. Each size class grows by a
+ *      slab of CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SIZE bytes at a time and keeps freed blocks for reuse, so a steady
+ *      stream of small messages does not touch the heap and does not occupy maximum-size blocks. Slabs whose blocks are
+ *      all free again are returned to the heap, except for one per size class.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB */
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB && (CHIP_SYSTEM_CONFIG_USE_LWIP || CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE != 0)
+#error "CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB requires sockets and CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE == 0"
+#endif
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE
+ *
+ *  @brief
+ *      Capacity, including the header reserve, of the smallest packet buffer size class when
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB is enabled. Sized for acknowledgements and other short messages.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE 128
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MEDIUM_SIZE
+ *
+ *  @brief
+ *      Capacity, including the header reserve, of the middle packet buffer size class when
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB is enabled. The largest class always has the maximum capacity,
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MEDIUM_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MEDIUM_SIZE 512
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MEDIUM_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SIZE
+ *
+ *  @brief
+ *      Number of bytes requested from the heap each time a packet buffer size class runs out of free blocks. A slab
+ *      always holds at least one block.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SIZE 16384
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE
+ *
+ *  @brief
+ *      Number of free blocks per size class that each thread may keep for itself when CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+ *      is enabled, so that allocation and release usually do not take the shared lock. Set to 0 to disable the per-thread
+ *      caches, e.g. on toolchains without \c thread_local support.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE
+#if CHIP_SYSTEM_CONFIG_NO_LOCKING
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE 0
+#else
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE 16
+#endif
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_EVENT_TYPE
  *
@@ -453,6 +523,24 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 32
 #endif /* CHIP_SYSTEM_CONFIG_NUM_TIMERS */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+ *
+ *  @brief
+ *      Use (1) an indexed binary min-heap to track armed timers instead of (0) scanning the whole timer pool.
+ *
+ *      With the heap, computing the next wakeup is O(1), starting, cancelling and expiring a timer is O(log n), and
+ *      Layer::CancelTimer() finds its target through a hash of (callback, app state) instead of a pool scan. This
+ *      matters when CHIP_SYSTEM_CONFIG_NUM_TIMERS is large. Only supported by sockets builds that do not use libdispatch.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+#define CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP 0
+#endif /* CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP */
+
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP && !(CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH)
+#error "CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP requires CHIP_SYSTEM_CONFIG_USE_SOCKETS without CHIP_SYSTEM_CONFIG_USE_DISPATCH"
+#endif
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
  *
@@ -563,6 +651,34 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_VALID_REAL_TIME_THRESHOLD 946684800
 #endif // CHIP_SYSTEM_CONFIG_VALID_REAL_TIME_THRESHOLD
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_EPOLL
+ *
+ *  @brief
+ *      Use (1) the Linux epoll WatchableEventManager (WatchableSocketEpoll.h) rather than (0) select() or libevent.
+ *
+ *  Normally set by the build from the chip_system_config_sockets_event_loop gn argument.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_EPOLL
+#define CHIP_SYSTEM_CONFIG_USE_EPOLL 0
+#endif // CHIP_SYSTEM_CONFIG_USE_EPOLL
+
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL && !CHIP_SYSTEM_CONFIG_USE_SOCKETS
+#error "CHIP_SYSTEM_CONFIG_USE_EPOLL requires CHIP_SYSTEM_CONFIG_USE_SOCKETS"
+#endif
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
+ *
+ *  @brief
+ *      The maximum number of ready file descriptors collected by a single epoll_wait() call.
+ *
+ *  Further ready descriptors are picked up by the next event loop iteration.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
+#define CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS 64
+#endif // CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE
  *
@@ -571,10 +687,12 @@ struct LwIPEvent;
  *
  *  Use the POSIX pipe() function to create an anonymous data stream.
  *
- *  Defaults to enabled if the system is using sockets (except for Zephyr RTOS).
+ *  Defaults to enabled if the system is using sockets (except for Zephyr RTOS, and the epoll event loop, which wakes
+ *  up through an eventfd instead).
  */
 #ifndef CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE
-#if (CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK) && !__ZEPHYR__ && !__MBED__
+#if (CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK) && !__ZEPHYR__ && !__MBED__ &&                    \
+    !CHIP_SYSTEM_CONFIG_USE_EPOLL
 #define CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE 1
 #else
 #define CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE 0
@@ -364,6 +364,14 @@ void Layer::CancelTimer(Layer::TimerCompleteFunct aOnComplete, void * aAppState)
     if (this->State() != kLayerState_Initialized)
         return;
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    Timer * lTimer = mTimerHeap.Find(aOnComplete, aAppState);
+
+    if (lTimer != nullptr)
+    {
+        lTimer->Cancel();
+    }
+#else  // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
     for (size_t i = 0; i < Timer::sPool.Size(); ++i)
     {
         Timer * lTimer = Timer::sPool.Get(*this, i);
@@ -374,6 +382,7 @@ void Layer::CancelTimer(Layer::TimerCompleteFunct aOnComplete, void * aAppState)
             break;
         }
     }
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
 }
 
 /**
@@ -460,6 +469,23 @@ bool Layer::GetTimeout(struct timeval & aSleepTime)
         static_cast<uint32_t>(aSleepTime.tv_usec) / 1000;
 
     bool anyTimer = false;
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    const Timer * lEarliest = mTimerHeap.Earliest();
+
+    if (lEarliest != nullptr)
+    {
+        anyTimer = true;
+
+        if (!Timer::IsEarlier(kCurrentTime, lEarliest->mAwakenTime))
+        {
+            lAwakenTime = kCurrentTime;
+        }
+        else if (Timer::IsEarlier(lEarliest->mAwakenTime, lAwakenTime))
+        {
+            lAwakenTime = lEarliest->mAwakenTime;
+        }
+    }
+#else  // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
     for (size_t i = 0; i < Timer::sPool.Size(); i++)
     {
         Timer * lTimer = Timer::sPool.Get(*this, i);
@@ -478,6 +504,7 @@ bool Layer::GetTimeout(struct timeval & aSleepTime)
                 lAwakenTime = lTimer->mAwakenTime;
         }
     }
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
 
     // check for an earlier callback timer, too
     if (lAwakenTime != kCurrentTime)
@@ -507,6 +534,22 @@ void Layer::HandleTimeout()
 
     const Clock::MonotonicMilliseconds kCurrentTime = Clock::GetMonotonicMilliseconds();
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    // Only expire timers that were armed before this pass started, so that callbacks re-arming zero-delay timers
+    // cannot starve the rest of the event loop. Because equal deadlines are ordered by arming sequence, every such
+    // timer that is due sits ahead of any timer armed during the pass.
+    const uint32_t kPassEnd = mTimerHeap.NextSequence();
+
+    for (Timer * lTimer = mTimerHeap.Earliest(); lTimer != nullptr; lTimer = mTimerHeap.Earliest())
+    {
+        if (Timer::IsEarlier(kCurrentTime, lTimer->mAwakenTime) || !TimerHeap::IsSequenceBefore(lTimer->mSequence, kPassEnd))
+        {
+            break;
+        }
+
+        lTimer->HandleComplete();
+    }
+#else  // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
     for (size_t i = 0; i < Timer::sPool.Size(); i++)
     {
         Timer * lTimer = Timer::sPool.Get(*this, i);
@@ -516,6 +559,7 @@ void Layer::HandleTimeout()
             lTimer->HandleComplete();
         }
     }
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
 
     DispatchTimerCallbacks(kCurrentTime);
 
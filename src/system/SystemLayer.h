@@ -36,6 +36,7 @@
 #include <system/SystemEvent.h>
 #include <system/SystemObject.h>
 #include <system/SystemTimer.h>
+#include <system/SystemTimerHeap.h>
 
 // Include dependent headers
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS
@@ -182,6 +183,10 @@ private:
     bool mTimerComplete;
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    TimerHeap mTimerHeap;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
     WatchableEventManager mWatchableEvents;
     WakeEvent mWakeEvent;
@@ -59,6 +59,10 @@
 #include <support/CHIPMem.h>
 #endif
 
+#if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_SLAB
+#include <system/SystemPacketBufferSlab.h>
+#endif
+
 namespace chip {
 namespace System {
 
@@ -164,6 +168,50 @@ void PacketBufferHandle::InternalRightSize()
     mBuffer = newBuffer;
 }
 
+#elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_SLAB
+//
+// Slab allocation for PacketBuffer objects.
+//
+
+void PacketBufferHandle::InternalRightSize()
+{
+    // Require a single buffer with no other references.
+    if ((mBuffer == nullptr) || mBuffer->HasChainedBuffer() || (mBuffer->ref != 1))
+    {
+        return;
+    }
+
+    // Move only if the contents fit a smaller size class.
+    uint8_t * const start   = reinterpret_cast<uint8_t *>(mBuffer) + PacketBuffer::kStructureSize;
+    uint8_t * const payload = reinterpret_cast<uint8_t *>(mBuffer->payload);
+    const uint16_t usedSize = static_cast<uint16_t>(payload - start + mBuffer->len);
+
+    const Stats::PacketBufferSizeClass sizeClass = PacketBufferSlabAllocator::SizeClassFor(usedSize);
+    if (PacketBufferSlabAllocator::Capacity(sizeClass) >= mBuffer->alloc_size)
+    {
+        return;
+    }
+
+    PacketBuffer * newBuffer = PacketBufferSlabAllocator::Allocate(sizeClass);
+    if (newBuffer == nullptr)
+    {
+        ChipLogError(chipSystemLayer, "PacketBuffer: pool EMPTY.");
+        return;
+    }
+    SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
+
+    uint8_t * const newStart = reinterpret_cast<uint8_t *>(newBuffer) + PacketBuffer::kStructureSize;
+    newBuffer->next          = nullptr;
+    newBuffer->payload       = newStart + (payload - start);
+    newBuffer->tot_len       = mBuffer->tot_len;
+    newBuffer->len           = mBuffer->len;
+    newBuffer->ref           = 1;
+    memcpy(newStart, start, usedSize);
+
+    PacketBuffer::Free(mBuffer);
+    mBuffer = newBuffer;
+}
+
 #elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_LWIP_CUSTOM
 
 void PacketBufferHandle::InternalRightSize()
@@ -490,6 +538,17 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
     lPacket = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(lBlockSize));
     SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 
+#elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_SLAB
+
+    static_cast<void>(lBlockSize);
+
+    // Sets alloc_size to the capacity of the chosen size class, which may exceed lAllocSize.
+    lPacket = PacketBufferSlabAllocator::Allocate(PacketBufferSlabAllocator::SizeClassFor(lAllocSize));
+    if (lPacket != nullptr)
+    {
+        SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
+    }
+
 #else
 #error "Unimplemented CHIP_SYSTEM_PACKETBUFFER_STORE case"
 #endif // CHIP_SYSTEM_PACKETBUFFER_STORE
@@ -552,7 +611,8 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
     }
 
 #elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_POOL ||                                                \
-    CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
+    CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP ||                                                  \
+    CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_SLAB
 
     LOCK_BUF_POOL();
 
@@ -575,6 +635,8 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
             sFreeList     = aPacket;
 #elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
             chip::Platform::MemoryFree(aPacket);
+#elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_SLAB
+            PacketBufferSlabAllocator::Release(aPacket);
 #endif // CHIP_SYSTEM_PACKETBUFFER_STORE
             aPacket       = lNextPacket;
         }
@@ -58,6 +58,7 @@ class PacketBufferTest;
 #define CHIP_SYSTEM_PACKETBUFFER_STORE_LWIP_CUSTOM 2 //   Custom lwIP allocation
 #define CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_POOL 3   //   Internal fixed pool
 #define CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP 4   //   Platform::MemoryAlloc
+#define CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_SLAB 5   //   Size-classed slabs from Platform::MemoryAlloc
 
 #undef CHIP_SYSTEM_PACKETBUFFER_HAS_RIGHT_SIZE // True if RightSize() has a nontrivial implementation
 #undef CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK      // True if Check() has a nontrivial implementation
@@ -76,6 +77,10 @@ class PacketBufferTest;
 #define CHIP_SYSTEM_PACKETBUFFER_STORE CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_POOL
 #define CHIP_SYSTEM_PACKETBUFFER_HAS_RIGHT_SIZE 0
 #define CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK 0
+#elif CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+#define CHIP_SYSTEM_PACKETBUFFER_STORE CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_SLAB
+#define CHIP_SYSTEM_PACKETBUFFER_HAS_RIGHT_SIZE 1
+#define CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK 0
 #else
 #define CHIP_SYSTEM_PACKETBUFFER_STORE CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
 #define CHIP_SYSTEM_PACKETBUFFER_HAS_RIGHT_SIZE 1
@@ -87,6 +92,7 @@ namespace chip {
 namespace System {
 
 class PacketBufferHandle;
+class PacketBufferSlabAllocator;
 
 #if !CHIP_SYSTEM_CONFIG_USE_LWIP
 struct pbuf
@@ -96,7 +102,8 @@ struct pbuf
     uint16_t tot_len;
     uint16_t len;
     uint16_t ref;
-#if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
+#if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP ||                                                  \
+    CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_SLAB
     uint16_t alloc_size;
 #endif
 };
@@ -175,7 +182,8 @@ public:
 #if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_LWIP_POOL ||                                                  \
     CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_POOL
         return kMaxSizeWithoutReserve;
-#elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
+#elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP ||                                                \
+    CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_SLAB
         return this->alloc_size;
 #elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_LWIP_CUSTOM
         // Temporary workaround for custom pbufs by assuming size to be PBUF_POOL_BUFSIZE
@@ -407,6 +415,7 @@ private:
     void SetDataLength(uint16_t aNewLen, PacketBuffer * aChainHead);
 
     friend class PacketBufferHandle;
+    friend class PacketBufferSlabAllocator;
     friend class ::PacketBufferTest;
 };
 
@@ -0,0 +1,394 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the chip::System::PacketBufferSlabAllocator class.
+ */
+
+// Include module header
+#include <system/SystemPacketBufferSlab.h>
+
+#if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_SLAB
+
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <system/SystemMutex.h>
+
+namespace chip {
+namespace System {
+
+static_assert(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE < CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MEDIUM_SIZE &&
+                  CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MEDIUM_SIZE < PacketBuffer::kMaxSizeWithoutReserve,
+              "Packet buffer size classes must be strictly increasing");
+
+const uint16_t PacketBufferSlabAllocator::kCapacities[kNumSizeClasses] = {
+    CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE,
+    CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MEDIUM_SIZE,
+    PacketBuffer::kMaxSizeWithoutReserve,
+};
+
+namespace {
+
+// Free blocks are linked through their first word.
+struct FreeBlock
+{
+    FreeBlock * mNext;
+};
+
+// Header at the start of each slab. Slabs with free blocks are linked into their size class's list.
+struct Slab
+{
+    Slab * mPrev;
+    Slab * mNext;
+    FreeBlock * mFreeList;
+    size_t mFreeCount;
+    size_t mBlockCount;
+};
+
+struct SizeClassSlabs
+{
+    Slab * mHead;       ///< Slabs with blocks in use come first, so that empty slabs stay empty and can be freed.
+    Slab * mTail;       ///< Last slab with free blocks.
+    size_t mEmptyCount; ///< Slabs in the list without any block in use; at most one is kept.
+};
+
+SizeClassSlabs sSlabs[PacketBufferSlabAllocator::kNumSizeClasses];
+
+// Each block starts with a pointer to its slab, followed by the PacketBuffer.
+constexpr size_t kBlockHeaderSize = sizeof(Slab *);
+
+static_assert(sizeof(Slab) % alignof(void *) == 0, "Slab headers must keep blocks pointer-aligned");
+
+Slab *& SlabOf(FreeBlock * aBlock)
+{
+    return reinterpret_cast<Slab **>(aBlock)[-1];
+}
+
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+Mutex sSlabMutex;
+
+bool InitSlabMutex()
+{
+    Mutex::Init(sSlabMutex);
+    return true;
+}
+
+const bool sSlabMutexInitialized = InitSlabMutex();
+
+#define LOCK_SLABS()                                                                                                               \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        sSlabMutex.Lock();                                                                                                         \
+    } while (0)
+#define UNLOCK_SLABS()                                                                                                             \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        sSlabMutex.Unlock();                                                                                                       \
+    } while (0)
+#else // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+#define LOCK_SLABS()                                                                                                               \
+    do                                                                                                                             \
+    {                                                                                                                              \
+    } while (0)
+#define UNLOCK_SLABS()                                                                                                             \
+    do                                                                                                                             \
+    {                                                                                                                              \
+    } while (0)
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+
+void LinkFront(SizeClassSlabs & aSlabs, Slab * aSlab)
+{
+    aSlab->mPrev = nullptr;
+    aSlab->mNext = aSlabs.mHead;
+    if (aSlabs.mHead != nullptr)
+    {
+        aSlabs.mHead->mPrev = aSlab;
+    }
+    else
+    {
+        aSlabs.mTail = aSlab;
+    }
+    aSlabs.mHead = aSlab;
+}
+
+void LinkBack(SizeClassSlabs & aSlabs, Slab * aSlab)
+{
+    aSlab->mPrev = aSlabs.mTail;
+    aSlab->mNext = nullptr;
+    if (aSlabs.mTail != nullptr)
+    {
+        aSlabs.mTail->mNext = aSlab;
+    }
+    else
+    {
+        aSlabs.mHead = aSlab;
+    }
+    aSlabs.mTail = aSlab;
+}
+
+void Unlink(SizeClassSlabs & aSlabs, Slab * aSlab)
+{
+    (aSlab->mPrev != nullptr ? aSlab->mPrev->mNext : aSlabs.mHead) = aSlab->mNext;
+    (aSlab->mNext != nullptr ? aSlab->mNext->mPrev : aSlabs.mTail) = aSlab->mPrev;
+}
+
+/**
+ *  Add one empty slab of blocks to a size class. Must be called with the slab lock held.
+ */
+bool Grow(Stats::PacketBufferSizeClass aClass, size_t aStride)
+{
+    constexpr size_t kSlabSize = CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SIZE;
+
+    size_t lCount = kSlabSize > sizeof(Slab) ? (kSlabSize - sizeof(Slab)) / aStride : 0;
+    if (lCount == 0)
+    {
+        lCount = 1;
+    }
+
+    Slab * const lSlab = static_cast<Slab *>(chip::Platform::MemoryAlloc(sizeof(Slab) + lCount * aStride));
+    if (lSlab == nullptr)
+    {
+        return false;
+    }
+
+    uint8_t * const lBlocks = reinterpret_cast<uint8_t *>(lSlab + 1);
+    lSlab->mFreeList        = nullptr;
+    for (size_t i = lCount; i > 0; i--)
+    {
+        FreeBlock * const lBlock = reinterpret_cast<FreeBlock *>(lBlocks + (i - 1) * aStride + kBlockHeaderSize);
+        SlabOf(lBlock)           = lSlab;
+        lBlock->mNext            = lSlab->mFreeList;
+        lSlab->mFreeList         = lBlock;
+    }
+    lSlab->mFreeCount  = lCount;
+    lSlab->mBlockCount = lCount;
+
+    LinkFront(sSlabs[aClass], lSlab);
+    sSlabs[aClass].mEmptyCount++;
+
+    SYSTEM_STATS_PACKETBUFFER_CLASS_RESERVE(aClass, lCount);
+    return true;
+}
+
+/**
+ *  Take a free block of a size class from its slabs, growing them if needed. Must be called with the slab lock held.
+ */
+FreeBlock * TakeBlock(Stats::PacketBufferSizeClass aClass, size_t aStride)
+{
+    SizeClassSlabs & lSlabs = sSlabs[aClass];
+    if (lSlabs.mHead == nullptr && !Grow(aClass, aStride))
+    {
+        return nullptr;
+    }
+
+    Slab * const lSlab = lSlabs.mHead;
+    if (lSlab->mFreeCount == lSlab->mBlockCount)
+    {
+        lSlabs.mEmptyCount--;
+    }
+
+    FreeBlock * const lBlock = lSlab->mFreeList;
+    lSlab->mFreeList         = lBlock->mNext;
+    if (--lSlab->mFreeCount == 0)
+    {
+        Unlink(lSlabs, lSlab);
+    }
+    return lBlock;
+}
+
+/**
+ *  Return a block to its slab. A slab left without any block in use is kept at the back of the list if it is the only
+ *  one, so that a class hovering around a slab boundary does not hit the heap on every allocation; otherwise it is freed.
+ *  Must be called with the slab lock held.
+ */
+void PutBlock(Stats::PacketBufferSizeClass aClass, FreeBlock * aBlock)
+{
+    SizeClassSlabs & lSlabs = sSlabs[aClass];
+    Slab * const lSlab      = SlabOf(aBlock);
+
+    aBlock->mNext    = lSlab->mFreeList;
+    lSlab->mFreeList = aBlock;
+    if (lSlab->mFreeCount++ == 0)
+    {
+        LinkFront(lSlabs, lSlab);
+    }
+    if (lSlab->mFreeCount < lSlab->mBlockCount)
+    {
+        return;
+    }
+
+    Unlink(lSlabs, lSlab);
+    if (lSlabs.mEmptyCount == 0)
+    {
+        LinkBack(lSlabs, lSlab);
+        lSlabs.mEmptyCount++;
+        return;
+    }
+
+    SYSTEM_STATS_PACKETBUFFER_CLASS_UNRESERVE(aClass, lSlab->mBlockCount);
+    chip::Platform::MemoryFree(lSlab);
+}
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE
+
+// Number of blocks moved between a thread cache and the shared slabs at a time.
+constexpr size_t kTransferCount = (CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE + 1) / 2;
+
+struct ThreadCache
+{
+    FreeBlock * mHeads[PacketBufferSlabAllocator::kNumSizeClasses];
+    size_t mCounts[PacketBufferSlabAllocator::kNumSizeClasses];
+
+    ~ThreadCache()
+    {
+        // Hand the blocks of an exiting thread back to their slabs.
+        for (size_t lClass = 0; lClass < PacketBufferSlabAllocator::kNumSizeClasses; lClass++)
+        {
+            MoveToShared(lClass, mCounts[lClass]);
+        }
+    }
+
+    void MoveToShared(size_t aClass, size_t aCount)
+    {
+        LOCK_SLABS();
+        for (; aCount > 0 && mHeads[aClass] != nullptr; aCount--)
+        {
+            FreeBlock * const lBlock = mHeads[aClass];
+            mHeads[aClass]           = lBlock->mNext;
+            mCounts[aClass]--;
+            PutBlock(static_cast<Stats::PacketBufferSizeClass>(aClass), lBlock);
+        }
+        UNLOCK_SLABS();
+    }
+
+    void MoveFromShared(Stats::PacketBufferSizeClass aClass, size_t aStride)
+    {
+        LOCK_SLABS();
+        for (size_t i = 0; i < kTransferCount; i++)
+        {
+            // Only the first block may grow the class; the rest take what is already free.
+            if (i > 0 && sSlabs[aClass].mHead == nullptr)
+            {
+                break;
+            }
+            FreeBlock * const lBlock = TakeBlock(aClass, aStride);
+            if (lBlock == nullptr)
+            {
+                break;
+            }
+            lBlock->mNext  = mHeads[aClass];
+            mHeads[aClass] = lBlock;
+            mCounts[aClass]++;
+        }
+        UNLOCK_SLABS();
+    }
+};
+
+thread_local ThreadCache sThreadCache;
+
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE
+
+} // anonymous namespace
+
+size_t PacketBufferSlabAllocator::BlockStride(Stats::PacketBufferSizeClass aClass)
+{
+    // Blocks are kept pointer-aligned so that the slab pointer and the pbuf header at the start of each one are.
+    constexpr size_t kBlockAlignment = alignof(void *);
+
+    const size_t lSize = kBlockHeaderSize + PacketBuffer::kStructureSize + kCapacities[aClass];
+    return (lSize + kBlockAlignment - 1) & ~(kBlockAlignment - 1);
+}
+
+Stats::PacketBufferSizeClass PacketBufferSlabAllocator::SizeClassFor(size_t aAllocSize)
+{
+    if (aAllocSize <= kCapacities[Stats::kSystemLayer_PacketBufferSmall])
+    {
+        return Stats::kSystemLayer_PacketBufferSmall;
+    }
+    if (aAllocSize <= kCapacities[Stats::kSystemLayer_PacketBufferMedium])
+    {
+        return Stats::kSystemLayer_PacketBufferMedium;
+    }
+    return Stats::kSystemLayer_PacketBufferLarge;
+}
+
+PacketBuffer * PacketBufferSlabAllocator::Allocate(Stats::PacketBufferSizeClass aClass)
+{
+    FreeBlock * lBlock;
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE
+    ThreadCache & lCache = sThreadCache;
+    if (lCache.mHeads[aClass] == nullptr)
+    {
+        lCache.MoveFromShared(aClass, BlockStride(aClass));
+    }
+
+    lBlock = lCache.mHeads[aClass];
+    if (lBlock != nullptr)
+    {
+        lCache.mHeads[aClass] = lBlock->mNext;
+        lCache.mCounts[aClass]--;
+    }
+#else  // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE
+    LOCK_SLABS();
+    lBlock = TakeBlock(aClass, BlockStride(aClass));
+    UNLOCK_SLABS();
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE
+
+    if (lBlock == nullptr)
+    {
+        return nullptr;
+    }
+
+    SYSTEM_STATS_PACKETBUFFER_CLASS_ALLOC(aClass);
+
+    PacketBuffer * const lBuffer = reinterpret_cast<PacketBuffer *>(lBlock);
+    lBuffer->alloc_size          = kCapacities[aClass];
+    return lBuffer;
+}
+
+void PacketBufferSlabAllocator::Release(PacketBuffer * aBuffer)
+{
+    const Stats::PacketBufferSizeClass lClass = SizeClassFor(aBuffer->alloc_size);
+    VerifyOrDieWithMsg(aBuffer->alloc_size == kCapacities[lClass], chipSystemLayer, "PacketBuffer: bad slab block size %u",
+                       aBuffer->alloc_size);
+
+    SYSTEM_STATS_PACKETBUFFER_CLASS_FREE(lClass);
+
+    FreeBlock * const lBlock = reinterpret_cast<FreeBlock *>(aBuffer);
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE
+    ThreadCache & lCache = sThreadCache;
+    if (lCache.mCounts[lClass] >= CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE)
+    {
+        lCache.MoveToShared(lClass, kTransferCount);
+    }
+    lBlock->mNext         = lCache.mHeads[lClass];
+    lCache.mHeads[lClass] = lBlock;
+    lCache.mCounts[lClass]++;
+#else  // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE
+    LOCK_SLABS();
+    PutBlock(lClass, lBlock);
+    UNLOCK_SLABS();
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE
+}
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_SLAB
@@ -0,0 +1,85 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the chip::System::PacketBufferSlabAllocator
+ *      class, the size-classed block allocator behind PacketBuffer when
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB is enabled.
+ */
+
+#pragma once
+
+#include <system/SystemPacketBuffer.h>
+
+#if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_SLAB
+
+#include <system/SystemStats.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * @class PacketBufferSlabAllocator
+ *
+ * @brief
+ *  Hands out PacketBuffer blocks of a few fixed capacities, carved from slabs obtained with chip::Platform::MemoryAlloc().
+ *
+ *  Each size class grows one slab at a time. Its slabs with free blocks are shared by all threads and protected by a mutex;
+ *  allocation prefers slabs that are already in use, and once every block of a slab is free again the slab is returned to
+ *  the heap, except for one empty slab per class kept to absorb bursts. With CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE
+ *  nonzero, every thread also holds up to that many free blocks per class, and moves half of them to or from the shared
+ *  slabs when its cache runs empty or full; a buffer may be released on a different thread than the one that allocated it.
+ *
+ *  A block's size class is recovered from the capacity recorded in its pbuf::alloc_size, and its slab from a pointer stored
+ *  just before the PacketBuffer.
+ */
+class PacketBufferSlabAllocator
+{
+public:
+    static constexpr size_t kNumSizeClasses = Stats::kNumPacketBufferSizeClasses;
+
+    /**
+     *  Returns the smallest size class able to hold @p aAllocSize bytes of reserve and data. @p aAllocSize must not exceed
+     *  PacketBuffer::kMaxSizeWithoutReserve.
+     */
+    static Stats::PacketBufferSizeClass SizeClassFor(size_t aAllocSize);
+
+    /** Returns the data capacity, including reserve, of blocks in @p aClass. */
+    static uint16_t Capacity(Stats::PacketBufferSizeClass aClass) { return kCapacities[aClass]; }
+
+    /**
+     *  Returns an uninitialized block of @p aClass with only alloc_size set, or nullptr if the heap is exhausted.
+     */
+    static PacketBuffer * Allocate(Stats::PacketBufferSizeClass aClass);
+
+    /** Returns a block obtained from Allocate() to its size class. */
+    static void Release(PacketBuffer * aBuffer);
+
+private:
+    static size_t BlockStride(Stats::PacketBufferSizeClass aClass);
+
+    static const uint16_t kCapacities[kNumSizeClasses];
+};
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_SLAB
@@ -50,8 +50,11 @@ inline int SetNonBlockingMode(int fd)
 }
 } // anonymous namespace
 
-CHIP_ERROR WakeEvent::Open(WatchableEventManager & watchState)
+CHIP_ERROR WakeEvent::Open(WatchableEventManager & watchState, Handler handler, intptr_t context)
 {
+    mHandler        = handler;
+    mHandlerContext = context;
+
     enum
     {
         FD_READ  = 0,
@@ -124,8 +127,11 @@ CHIP_ERROR WakeEvent::Notify()
 
 #else // CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE
 
-CHIP_ERROR WakeEvent::Open(WatchableEventManager & watchState)
+CHIP_ERROR WakeEvent::Open(WatchableEventManager & watchState, Handler handler, intptr_t context)
 {
+    mHandler        = handler;
+    mHandlerContext = context;
+
     mFD.Init(watchState);
 
     const int fd = ::eventfd(0, 0);
@@ -177,6 +183,17 @@ CHIP_ERROR WakeEvent::Notify()
 
 #endif // CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE
 
+void WakeEvent::Confirm(WatchableSocket & socket)
+{
+    WakeEvent * const event = reinterpret_cast<WakeEvent *>(socket.GetCallbackData());
+
+    event->Confirm();
+    if (event->mHandler != nullptr)
+    {
+        event->mHandler(event->mHandlerContext);
+    }
+}
+
 } // namespace System
 } // namespace chip
 
@@ -318,20 +318,31 @@ namespace System {
 class WakeEvent
 {
 public:
-    CHIP_ERROR Open(WatchableEventManager & watchState); /**< Initialize the pipeline */
-    CHIP_ERROR Close();                                  /**< Close both ends of the pipeline. */
+    /**
+     * Function called on the event loop thread after a notification has been confirmed.
+     */
+    using Handler = void (*)(intptr_t context);
+
+    /**
+     * Initialize the pipeline. If @p handler is not null, it is called with @p context each time the event loop consumes
+     * notifications, which lets other threads hand work to the event loop thread.
+     */
+    CHIP_ERROR Open(WatchableEventManager & watchState, Handler handler = nullptr, intptr_t context = 0);
+    CHIP_ERROR Close(); /**< Close both ends of the pipeline. */
 
     int GetNotifFD() const { return mFD.GetFD(); }
 
     CHIP_ERROR Notify(); /**< Set the event. */
     void Confirm();      /**< Clear the event. */
-    static void Confirm(WatchableSocket & socket) { reinterpret_cast<WakeEvent *>(socket.GetCallbackData())->Confirm(); }
+    static void Confirm(WatchableSocket & socket);
 
 private:
 #if CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE
     int mWriteFD;
 #endif
     WatchableSocket mFD;
+    Handler mHandler;
+    intptr_t mHandlerContext;
 };
 
 } // namespace System
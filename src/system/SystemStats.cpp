@@ -35,6 +35,10 @@
 
 #include <string.h>
 
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+#include <atomic>
+#endif
+
 namespace chip {
 namespace System {
 namespace Stats {
@@ -64,9 +68,28 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
     "ExchangeMgr_NumBindings",        "MessageLayer_NumConnectionsInUse",
 };
 
+static const Label sBatchHistogramStrings[kNumBatchHistograms] = {
+    "InetLayer_DatagramRecvBatch",
+    "InetLayer_DatagramSendBatch",
+};
+
+static const Label sPacketBufferClassStrings[kNumPacketBufferSizeClasses] = {
+    "SystemLayer_PacketBufferSmall",
+    "SystemLayer_PacketBufferMedium",
+    "SystemLayer_PacketBufferLarge",
+};
+
 count_t sResourcesInUse[kNumEntries];
 count_t sHighWatermarks[kNumEntries];
 
+static batch_count_t sBatchSizeHistograms[kNumBatchHistograms][kNumBatchSizeBuckets];
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+static std::atomic<pool_count_t> sPacketBufferClassInUse[kNumPacketBufferSizeClasses];
+static std::atomic<pool_count_t> sPacketBufferClassHighWatermarks[kNumPacketBufferSizeClasses];
+static std::atomic<pool_count_t> sPacketBufferClassReserved[kNumPacketBufferSizeClasses];
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+
 const Label * GetStrings()
 {
     return sStatsStrings;
@@ -82,6 +105,103 @@ count_t * GetHighWatermarks()
     return sHighWatermarks;
 }
 
+void RecordBatchSize(BatchHistogram aHistogram, size_t aBatchSize)
+{
+    if (aBatchSize == 0)
+    {
+        return;
+    }
+
+    unsigned int lBucket = 0;
+    while (lBucket + 1 < kNumBatchSizeBuckets && (aBatchSize >> (lBucket + 1)) != 0)
+    {
+        lBucket++;
+    }
+
+    batch_count_t & lCount = sBatchSizeHistograms[aHistogram][lBucket];
+    if (lCount < UINT32_MAX)
+    {
+        lCount++;
+    }
+}
+
+const batch_count_t * GetBatchSizeHistogram(BatchHistogram aHistogram)
+{
+    return sBatchSizeHistograms[aHistogram];
+}
+
+void ResetBatchSizeHistograms()
+{
+    memset(sBatchSizeHistograms, 0, sizeof(sBatchSizeHistograms));
+}
+
+const Label * GetBatchHistogramStrings()
+{
+    return sBatchHistogramStrings;
+}
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+
+void RecordPacketBufferClassAlloc(PacketBufferSizeClass aClass)
+{
+    const pool_count_t lInUse = sPacketBufferClassInUse[aClass].fetch_add(1, std::memory_order_relaxed) + 1;
+
+    pool_count_t lHighWatermark = sPacketBufferClassHighWatermarks[aClass].load(std::memory_order_relaxed);
+    while (lHighWatermark < lInUse &&
+           !sPacketBufferClassHighWatermarks[aClass].compare_exchange_weak(lHighWatermark, lInUse, std::memory_order_relaxed))
+    {
+    }
+}
+
+void RecordPacketBufferClassFree(PacketBufferSizeClass aClass)
+{
+    sPacketBufferClassInUse[aClass].fetch_sub(1, std::memory_order_relaxed);
+}
+
+void RecordPacketBufferClassReserve(PacketBufferSizeClass aClass, size_t aCount)
+{
+    sPacketBufferClassReserved[aClass].fetch_add(static_cast<pool_count_t>(aCount), std::memory_order_relaxed);
+}
+
+void RecordPacketBufferClassUnreserve(PacketBufferSizeClass aClass, size_t aCount)
+{
+    sPacketBufferClassReserved[aClass].fetch_sub(static_cast<pool_count_t>(aCount), std::memory_order_relaxed);
+}
+
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+
+void GetPacketBufferClassUsage(PacketBufferSizeClass aClass, PoolUsage & aUsage)
+{
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+    aUsage.mInUse         = sPacketBufferClassInUse[aClass].load(std::memory_order_relaxed);
+    aUsage.mHighWatermark = sPacketBufferClassHighWatermarks[aClass].load(std::memory_order_relaxed);
+    aUsage.mReserved      = sPacketBufferClassReserved[aClass].load(std::memory_order_relaxed);
+#else  // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+    aUsage.mInUse         = 0;
+    aUsage.mHighWatermark = 0;
+    aUsage.mReserved      = 0;
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+}
+
+/**
+ *  Restart high-water-mark tracking for every size class from the current number of blocks in use.
+ */
+void ResetPacketBufferClassHighWatermarks()
+{
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+    for (int i = 0; i < kNumPacketBufferSizeClasses; i++)
+    {
+        sPacketBufferClassHighWatermarks[i].store(sPacketBufferClassInUse[i].load(std::memory_order_relaxed),
+                                                  std::memory_order_relaxed);
+    }
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+}
+
+const Label * GetPacketBufferClassStrings()
+{
+    return sPacketBufferClassStrings;
+}
+
 void UpdateSnapshot(Snapshot & aSnapshot)
 {
     memcpy(&aSnapshot.mResourcesInUse, &sResourcesInUse, sizeof(aSnapshot.mResourcesInUse));
@@ -42,6 +42,7 @@
 #include <lwip/pbuf.h>
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace chip {
@@ -103,6 +104,62 @@ void UpdateLwipPbufCounts(void);
 typedef const char * Label;
 const Label * GetStrings();
 
+/**
+ *  Histograms of how many items were handled per batched operation (e.g. datagrams per recvmmsg() call).
+ *
+ *  Bucket i counts batches of 2^i to 2^(i+1) - 1 items; the last bucket also counts all larger batches.
+ */
+enum BatchHistogram
+{
+    kInetLayer_DatagramRecvBatch,
+    kInetLayer_DatagramSendBatch,
+    kNumBatchHistograms
+};
+
+constexpr unsigned int kNumBatchSizeBuckets = 6; // 1, 2-3, 4-7, 8-15, 16-31, 32+
+
+typedef uint32_t batch_count_t;
+
+void RecordBatchSize(BatchHistogram aHistogram, size_t aBatchSize);
+const batch_count_t * GetBatchSizeHistogram(BatchHistogram aHistogram);
+void ResetBatchSizeHistograms();
+const Label * GetBatchHistogramStrings();
+
+/**
+ *  Usage of each size class of the packet buffer slab allocator (see CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB); all zero when
+ *  the slab allocator is not in use.
+ *
+ *  These are kept apart from ResourcesInUse, whose counters are too narrow for a controller with thousands of buffers in
+ *  flight, and may be updated from any thread.
+ */
+enum PacketBufferSizeClass
+{
+    kSystemLayer_PacketBufferSmall,
+    kSystemLayer_PacketBufferMedium,
+    kSystemLayer_PacketBufferLarge,
+    kNumPacketBufferSizeClasses
+};
+
+typedef uint32_t pool_count_t;
+
+struct PoolUsage
+{
+    pool_count_t mInUse;         ///< Blocks currently holding a packet buffer.
+    pool_count_t mHighWatermark; ///< Largest value of mInUse since startup or the last reset.
+    pool_count_t mReserved;      ///< Blocks currently held from the heap, whether in use or free.
+};
+
+void GetPacketBufferClassUsage(PacketBufferSizeClass aClass, PoolUsage & aUsage);
+void ResetPacketBufferClassHighWatermarks();
+const Label * GetPacketBufferClassStrings();
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+void RecordPacketBufferClassAlloc(PacketBufferSizeClass aClass);
+void RecordPacketBufferClassFree(PacketBufferSizeClass aClass);
+void RecordPacketBufferClassReserve(PacketBufferSizeClass aClass, size_t aCount);
+void RecordPacketBufferClassUnreserve(PacketBufferSizeClass aClass, size_t aCount);
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+
 } // namespace Stats
 } // namespace System
 } // namespace chip
@@ -147,6 +204,36 @@ const Label * GetStrings();
         chip::System::Stats::GetResourcesInUse()[entry] = 0;                                                                       \
     } while (0);
 
+#define SYSTEM_STATS_RECORD_BATCH_SIZE(histogram, size)                                                                            \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        chip::System::Stats::RecordBatchSize(histogram, size);                                                                     \
+    } while (0);
+
+#define SYSTEM_STATS_PACKETBUFFER_CLASS_ALLOC(sizeClass)                                                                           \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        chip::System::Stats::RecordPacketBufferClassAlloc(sizeClass);                                                              \
+    } while (0);
+
+#define SYSTEM_STATS_PACKETBUFFER_CLASS_FREE(sizeClass)                                                                            \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        chip::System::Stats::RecordPacketBufferClassFree(sizeClass);                                                               \
+    } while (0);
+
+#define SYSTEM_STATS_PACKETBUFFER_CLASS_RESERVE(sizeClass, count)                                                                  \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        chip::System::Stats::RecordPacketBufferClassReserve(sizeClass, count);                                                     \
+    } while (0);
+
+#define SYSTEM_STATS_PACKETBUFFER_CLASS_UNRESERVE(sizeClass, count)                                                                \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        chip::System::Stats::RecordPacketBufferClassUnreserve(sizeClass, count);                                                   \
+    } while (0);
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP && LWIP_STATS && MEMP_STATS
 #define SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS()                                                                                     \
     do                                                                                                                             \
@@ -167,6 +254,16 @@ const Label * GetStrings();
 
 #define SYSTEM_STATS_RESET(entry)
 
+#define SYSTEM_STATS_RECORD_BATCH_SIZE(histogram, size)
+
+#define SYSTEM_STATS_PACKETBUFFER_CLASS_ALLOC(sizeClass)
+
+#define SYSTEM_STATS_PACKETBUFFER_CLASS_FREE(sizeClass)
+
+#define SYSTEM_STATS_PACKETBUFFER_CLASS_RESERVE(sizeClass, count)
+
+#define SYSTEM_STATS_PACKETBUFFER_CLASS_UNRESERVE(sizeClass, count)
+
 #define SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS()
 
 #endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
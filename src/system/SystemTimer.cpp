@@ -184,6 +184,10 @@ CHIP_ERROR Timer::Start(uint32_t aDelayMilliseconds, OnCompleteFunct aOnComplete
     }
 #endif // CHIP_SYSTEM_CONFIG_USE_DISPATCH
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    lLayer.mTimerHeap.Insert(*this);
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
 #if CHIP_SYSTEM_CONFIG_USE_IO_THREAD
     lLayer.WakeIOThread();
 #endif // CHIP_SYSTEM_CONFIG_USE_IO_THREAD
@@ -220,6 +224,9 @@ CHIP_ERROR Timer::ScheduleWork(OnCompleteFunct aOnComplete, void * aAppState)
     else
     {
 #endif // CHIP_SYSTEM_CONFIG_USE_DISPATCH
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+        lLayer.mTimerHeap.Insert(*this);
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
         lLayer.WakeIOThread();
 #if CHIP_SYSTEM_CONFIG_USE_DISPATCH
     }
@@ -236,9 +243,9 @@ CHIP_ERROR Timer::ScheduleWork(OnCompleteFunct aOnComplete, void * aAppState)
  */
 CHIP_ERROR Timer::Cancel()
 {
-#if CHIP_SYSTEM_CONFIG_USE_LWIP
+#if CHIP_SYSTEM_CONFIG_USE_LWIP || CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
     Layer & lLayer = this->SystemLayer();
-#endif // CHIP_SYSTEM_CONFIG_USE_LWIP
+#endif // CHIP_SYSTEM_CONFIG_USE_LWIP || CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
     OnCompleteFunct lOnComplete = this->OnComplete;
 
     // Check if the timer is armed
@@ -246,6 +253,10 @@ CHIP_ERROR Timer::Cancel()
     // Atomically disarm if the value has not changed
     VerifyOrExit(__sync_bool_compare_and_swap(&this->OnComplete, lOnComplete, nullptr), );
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    lLayer.mTimerHeap.Remove(*this, lOnComplete, this->AppState);
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
     // Since this thread changed the state of OnComplete, release the timer.
     this->AppState = nullptr;
 
@@ -304,6 +315,10 @@ void Timer::HandleComplete()
     // Atomically disarm if the value has not changed.
     VerifyOrExit(__sync_bool_compare_and_swap(&this->OnComplete, lOnComplete, nullptr), );
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    lLayer.mTimerHeap.Remove(*this, lOnComplete, lAppState);
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
     // Since this thread changed the state of OnComplete, release the timer.
     AppState = nullptr;
     this->Release();
@@ -57,6 +57,9 @@ class Layer;
 class DLL_EXPORT Timer : public Object
 {
     friend class Layer;
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    friend class TimerHeap;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
 
 public:
     static bool IsEarlier(const Clock::MonotonicMilliseconds & first, const Clock::MonotonicMilliseconds & second);
@@ -88,6 +91,12 @@ private:
     dispatch_source_t mTimerSource = nullptr;
 #endif // CHIP_SYSTEM_CONFIG_USE_DISPATCH
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    size_t mHeapIndex;     ///< Position in the layer's TimerHeap while armed.
+    uint32_t mSequence;    ///< Arming order, used to order timers with equal awaken times.
+    Timer * mNextInBucket; ///< Chain in the TimerHeap (OnComplete, AppState) index.
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
     // Not defined
     Timer(const Timer &) = delete;
     Timer & operator=(const Timer &) = delete;
@@ -0,0 +1,107 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the chip::System::TimerHeap class.
+ */
+
+// Include module header
+#include <system/SystemTimerHeap.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
+#include <support/CodeUtils.h>
+#include <support/HashUtils.h>
+
+namespace chip {
+namespace System {
+
+TimerHeap::TimerHeap() : mNextSequence(0)
+{
+    for (size_t i = 0; i < kNumBuckets; i++)
+    {
+        mBuckets[i] = nullptr;
+    }
+}
+
+size_t TimerHeap::BucketFor(Timer::OnCompleteFunct aOnComplete, void * aAppState)
+{
+    const uint64_t lKey = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(aOnComplete)) * UINT64_C(0x9e3779b97f4a7c15) ^
+        static_cast<uint64_t>(reinterpret_cast<uintptr_t>(aAppState));
+
+    return static_cast<size_t>(MixBits64(lKey)) & (kNumBuckets - 1);
+}
+
+bool TimerHeap::HeapTraits::IsBefore(const Timer & aFirst, const Timer & aSecond)
+{
+    if (aFirst.mAwakenTime != aSecond.mAwakenTime)
+    {
+        return Timer::IsEarlier(aFirst.mAwakenTime, aSecond.mAwakenTime);
+    }
+    return IsSequenceBefore(aFirst.mSequence, aSecond.mSequence);
+}
+
+/**
+ *  Adds an armed timer. OnComplete, AppState and the awaken time must already be set.
+ */
+void TimerHeap::Insert(Timer & aTimer)
+{
+    aTimer.mSequence = mNextSequence++;
+    mHeap.Insert(aTimer);
+
+    const size_t lBucket = BucketFor(aTimer.OnComplete, aTimer.AppState);
+    aTimer.mNextInBucket = mBuckets[lBucket];
+    mBuckets[lBucket]    = &aTimer;
+}
+
+/**
+ *  Removes a timer previously added with Insert().
+ *
+ *  @param[in]  aOnComplete, aAppState  The values the timer was armed with; the caller may have already cleared them
+ *                                      on the timer itself while disarming it.
+ */
+void TimerHeap::Remove(Timer & aTimer, Timer::OnCompleteFunct aOnComplete, void * aAppState)
+{
+    Timer ** lLink = &mBuckets[BucketFor(aOnComplete, aAppState)];
+    while (*lLink != &aTimer)
+    {
+        VerifyOrDie(*lLink != nullptr);
+        lLink = &(*lLink)->mNextInBucket;
+    }
+    *lLink               = aTimer.mNextInBucket;
+    aTimer.mNextInBucket = nullptr;
+
+    mHeap.Remove(aTimer);
+}
+
+Timer * TimerHeap::Find(Timer::OnCompleteFunct aOnComplete, void * aAppState) const
+{
+    for (Timer * lTimer = mBuckets[BucketFor(aOnComplete, aAppState)]; lTimer != nullptr; lTimer = lTimer->mNextInBucket)
+    {
+        if (lTimer->OnComplete == aOnComplete && lTimer->AppState == aAppState)
+        {
+            return lTimer;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
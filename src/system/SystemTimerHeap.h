@@ -0,0 +1,109 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the chip::System::TimerHeap class, the
+ *      deadline-ordered set of armed timers used by the sockets build
+ *      when CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP is enabled.
+ */
+
+#pragma once
+
+// Include configuration headers
+#include <system/SystemConfig.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
+#include <support/IndexedMinHeap.h>
+#include <system/SystemTimer.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace System {
+
+namespace Internal {
+
+constexpr size_t RoundUpToPowerOfTwo(size_t aValue, size_t aResult = 1)
+{
+    return (aResult >= aValue) ? aResult : RoundUpToPowerOfTwo(aValue, aResult << 1);
+}
+
+} // namespace Internal
+
+/**
+ * @class TimerHeap
+ *
+ * @brief
+ *  Binary min-heap of armed timers ordered by (awaken time, arming sequence), plus a chained hash index keyed by
+ *  (OnComplete, AppState).
+ *
+ *  Each Timer records its own heap position, so removal of an arbitrary timer is O(log n) without searching. The
+ *  arming sequence number breaks ties between equal deadlines so that timers expire in the order they were armed,
+ *  and lets Layer::HandleTimeout() stop at timers armed by the callbacks it is running.
+ *
+ *  All methods must be called with the CHIP stack lock held.
+ */
+class TimerHeap
+{
+public:
+    TimerHeap();
+
+    void Insert(Timer & aTimer);
+    void Remove(Timer & aTimer, Timer::OnCompleteFunct aOnComplete, void * aAppState);
+
+    /** Returns the timer with the earliest deadline, or nullptr if no timer is armed. */
+    Timer * Earliest() const { return mHeap.Top(); }
+
+    /** Returns an armed timer started with @p aOnComplete and @p aAppState, or nullptr. */
+    Timer * Find(Timer::OnCompleteFunct aOnComplete, void * aAppState) const;
+
+    size_t Count() const { return mHeap.Count(); }
+
+    /** The sequence number that the next call to Insert() will assign. */
+    uint32_t NextSequence() const { return mNextSequence; }
+
+    /** True if @p aFirst was assigned before @p aSecond, accounting for wrap. */
+    static bool IsSequenceBefore(uint32_t aFirst, uint32_t aSecond)
+    {
+        return static_cast<int32_t>(aFirst - aSecond) < 0;
+    }
+
+private:
+    // Smallest power of two not less than the timer pool size; keeps hash chains at about one entry.
+    static constexpr size_t kNumBuckets = Internal::RoundUpToPowerOfTwo(CHIP_SYSTEM_CONFIG_NUM_TIMERS);
+
+    struct HeapTraits
+    {
+        static bool IsBefore(const Timer & aFirst, const Timer & aSecond);
+        static size_t GetPosition(const Timer & aTimer) { return aTimer.mHeapIndex; }
+        static void SetPosition(Timer & aTimer, size_t aIndex) { aTimer.mHeapIndex = aIndex; }
+    };
+
+    static size_t BucketFor(Timer::OnCompleteFunct aOnComplete, void * aAppState);
+
+    IndexedMinHeap<Timer, CHIP_SYSTEM_CONFIG_NUM_TIMERS, HeapTraits> mHeap;
+    Timer * mBuckets[kNumBuckets];
+    uint32_t mNextSequence;
+};
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
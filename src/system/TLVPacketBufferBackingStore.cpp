@@ -23,6 +23,7 @@
 
 #include <system/TLVPacketBufferBackingStore.h>
 
+#include <support/CodeUtils.h>
 #include <support/SafeInt.h>
 
 namespace chip {
@@ -71,16 +72,44 @@ CHIP_ERROR TLVPacketBufferBackingStore::FinalizeBuffer(chip::TLV::TLVWriter & wr
 {
     uint8_t * endPtr = bufStart + dataLen;
 
+    // A writer that rolled back to a checkpoint can be writing to a buffer before the last one it got.
+    if (mUseChainedBuffers && !IsInBuffer(mCurrentBuffer, bufStart))
+    {
+        for (mCurrentBuffer = mHeadBuffer.Retain(); !mCurrentBuffer.IsNull(); mCurrentBuffer.Advance())
+        {
+            if (IsInBuffer(mCurrentBuffer, bufStart))
+            {
+                break;
+            }
+        }
+        VerifyOrReturnError(!mCurrentBuffer.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
     intptr_t length = endPtr - mCurrentBuffer->Start();
     if (!CanCastTo<uint16_t>(length))
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-    mCurrentBuffer->SetDataLength(static_cast<uint16_t>(length));
+    mCurrentBuffer->SetDataLength(static_cast<uint16_t>(length), mHeadBuffer);
+
+    // Anything in the buffers after this one was rolled back. They stay in the chain, and GetNewBuffer() hands them out again.
+    if (mUseChainedBuffers)
+    {
+        PacketBufferHandle next = mCurrentBuffer.Retain();
+        for (next.Advance(); !next.IsNull(); next.Advance())
+        {
+            next->SetDataLength(0, mHeadBuffer);
+        }
+    }
 
     return CHIP_NO_ERROR;
 }
 
+bool TLVPacketBufferBackingStore::IsInBuffer(const PacketBufferHandle & buffer, const uint8_t * p)
+{
+    return p >= buffer->Start() && p <= buffer->Start() + buffer->MaxDataLength();
+}
+
 CHIP_ERROR TLVPacketBufferBackingStore::GetNewBuffer(chip::TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen)
 {
     if (!mUseChainedBuffers)
@@ -82,6 +82,8 @@ public:
     CHIP_ERROR FinalizeBuffer(chip::TLV::TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override;
 
 protected:
+    static bool IsInBuffer(const chip::System::PacketBufferHandle & buffer, const uint8_t * p);
+
     chip::System::PacketBufferHandle mHeadBuffer;
     chip::System::PacketBufferHandle mCurrentBuffer;
     bool mUseChainedBuffers;
@@ -119,11 +121,12 @@ public:
      *                       If true, advance to the next buffer in the chain once all space
      *                       in the current buffer has been consumed. Once all existing buffers
      *                       have been used, new PacketBuffers will be allocated as necessary.
+     * @param[in]    maxLen  The maximum number of bytes that should be written, even if the buffers have more room.
      */
-    void Init(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false)
+    void Init(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false, uint32_t maxLen = UINT32_MAX)
     {
         mBackingStore.Init(std::move(buffer), useChainedBuffers);
-        chip::TLV::TLVWriter::Init(mBackingStore);
+        chip::TLV::TLVWriter::Init(mBackingStore, maxLen);
     }
     /**
      * Finish the writing of a TLV encoding and release ownership of the underlying PacketBuffer.
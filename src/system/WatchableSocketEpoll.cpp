@@ -0,0 +1,322 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements WatchableEvents using Linux epoll.
+ */
+
+#include <platform/LockTracker.h>
+#include <support/CodeUtils.h>
+#include <system/SystemLayer.h>
+#include <system/SystemSockets.h>
+
+#include <errno.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#define DEFAULT_MIN_SLEEP_PERIOD (60 * 60 * 24 * 30) // Month [sec]
+
+#if CHIP_DEVICE_CONFIG_ENABLE_MDNS && !__ZEPHYR__
+
+namespace chip {
+namespace Mdns {
+void GetMdnsTimeout(timeval & timeout);
+void HandleMdnsTimeout();
+} // namespace Mdns
+} // namespace chip
+
+#endif // CHIP_DEVICE_CONFIG_ENABLE_MDNS && !__ZEPHYR__
+
+namespace chip {
+namespace System {
+
+namespace {
+
+uint64_t MonotonicMicroseconds()
+{
+    struct timespec now;
+    VerifyOrDie(clock_gettime(CLOCK_MONOTONIC, &now) == 0);
+    return static_cast<uint64_t>(now.tv_sec) * 1000000 + static_cast<uint64_t>(now.tv_nsec) / 1000;
+}
+
+} // anonymous namespace
+
+void WatchableEventManager::Init(Layer & systemLayer)
+{
+    mSystemLayer                  = &systemLayer;
+    mEventCount                   = 0;
+    mWaitTimeoutMs                = -1;
+    mTimerDeadlineUs              = 0;
+    mHandlingEvents               = false;
+    mUnwatchedOutsideHandleEvents = false;
+
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrDieWithMsg(mEpollFd >= 0, chipSystemLayer, "epoll_create1 failed: %s", ErrorStr(MapErrorPOSIX(errno)));
+
+    mTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    VerifyOrDieWithMsg(mTimerFd >= 0, chipSystemLayer, "timerfd_create failed: %s", ErrorStr(MapErrorPOSIX(errno)));
+
+    // The timerfd is told apart from sockets by carrying the manager itself as its event data.
+    struct epoll_event event;
+    event.events   = EPOLLIN;
+    event.data.ptr = this;
+    VerifyOrDieWithMsg(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mTimerFd, &event) == 0, chipSystemLayer, "epoll_ctl failed: %s",
+                       ErrorStr(MapErrorPOSIX(errno)));
+}
+
+void WatchableEventManager::Shutdown()
+{
+    if (mTimerFd >= 0)
+    {
+        close(mTimerFd);
+        mTimerFd = -1;
+    }
+    if (mEpollFd >= 0)
+    {
+        close(mEpollFd);
+        mEpollFd = -1;
+    }
+    mEventCount  = 0;
+    mSystemLayer = nullptr;
+}
+
+/**
+ *  Translate the events reported by epoll for a socket into SocketEvents.
+ *
+ *  @param[in]    events    The events reported by epoll_wait().
+ *
+ *  @param[in]    watched   The events the socket is registered for.
+ *
+ *  Errors and hang-ups are reported by epoll regardless of the registered events; like select(), they are
+ *  presented as readiness in whichever directions the socket is watching, so that the subsequent I/O call
+ *  surfaces the error.
+ */
+SocketEvents WatchableEventManager::SocketEventsFromEpoll(uint32_t events, uint32_t watched)
+{
+    SocketEvents res;
+
+    if (events & (EPOLLERR | EPOLLHUP))
+    {
+        events |= watched;
+    }
+    if (events & watched & EPOLLIN)
+        res.Set(SocketEventFlags::kRead);
+    if (events & watched & EPOLLOUT)
+        res.Set(SocketEventFlags::kWrite);
+    if (events & EPOLLPRI)
+        res.Set(SocketEventFlags::kExcept);
+
+    return res;
+}
+
+void WatchableEventManager::UpdateWatch(WatchableSocket & watchable, uint32_t events)
+{
+    if (events == watchable.mWatchedEvents || watchable.mFD < 0)
+    {
+        return;
+    }
+
+    struct epoll_event event;
+    event.events   = events;
+    event.data.ptr = &watchable;
+
+    // Sockets with nothing requested are removed entirely, since epoll would otherwise keep reporting errors
+    // and hang-ups for them.
+    int op = EPOLL_CTL_MOD;
+    if (watchable.mWatchedEvents == 0)
+    {
+        op = EPOLL_CTL_ADD;
+    }
+    else if (events == 0)
+    {
+        op = EPOLL_CTL_DEL;
+        ForgetPendingEvents(watchable);
+    }
+
+    if (epoll_ctl(mEpollFd, op, watchable.mFD, &event) != 0)
+    {
+        ChipLogError(chipSystemLayer, "epoll_ctl(%d) on fd %d failed: %s", op, watchable.mFD, ErrorStr(MapErrorPOSIX(errno)));
+        return;
+    }
+
+    watchable.mWatchedEvents = events;
+}
+
+/**
+ *  Drop events already returned by epoll_wait() for a socket that is no longer watched, so that HandleEvents()
+ *  neither dispatches them nor touches the socket again if it has been closed, freed or reused.
+ */
+void WatchableEventManager::ForgetPendingEvents(const WatchableSocket & watchable)
+{
+    if (!mHandlingEvents)
+    {
+        // WaitForEvents() may be filling in mEvents on the event loop thread right now.
+        mUnwatchedOutsideHandleEvents = true;
+        return;
+    }
+
+    for (int i = 0; i < mEventCount; i++)
+    {
+        if (mEvents[i].data.ptr == &watchable)
+        {
+            mEvents[i].data.ptr = nullptr;
+        }
+    }
+}
+
+void WatchableEventManager::SetTimerDeadline(const timeval & timeout)
+{
+    const uint64_t kTimeoutUs = static_cast<uint64_t>(timeout.tv_sec) * 1000000 + static_cast<uint64_t>(timeout.tv_usec);
+
+    if (kTimeoutUs == 0)
+    {
+        mWaitTimeoutMs = 0;
+        return;
+    }
+    mWaitTimeoutMs = -1;
+
+    // System::Layer works in milliseconds, so round the deadline up to one; repeated loop iterations aiming at
+    // the same timer then compute the same deadline and the timerfd does not have to be re-armed.
+    const uint64_t kDeadlineUs = (MonotonicMicroseconds() + kTimeoutUs + 999) / 1000 * 1000;
+    if (kDeadlineUs == mTimerDeadlineUs)
+    {
+        return;
+    }
+
+    struct itimerspec spec;
+    spec.it_interval.tv_sec  = 0;
+    spec.it_interval.tv_nsec = 0;
+    spec.it_value.tv_sec     = static_cast<time_t>(kDeadlineUs / 1000000);
+    spec.it_value.tv_nsec    = static_cast<long>(kDeadlineUs % 1000000) * 1000;
+
+    if (timerfd_settime(mTimerFd, TFD_TIMER_ABSTIME, &spec, nullptr) != 0)
+    {
+        ChipLogError(chipSystemLayer, "timerfd_settime failed: %s", ErrorStr(MapErrorPOSIX(errno)));
+        // Fall back to polling so that timers are not missed.
+        mWaitTimeoutMs   = static_cast<int>((kTimeoutUs + 999) / 1000);
+        mTimerDeadlineUs = 0;
+        return;
+    }
+    mTimerDeadlineUs = kDeadlineUs;
+}
+
+void WatchableEventManager::ConfirmTimer()
+{
+    uint64_t expirations;
+
+    if (read(mTimerFd, &expirations, sizeof(expirations)) < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+    {
+        ChipLogError(chipSystemLayer, "timerfd read failed: %s", ErrorStr(MapErrorPOSIX(errno)));
+    }
+    mTimerDeadlineUs = 0;
+}
+
+void WatchableEventManager::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    // Max out this duration and let CHIP set it appropriately.
+    timeval nextTimeout;
+    nextTimeout.tv_sec  = DEFAULT_MIN_SLEEP_PERIOD;
+    nextTimeout.tv_usec = 0;
+    PrepareEventsWithTimeout(nextTimeout);
+}
+
+void WatchableEventManager::PrepareEventsWithTimeout(struct timeval & nextTimeout)
+{
+    // TODO(#5556): Integrate timer platform details with WatchableEventManager.
+    mSystemLayer->GetTimeout(nextTimeout);
+
+#if CHIP_DEVICE_CONFIG_ENABLE_MDNS && !__ZEPHYR__ && !__MBED__
+    chip::Mdns::GetMdnsTimeout(nextTimeout);
+#endif // CHIP_DEVICE_CONFIG_ENABLE_MDNS && !__ZEPHYR__
+
+    SetTimerDeadline(nextTimeout);
+
+    // Sockets unwatched before epoll_wait() is called are not reported by it.
+    mUnwatchedOutsideHandleEvents = false;
+}
+
+void WatchableEventManager::WaitForEvents()
+{
+    mEventCount = epoll_wait(mEpollFd, mEvents, CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS, mWaitTimeoutMs);
+}
+
+void WatchableEventManager::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (mEventCount < 0)
+    {
+        ChipLogError(DeviceLayer, "epoll_wait failed: %s\n", ErrorStr(System::MapErrorPOSIX(errno)));
+        mEventCount = 0;
+    }
+    if (mUnwatchedOutsideHandleEvents)
+    {
+        // The batch may refer to a socket that is gone; the sockets that are still ready will be reported again.
+        mEventCount = 0;
+    }
+
+    // Timer callbacks may close sockets in this batch too.
+    mHandlingEvents = true;
+    VerifyOrDie(mSystemLayer != nullptr);
+    mSystemLayer->HandleTimeout();
+
+    for (int i = 0; i < mEventCount; i++)
+    {
+        void * const data = mEvents[i].data.ptr;
+        if (data == this)
+        {
+            ConfirmTimer();
+            mEvents[i].data.ptr = nullptr;
+        }
+        else if (data != nullptr)
+        {
+            WatchableSocket * const watchable = static_cast<WatchableSocket *>(data);
+            watchable->SetPendingIO(SocketEventsFromEpoll(mEvents[i].events, watchable->mWatchedEvents));
+        }
+    }
+
+    // Callbacks may stop watching or close other sockets in this batch; those entries are cleared by
+    // ForgetPendingEvents(), so re-read the event data on every iteration.
+    for (int i = 0; i < mEventCount; i++)
+    {
+        WatchableSocket * const watchable = static_cast<WatchableSocket *>(mEvents[i].data.ptr);
+        if (watchable != nullptr && watchable->mPendingIO.HasAny())
+        {
+            watchable->InvokeCallback();
+        }
+    }
+    mEventCount = 0;
+
+#if CHIP_DEVICE_CONFIG_ENABLE_MDNS && !__ZEPHYR__ && !__MBED__
+    chip::Mdns::HandleMdnsTimeout();
+#endif // CHIP_DEVICE_CONFIG_ENABLE_MDNS && !__ZEPHYR__
+
+    mHandlingEvents = false;
+}
+
+void WatchableSocket::OnClose()
+{
+    VerifyOrDie(mFD >= 0);
+    mSharedState->UpdateWatch(*this, 0);
+}
+
+} // namespace System
+} // namespace chip
@@ -0,0 +1,115 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares an implementation of WatchableEvents using Linux epoll.
+ */
+
+#pragma once
+
+#include <sys/epoll.h>
+#include <sys/time.h>
+
+#if !INCLUDING_CHIP_SYSTEM_WATCHABLE_SOCKET_CONFIG_FILE
+#error "This file should only be included from <system/SystemSockets.h>"
+#endif //  !INCLUDING_CHIP_SYSTEM_WATCHABLE_SOCKET_CONFIG_FILE
+
+namespace chip {
+
+namespace System {
+
+class WatchableEventManager
+{
+public:
+    WatchableEventManager() :
+        mSystemLayer(nullptr), mEpollFd(-1), mTimerFd(-1), mTimerDeadlineUs(0), mWaitTimeoutMs(-1), mEventCount(0),
+        mHandlingEvents(false), mUnwatchedOutsideHandleEvents(false)
+    {}
+    void Init(Layer & systemLayer);
+    void Shutdown();
+
+    void EventLoopBegins() {}
+    void PrepareEvents();
+    void WaitForEvents();
+    void HandleEvents();
+    void EventLoopEnds() {}
+
+    // TODO(#5556): Some unit tests supply a timeout at low level, due to originally using select(); these should a proper timer.
+    void PrepareEventsWithTimeout(timeval & nextTimeout);
+
+    static SocketEvents SocketEventsFromEpoll(uint32_t events, uint32_t watched);
+
+private:
+    /*
+     * Sockets are registered with the epoll instance only while a read or write callback is requested, and in
+     * level-triggered mode, so that a callback that does not drain its socket is invoked again on the next
+     * iteration exactly as with select(). Changes to the interest set take effect immediately, even while another
+     * thread is blocked in WaitForEvents(), so unlike the select() implementation they do not need to wake the loop.
+     *
+     * The System::Layer timer deadline is tracked by a timerfd that is itself registered with the epoll instance,
+     * which lets WaitForEvents() block without a timeout and keeps timer resolution independent of the millisecond
+     * granularity of epoll_wait().
+     *
+     * The events collected by WaitForEvents() are only read and written with the CHIP stack lock held, from
+     * HandleEvents(). Sockets unwatched during HandleEvents() are removed from the collected events directly; when
+     * one is unwatched between PrepareEvents() and HandleEvents(), possibly by another thread while WaitForEvents()
+     * is filling in the events, the batch is dropped as a whole instead, since it may refer to that socket.
+     * Registration is level-triggered, so the sockets in a dropped batch that are still ready are reported again
+     * right away.
+     */
+    friend class WatchableSocket;
+
+    void UpdateWatch(WatchableSocket & watchable, uint32_t events);
+    void ForgetPendingEvents(const WatchableSocket & watchable);
+    void SetTimerDeadline(const timeval & timeout);
+    void ConfirmTimer();
+
+    Layer * mSystemLayer;
+    int mEpollFd;
+    int mTimerFd;
+    uint64_t mTimerDeadlineUs; ///< Absolute CLOCK_MONOTONIC deadline the timerfd is armed for, or 0 if disarmed.
+    int mWaitTimeoutMs;        ///< Timeout passed to epoll_wait(); 0 when a deadline has already passed, otherwise -1.
+
+    struct epoll_event mEvents[CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS];
+    int mEventCount;                    ///< return value from epoll_wait()
+    bool mHandlingEvents;               ///< Whether HandleEvents() is running, so that mEvents may be changed.
+    bool mUnwatchedOutsideHandleEvents; ///< Whether a socket was unwatched since PrepareEvents().
+};
+
+class WatchableSocket : public WatchableSocketBasis<WatchableSocket>
+{
+public:
+    void OnInit() { mWatchedEvents = 0; }
+    void OnAttach() { mWatchedEvents = 0; }
+    void OnClose();
+
+    void OnRequestCallbackOnPendingRead() { mSharedState->UpdateWatch(*this, mWatchedEvents | EPOLLIN); }
+    void OnRequestCallbackOnPendingWrite() { mSharedState->UpdateWatch(*this, mWatchedEvents | EPOLLOUT); }
+    void OnClearCallbackOnPendingRead() { mSharedState->UpdateWatch(*this, mWatchedEvents & ~static_cast<uint32_t>(EPOLLIN)); }
+    void OnClearCallbackOnPendingWrite() { mSharedState->UpdateWatch(*this, mWatchedEvents & ~static_cast<uint32_t>(EPOLLOUT)); }
+
+    void SetPendingIO(SocketEvents events) { mPendingIO = events; }
+
+private:
+    friend class WatchableEventManager;
+
+    uint32_t mWatchedEvents; ///< Events currently registered with the epoll instance; 0 if not registered.
+};
+
+} // namespace System
+} // namespace chip
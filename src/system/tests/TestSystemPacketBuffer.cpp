@@ -38,6 +38,7 @@
 #include <support/CodeUtils.h>
 #include <support/UnitTestRegistration.h>
 #include <system/SystemPacketBuffer.h>
+#include <system/SystemStats.h>
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
 #include <lwip/init.h>
@@ -131,6 +132,7 @@ public:
     static void CheckHandleRightSize(nlTestSuite * inSuite, void * inContext);
     static void CheckHandleCloneData(nlTestSuite * inSuite, void * inContext);
     static void CheckPacketBufferWriter(nlTestSuite * inSuite, void * inContext);
+    static void CheckSlabSizeClasses(nlTestSuite * inSuite, void * inContext);
     static void CheckBuildFreeList(nlTestSuite * inSuite, void * inContext);
 
     static void PrintHandle(const char * tag, const PacketBuffer * buffer)
@@ -1923,6 +1925,99 @@ void PacketBufferTest::CheckHandleCloneData(nlTestSuite * inSuite, void * inCont
 #endif // CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
 }
 
+void PacketBufferTest::CheckSlabSizeClasses(nlTestSuite * inSuite, void * inContext)
+{
+    using namespace chip::System::Stats;
+
+#if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_SLAB
+
+    PoolUsage smallBefore, largeBefore;
+    GetPacketBufferClassUsage(kSystemLayer_PacketBufferSmall, smallBefore);
+    GetPacketBufferClassUsage(kSystemLayer_PacketBufferLarge, largeBefore);
+
+    // Small requests are served from the smallest class, even with the default header reserve.
+    PacketBufferHandle small = PacketBufferHandle::New(16);
+    NL_TEST_ASSERT(inSuite, !small.IsNull());
+    NL_TEST_ASSERT(inSuite, small->AllocSize() == CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE);
+    NL_TEST_ASSERT(inSuite, small->AvailableDataLength() >= 16);
+
+    PacketBufferHandle medium = PacketBufferHandle::New(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE + 1, 0);
+    NL_TEST_ASSERT(inSuite, !medium.IsNull());
+    NL_TEST_ASSERT(inSuite, medium->AllocSize() == CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MEDIUM_SIZE);
+
+    PacketBufferHandle large = PacketBufferHandle::New(PacketBuffer::kMaxSizeWithoutReserve, 0);
+    NL_TEST_ASSERT(inSuite, !large.IsNull());
+    NL_TEST_ASSERT(inSuite, large->AllocSize() == PacketBuffer::kMaxSizeWithoutReserve);
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    PoolUsage usage;
+    GetPacketBufferClassUsage(kSystemLayer_PacketBufferSmall, usage);
+    NL_TEST_ASSERT(inSuite, usage.mInUse == smallBefore.mInUse + 1);
+    NL_TEST_ASSERT(inSuite, usage.mHighWatermark >= usage.mInUse);
+    NL_TEST_ASSERT(inSuite, usage.mReserved >= usage.mInUse);
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+
+    // RightSize() moves a lightly filled buffer into a smaller class.
+    const char kPayload[] = "ack";
+    large->SetStart(large->Start() + PacketBuffer::kDefaultHeaderReserve);
+    memcpy(large->Start(), kPayload, sizeof kPayload);
+    large->SetDataLength(sizeof kPayload);
+    large.RightSize();
+    NL_TEST_ASSERT(inSuite, large->AllocSize() == CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE);
+    NL_TEST_ASSERT(inSuite, large->ReservedSize() == PacketBuffer::kDefaultHeaderReserve);
+    NL_TEST_ASSERT(inSuite, large->DataLength() == sizeof kPayload);
+    NL_TEST_ASSERT(inSuite, memcmp(large->Start(), kPayload, sizeof kPayload) == 0);
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    GetPacketBufferClassUsage(kSystemLayer_PacketBufferLarge, usage);
+    NL_TEST_ASSERT(inSuite, usage.mInUse == largeBefore.mInUse);
+    GetPacketBufferClassUsage(kSystemLayer_PacketBufferSmall, usage);
+    NL_TEST_ASSERT(inSuite, usage.mInUse == smallBefore.mInUse + 2);
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+
+    // Freed blocks are reused before new ones are taken from the heap.
+    PacketBuffer * const freedBlock = small.Get();
+    small                           = nullptr;
+    small                           = PacketBufferHandle::New(16);
+    NL_TEST_ASSERT(inSuite, small.Get() == freedBlock);
+
+    small  = nullptr;
+    medium = nullptr;
+    large  = nullptr;
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    GetPacketBufferClassUsage(kSystemLayer_PacketBufferSmall, usage);
+    NL_TEST_ASSERT(inSuite, usage.mInUse == smallBefore.mInUse);
+
+    // Slabs are returned to the heap once a burst has been freed, keeping at most one spare slab and the thread's cache.
+    constexpr size_t kBurstCount = 8 * CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SIZE / CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE;
+    std::vector<PacketBufferHandle> burst;
+    for (size_t i = 0; i < kBurstCount; i++)
+    {
+        burst.push_back(PacketBufferHandle::New(16));
+        NL_TEST_ASSERT(inSuite, !burst.back().IsNull());
+    }
+
+    PoolUsage peak;
+    GetPacketBufferClassUsage(kSystemLayer_PacketBufferSmall, peak);
+    NL_TEST_ASSERT(inSuite, peak.mReserved >= smallBefore.mInUse + kBurstCount);
+
+    burst.clear();
+    GetPacketBufferClassUsage(kSystemLayer_PacketBufferSmall, usage);
+    NL_TEST_ASSERT(inSuite, usage.mInUse == smallBefore.mInUse);
+    NL_TEST_ASSERT(inSuite, usage.mReserved < peak.mReserved / 2);
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+
+#else // CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_SLAB
+
+    // Without the slab allocator every size class reports no usage.
+    PoolUsage usage;
+    GetPacketBufferClassUsage(kSystemLayer_PacketBufferSmall, usage);
+    NL_TEST_ASSERT(inSuite, usage.mInUse == 0 && usage.mHighWatermark == 0 && usage.mReserved == 0);
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_SLAB
+}
+
 void PacketBufferTest::CheckPacketBufferWriter(nlTestSuite * inSuite, void * inContext)
 {
     struct TestContext * const theContext = static_cast<struct TestContext *>(inContext);
@@ -1992,6 +2087,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("PacketBuffer::HandleRightSize",        PacketBufferTest::CheckHandleRightSize),
     NL_TEST_DEF("PacketBuffer::HandleCloneData",        PacketBufferTest::CheckHandleCloneData),
     NL_TEST_DEF("PacketBuffer::PacketBufferWriter",     PacketBufferTest::CheckPacketBufferWriter),
+    NL_TEST_DEF("PacketBuffer::SlabSizeClasses",        PacketBufferTest::CheckSlabSizeClasses),
 
     NL_TEST_SENTINEL()
 };
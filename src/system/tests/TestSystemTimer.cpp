@@ -182,6 +182,85 @@ static void CheckStarvation(nlTestSuite * inSuite, void * aContext)
     ServiceEvents(lSys, sleepTime);
 }
 
+// Stress test: arm every timer of the pool, with scattered deadlines, cancel a share of them by (callback, state),
+// and check that every remaining timer fires exactly once and never early. Run with a larger
+// CHIP_SYSTEM_CONFIG_NUM_TIMERS to stress the timer heap.
+
+// Pool entries left for the layer's own use.
+static const uint32_t kStressReservedTimers = 2;
+static_assert(CHIP_SYSTEM_CONFIG_NUM_TIMERS > kStressReservedTimers, "The stress test needs timers beyond the reserved ones");
+static const uint32_t kStressTimerCount = CHIP_SYSTEM_CONFIG_NUM_TIMERS - kStressReservedTimers;
+static const uint32_t kStressMaxDelayMs = 64;
+
+struct StressTimerRecord
+{
+    Clock::MonotonicMilliseconds mAwakenTime;
+    uint8_t mFiredCount;
+    bool mCancelled;
+};
+
+static StressTimerRecord sStressRecords[kStressTimerCount];
+static uint32_t sStressFired;
+static bool sStressFiredEarly;
+
+static void HandleStressTimer(Layer * aLayer, void * aState, CHIP_ERROR aError)
+{
+    StressTimerRecord & lRecord = *static_cast<StressTimerRecord *>(aState);
+
+    if (Clock::GetMonotonicMilliseconds() < lRecord.mAwakenTime)
+    {
+        sStressFiredEarly = true;
+    }
+    lRecord.mFiredCount++;
+    sStressFired++;
+}
+
+static void CheckStress(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+    Layer & lSys           = *lContext.mLayer;
+
+    StressTimerRecord * lRecords = sStressRecords;
+
+    memset(sStressRecords, 0, sizeof(sStressRecords));
+    sStressFired      = 0;
+    sStressFiredEarly = false;
+
+    for (uint32_t i = 0; i < kStressTimerCount; i++)
+    {
+        // Cheap deterministic scatter of deadlines over [0, kStressMaxDelayMs).
+        uint32_t lDelay         = (i * 2654435761u) % kStressMaxDelayMs;
+        lRecords[i].mAwakenTime = Clock::GetMonotonicMilliseconds() + lDelay;
+        NL_TEST_ASSERT(inSuite, lSys.StartTimer(lDelay, HandleStressTimer, &lRecords[i]) == CHIP_NO_ERROR);
+    }
+
+    uint32_t lCancelled = 0;
+    for (uint32_t i = 0; i < kStressTimerCount; i += 4)
+    {
+        lSys.CancelTimer(HandleStressTimer, &lRecords[i]);
+        lRecords[i].mCancelled = true;
+        lCancelled++;
+    }
+
+    const uint32_t lExpected = kStressTimerCount - lCancelled;
+    const uint64_t lStart    = Clock::GetMonotonicMicroseconds();
+    while (sStressFired < lExpected && Clock::GetMonotonicMicroseconds() - lStart < 10 * 1000 * 1000)
+    {
+        struct timeval sleepTime;
+        sleepTime.tv_sec  = 0;
+        sleepTime.tv_usec = 1000; // 1 ms tick
+        ServiceEvents(lSys, sleepTime);
+    }
+
+    NL_TEST_ASSERT(inSuite, sStressFired == lExpected);
+    NL_TEST_ASSERT(inSuite, !sStressFiredEarly);
+    for (uint32_t i = 0; i < kStressTimerCount; i++)
+    {
+        NL_TEST_ASSERT(inSuite, lRecords[i].mFiredCount == (lRecords[i].mCancelled ? 0 : 1));
+    }
+
+}
+
 // Test Suite
 
 /**
@@ -191,6 +270,7 @@ static void CheckStarvation(nlTestSuite * inSuite, void * aContext)
 static const nlTest sTests[] =
 {
     NL_TEST_DEF("Timer::TestOverflow",             CheckOverflow),
+    NL_TEST_DEF("Timer::TestStress",               CheckStress),
     NL_TEST_DEF("Timer::TestTimerStarvation",      CheckStarvation),
     NL_TEST_SENTINEL()
 };
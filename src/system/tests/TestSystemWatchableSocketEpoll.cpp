@@ -0,0 +1,252 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a unit test suite for the epoll implementation of
+ *      <tt>chip::System::WatchableEventManager</tt>.
+ *
+ */
+
+#include <system/SystemConfig.h>
+
+#include <nlunit-test.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+#include <system/SystemLayer.h>
+#include <system/SystemSockets.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace chip::System;
+
+namespace {
+
+constexpr size_t kNumSockets = 2;
+
+struct TestContext
+{
+    Layer mSystemLayer;
+    WatchableSocket mSockets[kNumSockets];
+    int mWriteFds[kNumSockets];
+    int mCallbacks[kNumSockets];
+    bool mCloseOthers;
+
+    // Open a pipe for each socket, with a byte to read in it, and watch the read ends.
+    void Open()
+    {
+        for (size_t i = 0; i < kNumSockets; i++)
+        {
+            int fds[2];
+            VerifyOrDie(pipe2(fds, O_NONBLOCK | O_CLOEXEC) == 0);
+            VerifyOrDie(write(fds[1], "x", 1) == 1);
+            mWriteFds[i]  = fds[1];
+            mCallbacks[i] = 0;
+            mSockets[i]
+                .Init(mSystemLayer.WatchableEvents())
+                .Attach(fds[0])
+                .SetCallback(HandleReadable, reinterpret_cast<intptr_t>(this))
+                .RequestCallbackOnPendingRead();
+        }
+        mCloseOthers = false;
+    }
+
+    void Close()
+    {
+        for (size_t i = 0; i < kNumSockets; i++)
+        {
+            if (mSockets[i].HasFD())
+            {
+                mSockets[i].Close();
+            }
+            close(mWriteFds[i]);
+        }
+    }
+
+    // Collect the events of the sockets that are ready, without blocking; Handle() dispatches them.
+    void Wait()
+    {
+        timeval timeout = { 0, 0 };
+        mSystemLayer.WatchableEvents().PrepareEventsWithTimeout(timeout);
+        mSystemLayer.WatchableEvents().WaitForEvents();
+    }
+    void Handle() { mSystemLayer.WatchableEvents().HandleEvents(); }
+
+    int TotalCallbacks() const
+    {
+        int total = 0;
+        for (size_t i = 0; i < kNumSockets; i++)
+        {
+            total += mCallbacks[i];
+        }
+        return total;
+    }
+
+    static void HandleReadable(WatchableSocket & socket)
+    {
+        TestContext * const context = reinterpret_cast<TestContext *>(socket.GetCallbackData());
+        const size_t index          = static_cast<size_t>(&socket - context->mSockets);
+        char byte;
+
+        context->mCallbacks[index]++;
+        if (socket.HasPendingRead())
+        {
+            (void) read(socket.GetFD(), &byte, 1);
+        }
+        if (context->mCloseOthers)
+        {
+            for (size_t i = 0; i < kNumSockets; i++)
+            {
+                if (i != index && context->mSockets[i].HasFD())
+                {
+                    context->mSockets[i].Close();
+                }
+            }
+        }
+    }
+};
+
+void TestReadable(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+    lContext.Open();
+
+    lContext.Wait();
+    lContext.Handle();
+    NL_TEST_ASSERT(inSuite, lContext.mCallbacks[0] == 1 && lContext.mCallbacks[1] == 1);
+
+    // The pipes have been drained, so the sockets are not ready anymore.
+    lContext.Wait();
+    lContext.Handle();
+    NL_TEST_ASSERT(inSuite, lContext.TotalCallbacks() == 2);
+
+    lContext.Close();
+}
+
+void TestCloseInCallback(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+    lContext.Open();
+
+    // Both sockets are in the same batch; whichever callback runs first closes the other socket, whose event must then
+    // not be dispatched.
+    lContext.mCloseOthers = true;
+    lContext.Wait();
+    lContext.Handle();
+    NL_TEST_ASSERT(inSuite, lContext.TotalCallbacks() == 1);
+    NL_TEST_ASSERT(inSuite, lContext.mSockets[0].HasFD() != lContext.mSockets[1].HasFD());
+
+    lContext.Close();
+}
+
+void TestCloseOutsideHandleEvents(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+    lContext.Open();
+
+    // A socket closed between collecting events and handling them, e.g. by another thread holding the stack lock, is
+    // not dispatched, even though epoll_wait() reported it.
+    lContext.Wait();
+    lContext.mSockets[1].Close();
+    lContext.Handle();
+    NL_TEST_ASSERT(inSuite, lContext.mCallbacks[1] == 0);
+
+    // The sockets that are still open and ready are reported again.
+    lContext.Wait();
+    lContext.Handle();
+    NL_TEST_ASSERT(inSuite, lContext.mCallbacks[0] == 1 && lContext.mCallbacks[1] == 0);
+
+    lContext.Close();
+}
+
+void TestUnwatchInCallback(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+    lContext.Open();
+
+    // A socket that is unwatched in the same batch, but kept open, is not dispatched either.
+    lContext.mSockets[0].SetCallback(
+        [](WatchableSocket & socket) {
+            TestContext * const context = reinterpret_cast<TestContext *>(socket.GetCallbackData());
+            context->mSockets[1].ClearCallbackOnPendingRead();
+            context->mSockets[0].ClearCallbackOnPendingRead();
+            context->mCallbacks[0]++;
+        },
+        reinterpret_cast<intptr_t>(&lContext));
+    lContext.mSockets[1].SetCallback(
+        [](WatchableSocket & socket) {
+            TestContext * const context = reinterpret_cast<TestContext *>(socket.GetCallbackData());
+            context->mSockets[0].ClearCallbackOnPendingRead();
+            context->mSockets[1].ClearCallbackOnPendingRead();
+            context->mCallbacks[1]++;
+        },
+        reinterpret_cast<intptr_t>(&lContext));
+
+    lContext.Wait();
+    lContext.Handle();
+    NL_TEST_ASSERT(inSuite, lContext.TotalCallbacks() == 1);
+
+    lContext.Close();
+}
+
+} // namespace
+
+// Test Suite
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("WatchableSocketEpoll::TestReadable",                 TestReadable),
+    NL_TEST_DEF("WatchableSocketEpoll::TestCloseInCallback",          TestCloseInCallback),
+    NL_TEST_DEF("WatchableSocketEpoll::TestCloseOutsideHandleEvents", TestCloseOutsideHandleEvents),
+    NL_TEST_DEF("WatchableSocketEpoll::TestUnwatchInCallback",        TestUnwatchInCallback),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+// clang-format off
+static nlTestSuite kTheSuite =
+{
+    "chip-system-watchable-socket-epoll",
+    sTests
+};
+// clang-format on
+
+int TestSystemWatchableSocketEpoll(void)
+{
+    TestContext context;
+
+    VerifyOrDie(context.mSystemLayer.Init(nullptr) == CHIP_NO_ERROR);
+    nlTestRunner(&kTheSuite, &context);
+    context.mSystemLayer.Shutdown();
+
+    return nlTestRunnerStats(&kTheSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSystemWatchableSocketEpoll)
+#else  // CHIP_SYSTEM_CONFIG_USE_EPOLL
+int TestSystemWatchableSocketEpoll(void)
+{
+    return SUCCESS;
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_EPOLL
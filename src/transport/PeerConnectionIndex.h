@@ -0,0 +1,232 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @brief Defines the open-addressing index used by PeerConnections to find
+ *        connection states without scanning the whole pool.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <support/HashUtils.h>
+#include <transport/raw/PeerAddress.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * Multi-map from a lookup key (local key ID, peer key ID, peer node ID or peer
+ * address) to the pool slots currently holding that key.
+ *
+ * Each key kind has its own linear-probing table sized to at least twice the
+ * pool capacity, so the load factor never exceeds 1/2. Buckets only store the
+ * full 32-bit key hash and the slot number; callers confirm a candidate by
+ * comparing against the slot's actual state, so hash collisions are harmless.
+ *
+ * Entries are removed with backward-shift deletion, which keeps probe
+ * sequences short without tombstones even under heavy session churn.
+ */
+template <size_t kMaxConnectionCount>
+class PeerConnectionIndex
+{
+public:
+    enum class Key : uint8_t
+    {
+        kLocalKeyId = 0,
+        kPeerKeyId,
+        kPeerNodeId,
+        kPeerAddress,
+
+        kCount,
+    };
+
+    /// Returned by Find() when no slot matches.
+    static constexpr size_t kNotFound = kMaxConnectionCount;
+
+    PeerConnectionIndex() { Clear(); }
+
+    void Clear()
+    {
+        for (size_t k = 0; k < kKeyCount; k++)
+        {
+            for (size_t b = 0; b < kBucketCount; b++)
+            {
+                mBuckets[k][b].mSlot = kEmptyBucket;
+            }
+            for (size_t s = 0; s < kMaxConnectionCount; s++)
+            {
+                mSlotIndexed[k][s] = false;
+            }
+        }
+    }
+
+    /**
+     * Replaces the entry of @p slot for @p key. A slot has at most one entry per key kind.
+     *
+     * @param indexed false if the slot's current key value should not be indexed
+     *                (e.g. an undefined node id), in which case only the old entry is dropped.
+     */
+    void Update(Key key, size_t slot, bool indexed, uint32_t hash)
+    {
+        const size_t k = static_cast<size_t>(key);
+
+        if (mSlotIndexed[k][slot])
+        {
+            if (indexed && mSlotHash[k][slot] == hash)
+            {
+                return; // unchanged
+            }
+            Remove(k, slot);
+        }
+
+        if (indexed)
+        {
+            Insert(k, slot, hash);
+        }
+    }
+
+    /**
+     * Finds the lowest numbered slot, strictly greater than @p after (or any slot
+     * if @p after is kNotFound), whose key hashes to @p hash and for which
+     * @p match(slot) returns true.
+     *
+     * Returning the lowest slot preserves the pool-order iteration semantics of
+     * the PeerConnections `begin` parameter.
+     */
+    template <typename Predicate>
+    size_t Find(Key key, uint32_t hash, size_t after, Predicate match) const
+    {
+        const size_t k = static_cast<size_t>(key);
+        size_t found   = kNotFound;
+
+        for (size_t b = hash & kBucketMask; mBuckets[k][b].mSlot != kEmptyBucket; b = (b + 1) & kBucketMask)
+        {
+            const Bucket & bucket = mBuckets[k][b];
+            const size_t slot     = bucket.mSlot;
+
+            if (bucket.mHash != hash || slot >= found)
+            {
+                continue;
+            }
+            if (after != kNotFound && slot <= after)
+            {
+                continue;
+            }
+            if (match(slot))
+            {
+                found = slot;
+            }
+        }
+
+        return found;
+    }
+
+    // Spreads sequential ids across buckets.
+    static uint32_t Hash(uint64_t value) { return static_cast<uint32_t>(MixBits64(value)); }
+
+    static uint32_t Hash(const PeerAddress & address)
+    {
+        // The interface is deliberately left out: it is not hashable on every platform and
+        // equality is re-checked by the caller anyway.
+        const Inet::IPAddress & ip = address.GetIPAddress();
+        uint64_t value             = (static_cast<uint64_t>(ip.Addr[0]) << 32) ^ ip.Addr[1];
+        value                      = Hash(value) ^ ((static_cast<uint64_t>(ip.Addr[2]) << 32) ^ ip.Addr[3]);
+        value = Hash(value) ^ ((static_cast<uint64_t>(address.GetPort()) << 8) | static_cast<uint8_t>(address.GetTransportType()));
+        return Hash(value);
+    }
+
+private:
+    static constexpr size_t kKeyCount = static_cast<size_t>(Key::kCount);
+
+    static constexpr size_t RoundUpToPowerOfTwo(size_t value, size_t result = 1)
+    {
+        return (result >= value) ? result : RoundUpToPowerOfTwo(value, result << 1);
+    }
+
+    static constexpr size_t kBucketCount = RoundUpToPowerOfTwo(2 * kMaxConnectionCount);
+    static constexpr size_t kBucketMask  = kBucketCount - 1;
+
+    static_assert(kMaxConnectionCount < UINT16_MAX, "Connection pool too large for a 16-bit slot index");
+    static constexpr uint16_t kEmptyBucket = UINT16_MAX;
+
+    struct Bucket
+    {
+        uint32_t mHash;
+        uint16_t mSlot;
+    };
+
+    void Insert(size_t k, size_t slot, uint32_t hash)
+    {
+        size_t b = hash & kBucketMask;
+        while (mBuckets[k][b].mSlot != kEmptyBucket)
+        {
+            b = (b + 1) & kBucketMask;
+        }
+
+        mBuckets[k][b].mHash  = hash;
+        mBuckets[k][b].mSlot  = static_cast<uint16_t>(slot);
+        mSlotHash[k][slot]    = hash;
+        mSlotIndexed[k][slot] = true;
+    }
+
+    void Remove(size_t k, size_t slot)
+    {
+        size_t hole = mSlotHash[k][slot] & kBucketMask;
+        while (mBuckets[k][hole].mSlot != slot)
+        {
+            hole = (hole + 1) & kBucketMask;
+        }
+
+        mSlotIndexed[k][slot] = false;
+
+        // Backward-shift deletion: pull forward every entry in the same cluster whose
+        // home bucket does not lie cyclically within (hole, next].
+        size_t next = hole;
+        while (true)
+        {
+            mBuckets[k][hole].mSlot = kEmptyBucket;
+
+            do
+            {
+                next = (next + 1) & kBucketMask;
+                if (mBuckets[k][next].mSlot == kEmptyBucket)
+                {
+                    return;
+                }
+            } while (IsCyclicallyBetween(mBuckets[k][next].mHash & kBucketMask, hole, next));
+
+            mBuckets[k][hole] = mBuckets[k][next];
+            hole              = next;
+        }
+    }
+
+    /// True if @p home lies in the cyclic interval (from, to].
+    static bool IsCyclicallyBetween(size_t home, size_t from, size_t to)
+    {
+        return (from <= to) ? (from < home && home <= to) : (from < home || home <= to);
+    }
+
+    Bucket mBuckets[kKeyCount][kBucketCount];
+    uint32_t mSlotHash[kKeyCount][kMaxConnectionCount];
+    bool mSlotIndexed[kKeyCount][kMaxConnectionCount];
+};
+
+} // namespace Transport
+} // namespace chip
@@ -33,6 +33,20 @@ namespace Transport {
 
 static constexpr uint32_t kUndefinedMessageIndex = UINT32_MAX;
 
+class PeerConnectionState;
+
+/**
+ * Notified whenever one of the lookup keys of a PeerConnectionState (peer
+ * address, peer node id, peer or local key id) changes, so that the owning
+ * pool can keep its lookup index consistent.
+ */
+class PeerConnectionStateObserver
+{
+public:
+    virtual ~PeerConnectionStateObserver() {}
+    virtual void OnPeerConnectionKeysChanged(PeerConnectionState & state) = 0;
+};
+
 /**
  * Defines state of a peer connection at a transport layer.
  *
@@ -59,17 +73,32 @@ public:
     PeerConnectionState & operator=(PeerConnectionState &&) = default;
 
     const PeerAddress & GetPeerAddress() const { return mPeerAddress; }
-    PeerAddress & GetPeerAddress() { return mPeerAddress; }
-    void SetPeerAddress(const PeerAddress & address) { mPeerAddress = address; }
+    void SetPeerAddress(const PeerAddress & address)
+    {
+        mPeerAddress = address;
+        NotifyKeysChanged();
+    }
 
     NodeId GetPeerNodeId() const { return mPeerNodeId; }
-    void SetPeerNodeId(NodeId peerNodeId) { mPeerNodeId = peerNodeId; }
+    void SetPeerNodeId(NodeId peerNodeId)
+    {
+        mPeerNodeId = peerNodeId;
+        NotifyKeysChanged();
+    }
 
     uint16_t GetPeerKeyID() const { return mPeerKeyID; }
-    void SetPeerKeyID(uint16_t id) { mPeerKeyID = id; }
+    void SetPeerKeyID(uint16_t id)
+    {
+        mPeerKeyID = id;
+        NotifyKeysChanged();
+    }
 
     uint16_t GetLocalKeyID() const { return mLocalKeyID; }
-    void SetLocalKeyID(uint16_t id) { mLocalKeyID = id; }
+    void SetLocalKeyID(uint16_t id)
+    {
+        mLocalKeyID = id;
+        NotifyKeysChanged();
+    }
 
     uint64_t GetLastActivityTimeMs() const { return mLastActivityTimeMs; }
     void SetLastActivityTimeMs(uint64_t value) { mLastActivityTimeMs = value; }
@@ -95,16 +124,28 @@ public:
         mLastActivityTimeMs = 0;
         mSecureSession.Reset();
         mSessionMessageCounter.Reset();
+        NotifyKeysChanged();
     }
 
+    /**
+     *  Attach the observer of a pooled state. The observer is bound to the storage
+     *  slot: it is neither copied nor moved along with the state's value.
+     */
+    void SetObserver(PeerConnectionStateObserver * observer) { mObserver.mObserver = observer; }
+
     CHIP_ERROR EncryptBeforeSend(const uint8_t * input, size_t input_length, uint8_t * output, PacketHeader & header,
-                                 MessageAuthenticationCode & mac) const
+                                 MessageAuthenticationCode & mac)
     {
         return mSecureSession.Encrypt(input, input_length, output, header, mac);
     }
 
+    CHIP_ERROR EncryptBeforeSend(const System::PacketBufferHandle & msgBuf, PacketHeader & header, MessageAuthenticationCode & mac)
+    {
+        return mSecureSession.Encrypt(msgBuf, header, mac);
+    }
+
     CHIP_ERROR DecryptOnReceive(const uint8_t * input, size_t input_length, uint8_t * output, const PacketHeader & header,
-                                const MessageAuthenticationCode & mac) const
+                                const MessageAuthenticationCode & mac)
     {
         return mSecureSession.Decrypt(input, input_length, output, header, mac);
     }
@@ -112,6 +153,23 @@ public:
     SessionMessageCounter & GetSessionMessageCounter() { return mSessionMessageCounter; }
 
 private:
+    struct ObserverRef
+    {
+        ObserverRef() = default;
+        ObserverRef(const ObserverRef &) {}
+        ObserverRef & operator=(const ObserverRef &) { return *this; }
+
+        PeerConnectionStateObserver * mObserver = nullptr;
+    };
+
+    void NotifyKeysChanged()
+    {
+        if (mObserver.mObserver != nullptr)
+        {
+            mObserver.mObserver->OnPeerConnectionKeysChanged(*this);
+        }
+    }
+
     PeerAddress mPeerAddress;
     NodeId mPeerNodeId           = kUndefinedNodeId;
     uint16_t mPeerKeyID          = UINT16_MAX;
@@ -120,6 +178,7 @@ private:
     SecureSession mSecureSession;
     SessionMessageCounter mSessionMessageCounter;
     Transport::AdminId mAdmin = kUndefinedAdminId;
+    ObserverRef mObserver;
 };
 
 } // namespace Transport
@@ -20,6 +20,7 @@
 #include <support/CodeUtils.h>
 #include <system/TimeSource.h>
 #include <transport/AdminPairingTable.h>
+#include <transport/PeerConnectionIndex.h>
 #include <transport/PeerConnectionState.h>
 
 namespace chip {
@@ -36,11 +37,28 @@ constexpr const uint16_t kAnyKeyId = 0xffff;
  * Intended for:
  *   - handle connection active time and expiration
  *   - allocate and free space for connection states.
+ *
+ * Lookups by local key id, peer key id, peer node id and peer address go through
+ * a PeerConnectionIndex, so their cost does not grow with kMaxConnectionCount.
+ * The index is kept consistent because every pooled state reports key changes
+ * back to this object (see PeerConnectionStateObserver).
  */
 template <size_t kMaxConnectionCount, Time::Source kTimeSource = Time::Source::kSystem>
-class PeerConnections
+class PeerConnections : private PeerConnectionStateObserver
 {
 public:
+    PeerConnections()
+    {
+        for (size_t i = 0; i < kMaxConnectionCount; i++)
+        {
+            mStates[i].SetObserver(this);
+        }
+    }
+
+    // Pooled states hold a pointer back to this object.
+    PeerConnections(const PeerConnections &) = delete;
+    PeerConnections & operator=(const PeerConnections &) = delete;
+
     /**
      * Allocates a new peer connection state state object out of the internal resource pool.
      *
@@ -68,6 +86,7 @@ public:
             {
                 mStates[i] = PeerConnectionState(address);
                 mStates[i].SetLastActivityTimeMs(mTimeSource.GetCurrentMonotonicTimeMs());
+                OnPeerConnectionKeysChanged(mStates[i]);
 
                 if (state)
                 {
@@ -111,6 +130,7 @@ public:
             if (!mStates[i].IsInitialized())
             {
                 mStates[i] = PeerConnectionState();
+                OnPeerConnectionKeysChanged(mStates[i]);
                 mStates[i].SetPeerKeyID(peerKeyId);
                 mStates[i].SetLocalKeyID(localKeyId);
                 mStates[i].SetLastActivityTimeMs(mTimeSource.GetCurrentMonotonicTimeMs());
@@ -144,23 +164,15 @@ public:
     CHECK_RETURN_VALUE
     PeerConnectionState * FindPeerConnectionState(const PeerAddress & address, PeerConnectionState * begin)
     {
-        PeerConnectionState * state = nullptr;
-        PeerConnectionState * iter  = &mStates[0];
+        auto match = [&](const PeerConnectionState & state) { return state.GetPeerAddress() == address; };
 
-        if (begin >= iter && begin < &mStates[kMaxConnectionCount])
+        if (!address.IsInitialized())
         {
-            iter = begin + 1;
+            // Uninitialized addresses are never indexed.
+            return FindLinear(begin, match);
         }
 
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (iter->GetPeerAddress() == address)
-            {
-                state = iter;
-                break;
-            }
-        }
-        return state;
+        return FindIndexed(Index::Key::kPeerAddress, Index::Hash(address), begin, match);
     }
 
     /**
@@ -175,27 +187,14 @@ public:
     CHECK_RETURN_VALUE
     PeerConnectionState * FindPeerConnectionState(NodeId nodeId, PeerConnectionState * begin)
     {
-        PeerConnectionState * state = nullptr;
-        PeerConnectionState * iter  = &mStates[0];
+        auto match = [&](PeerConnectionState & state) { return state.IsInitialized() && state.GetPeerNodeId() == nodeId; };
 
-        if (begin >= iter && begin < &mStates[kMaxConnectionCount])
+        if (nodeId == kUndefinedNodeId)
         {
-            iter = begin + 1;
+            return FindLinear(begin, match);
         }
 
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (!iter->IsInitialized())
-            {
-                continue;
-            }
-            if (iter->GetPeerNodeId() == nodeId)
-            {
-                state = iter;
-                break;
-            }
-        }
-        return state;
+        return FindIndexed(Index::Key::kPeerNodeId, Index::Hash(nodeId), begin, match);
     }
 
     /**
@@ -211,31 +210,17 @@ public:
     CHECK_RETURN_VALUE
     PeerConnectionState * FindPeerConnectionState(Optional<NodeId> nodeId, uint16_t peerKeyId, PeerConnectionState * begin)
     {
-        PeerConnectionState * state = nullptr;
-        PeerConnectionState * iter  = &mStates[0];
+        auto match = [&](PeerConnectionState & state) {
+            return state.IsInitialized() && (peerKeyId == kAnyKeyId || state.GetPeerKeyID() == peerKeyId) &&
+                MatchesNodeId(state, nodeId);
+        };
 
-        if (begin >= iter && begin < &mStates[kMaxConnectionCount])
+        if (peerKeyId == kAnyKeyId)
         {
-            iter = begin + 1;
+            return FindLinear(begin, match);
         }
 
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (!iter->IsInitialized())
-            {
-                continue;
-            }
-            if (peerKeyId == kAnyKeyId || iter->GetPeerKeyID() == peerKeyId)
-            {
-                if (nodeId.ValueOr(kUndefinedNodeId) == kUndefinedNodeId || iter->GetPeerNodeId() == kUndefinedNodeId ||
-                    iter->GetPeerNodeId() == nodeId.Value())
-                {
-                    state = iter;
-                    break;
-                }
-            }
-        }
-        return state;
+        return FindIndexed(Index::Key::kPeerKeyId, Index::Hash(peerKeyId), begin, match);
     }
 
     /**
@@ -249,30 +234,16 @@ public:
     CHECK_RETURN_VALUE
     PeerConnectionState * FindPeerConnectionState(uint16_t keyId, PeerConnectionState * begin)
     {
-        PeerConnectionState * state = nullptr;
-        PeerConnectionState * iter  = &mStates[0];
+        assert(begin == nullptr || (begin >= &mStates[0] && begin < &mStates[kMaxConnectionCount]));
 
-        assert(begin == nullptr || (begin >= iter && begin < &mStates[kMaxConnectionCount]));
+        auto match = [&](PeerConnectionState & state) { return state.IsInitialized() && state.GetLocalKeyID() == keyId; };
 
-        if (begin != nullptr)
+        if (keyId == UINT16_MAX)
         {
-            iter = begin + 1;
+            return FindLinear(begin, match);
         }
 
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (!iter->IsInitialized())
-            {
-                continue;
-            }
-
-            if (iter->GetLocalKeyID() == keyId)
-            {
-                state = iter;
-                break;
-            }
-        }
-        return state;
+        return FindIndexed(Index::Key::kLocalKeyId, Index::Hash(keyId), begin, match);
     }
 
     /**
@@ -289,31 +260,16 @@ public:
     PeerConnectionState * FindPeerConnectionStateByLocalKey(Optional<NodeId> nodeId, uint16_t localKeyId,
                                                             PeerConnectionState * begin)
     {
-        PeerConnectionState * state = nullptr;
-        PeerConnectionState * iter  = &mStates[0];
+        auto match = [&](PeerConnectionState & state) {
+            return state.IsInitialized() && state.GetLocalKeyID() == localKeyId && MatchesNodeId(state, nodeId);
+        };
 
-        if (begin >= iter && begin < &mStates[kMaxConnectionCount])
+        if (localKeyId == UINT16_MAX)
         {
-            iter = begin + 1;
+            return FindLinear(begin, match);
         }
 
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (!iter->IsInitialized())
-            {
-                continue;
-            }
-            if (iter->GetLocalKeyID() == localKeyId)
-            {
-                if (nodeId.ValueOr(kUndefinedNodeId) == kUndefinedNodeId || iter->GetPeerNodeId() == kUndefinedNodeId ||
-                    iter->GetPeerNodeId() == nodeId.Value())
-                {
-                    state = iter;
-                    break;
-                }
-            }
-        }
-        return state;
+        return FindIndexed(Index::Key::kLocalKeyId, Index::Hash(localKeyId), begin, match);
     }
 
     /// Convenience method to mark a peer connection state as active
@@ -328,6 +284,7 @@ public:
     {
         callback(*state);
         *state = PeerConnectionState(PeerAddress::Uninitialized());
+        OnPeerConnectionKeysChanged(*state);
     }
 
     /**
@@ -362,8 +319,62 @@ public:
     Time::TimeSource<kTimeSource> & GetTimeSource() { return mTimeSource; }
 
 private:
+    using Index = PeerConnectionIndex<kMaxConnectionCount>;
+
+    static bool MatchesNodeId(const PeerConnectionState & state, const Optional<NodeId> & nodeId)
+    {
+        return nodeId.ValueOr(kUndefinedNodeId) == kUndefinedNodeId || state.GetPeerNodeId() == kUndefinedNodeId ||
+            state.GetPeerNodeId() == nodeId.Value();
+    }
+
+    /// Pool slot to resume a search after, or Index::kNotFound to search from the start.
+    size_t SlotAfter(const PeerConnectionState * begin) const
+    {
+        if (begin >= &mStates[0] && begin < &mStates[kMaxConnectionCount])
+        {
+            return static_cast<size_t>(begin - &mStates[0]);
+        }
+        return Index::kNotFound;
+    }
+
+    template <typename Predicate>
+    PeerConnectionState * FindIndexed(typename Index::Key key, uint32_t hash, PeerConnectionState * begin, Predicate match)
+    {
+        size_t slot = mIndex.Find(key, hash, SlotAfter(begin), [&](size_t i) { return match(mStates[i]); });
+        return (slot == Index::kNotFound) ? nullptr : &mStates[slot];
+    }
+
+    template <typename Predicate>
+    PeerConnectionState * FindLinear(PeerConnectionState * begin, Predicate match)
+    {
+        size_t after = SlotAfter(begin);
+        for (size_t i = (after == Index::kNotFound) ? 0 : after + 1; i < kMaxConnectionCount; i++)
+        {
+            if (match(mStates[i]))
+            {
+                return &mStates[i];
+            }
+        }
+        return nullptr;
+    }
+
+    void OnPeerConnectionKeysChanged(PeerConnectionState & state) override
+    {
+        const size_t slot = static_cast<size_t>(&state - &mStates[0]);
+        VerifyOrDie(slot < kMaxConnectionCount);
+
+        const NodeId nodeId         = state.GetPeerNodeId();
+        const PeerAddress & address = state.GetPeerAddress();
+
+        mIndex.Update(Index::Key::kLocalKeyId, slot, state.GetLocalKeyID() != UINT16_MAX, Index::Hash(state.GetLocalKeyID()));
+        mIndex.Update(Index::Key::kPeerKeyId, slot, state.GetPeerKeyID() != UINT16_MAX, Index::Hash(state.GetPeerKeyID()));
+        mIndex.Update(Index::Key::kPeerNodeId, slot, nodeId != kUndefinedNodeId, Index::Hash(nodeId));
+        mIndex.Update(Index::Key::kPeerAddress, slot, address.IsInitialized(), Index::Hash(address));
+    }
+
     Time::TimeSource<kTimeSource> mTimeSource;
     PeerConnectionState mStates[kMaxConnectionCount];
+    Index mIndex;
 };
 
 } // namespace Transport
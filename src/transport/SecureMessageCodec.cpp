@@ -40,7 +40,6 @@ CHIP_ERROR Encode(NodeId localNodeId, Transport::PeerConnectionState * state, Pa
                   PacketHeader & packetHeader, System::PacketBufferHandle & msgBuf, MessageCounter & counter)
 {
     VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrReturnError(!msgBuf->HasChainedBuffer(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
     VerifyOrReturnError(msgBuf->TotalLength() <= kMaxAppMessageLen, CHIP_ERROR_MESSAGE_TOO_LONG);
 
     uint32_t msgId = counter.Value();
@@ -62,17 +61,25 @@ CHIP_ERROR Encode(NodeId localNodeId, Transport::PeerConnectionState * state, Pa
 
     ReturnErrorOnFailure(payloadHeader.EncodeBeforeData(msgBuf));
 
-    uint8_t * data    = msgBuf->Start();
-    uint16_t totalLen = msgBuf->TotalLength();
-
     MessageAuthenticationCode mac;
-    ReturnErrorOnFailure(state->EncryptBeforeSend(data, totalLen, data, packetHeader, mac));
+    ReturnErrorOnFailure(state->EncryptBeforeSend(msgBuf, packetHeader, mac));
 
-    uint16_t taglen = 0;
-    ReturnErrorOnFailure(mac.Encode(packetHeader, &data[totalLen], msgBuf->AvailableDataLength(), &taglen));
+    // The tag follows the message in its last buffer. A chain whose last buffer is full gets one more buffer for the tag, so
+    // that the message is never compacted.
+    PacketBufferHandle last = msgBuf->Last();
+    if (msgBuf->HasChainedBuffer() && last->AvailableDataLength() < kMaxTagLen)
+    {
+        last = PacketBufferHandle::New(kMaxTagLen, 0);
+        VerifyOrReturnError(!last.IsNull(), CHIP_ERROR_NO_MEMORY);
+        msgBuf->AddToEnd(last.Retain());
+    }
+
+    uint16_t totalLen = msgBuf->TotalLength();
+    uint16_t taglen   = 0;
+    ReturnErrorOnFailure(mac.Encode(packetHeader, last->Start() + last->DataLength(), last->AvailableDataLength(), &taglen));
 
     VerifyOrReturnError(CanCastTo<uint16_t>(totalLen + taglen), CHIP_ERROR_INTERNAL);
-    msgBuf->SetDataLength(static_cast<uint16_t>(totalLen + taglen));
+    last->SetDataLength(static_cast<uint16_t>(last->DataLength() + taglen), msgBuf);
 
     ChipLogDetail(Inet, "Secure message was encrypted: Msg ID %" PRIu32, msgId);
 
@@ -0,0 +1,303 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the secure message receive pipeline.
+ */
+
+#include <transport/SecureReceivePipeline.h>
+
+#if CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/logging/CHIPLogging.h>
+#include <system/SystemError.h>
+#include <transport/SecureSessionMgr.h>
+
+namespace chip {
+
+using Transport::PeerConnectionState;
+
+namespace {
+constexpr size_t kQueueSize = CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_QUEUE_SIZE;
+} // anonymous namespace
+
+static_assert(kQueueSize > 0, "CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_QUEUE_SIZE must be nonzero");
+
+struct SecureReceivePipeline::Worker
+{
+    explicit Worker(SecureReceivePipeline & pipeline) : mPipeline(pipeline)
+    {
+        pthread_mutex_init(&mLock, nullptr);
+        pthread_mutex_init(&mProcessLock, nullptr);
+        pthread_cond_init(&mQueued, nullptr);
+    }
+
+    ~Worker()
+    {
+        pthread_cond_destroy(&mQueued);
+        pthread_mutex_destroy(&mProcessLock);
+        pthread_mutex_destroy(&mLock);
+    }
+
+    Job & At(size_t index) { return mJobs[(mHead + index) % kQueueSize]; }
+
+    SecureReceivePipeline & mPipeline;
+    pthread_t mThread;
+
+    // mLock protects the ring indices and flags below. mProcessLock is held by the worker while it processes a job, so
+    // that Cancel() can wait for a job of the session being cancelled to finish.
+    pthread_mutex_t mLock;
+    pthread_mutex_t mProcessLock;
+    pthread_cond_t mQueued; ///< Signalled when a job is queued or the worker is stopped.
+
+    bool mStopping         = false;
+    size_t mHead           = 0; ///< Index of the oldest undelivered job.
+    size_t mCount          = 0; ///< Number of undelivered jobs, starting at mHead.
+    size_t mProcessedCount = 0; ///< Number of undelivered jobs, starting at mHead, that have been processed.
+
+    Job mJobs[kQueueSize];
+};
+
+CHIP_ERROR SecureReceivePipeline::Init(System::Layer & systemLayer, SecureSessionMgr & sessionMgr, uint8_t workerCount)
+{
+    VerifyOrReturnError(mSessionMgr == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(workerCount > 0 && workerCount <= CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(mWakeEvent.Open(systemLayer.WatchableEvents(), HandleWake, reinterpret_cast<intptr_t>(this)));
+    mSessionMgr  = &sessionMgr;
+    mWakePending = false;
+
+    for (uint8_t i = 0; i < workerCount; i++)
+    {
+        Worker * worker = Platform::New<Worker>(*this);
+        if (worker == nullptr)
+        {
+            Shutdown();
+            return CHIP_ERROR_NO_MEMORY;
+        }
+
+        const int res = pthread_create(&worker->mThread, nullptr, WorkerMain, worker);
+        if (res != 0)
+        {
+            Platform::Delete(worker);
+            Shutdown();
+            return System::MapErrorPOSIX(res);
+        }
+        mWorkers[i] = worker;
+    }
+
+    mWorkerCount = workerCount;
+    return CHIP_NO_ERROR;
+}
+
+void SecureReceivePipeline::Shutdown()
+{
+    if (mSessionMgr == nullptr)
+    {
+        return;
+    }
+
+    mWorkerCount = 0;
+
+    for (Worker * worker : mWorkers)
+    {
+        if (worker != nullptr)
+        {
+            pthread_mutex_lock(&worker->mLock);
+            worker->mStopping = true;
+            pthread_cond_signal(&worker->mQueued);
+            pthread_mutex_unlock(&worker->mLock);
+        }
+    }
+
+    for (Worker *& worker : mWorkers)
+    {
+        if (worker != nullptr)
+        {
+            pthread_join(worker->mThread, nullptr);
+            Platform::Delete(worker);
+            worker = nullptr;
+        }
+    }
+
+    mWakeEvent.Close();
+    mSessionMgr = nullptr;
+}
+
+SecureReceivePipeline::Worker & SecureReceivePipeline::WorkerFor(const PeerConnectionState * state)
+{
+    return *mWorkers[state->GetLocalKeyID() % mWorkerCount];
+}
+
+CHIP_ERROR SecureReceivePipeline::Submit(Job && job)
+{
+    Worker & worker = WorkerFor(job.mState);
+
+    pthread_mutex_lock(&worker.mLock);
+    while (worker.mCount == kQueueSize)
+    {
+        // Waiting for the worker would stall the event loop, and delivering from within a delivery would complete messages
+        // out of order with the one whose delivery led to this call.
+        if (worker.mProcessedCount == 0 || mDelivering)
+        {
+            pthread_mutex_unlock(&worker.mLock);
+            ChipLogError(Inet, "Secure receive pipeline queue full, dropping message for key ID %d",
+                         job.mPacketHeader.GetEncryptionKeyID());
+            return CHIP_ERROR_NO_MEMORY;
+        }
+
+        pthread_mutex_unlock(&worker.mLock);
+        DeliverProcessed(worker);
+        if (mWorkerCount == 0)
+        {
+            // A delegate shut the pipeline down.
+            return CHIP_NO_ERROR;
+        }
+        pthread_mutex_lock(&worker.mLock);
+    }
+
+    worker.At(worker.mCount) = std::move(job);
+    worker.mCount++;
+    pthread_cond_signal(&worker.mQueued);
+    pthread_mutex_unlock(&worker.mLock);
+    return CHIP_NO_ERROR;
+}
+
+void SecureReceivePipeline::Cancel(const PeerConnectionState * state)
+{
+    if (!IsRunning())
+    {
+        return;
+    }
+
+    Worker & worker = WorkerFor(state);
+
+    pthread_mutex_lock(&worker.mProcessLock);
+    pthread_mutex_lock(&worker.mLock);
+    for (size_t i = 0; i < worker.mCount; i++)
+    {
+        Job & job = worker.At(i);
+        if (job.mState == state)
+        {
+            job.mState = nullptr;
+        }
+    }
+    pthread_mutex_unlock(&worker.mLock);
+    pthread_mutex_unlock(&worker.mProcessLock);
+}
+
+void SecureReceivePipeline::DeliverProcessed()
+{
+    for (uint8_t i = 0; i < mWorkerCount; i++)
+    {
+        DeliverProcessed(*mWorkers[i]);
+    }
+}
+
+void SecureReceivePipeline::DeliverProcessed(Worker & worker)
+{
+    pthread_mutex_lock(&worker.mLock);
+    while (worker.mProcessedCount > 0)
+    {
+        Job job = std::move(worker.At(0));
+        worker.mHead = (worker.mHead + 1) % kQueueSize;
+        worker.mCount--;
+        worker.mProcessedCount--;
+        pthread_mutex_unlock(&worker.mLock);
+
+        if (job.mState != nullptr)
+        {
+            mDelivering = true;
+            mSessionMgr->DeliverReceivedMessage(job);
+            mDelivering = false;
+
+            if (mWorkerCount == 0)
+            {
+                return;
+            }
+        }
+
+        pthread_mutex_lock(&worker.mLock);
+    }
+    pthread_mutex_unlock(&worker.mLock);
+}
+
+void * SecureReceivePipeline::WorkerMain(void * arg)
+{
+    Worker & worker                  = *static_cast<Worker *>(arg);
+    SecureReceivePipeline & pipeline = worker.mPipeline;
+
+    pthread_mutex_lock(&worker.mLock);
+    while (true)
+    {
+        while (!worker.mStopping && worker.mProcessedCount == worker.mCount)
+        {
+            pthread_cond_wait(&worker.mQueued, &worker.mLock);
+        }
+        if (worker.mStopping)
+        {
+            break;
+        }
+
+        // The event thread neither delivers nor reuses this entry until it is counted as processed, and only
+        // changes it in Cancel(), under mProcessLock.
+        Job & job = worker.At(worker.mProcessedCount);
+        pthread_mutex_unlock(&worker.mLock);
+
+        pthread_mutex_lock(&worker.mProcessLock);
+        if (job.mState != nullptr)
+        {
+            pipeline.mSessionMgr->ProcessReceivedMessage(job);
+        }
+        pthread_mutex_unlock(&worker.mProcessLock);
+
+        pthread_mutex_lock(&worker.mLock);
+        worker.mProcessedCount++;
+        pthread_mutex_unlock(&worker.mLock);
+
+        if (!pipeline.mWakePending.exchange(true))
+        {
+            const CHIP_ERROR err = pipeline.mWakeEvent.Notify();
+            if (err != CHIP_NO_ERROR)
+            {
+                ChipLogError(Inet, "Secure receive pipeline wake failed: %s", ErrorStr(err));
+            }
+        }
+
+        pthread_mutex_lock(&worker.mLock);
+    }
+    pthread_mutex_unlock(&worker.mLock);
+
+    return nullptr;
+}
+
+void SecureReceivePipeline::HandleWake(intptr_t context)
+{
+    SecureReceivePipeline * const pipeline = reinterpret_cast<SecureReceivePipeline *>(context);
+
+    // Clear the flag before looking at the queues, so that a job processed after that is announced with a new wake.
+    pipeline->mWakePending = false;
+    pipeline->DeliverProcessed();
+}
+
+} // namespace chip
+
+#endif // CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
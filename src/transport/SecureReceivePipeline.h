@@ -0,0 +1,146 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the receive pipeline that lets SecureSessionMgr
+ *      verify and decrypt received secure messages on worker threads.
+ */
+
+#pragma once
+
+#include <core/CHIPConfig.h>
+
+#if CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+
+#if !CHIP_SYSTEM_CONFIG_POSIX_LOCKING || !CHIP_SYSTEM_CONFIG_USE_SOCKETS
+#error "The secure receive pipeline requires CHIP_SYSTEM_CONFIG_POSIX_LOCKING and CHIP_SYSTEM_CONFIG_USE_SOCKETS"
+#endif
+
+#include <atomic>
+
+#include <pthread.h>
+
+#include <core/CHIPError.h>
+#include <system/SystemLayer.h>
+#include <system/SystemPacketBuffer.h>
+#include <transport/PeerConnectionState.h>
+#include <transport/raw/MessageHeader.h>
+#include <transport/raw/PeerAddress.h>
+
+namespace chip {
+
+class SecureSessionMgr;
+
+/**
+ * @class SecureReceivePipeline
+ *
+ * @brief
+ *  Runs the message counter check, decryption and payload header decoding of received secure messages on a set of
+ *  worker threads, and hands the results back to the event loop thread in the order the messages were received.
+ *
+ *  Sessions are sharded across the workers by local key ID, so all messages of a session are processed by the same
+ *  worker, one at a time, and the session's peer message counter and decryption context are only ever touched by that
+ *  worker while the pipeline runs. Each worker owns a fixed-size ring of messages: the event thread appends to it, the
+ *  worker processes entries in order, and the event thread delivers processed entries from the head. The worker wakes
+ *  the event thread through a WakeEvent. Neither thread waits for the other, except for Cancel(), and the worker never
+ *  allocates or frees packet buffers.
+ *
+ *  Except for the worker threads, all methods must be called on the event loop thread.
+ */
+class SecureReceivePipeline
+{
+public:
+    /**
+     * A received secure message travelling through the pipeline.
+     */
+    struct Job
+    {
+        Transport::PeerConnectionState * mState = nullptr; ///< Session the message was received on; null once cancelled.
+        PacketHeader mPacketHeader;
+        PayloadHeader mPayloadHeader;
+        Transport::PeerAddress mPeerAddress;
+        System::PacketBufferHandle mMsg; ///< Ciphertext when queued, plaintext once processed.
+        CHIP_ERROR mError = CHIP_NO_ERROR;
+        bool mDuplicate   = false;
+        bool mDrop        = false; ///< Set by the worker if the message is to be discarded without reporting an error.
+    };
+
+    SecureReceivePipeline() {}
+    ~SecureReceivePipeline() { Shutdown(); }
+
+    SecureReceivePipeline(const SecureReceivePipeline &) = delete;
+    SecureReceivePipeline & operator=(const SecureReceivePipeline &) = delete;
+
+    /**
+     * Start @p workerCount worker threads that process messages for @p sessionMgr.
+     *
+     * @retval CHIP_ERROR_INCORRECT_STATE  The pipeline is already running.
+     * @retval CHIP_ERROR_INVALID_ARGUMENT @p workerCount is 0 or exceeds CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS.
+     * @retval CHIP_ERROR_NO_MEMORY        The worker state could not be allocated.
+     */
+    CHIP_ERROR Init(System::Layer & systemLayer, SecureSessionMgr & sessionMgr, uint8_t workerCount);
+
+    /**
+     * Stop and join the worker threads. Messages that have not been delivered yet are discarded.
+     */
+    void Shutdown();
+
+    bool IsRunning() const { return mWorkerCount > 0; }
+    uint8_t GetWorkerCount() const { return mWorkerCount; }
+
+    /**
+     * Queue a message for processing by the worker that owns @p job.mState. If that worker's queue is full, messages it
+     * has already processed are delivered first. The call never waits for the worker.
+     *
+     * @retval CHIP_ERROR_NO_MEMORY The worker's queue is full of messages it has not processed yet; the message is
+     *                              dropped, as a network would drop it, and the peer retransmits it.
+     */
+    CHIP_ERROR Submit(Job && job);
+
+    /**
+     * Discard all queued messages of @p state, waiting for the worker if it is processing one of them. Must be called
+     * before the session is released or its keys or counters are changed.
+     */
+    void Cancel(const Transport::PeerConnectionState * state);
+
+    /**
+     * Deliver all processed messages to the session manager, in the order each worker queue received them.
+     */
+    void DeliverProcessed();
+
+private:
+    struct Worker;
+
+    static void * WorkerMain(void * arg);
+    static void HandleWake(intptr_t context);
+
+    Worker & WorkerFor(const Transport::PeerConnectionState * state);
+    void DeliverProcessed(Worker & worker);
+
+    SecureSessionMgr * mSessionMgr = nullptr;
+    System::WakeEvent mWakeEvent;
+    std::atomic<bool> mWakePending{ false };
+    bool mDelivering     = false;
+    uint8_t mWorkerCount = 0;
+
+    Worker * mWorkers[CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS] = {};
+};
+
+} // namespace chip
+
+#endif // CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
@@ -76,6 +76,22 @@ CHIP_ERROR SecureSession::InitFromSecret(const ByteSpan & secret, const ByteSpan
     ReturnErrorOnFailure(
         mHKDF.HKDF_SHA256(secret.data(), secret.size(), salt.data(), salt.size(), info, infoLen, &mKeys[0][0], sizeof(mKeys)));
 
+    // Messages are encrypted with the key of the direction this node sends in: I2R if the secure session
+    // was created by session initiator, R2I otherwise. Received messages are decrypted with the other one.
+    const KeyUsage sendKey    = (role == SessionRole::kInitiator) ? kI2RKey : kR2IKey;
+    const KeyUsage receiveKey = (role == SessionRole::kInitiator) ? kR2IKey : kI2RKey;
+
+    CHIP_ERROR err = mEncryptContext.Init(mKeys[sendKey], kAES_CCM128_Key_Length);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = mDecryptContext.Init(mKeys[receiveKey], kAES_CCM128_Key_Length);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        Reset();
+        return err;
+    }
+
     mKeyAvailable = true;
     mSessionRole  = role;
 
@@ -98,6 +114,8 @@ void SecureSession::Reset()
 {
     mKeyAvailable = false;
     memset(mKeys, 0, sizeof(mKeys));
+    mEncryptContext.Clear();
+    mDecryptContext.Clear();
 }
 
 CHIP_ERROR SecureSession::GetIV(const PacketHeader & header, uint8_t * iv, size_t len)
@@ -130,7 +148,7 @@ CHIP_ERROR SecureSession::GetAdditionalAuthData(const PacketHeader & header, uin
 }
 
 CHIP_ERROR SecureSession::Encrypt(const uint8_t * input, size_t input_length, uint8_t * output, PacketHeader & header,
-                                  MessageAuthenticationCode & mac) const
+                                  MessageAuthenticationCode & mac)
 {
 
     constexpr Header::EncryptionType encType = Header::EncryptionType::kAESCCMTagLen16;
@@ -151,18 +169,44 @@ CHIP_ERROR SecureSession::Encrypt(const uint8_t * input, size_t input_length, ui
     ReturnErrorOnFailure(GetIV(header, IV, sizeof(IV)));
     ReturnErrorOnFailure(GetAdditionalAuthData(header, AAD, aadLen));
 
-    KeyUsage usage = kR2IKey;
+    ReturnErrorOnFailure(mEncryptContext.Encrypt(input, input_length, AAD, aadLen, IV, sizeof(IV), output, tag, taglen));
+
+    mac.SetTag(&header, encType, tag, taglen);
 
-    // Message is encrypted before sending. If the secure session was created by session
-    // initiator, we'll use I2R key to encrypt the message that's being transmittted.
-    // Otherwise, we'll use R2I key, as the responder is sending the message.
-    if (mSessionRole == SessionRole::kInitiator)
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SecureSession::Encrypt(const System::PacketBufferHandle & msgBuf, PacketHeader & header, MessageAuthenticationCode & mac)
+{
+    VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (!msgBuf->HasChainedBuffer())
     {
-        usage = kI2RKey;
+        return Encrypt(msgBuf->Start(), msgBuf->DataLength(), msgBuf->Start(), header, mac);
     }
 
-    ReturnErrorOnFailure(AES_CCM_encrypt(input, input_length, AAD, aadLen, mKeys[usage], kAES_CCM128_Key_Length, IV, sizeof(IV),
-                                         output, tag, taglen));
+    constexpr Header::EncryptionType encType = Header::EncryptionType::kAESCCMTagLen16;
+
+    const size_t taglen = MessageAuthenticationCode::TagLenForEncryptionType(encType);
+    assert(taglen <= kMaxTagLen);
+
+    VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
+    VerifyOrReturnError(msgBuf->TotalLength() > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint8_t AAD[kMaxAADLen];
+    uint8_t IV[kAESCCMIVLen];
+    uint16_t aadLen = sizeof(AAD);
+    uint8_t tag[kMaxTagLen];
+
+    ReturnErrorOnFailure(GetIV(header, IV, sizeof(IV)));
+    ReturnErrorOnFailure(GetAdditionalAuthData(header, AAD, aadLen));
+
+    ReturnErrorOnFailure(mEncryptContext.BeginEncrypt(msgBuf->TotalLength(), AAD, aadLen, IV, sizeof(IV), taglen));
+    for (System::PacketBufferHandle buffer = msgBuf.Retain(); !buffer.IsNull(); buffer.Advance())
+    {
+        ReturnErrorOnFailure(mEncryptContext.EncryptData(buffer->Start(), buffer->DataLength(), buffer->Start()));
+    }
+    ReturnErrorOnFailure(mEncryptContext.FinishEncrypt(tag, taglen));
 
     mac.SetTag(&header, encType, tag, taglen);
 
@@ -170,7 +214,7 @@ CHIP_ERROR SecureSession::Encrypt(const uint8_t * input, size_t input_length, ui
 }
 
 CHIP_ERROR SecureSession::Decrypt(const uint8_t * input, size_t input_length, uint8_t * output, const PacketHeader & header,
-                                  const MessageAuthenticationCode & mac) const
+                                  const MessageAuthenticationCode & mac)
 {
     const size_t taglen = MessageAuthenticationCode::TagLenForEncryptionType(header.GetEncryptionType());
     const uint8_t * tag = mac.GetTag();
@@ -186,18 +230,7 @@ CHIP_ERROR SecureSession::Decrypt(const uint8_t * input, size_t input_length, ui
     ReturnErrorOnFailure(GetIV(header, IV, sizeof(IV)));
     ReturnErrorOnFailure(GetAdditionalAuthData(header, AAD, aadLen));
 
-    KeyUsage usage = kI2RKey;
-
-    // Message is decrypted on receive. If the secure session was created by session
-    // initiator, we'll use R2I key to decrypt the message (as it was sent by responder).
-    // Otherwise, we'll use I2R key, as the responder is sending the message.
-    if (mSessionRole == SessionRole::kInitiator)
-    {
-        usage = kR2IKey;
-    }
-
-    return AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mKeys[usage], kAES_CCM128_Key_Length, IV, sizeof(IV),
-                           output);
+    return mDecryptContext.Decrypt(input, input_length, AAD, aadLen, tag, taglen, IV, sizeof(IV), output);
 }
 
 } // namespace chip
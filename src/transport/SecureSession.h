@@ -28,6 +28,7 @@
 #include <core/CHIPCore.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <support/Span.h>
+#include <system/SystemPacketBuffer.h>
 #include <transport/raw/MessageHeader.h>
 
 namespace chip {
@@ -90,14 +91,27 @@ public:
      *
      * @param input Unencrypted input data
      * @param input_length Length of the input data
-     * @param output Output buffer for encrypted data
+     * @param output Output buffer for encrypted data. May be the same as input to encrypt in place.
      * @param header message header structure. Encryption type will be set on the header.
      * @param mac - output the resulting mac
      *
      * @return CHIP_ERROR The result of encryption
      */
     CHIP_ERROR Encrypt(const uint8_t * input, size_t input_length, uint8_t * output, PacketHeader & header,
-                       MessageAuthenticationCode & mac) const;
+                       MessageAuthenticationCode & mac);
+
+    /**
+     * @brief
+     *   Encrypt, in place, the message held by a buffer or a chain of buffers, using keys established in the secure channel.
+     *   The buffers of a chain are encrypted one after the other, without copying the message into one buffer.
+     *
+     * @param msgBuf The message to encrypt
+     * @param header message header structure. Encryption type will be set on the header.
+     * @param mac - output the resulting mac
+     *
+     * @return CHIP_ERROR The result of encryption
+     */
+    CHIP_ERROR Encrypt(const System::PacketBufferHandle & msgBuf, PacketHeader & header, MessageAuthenticationCode & mac);
 
     /**
      * @brief
@@ -105,13 +119,13 @@ public:
      *
      * @param input Encrypted input data
      * @param input_length Length of the input data
-     * @param output Output buffer for decrypted data
+     * @param output Output buffer for decrypted data. May be the same as input to decrypt in place.
      * @param header message header structure
      * @return CHIP_ERROR The result of decryption
      * @param mac Input mac
      */
     CHIP_ERROR Decrypt(const uint8_t * input, size_t input_length, uint8_t * output, const PacketHeader & header,
-                       const MessageAuthenticationCode & mac) const;
+                       const MessageAuthenticationCode & mac);
 
     /**
      * @brief
@@ -145,6 +159,10 @@ private:
     bool mKeyAvailable;
     CryptoKey mKeys[KeyUsage::kNumCryptoKeys];
 
+    // Ciphers for the keys of the two directions, set up once when the keys are derived.
+    Crypto::AES_CCM_Context mEncryptContext;
+    Crypto::AES_CCM_Context mDecryptContext;
+
     static CHIP_ERROR GetIV(const PacketHeader & header, uint8_t * iv, size_t len);
 
     // Use unencrypted header as additional authenticated data (AAD) during encryption and decryption.
@@ -68,6 +68,9 @@ SecureSessionMgr::SecureSessionMgr() : mState(State::kNotReady) {}
 
 SecureSessionMgr::~SecureSessionMgr()
 {
+#if CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+    StopReceivePipeline();
+#endif
     CancelExpiryTimer();
 }
 
@@ -98,6 +101,9 @@ CHIP_ERROR SecureSessionMgr::Init(NodeId localNodeId, System::Layer * systemLaye
 
 void SecureSessionMgr::Shutdown()
 {
+#if CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+    StopReceivePipeline();
+#endif
     CancelExpiryTimer();
 
     mMessageCounterManager = nullptr;
@@ -159,7 +165,6 @@ CHIP_ERROR SecureSessionMgr::SendPreparedMessage(SecureSessionHandle session, co
     VerifyOrExit(!preparedMessage.IsNull(), err = CHIP_ERROR_INVALID_ARGUMENT);
     msgBuf = preparedMessage.CastToWritable();
     VerifyOrExit(!msgBuf.IsNull(), err = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(!msgBuf->HasChainedBuffer(), err = CHIP_ERROR_INVALID_MESSAGE_LENGTH);
 
     // Find an active connection to the specified peer node
     state = GetPeerConnectionState(session);
@@ -327,13 +332,8 @@ void SecureSessionMgr::SecureMessageDispatch(const PacketHeader & packetHeader,
 
     PayloadHeader payloadHeader;
 
-    Transport::AdminPairingInfo * admin = nullptr;
-
-    bool modifiedAdmin = false;
-    NodeId localNodeId;
-    FabricId fabricId;
-
-    SecureSessionMgrDelegate::DuplicateMessage isDuplicate = SecureSessionMgrDelegate::DuplicateMessage::No;
+    bool isDuplicate = false;
+    bool drop        = false;
 
     VerifyOrExit(!msg.IsNull(), ChipLogError(Inet, "Secure transport received NULL packet, discarding"));
 
@@ -343,61 +343,77 @@ void SecureSessionMgr::SecureMessageDispatch(const PacketHeader & packetHeader,
         ExitNow(err = CHIP_ERROR_KEY_NOT_FOUND_FROM_PEER);
     }
 
-    // Verify message counter
-    if (packetHeader.GetFlags().Has(Header::FlagValues::kSecureSessionControlMessage))
-    {
-        // TODO: control message counter is not implemented yet
-    }
-    else
+    if (!packetHeader.GetFlags().Has(Header::FlagValues::kSecureSessionControlMessage) &&
+        !state->GetSessionMessageCounter().GetPeerMessageCounter().IsSynchronized())
     {
-        if (!state->GetSessionMessageCounter().GetPeerMessageCounter().IsSynchronized())
-        {
-            // Queue and start message sync procedure
-            err = mMessageCounterManager->QueueReceivedMessageAndStartSync(
-                packetHeader, { state->GetPeerNodeId(), state->GetPeerKeyID(), state->GetAdminId() }, state, peerAddress,
-                std::move(msg));
-
-            if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Inet,
-                             "Message counter synchronization for received message, failed to "
-                             "QueueReceivedMessageAndStartSync, err = %" CHIP_ERROR_FORMAT,
-                             ChipError::FormatError(err));
-            }
-            else
-            {
-                ChipLogDetail(Inet, "Received message have been queued due to peer counter is not synced");
-            }
-
-            return;
-        }
+        // Queue and start message sync procedure
+        err = mMessageCounterManager->QueueReceivedMessageAndStartSync(
+            packetHeader, { state->GetPeerNodeId(), state->GetPeerKeyID(), state->GetAdminId() }, state, peerAddress,
+            std::move(msg));
 
-        err = state->GetSessionMessageCounter().GetPeerMessageCounter().Verify(packetHeader.GetMessageId());
-        if (err == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED)
+        if (err != CHIP_NO_ERROR)
         {
-            ChipLogDetail(Inet, "Received a duplicate message");
-            isDuplicate = SecureSessionMgrDelegate::DuplicateMessage::Yes;
-            err         = CHIP_NO_ERROR;
+            ChipLogError(Inet,
+                         "Message counter synchronization for received message, failed to "
+                         "QueueReceivedMessageAndStartSync, err = %" CHIP_ERROR_FORMAT,
+                         ChipError::FormatError(err));
         }
-        if (err != CHIP_NO_ERROR)
+        else
         {
-            ChipLogError(Inet, "Message counter verify failed, err = %" CHIP_ERROR_FORMAT, ChipError::FormatError(err));
+            ChipLogDetail(Inet, "Received message have been queued due to peer counter is not synced");
         }
+
+        return;
+    }
+
+    VerifyOrReturn(VerifyReceivedMessageDestination(state, packetHeader));
+
+    mPeerConnections.MarkConnectionActive(state);
+
+#if CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+    if (mReceivePipeline.IsRunning())
+    {
+        SecureReceivePipeline::Job job;
+        job.mState        = state;
+        job.mPacketHeader = packetHeader;
+        job.mPeerAddress  = peerAddress;
+        job.mMsg          = std::move(msg);
+        err               = mReceivePipeline.Submit(std::move(job));
         SuccessOrExit(err);
+        return;
+    }
+#endif // CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+
+    err = DecryptReceivedMessage(state, packetHeader, payloadHeader, msg, isDuplicate, drop);
+    SuccessOrExit(err);
+    VerifyOrReturn(!drop);
+
+    HandleDecryptedMessage(state, packetHeader, payloadHeader, peerAddress, isDuplicate, std::move(msg));
+
+exit:
+    if (err != CHIP_NO_ERROR && mCB != nullptr)
+    {
+        mCB->OnReceiveError(err, peerAddress);
     }
+}
 
-    admin = mAdmins->FindAdminWithId(state->GetAdminId());
-    VerifyOrExit(admin != nullptr,
-                 ChipLogError(Inet, "Secure transport received packet for unknown admin (%p, %d) pairing, discarding", state,
-                              state->GetAdminId()));
-    if (packetHeader.GetDestinationNodeId().HasValue() && admin->GetNodeId() != kUndefinedNodeId)
+bool SecureSessionMgr::VerifyReceivedMessageDestination(PeerConnectionState * state, const PacketHeader & packetHeader)
+{
+    Transport::AdminPairingInfo * admin = mAdmins->FindAdminWithId(state->GetAdminId());
+    if (admin == nullptr)
+    {
+        ChipLogError(Inet, "Secure transport received packet for unknown admin (%p, %d) pairing, discarding", state,
+                     state->GetAdminId());
+        return false;
+    }
+    if (packetHeader.GetDestinationNodeId().HasValue() && admin->GetNodeId() != kUndefinedNodeId &&
+        admin->GetNodeId() != packetHeader.GetDestinationNodeId().Value())
     {
-        VerifyOrExit(admin->GetNodeId() == packetHeader.GetDestinationNodeId().Value(),
-                     ChipLogError(Inet,
-                                  "Secure transport received message, but destination node ID (0x" ChipLogFormatX64
-                                  ") doesn't match our node ID (0x" ChipLogFormatX64 "), discarding",
-                                  ChipLogValueX64(packetHeader.GetDestinationNodeId().Value()),
-                                  ChipLogValueX64(admin->GetNodeId())));
+        ChipLogError(Inet,
+                     "Secure transport received message, but destination node ID (0x" ChipLogFormatX64
+                     ") doesn't match our node ID (0x" ChipLogFormatX64 "), discarding",
+                     ChipLogValueX64(packetHeader.GetDestinationNodeId().Value()), ChipLogValueX64(admin->GetNodeId()));
+        return false;
     }
 
     if (packetHeader.GetDestinationNodeId().HasValue())
@@ -412,20 +428,53 @@ void SecureSessionMgr::SecureMessageDispatch(const PacketHeader & packetHeader,
                         static_cast<int>(state->GetAdminId()), packetHeader.GetEncryptionKeyID());
     }
 
-    mPeerConnections.MarkConnectionActive(state);
+    return true;
+}
+
+CHIP_ERROR SecureSessionMgr::DecryptReceivedMessage(PeerConnectionState * state, const PacketHeader & packetHeader,
+                                                    PayloadHeader & payloadHeader, System::PacketBufferHandle & msg,
+                                                    bool & isDuplicate, bool & drop)
+{
+    const bool isControlMessage = packetHeader.GetFlags().Has(Header::FlagValues::kSecureSessionControlMessage);
+
+    // Verify message counter
+    if (isControlMessage)
+    {
+        // TODO: control message counter is not implemented yet
+    }
+    else
+    {
+        CHIP_ERROR err = state->GetSessionMessageCounter().GetPeerMessageCounter().Verify(packetHeader.GetMessageId());
+        if (err == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED)
+        {
+            ChipLogDetail(Inet, "Received a duplicate message");
+            isDuplicate = true;
+            err         = CHIP_NO_ERROR;
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Message counter verify failed, err = %" CHIP_ERROR_FORMAT, ChipError::FormatError(err));
+        }
+        ReturnErrorOnFailure(err);
+    }
 
     // Decode the message
-    VerifyOrExit(CHIP_NO_ERROR == SecureMessageCodec::Decode(state, payloadHeader, packetHeader, msg),
-                 ChipLogError(Inet, "Secure transport received message, but failed to decode it, discarding"));
+    if (SecureMessageCodec::Decode(state, payloadHeader, packetHeader, msg) != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Secure transport received message, but failed to decode it, discarding");
+        drop = true;
+        return CHIP_NO_ERROR;
+    }
 
-    if (isDuplicate == SecureSessionMgrDelegate::DuplicateMessage::Yes && !payloadHeader.NeedsAck())
+    if (isDuplicate && !payloadHeader.NeedsAck())
     {
         // If it's a duplicate message, but doesn't require an ack, let's drop it right here to save CPU
         // cycles on further message processing.
-        ExitNow(err = CHIP_NO_ERROR);
+        drop = true;
+        return CHIP_NO_ERROR;
     }
 
-    if (packetHeader.GetFlags().Has(Header::FlagValues::kSecureSessionControlMessage))
+    if (isControlMessage)
     {
         // TODO: control message counter is not implemented yet
     }
@@ -434,6 +483,22 @@ void SecureSessionMgr::SecureMessageDispatch(const PacketHeader & packetHeader,
         state->GetSessionMessageCounter().GetPeerMessageCounter().Commit(packetHeader.GetMessageId());
     }
 
+    return CHIP_NO_ERROR;
+}
+
+void SecureSessionMgr::HandleDecryptedMessage(PeerConnectionState * state, const PacketHeader & packetHeader,
+                                              const PayloadHeader & payloadHeader, const Transport::PeerAddress & peerAddress,
+                                              bool isDuplicate, System::PacketBufferHandle && msg)
+{
+    Transport::AdminPairingInfo * admin = mAdmins->FindAdminWithId(state->GetAdminId());
+
+    bool modifiedAdmin = false;
+    NodeId localNodeId;
+    FabricId fabricId;
+
+    // The admin was checked before the message was decrypted; it can only be gone here if the receive pipeline is used.
+    VerifyOrReturn(admin != nullptr);
+
     // See operational-credentials-server.cpp for explanation as to why fabricId is being set to commissioner node id
     // This is temporary code until AddOptCert is implemented through which an admin will be correctly added with the correct
     // fields.
@@ -488,18 +553,55 @@ void SecureSessionMgr::SecureMessageDispatch(const PacketHeader & packetHeader,
     if (mCB != nullptr)
     {
         SecureSessionHandle session(state->GetPeerNodeId(), state->GetPeerKeyID(), state->GetAdminId());
-        mCB->OnMessageReceived(packetHeader, payloadHeader, session, peerAddress, isDuplicate, std::move(msg));
+        mCB->OnMessageReceived(packetHeader, payloadHeader, session, peerAddress,
+                               isDuplicate ? SecureSessionMgrDelegate::DuplicateMessage::Yes
+                                           : SecureSessionMgrDelegate::DuplicateMessage::No,
+                               std::move(msg));
     }
+}
 
-exit:
-    if (err != CHIP_NO_ERROR && mCB != nullptr)
+#if CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+
+CHIP_ERROR SecureSessionMgr::StartReceivePipeline(uint8_t workerCount)
+{
+    VerifyOrReturnError(mState == State::kInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    return mReceivePipeline.Init(*mSystemLayer, *this, workerCount);
+}
+
+void SecureSessionMgr::ProcessReceivedMessage(SecureReceivePipeline::Job & job)
+{
+    job.mError =
+        DecryptReceivedMessage(job.mState, job.mPacketHeader, job.mPayloadHeader, job.mMsg, job.mDuplicate, job.mDrop);
+}
+
+void SecureSessionMgr::DeliverReceivedMessage(SecureReceivePipeline::Job & job)
+{
+    if (job.mError != CHIP_NO_ERROR)
     {
-        mCB->OnReceiveError(err, peerAddress);
+        if (mCB != nullptr)
+        {
+            mCB->OnReceiveError(job.mError, job.mPeerAddress);
+        }
+        return;
+    }
+
+    if (!job.mDrop)
+    {
+        HandleDecryptedMessage(job.mState, job.mPacketHeader, job.mPayloadHeader, job.mPeerAddress, job.mDuplicate,
+                               std::move(job.mMsg));
     }
 }
 
+#endif // CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+
 void SecureSessionMgr::HandleConnectionExpired(const Transport::PeerConnectionState & state)
 {
+#if CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+    // Every way a session is released or reused passes through here, before its state is cleared.
+    mReceivePipeline.Cancel(&state);
+#endif
+
     ChipLogDetail(Inet, "Marking old secure session for device 0x" ChipLogFormatX64 " as expired",
                   ChipLogValueX64(state.GetPeerNodeId()));
 
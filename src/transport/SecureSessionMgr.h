@@ -37,6 +37,7 @@
 #include <transport/MessageCounterManagerInterface.h>
 #include <transport/PairingSession.h>
 #include <transport/PeerConnections.h>
+#include <transport/SecureReceivePipeline.h>
 #include <transport/SecureSession.h>
 #include <transport/SecureSessionHandle.h>
 #include <transport/TransportMgr.h>
@@ -273,7 +274,33 @@ public:
      */
     void OnMessageReceived(const Transport::PeerAddress & source, System::PacketBufferHandle && msgBuf) override;
 
+#if CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+    /**
+     * @brief
+     *   Move message counter checks, decryption and payload header decoding of received secure messages to worker threads.
+     *
+     * @details
+     *   Sessions are sharded across @p workerCount threads by local key ID. Messages are still delivered to the delegate on
+     *   the event loop thread, in the order they were received on each session, but asynchronously: OnMessageReceived()
+     *   returns before the message has been decrypted. Messages of sessions whose peer counter is not synchronized yet
+     *   are handled inline as before.
+     *
+     *   Must be called on the event loop thread after Init().
+     */
+    CHIP_ERROR StartReceivePipeline(uint8_t workerCount);
+
+    /**
+     * @brief
+     *   Stop the receive pipeline started by StartReceivePipeline(). Messages that have not been delivered yet are dropped.
+     */
+    void StopReceivePipeline() { mReceivePipeline.Shutdown(); }
+#endif // CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+
 private:
+#if CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+    friend class SecureReceivePipeline;
+#endif
+
     /**
      *    The State of a secure transport object.
      */
@@ -302,6 +329,10 @@ private:
     GlobalUnencryptedMessageCounter mGlobalUnencryptedMessageCounter;
     GlobalEncryptedMessageCounter mGlobalEncryptedMessageCounter;
 
+#if CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+    SecureReceivePipeline mReceivePipeline;
+#endif
+
     /** Schedules a new oneshot timer for checking connection expiry. */
     void ScheduleExpiryTimer();
 
@@ -323,6 +354,36 @@ private:
     void MessageDispatch(const PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
                          System::PacketBufferHandle && msg);
 
+    /**
+     * Check that a received secure message is for an admin of this node and that its destination node ID, if any, is ours.
+     */
+    bool VerifyReceivedMessageDestination(Transport::PeerConnectionState * state, const PacketHeader & packetHeader);
+
+    /**
+     * Verify the message counter of a received secure message, decrypt it in place and decode its payload header, then
+     * commit the counter. Sets @p drop if the message is to be discarded without reporting an error.
+     *
+     * Only touches the receive side of @p state and never frees @p msg, so it may run on a receive pipeline worker.
+     */
+    CHIP_ERROR DecryptReceivedMessage(Transport::PeerConnectionState * state, const PacketHeader & packetHeader,
+                                      PayloadHeader & payloadHeader, System::PacketBufferHandle & msg, bool & isDuplicate,
+                                      bool & drop);
+
+    /**
+     * Update the session from a received and decrypted secure message and pass the message to the delegate.
+     */
+    void HandleDecryptedMessage(Transport::PeerConnectionState * state, const PacketHeader & packetHeader,
+                                const PayloadHeader & payloadHeader, const Transport::PeerAddress & peerAddress, bool isDuplicate,
+                                System::PacketBufferHandle && msg);
+
+#if CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+    /** Receive pipeline worker step: runs DecryptReceivedMessage() for @p job. */
+    void ProcessReceivedMessage(SecureReceivePipeline::Job & job);
+
+    /** Receive pipeline event thread step: reports the outcome of ProcessReceivedMessage() for @p job. */
+    void DeliverReceivedMessage(SecureReceivePipeline::Job & job);
+#endif
+
     static bool IsControlMessage(PayloadHeader & payloadHeader)
     {
         return payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::MsgCounterSyncReq) ||
@@ -367,6 +428,23 @@ inline System::PacketBufferHandle New(size_t aAvailableSize)
     return System::PacketBufferHandle::New(aAvailableSize + kMaxFooterSize);
 }
 
+/**
+ * Allocates the first packet buffer of a message that may be written across a chain of buffers.
+ *
+ *  The buffer has space for message headers, and for \a aMessageSize octets of application data and the footers if a single
+ *  buffer can hold them; otherwise it is as large as a single buffer can be, and the rest of the message goes in buffers
+ *  chained after it.
+ *
+ *  @param[in]  aMessageSize    Maximum number of octets of application data in the message.
+ *
+ *  @return     On success, a PacketBufferHandle to the allocated buffer. On fail, \c nullptr.
+ */
+inline System::PacketBufferHandle NewChainHead(size_t aMessageSize)
+{
+    constexpr size_t kMaxAvailableSize = System::PacketBuffer::kMaxSize - kMaxFooterSize;
+    return New(aMessageSize < kMaxAvailableSize ? aMessageSize : kMaxAvailableSize);
+}
+
 /**
  * Allocates a packet buffer with initial contents.
  *
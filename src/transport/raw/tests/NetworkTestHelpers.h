@@ -73,7 +73,19 @@ public:
 
         if (mNumMessagesToDrop == 0)
         {
-            System::PacketBufferHandle receivedMessage = msgBuf.CloneData();
+            // Like a network, deliver a message written across a chain of buffers in one buffer.
+            System::PacketBufferHandle receivedMessage;
+            if (msgBuf->HasChainedBuffer())
+            {
+                receivedMessage = System::PacketBufferHandle::New(msgBuf->TotalLength());
+                VerifyOrReturnError(!receivedMessage.IsNull(), CHIP_ERROR_NO_MEMORY);
+                ReturnErrorOnFailure(msgBuf->Read(receivedMessage->Start(), msgBuf->TotalLength()));
+                receivedMessage->SetDataLength(msgBuf->TotalLength());
+            }
+            else
+            {
+                receivedMessage = msgBuf.CloneData();
+            }
             HandleMessageReceived(address, std::move(receivedMessage));
         }
         else
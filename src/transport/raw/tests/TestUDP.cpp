@@ -26,6 +26,7 @@
 #include <core/CHIPCore.h>
 #include <support/CodeUtils.h>
 #include <support/UnitTestRegistration.h>
+#include <system/SystemStats.h>
 #include <transport/TransportMgr.h>
 #include <transport/raw/UDP.h>
 
@@ -169,6 +170,249 @@ void CheckMessageTest6(nlTestSuite * inSuite, void * inContext)
     CheckMessageTest(inSuite, inContext, addr);
 }
 
+/////////////////////////// Burst test
+
+void CheckMessageBurstTest(nlTestSuite * inSuite, void * inContext, const IPAddress & addr)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    // Enough to span more than one recvmmsg()/sendmmsg() call when datagram batching is enabled.
+    constexpr int kBurstCount = 24;
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    Transport::UDP udp;
+
+    err = udp.Init(Transport::UdpListenParameters(&ctx.GetInetLayer()).SetAddressType(addr.Type()));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite);
+    TransportMgrBase gTransportMgrBase;
+    gTransportMgrBase.SetSecureSessionMgr(&gMockTransportMgrDelegate);
+    gTransportMgrBase.Init(&udp);
+
+    ReceiveHandlerCallCount = 0;
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    System::Stats::ResetBatchSizeHistograms();
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+
+    // Send without servicing the event loop in between, so that a batching endpoint queues the datagrams and
+    // the receiver finds several of them pending at once.
+    for (int i = 0; i < kBurstCount; i++)
+    {
+        chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+        PacketHeader header;
+        header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageId(kMessageId);
+
+        err = header.EncodeBeforeData(buffer);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        err = udp.SendMessage(Transport::PeerAddress::UDP(addr), std::move(buffer));
+        if (err == System::MapErrorPOSIX(EADDRNOTAVAIL))
+        {
+            // TODO(#2698): the underlying system does not support IPV6. This early return
+            // should be removed and error should be made fatal.
+            printf("%s:%u: System does NOT support IPV6.\n", __FILE__, __LINE__);
+            return;
+        }
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+
+    ctx.DriveIOUntil(1000 /* ms */, []() { return ReceiveHandlerCallCount >= kBurstCount; });
+
+    NL_TEST_ASSERT(inSuite, ReceiveHandlerCallCount == kBurstCount);
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS && INET_DATAGRAM_RECV_BATCHING
+    // The receiver starts with buffers for a single datagram, and allocates more for the following batches while they come
+    // back full.
+    const System::Stats::batch_count_t * recvBatches =
+        System::Stats::GetBatchSizeHistogram(System::Stats::kInetLayer_DatagramRecvBatch);
+    NL_TEST_ASSERT(inSuite, recvBatches[0] > 0);
+    NL_TEST_ASSERT(inSuite, recvBatches[1] + recvBatches[2] + recvBatches[3] > 0);
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS && INET_DATAGRAM_RECV_BATCHING
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS && INET_DATAGRAM_SEND_BATCHING
+    const System::Stats::batch_count_t * sendBatches =
+        System::Stats::GetBatchSizeHistogram(System::Stats::kInetLayer_DatagramSendBatch);
+    NL_TEST_ASSERT(inSuite, sendBatches[0] == 0);
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS && INET_DATAGRAM_SEND_BATCHING
+}
+
+void CheckMessageBurstTest4(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("127.0.0.1", addr);
+    CheckMessageBurstTest(inSuite, inContext, addr);
+}
+
+void CheckMessageBurstTest6(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CheckMessageBurstTest(inSuite, inContext, addr);
+}
+
+/////////////////////////// Chained buffer test
+
+void CheckChainedMessageTest(nlTestSuite * inSuite, void * inContext, const IPAddress & addr)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    Transport::UDP udp;
+
+    err = udp.Init(Transport::UdpListenParameters(&ctx.GetInetLayer()).SetAddressType(addr.Type()));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite);
+    TransportMgrBase gTransportMgrBase;
+    gTransportMgrBase.SetSecureSessionMgr(&gMockTransportMgrDelegate);
+    gTransportMgrBase.Init(&udp);
+
+    ReceiveHandlerCallCount = 0;
+
+    // The header and the start of the payload in one buffer, and the rest of the payload one byte per buffer; the receiver
+    // gets it all in one datagram.
+    chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, 2);
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+    for (size_t i = 2; i < sizeof(PAYLOAD); i++)
+    {
+        chip::System::PacketBufferHandle next = chip::System::PacketBufferHandle::NewWithData(&PAYLOAD[i], 1, 0, 0);
+        NL_TEST_ASSERT(inSuite, !next.IsNull());
+        buffer->AddToEnd(std::move(next));
+    }
+
+    PacketHeader header;
+    header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageId(kMessageId);
+
+    err = header.EncodeBeforeData(buffer);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = udp.SendMessage(Transport::PeerAddress::UDP(addr), std::move(buffer));
+    if (err == System::MapErrorPOSIX(EADDRNOTAVAIL))
+    {
+        // TODO(#2698): the underlying system does not support IPV6. This early return
+        // should be removed and error should be made fatal.
+        printf("%s:%u: System does NOT support IPV6.\n", __FILE__, __LINE__);
+        return;
+    }
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    ctx.DriveIOUntil(1000 /* ms */, []() { return ReceiveHandlerCallCount != 0; });
+
+    NL_TEST_ASSERT(inSuite, ReceiveHandlerCallCount == 1);
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    // A chain longer than a scatter-gather send takes is rejected.
+    buffer = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+    for (size_t i = 0; i < INET_CONFIG_DATAGRAM_SEND_MAX_BUFFERS; i++)
+    {
+        chip::System::PacketBufferHandle next = chip::System::PacketBufferHandle::New(1, 0);
+        NL_TEST_ASSERT(inSuite, !next.IsNull());
+        *next->Start() = 0;
+        next->SetDataLength(1);
+        buffer->AddToEnd(std::move(next));
+    }
+
+    err = udp.SendMessage(Transport::PeerAddress::UDP(addr), std::move(buffer));
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_MESSAGE_TOO_LONG);
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+}
+
+void CheckChainedMessageTest4(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("127.0.0.1", addr);
+    CheckChainedMessageTest(inSuite, inContext, addr);
+}
+
+void CheckChainedMessageTest6(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CheckChainedMessageTest(inSuite, inContext, addr);
+}
+
+/////////////////////////// Send error test
+
+System::PacketBufferHandle NewTestMessage(nlTestSuite * inSuite)
+{
+    chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+    PacketHeader header;
+    header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageId(kMessageId);
+    NL_TEST_ASSERT(inSuite, header.EncodeBeforeData(buffer) == CHIP_NO_ERROR);
+    return buffer;
+}
+
+void CheckSendErrorTest(nlTestSuite * inSuite, void * inContext, const IPAddress & addr)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    Transport::UDP udp;
+
+    err = udp.Init(Transport::UdpListenParameters(&ctx.GetInetLayer()).SetAddressType(addr.Type()));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite);
+    TransportMgrBase gTransportMgrBase;
+    gTransportMgrBase.SetSecureSessionMgr(&gMockTransportMgrDelegate);
+    gTransportMgrBase.Init(&udp);
+
+    ReceiveHandlerCallCount = 0;
+
+    // The kernel rejects datagrams to port 0.
+    err = udp.SendMessage(Transport::PeerAddress::UDP(addr, 0), NewTestMessage(inSuite));
+    if (err == System::MapErrorPOSIX(EADDRNOTAVAIL))
+    {
+        // TODO(#2698): the underlying system does not support IPV6. This early return
+        // should be removed and error should be made fatal.
+        printf("%s:%u: System does NOT support IPV6.\n", __FILE__, __LINE__);
+        return;
+    }
+
+#if INET_DATAGRAM_SEND_BATCHING
+    // The datagram is queued, and its error is returned by the first send after the queue went out, which sends nothing.
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = udp.SendMessage(Transport::PeerAddress::UDP(addr), NewTestMessage(inSuite));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    ctx.DriveIOUntil(1000 /* ms */, []() { return ReceiveHandlerCallCount != 0; });
+    NL_TEST_ASSERT(inSuite, ReceiveHandlerCallCount == 1);
+
+    err = udp.SendMessage(Transport::PeerAddress::UDP(addr), NewTestMessage(inSuite));
+#endif // INET_DATAGRAM_SEND_BATCHING
+    NL_TEST_ASSERT(inSuite, err == System::MapErrorPOSIX(EINVAL));
+
+    // The error is reported once, and the endpoint keeps sending.
+    ReceiveHandlerCallCount = 0;
+    err                     = udp.SendMessage(Transport::PeerAddress::UDP(addr), NewTestMessage(inSuite));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    ctx.DriveIOUntil(1000 /* ms */, []() { return ReceiveHandlerCallCount != 0; });
+    NL_TEST_ASSERT(inSuite, ReceiveHandlerCallCount == 1);
+}
+
+void CheckSendErrorTest4(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("127.0.0.1", addr);
+    CheckSendErrorTest(inSuite, inContext, addr);
+}
+
+void CheckSendErrorTest6(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CheckSendErrorTest(inSuite, inContext, addr);
+}
+
 // Test Suite
 
 /**
@@ -178,12 +422,18 @@ void CheckMessageTest6(nlTestSuite * inSuite, void * inContext)
 static const nlTest sTests[] =
 {
 #if INET_CONFIG_ENABLE_IPV4
-    NL_TEST_DEF("Simple Init Test IPV4",   CheckSimpleInitTest4),
-    NL_TEST_DEF("Message Self Test IPV4",  CheckMessageTest4),
+    NL_TEST_DEF("Simple Init Test IPV4",     CheckSimpleInitTest4),
+    NL_TEST_DEF("Message Self Test IPV4",    CheckMessageTest4),
+    NL_TEST_DEF("Message Burst Test IPV4",   CheckMessageBurstTest4),
+    NL_TEST_DEF("Chained Message Test IPV4", CheckChainedMessageTest4),
+    NL_TEST_DEF("Send Error Test IPV4",      CheckSendErrorTest4),
 #endif
 
-    NL_TEST_DEF("Simple Init Test IPV6",   CheckSimpleInitTest6),
-    NL_TEST_DEF("Message Self Test IPV6",  CheckMessageTest6),
+    NL_TEST_DEF("Simple Init Test IPV6",     CheckSimpleInitTest6),
+    NL_TEST_DEF("Message Self Test IPV6",    CheckMessageTest6),
+    NL_TEST_DEF("Message Burst Test IPV6",   CheckMessageBurstTest6),
+    NL_TEST_DEF("Chained Message Test IPV6", CheckChainedMessageTest6),
+    NL_TEST_DEF("Send Error Test IPV6",      CheckSendErrorTest6),
 
     NL_TEST_SENTINEL()
 };
@@ -284,6 +284,119 @@ void TestExpireConnections(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, !connections.FindPeerConnectionState(kPeer3Addr, nullptr));
 }
 
+void TestIndexTracksKeyChanges(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err;
+    PeerConnectionState * state1 = nullptr;
+    PeerConnectionState * state2 = nullptr;
+    PeerConnections<4, Time::Source::kTest> connections;
+
+    err = connections.CreateNewPeerConnectionState(Optional<NodeId>::Value(kPeer1NodeId), 10, 20, &state1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = connections.CreateNewPeerConnectionState(Optional<NodeId>::Value(kPeer2NodeId), 11, 21, &state2);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // Keys updated after creation must be visible to lookups
+    state1->SetPeerAddress(kPeer1Addr);
+    state2->SetPeerNodeId(kPeer3NodeId);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(kPeer1Addr, nullptr) == state1);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(kPeer3NodeId, nullptr) == state2);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(kPeer2NodeId, nullptr) == nullptr);
+
+    // ... and stale values must no longer be found
+    state1->SetPeerAddress(kPeer2Addr);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(kPeer1Addr, nullptr) == nullptr);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(kPeer2Addr, nullptr) == state1);
+
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(static_cast<uint16_t>(21), nullptr) == state2);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(Optional<NodeId>::Value(kPeer3NodeId), 11, nullptr) == state2);
+
+    // Expiring a connection removes all of its keys from the index
+    connections.MarkConnectionExpired(state2, [](const PeerConnectionState &) {});
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(static_cast<uint16_t>(21), nullptr) == nullptr);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(Optional<NodeId>::Missing(), 11, nullptr) == nullptr);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(kPeer3NodeId, nullptr) == nullptr);
+
+    // Wildcard key lookups still match anything
+    NL_TEST_ASSERT(inSuite,
+                   connections.FindPeerConnectionState(Optional<NodeId>::Value(kPeer1NodeId), kAnyKeyId, nullptr) == state1);
+}
+
+void TestIndexChurn(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr size_t kCount = 64;
+    PeerConnections<kCount, Time::Source::kTest> connections;
+    PeerConnectionState * states[kCount];
+
+    // Repeatedly fill, expire every other slot and refill with different keys, so that
+    // clusters in the open-addressing tables get split and re-formed.
+    for (uint16_t round = 0; round < 8; round++)
+    {
+        for (size_t i = 0; i < kCount; i++)
+        {
+            if (round != 0 && (i % 2) == 1)
+            {
+                continue;
+            }
+            uint16_t key = static_cast<uint16_t>(round * kCount + i);
+            NL_TEST_ASSERT(inSuite,
+                           connections.CreateNewPeerConnectionState(Optional<NodeId>::Value(key + 1000u), key, key, &states[i]) ==
+                               CHIP_NO_ERROR);
+        }
+
+        for (size_t i = 0; i < kCount; i++)
+        {
+            PeerConnectionState * state = states[i];
+            NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(state->GetLocalKeyID(), nullptr) == state);
+            NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(state->GetPeerNodeId(), nullptr) == state);
+        }
+
+        for (size_t i = 0; i < kCount; i += 2)
+        {
+            uint16_t key = states[i]->GetLocalKeyID();
+            connections.MarkConnectionExpired(states[i], [](const PeerConnectionState &) {});
+            NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(key, nullptr) == nullptr);
+        }
+    }
+}
+
+/**
+ * Every session of a full pool is found both by local key id, as for an inbound message, and by node id and peer key id, as
+ * for an outbound one.
+ */
+template <size_t kCount>
+void CheckFullPoolLookup(nlTestSuite * inSuite)
+{
+    static PeerConnections<kCount, Time::Source::kTest> connections;
+
+    for (size_t i = 0; i < kCount; i++)
+    {
+        uint16_t key = static_cast<uint16_t>(i);
+        NL_TEST_ASSERT(inSuite,
+                       connections.CreateNewPeerConnectionState(Optional<NodeId>::Value(key + 1u), key, key, nullptr) ==
+                           CHIP_NO_ERROR);
+    }
+
+    for (size_t i = 0; i < kCount; i++)
+    {
+        uint16_t key                = static_cast<uint16_t>(i);
+        PeerConnectionState * state = connections.FindPeerConnectionState(key, nullptr);
+        NL_TEST_ASSERT(inSuite, state != nullptr && state->GetLocalKeyID() == key);
+        NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(Optional<NodeId>::Value(key + 1u), key, nullptr) == state);
+    }
+
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(static_cast<uint16_t>(kCount), nullptr) == nullptr);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(Optional<NodeId>::Value(1u), 1, nullptr) == nullptr);
+}
+
+void TestFullPoolLookup(nlTestSuite * inSuite, void * inContext)
+{
+    CheckFullPoolLookup<16>(inSuite);
+    CheckFullPoolLookup<128>(inSuite);
+    CheckFullPoolLookup<1024>(inSuite);
+    CheckFullPoolLookup<4096>(inSuite);
+}
+
 } // namespace
 
 // clang-format off
@@ -294,6 +407,9 @@ static const nlTest sTests[] =
     NL_TEST_DEF("FindByNodeId", TestFindByNodeId),
     NL_TEST_DEF("FindByKeyId", TestFindByKeyId),
     NL_TEST_DEF("ExpireConnections", TestExpireConnections),
+    NL_TEST_DEF("IndexTracksKeyChanges", TestIndexTracksKeyChanges),
+    NL_TEST_DEF("IndexChurn", TestIndexChurn),
+    NL_TEST_DEF("FullPoolLookup", TestFullPoolLookup),
     NL_TEST_SENTINEL()
 };
 // clang-format on
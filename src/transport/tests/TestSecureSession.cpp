@@ -28,6 +28,7 @@
 #include <transport/SecureSession.h>
 
 #include <stdarg.h>
+#include <support/CHIPMem.h>
 #include <support/CodeUtils.h>
 #include <support/UnitTestRegistration.h>
 
@@ -151,6 +152,183 @@ void SecureChannelDecryptTest(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, memcmp(plain_text, output, sizeof(plain_text)) == 0);
 }
 
+void SecureChannelInPlaceTest(nlTestSuite * inSuite, void * inContext)
+{
+    const uint8_t plain_text[] = { 0x86, 0x74, 0x64, 0xe5, 0x0b, 0xd4, 0x0d, 0x90, 0xe1, 0x17, 0xa3, 0x2d, 0x4b, 0xd4, 0xe1, 0xe6 };
+    uint8_t buffer[sizeof(plain_text)];
+    PacketHeader packetHeader;
+    MessageAuthenticationCode mac;
+
+    const char * salt = "Test Salt";
+
+    P256Keypair keypair;
+    NL_TEST_ASSERT(inSuite, keypair.Initialize() == CHIP_NO_ERROR);
+
+    P256Keypair keypair2;
+    NL_TEST_ASSERT(inSuite, keypair2.Initialize() == CHIP_NO_ERROR);
+
+    SecureSession channel;
+    NL_TEST_ASSERT(inSuite,
+                   channel.Init(keypair, keypair2.Pubkey(), ByteSpan((const uint8_t *) salt, sizeof(salt)),
+                                SecureSession::SessionInfoType::kSessionEstablishment,
+                                SecureSession::SessionRole::kInitiator) == CHIP_NO_ERROR);
+
+    SecureSession channel2;
+    NL_TEST_ASSERT(inSuite,
+                   channel2.Init(keypair2, keypair.Pubkey(), ByteSpan((const uint8_t *) salt, sizeof(salt)),
+                                 SecureSession::SessionInfoType::kSessionEstablishment,
+                                 SecureSession::SessionRole::kResponder) == CHIP_NO_ERROR);
+
+    for (uint32_t messageId = 1; messageId <= 3; messageId++)
+    {
+        packetHeader.SetMessageId(messageId);
+
+        memcpy(buffer, plain_text, sizeof(buffer));
+        NL_TEST_ASSERT(inSuite, channel.Encrypt(buffer, sizeof(buffer), buffer, packetHeader, mac) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(buffer, plain_text, sizeof(buffer)) != 0);
+
+        NL_TEST_ASSERT(inSuite, channel2.Decrypt(buffer, sizeof(buffer), buffer, packetHeader, mac) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(buffer, plain_text, sizeof(buffer)) == 0);
+    }
+
+    // A copied session holds the same keys.
+    SecureSession channel3(channel2);
+    NL_TEST_ASSERT(inSuite, channel.Encrypt(buffer, sizeof(buffer), buffer, packetHeader, mac) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, channel3.Decrypt(buffer, sizeof(buffer), buffer, packetHeader, mac) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(buffer, plain_text, sizeof(buffer)) == 0);
+
+    // After a reset the session no longer has keys.
+    channel3.Reset();
+    NL_TEST_ASSERT(inSuite,
+                   channel3.Decrypt(buffer, sizeof(buffer), buffer, packetHeader, mac) == CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
+}
+
+void SecureChannelChainedTest(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t plain_text[100];
+    uint8_t encrypted[sizeof(plain_text)];
+    PacketHeader packetHeader;
+    MessageAuthenticationCode mac;
+    MessageAuthenticationCode chainMac;
+
+    for (size_t i = 0; i < sizeof(plain_text); i++)
+    {
+        plain_text[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    const char * salt = "Test Salt";
+
+    P256Keypair keypair;
+    NL_TEST_ASSERT(inSuite, keypair.Initialize() == CHIP_NO_ERROR);
+
+    P256Keypair keypair2;
+    NL_TEST_ASSERT(inSuite, keypair2.Initialize() == CHIP_NO_ERROR);
+
+    SecureSession channel;
+    NL_TEST_ASSERT(inSuite,
+                   channel.Init(keypair, keypair2.Pubkey(), ByteSpan((const uint8_t *) salt, sizeof(salt)),
+                                SecureSession::SessionInfoType::kSessionEstablishment,
+                                SecureSession::SessionRole::kInitiator) == CHIP_NO_ERROR);
+
+    SecureSession channel2;
+    NL_TEST_ASSERT(inSuite,
+                   channel2.Init(keypair2, keypair.Pubkey(), ByteSpan((const uint8_t *) salt, sizeof(salt)),
+                                 SecureSession::SessionInfoType::kSessionEstablishment,
+                                 SecureSession::SessionRole::kResponder) == CHIP_NO_ERROR);
+
+    packetHeader.SetMessageId(1);
+    NL_TEST_ASSERT(inSuite, channel.Encrypt(plain_text, sizeof(plain_text), encrypted, packetHeader, mac) == CHIP_NO_ERROR);
+
+    // Buffers that end inside cipher blocks, encrypted in place, give the same message as one buffer.
+    const uint16_t kBufferLengths[] = { 7, 30, 63 };
+    System::PacketBufferHandle chain;
+    uint16_t offset = 0;
+    for (uint16_t length : kBufferLengths)
+    {
+        System::PacketBufferHandle buffer = System::PacketBufferHandle::NewWithData(&plain_text[offset], length);
+        NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+        if (chain.IsNull())
+        {
+            chain = std::move(buffer);
+        }
+        else
+        {
+            chain->AddToEnd(std::move(buffer));
+        }
+        offset = static_cast<uint16_t>(offset + length);
+    }
+    NL_TEST_ASSERT(inSuite, chain->TotalLength() == sizeof(plain_text));
+
+    NL_TEST_ASSERT(inSuite, channel.Encrypt(chain, packetHeader, chainMac) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(chainMac.GetTag(), mac.GetTag(), kMaxTagLen) == 0);
+
+    offset = 0;
+    for (System::PacketBufferHandle buffer = chain.Retain(); !buffer.IsNull(); buffer.Advance())
+    {
+        NL_TEST_ASSERT(inSuite, memcmp(buffer->Start(), &encrypted[offset], buffer->DataLength()) == 0);
+        offset = static_cast<uint16_t>(offset + buffer->DataLength());
+    }
+
+    NL_TEST_ASSERT(inSuite, channel2.Decrypt(encrypted, sizeof(encrypted), encrypted, packetHeader, chainMac) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(encrypted, plain_text, sizeof(plain_text)) == 0);
+}
+
+/**
+ * Encrypts and decrypts a run of messages with the cipher contexts a SecureSession keeps for its keys, checking that every
+ * message comes back unchanged.
+ */
+template <size_t kPayloadLength>
+void CheckMessages(nlTestSuite * inSuite, SecureSession & sender, SecureSession & receiver)
+{
+    constexpr uint32_t kMessageCount = 16;
+
+    static uint8_t plainText[kPayloadLength];
+    static uint8_t buffer[kPayloadLength];
+    PacketHeader packetHeader;
+    MessageAuthenticationCode mac;
+
+    for (size_t i = 0; i < sizeof(plainText); i++)
+    {
+        plainText[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+
+    for (uint32_t i = 0; i < kMessageCount; i++)
+    {
+        packetHeader.SetMessageId(i);
+        memcpy(buffer, plainText, sizeof(buffer));
+        NL_TEST_ASSERT(inSuite, sender.Encrypt(buffer, sizeof(buffer), buffer, packetHeader, mac) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(buffer, plainText, sizeof(buffer)) != 0);
+        NL_TEST_ASSERT(inSuite, receiver.Decrypt(buffer, sizeof(buffer), buffer, packetHeader, mac) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(buffer, plainText, sizeof(buffer)) == 0);
+    }
+}
+
+void SecureChannelManyMessagesTest(nlTestSuite * inSuite, void * inContext)
+{
+    const char * salt = "Test Salt";
+
+    P256Keypair keypair;
+    NL_TEST_ASSERT(inSuite, keypair.Initialize() == CHIP_NO_ERROR);
+
+    P256Keypair keypair2;
+    NL_TEST_ASSERT(inSuite, keypair2.Initialize() == CHIP_NO_ERROR);
+
+    SecureSession sender;
+    NL_TEST_ASSERT(inSuite,
+                   sender.Init(keypair, keypair2.Pubkey(), ByteSpan((const uint8_t *) salt, sizeof(salt)),
+                               SecureSession::SessionInfoType::kSessionEstablishment,
+                               SecureSession::SessionRole::kInitiator) == CHIP_NO_ERROR);
+
+    SecureSession receiver;
+    NL_TEST_ASSERT(inSuite,
+                   receiver.Init(keypair2, keypair.Pubkey(), ByteSpan((const uint8_t *) salt, sizeof(salt)),
+                                 SecureSession::SessionInfoType::kSessionEstablishment,
+                                 SecureSession::SessionRole::kResponder) == CHIP_NO_ERROR);
+
+    CheckMessages<64>(inSuite, sender, receiver);
+    CheckMessages<1024>(inSuite, sender, receiver);
+}
+
 // Test Suite
 
 /**
@@ -162,18 +340,38 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Init",    SecureChannelInitTest),
     NL_TEST_DEF("Encrypt", SecureChannelEncryptTest),
     NL_TEST_DEF("Decrypt", SecureChannelDecryptTest),
+    NL_TEST_DEF("InPlace", SecureChannelInPlaceTest),
+    NL_TEST_DEF("Chained", SecureChannelChainedTest),
+    NL_TEST_DEF("ManyMessages", SecureChannelManyMessagesTest),
 
     NL_TEST_SENTINEL()
 };
 // clang-format on
 
+/**
+ *  Set up the test suite.
+ */
+static int Initialize(void * aContext)
+{
+    return (chip::Platform::MemoryInit() == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+/**
+ *  Tear down the test suite.
+ */
+static int Finalize(void * aContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
 // clang-format off
 static nlTestSuite sSuite =
 {
     "Test-CHIP-SecureChannel",
     &sTests[0],
-    nullptr,
-    nullptr
+    Initialize,
+    Finalize
 };
 // clang-format on
 
@@ -39,6 +39,7 @@
 #include <nlunit-test.h>
 
 #include <errno.h>
+#include <vector>
 
 #undef CHIP_ENABLE_TEST_ENCRYPTED_BUFFER_API
 
@@ -213,6 +214,23 @@ void CheckMessageTest(nlTestSuite * inSuite, void * inContext)
 
     NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == 2);
 
+    // A message written across a chain of buffers is sent as it is. Its last buffer is full, so the tag goes into one more.
+    chip::System::PacketBufferHandle chain = chip::MessagePacketBuffer::NewWithData(LARGE_PAYLOAD, 100);
+    NL_TEST_ASSERT(inSuite, !chain.IsNull());
+    chip::System::PacketBufferHandle tail = chip::System::PacketBufferHandle::New(200, 0);
+    NL_TEST_ASSERT(inSuite, !tail.IsNull() && tail->MaxDataLength() <= kMaxAppMessageLen - 100);
+    memcpy(tail->Start(), &LARGE_PAYLOAD[100], tail->MaxDataLength());
+    tail->SetDataLength(tail->MaxDataLength());
+    chain->AddToEnd(std::move(tail));
+
+    err = secureSessionMgr.BuildEncryptedMessagePayload(localToRemoteSession, payloadHeader, std::move(chain), preparedMessage);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = secureSessionMgr.SendPreparedMessage(localToRemoteSession, preparedMessage);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == 3);
+
     uint16_t large_payload_len = sizeof(LARGE_PAYLOAD);
 
     // Let's send bigger message than supported and make sure it fails to send
@@ -472,6 +490,293 @@ void SendBadEncryptedPacketTest(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == 2);
 }
 
+#if CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+
+// Every pipeline test session uses two peer connections: one to send on and one to receive on.
+constexpr uint16_t kPipelineSessionCount = CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE / 2;
+constexpr uint16_t kPipelineSendKeyBase  = 100;
+
+class PipelineCallback : public SecureSessionMgrDelegate
+{
+public:
+    void OnMessageReceived(const PacketHeader & header, const PayloadHeader & payloadHeader, SecureSessionHandle session,
+                           const Transport::PeerAddress & source, DuplicateMessage isDuplicate,
+                           System::PacketBufferHandle && msgBuf) override
+    {
+        // Sessions receive on local key IDs 1 to kPipelineSessionCount, and must see their messages in order.
+        const uint16_t keyId = header.GetEncryptionKeyID();
+        if (keyId == 0 || keyId > kPipelineSessionCount ||
+            (mReceivedCount[keyId - 1] > 0 && header.GetMessageId() <= mLastMessageId[keyId - 1]))
+        {
+            mOrderErrorCount++;
+            return;
+        }
+
+        mLastMessageId[keyId - 1] = header.GetMessageId();
+        mReceivedCount[keyId - 1]++;
+        mTotalReceivedCount++;
+    }
+
+    void OnReceiveError(CHIP_ERROR error, const Transport::PeerAddress & source) override
+    {
+        mErrorCount++;
+        mNoMemoryErrorCount += (error == CHIP_ERROR_NO_MEMORY);
+    }
+
+    uint32_t mLastMessageId[kPipelineSessionCount] = {};
+    uint32_t mReceivedCount[kPipelineSessionCount] = {};
+    uint32_t mTotalReceivedCount                   = 0;
+    uint32_t mOrderErrorCount                      = 0;
+    uint32_t mErrorCount                           = 0;
+    uint32_t mNoMemoryErrorCount                   = 0;
+};
+
+/**
+ *  Set up kPipelineSessionCount loopback sessions; a message sent on senders[k] is received on local key ID k + 1.
+ */
+void SetUpPipelineSessions(nlTestSuite * inSuite, SecureSessionMgr & secureSessionMgr, Transport::AdminPairingTable & admins,
+                           SecureSessionHandle (&senders)[kPipelineSessionCount])
+{
+    IPAddress addr;
+    IPAddress::FromString("127.0.0.1", addr);
+    Optional<Transport::PeerAddress> peer(Transport::PeerAddress::UDP(addr, CHIP_PORT));
+
+    NL_TEST_ASSERT(inSuite, admins.AssignAdminId(0, kSourceNodeId) != nullptr);
+    NL_TEST_ASSERT(inSuite, admins.AssignAdminId(1, kDestinationNodeId) != nullptr);
+
+    for (uint16_t k = 0; k < kPipelineSessionCount; k++)
+    {
+        const uint16_t receiveKeyId = static_cast<uint16_t>(k + 1);
+        const uint16_t sendKeyId    = static_cast<uint16_t>(kPipelineSendKeyBase + k);
+
+        SecurePairingUsingTestSecret receivePairing(sendKeyId, receiveKeyId);
+        NL_TEST_ASSERT(inSuite,
+                       secureSessionMgr.NewPairing(peer, kSourceNodeId, &receivePairing, SecureSession::SessionRole::kInitiator,
+                                                   1) == CHIP_NO_ERROR);
+
+        SecurePairingUsingTestSecret sendPairing(receiveKeyId, sendKeyId);
+        NL_TEST_ASSERT(inSuite,
+                       secureSessionMgr.NewPairing(peer, kDestinationNodeId, &sendPairing, SecureSession::SessionRole::kResponder,
+                                                   0) == CHIP_NO_ERROR);
+
+        senders[k] = SecureSessionHandle(kDestinationNodeId, receiveKeyId, 0);
+    }
+}
+
+CHIP_ERROR SendPipelineMessage(SecureSessionMgr & secureSessionMgr, SecureSessionHandle session, uint16_t payloadLength)
+{
+    PayloadHeader payloadHeader;
+    EncryptedPacketBufferHandle preparedMessage;
+
+    payloadHeader.SetExchangeID(0);
+    payloadHeader.SetMessageType(chip::Protocols::Echo::MsgType::EchoRequest);
+
+    System::PacketBufferHandle buffer = MessagePacketBuffer::NewWithData(LARGE_PAYLOAD, payloadLength);
+    VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(secureSessionMgr.BuildEncryptedMessagePayload(session, payloadHeader, std::move(buffer), preparedMessage));
+    return secureSessionMgr.SendPreparedMessage(session, preparedMessage);
+}
+
+void ReceivePipelineTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    constexpr uint32_t kMessagesPerSession = 8;
+
+    ctx.GetInetLayer().SystemLayer()->Init(nullptr);
+
+    TransportMgr<LoopbackTransport> transportMgr;
+    SecureSessionMgr secureSessionMgr;
+    secure_channel::MessageCounterManager gMessageCounterManager;
+    Transport::AdminPairingTable admins;
+    PipelineCallback pipelineCallback;
+    SecureSessionHandle senders[kPipelineSessionCount];
+
+    NL_TEST_ASSERT(inSuite, transportMgr.Init("LOOPBACK") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   secureSessionMgr.Init(kSourceNodeId, ctx.GetInetLayer().SystemLayer(), &transportMgr, &admins,
+                                         &gMessageCounterManager) == CHIP_NO_ERROR);
+    secureSessionMgr.SetDelegate(&pipelineCallback);
+    SetUpPipelineSessions(inSuite, secureSessionMgr, admins, senders);
+
+    NL_TEST_ASSERT(inSuite, secureSessionMgr.StartReceivePipeline(0) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, secureSessionMgr.StartReceivePipeline(3) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, secureSessionMgr.StartReceivePipeline(3) == CHIP_ERROR_INCORRECT_STATE);
+
+    for (uint32_t i = 0; i < kMessagesPerSession; i++)
+    {
+        for (SecureSessionHandle & sender : senders)
+        {
+            NL_TEST_ASSERT(inSuite, SendPipelineMessage(secureSessionMgr, sender, sizeof(PAYLOAD)) == CHIP_NO_ERROR);
+        }
+    }
+
+    // Messages still queued for a session that goes away are dropped.
+    secureSessionMgr.ExpirePairing(SecureSessionHandle(kSourceNodeId, kPipelineSendKeyBase, 1));
+
+    constexpr uint32_t kExpected = (kPipelineSessionCount - 1) * kMessagesPerSession;
+    ctx.DriveIOUntil(1000, [&pipelineCallback] { return pipelineCallback.mTotalReceivedCount >= kExpected; });
+
+    NL_TEST_ASSERT(inSuite, pipelineCallback.mTotalReceivedCount == kExpected);
+    NL_TEST_ASSERT(inSuite, pipelineCallback.mReceivedCount[0] == 0);
+    NL_TEST_ASSERT(inSuite, pipelineCallback.mOrderErrorCount == 0);
+    NL_TEST_ASSERT(inSuite, pipelineCallback.mErrorCount == 0);
+
+    // Replay checks still apply: pretend the next message of a session was already received.
+    Transport::PeerConnectionState * state =
+        secureSessionMgr.GetPeerConnectionState(SecureSessionHandle(kSourceNodeId, kPipelineSendKeyBase + 1, 1));
+    NL_TEST_ASSERT(inSuite, state != nullptr);
+    const uint32_t lastMessageId = pipelineCallback.mLastMessageId[1];
+    state->GetSessionMessageCounter().GetPeerMessageCounter().Commit(lastMessageId + 1);
+
+    NL_TEST_ASSERT(inSuite, SendPipelineMessage(secureSessionMgr, senders[1], sizeof(PAYLOAD)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, SendPipelineMessage(secureSessionMgr, senders[1], sizeof(PAYLOAD)) == CHIP_NO_ERROR);
+    ctx.DriveIOUntil(1000, [&pipelineCallback] { return pipelineCallback.mTotalReceivedCount > kExpected; });
+
+    NL_TEST_ASSERT(inSuite, pipelineCallback.mTotalReceivedCount == kExpected + 1);
+    NL_TEST_ASSERT(inSuite, pipelineCallback.mLastMessageId[1] == lastMessageId + 2);
+    NL_TEST_ASSERT(inSuite, pipelineCallback.mErrorCount == 0);
+
+    secureSessionMgr.StopReceivePipeline();
+}
+
+/**
+ *  Check that SecureSessionMgr receives every message of a burst spread over kPipelineSessionCount sessions, in order per
+ *  session, with decryption done inline on the event thread and on an increasing number of receive pipeline workers.
+ */
+void ReceivePipelineWorkerCountsTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    constexpr uint32_t kMessagesPerSession = 50;
+    constexpr uint32_t kMessageCount       = kMessagesPerSession * kPipelineSessionCount;
+    constexpr uint16_t kPayloadLength      = 1024;
+    const uint8_t kWorkerCounts[]          = { 0, 1, 2, 4, 8 };
+
+    ctx.GetInetLayer().SystemLayer()->Init(nullptr);
+
+    TransportMgr<LoopbackTransport> transportMgr;
+    SecureSessionMgr secureSessionMgr;
+    secure_channel::MessageCounterManager gMessageCounterManager;
+    Transport::AdminPairingTable admins;
+    PipelineCallback pipelineCallback;
+    SecureSessionHandle senders[kPipelineSessionCount];
+
+    NL_TEST_ASSERT(inSuite, transportMgr.Init("LOOPBACK") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   secureSessionMgr.Init(kSourceNodeId, ctx.GetInetLayer().SystemLayer(), &transportMgr, &admins,
+                                         &gMessageCounterManager) == CHIP_NO_ERROR);
+    secureSessionMgr.SetDelegate(&pipelineCallback);
+    SetUpPipelineSessions(inSuite, secureSessionMgr, admins, senders);
+
+    std::vector<EncryptedPacketBufferHandle> messages(kMessageCount);
+
+    for (uint8_t workerCount : kWorkerCounts)
+    {
+        if (workerCount > CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS)
+        {
+            break;
+        }
+
+        // Encrypt the messages up front, interleaving the sessions, so that they arrive back to back.
+        bool ok = true;
+        for (uint32_t i = 0; i < kMessageCount; i++)
+        {
+            PayloadHeader payloadHeader;
+            payloadHeader.SetMessageType(chip::Protocols::Echo::MsgType::EchoRequest);
+            System::PacketBufferHandle buffer = MessagePacketBuffer::NewWithData(LARGE_PAYLOAD, kPayloadLength);
+            ok &= !buffer.IsNull() &&
+                secureSessionMgr.BuildEncryptedMessagePayload(senders[i % kPipelineSessionCount], payloadHeader, std::move(buffer),
+                                                              messages[i]) == CHIP_NO_ERROR;
+        }
+        NL_TEST_ASSERT(inSuite, ok);
+
+        if (workerCount > 0)
+        {
+            NL_TEST_ASSERT(inSuite, secureSessionMgr.StartReceivePipeline(workerCount) == CHIP_NO_ERROR);
+        }
+
+        // Send in rounds no larger than a worker's queue, which would drop the messages that do not fit.
+        const uint32_t receivedBefore = pipelineCallback.mTotalReceivedCount;
+        for (uint32_t i = 0; i < kMessageCount; i++)
+        {
+            ok &= secureSessionMgr.SendPreparedMessage(senders[i % kPipelineSessionCount], messages[i]) == CHIP_NO_ERROR;
+
+            const uint32_t sent = i + 1;
+            if (sent % CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_QUEUE_SIZE == 0 || sent == kMessageCount)
+            {
+                ctx.DriveIOUntil(10000, [&] { return pipelineCallback.mTotalReceivedCount - receivedBefore >= sent; });
+            }
+        }
+
+        NL_TEST_ASSERT(inSuite, ok);
+        NL_TEST_ASSERT(inSuite, pipelineCallback.mTotalReceivedCount - receivedBefore == kMessageCount);
+        NL_TEST_ASSERT(inSuite, pipelineCallback.mOrderErrorCount == 0);
+        NL_TEST_ASSERT(inSuite, pipelineCallback.mErrorCount == 0);
+
+        secureSessionMgr.StopReceivePipeline();
+    }
+}
+
+/**
+ *  Check that a burst larger than a worker's queue does not stall the event thread: every message is either received, in
+ *  order, or dropped and reported with CHIP_ERROR_NO_MEMORY.
+ */
+void ReceivePipelineFullQueueTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    constexpr uint32_t kMessageCount  = 4 * CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_QUEUE_SIZE;
+    constexpr uint16_t kPayloadLength = 1024;
+
+    ctx.GetInetLayer().SystemLayer()->Init(nullptr);
+
+    TransportMgr<LoopbackTransport> transportMgr;
+    SecureSessionMgr secureSessionMgr;
+    secure_channel::MessageCounterManager gMessageCounterManager;
+    Transport::AdminPairingTable admins;
+    PipelineCallback pipelineCallback;
+    SecureSessionHandle senders[kPipelineSessionCount];
+
+    NL_TEST_ASSERT(inSuite, transportMgr.Init("LOOPBACK") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   secureSessionMgr.Init(kSourceNodeId, ctx.GetInetLayer().SystemLayer(), &transportMgr, &admins,
+                                         &gMessageCounterManager) == CHIP_NO_ERROR);
+    secureSessionMgr.SetDelegate(&pipelineCallback);
+    SetUpPipelineSessions(inSuite, secureSessionMgr, admins, senders);
+
+    // Encrypt the messages up front, so that they reach the single worker faster than it decrypts them.
+    std::vector<EncryptedPacketBufferHandle> messages(kMessageCount);
+    bool ok = true;
+    for (uint32_t i = 0; i < kMessageCount; i++)
+    {
+        PayloadHeader payloadHeader;
+        payloadHeader.SetMessageType(chip::Protocols::Echo::MsgType::EchoRequest);
+        System::PacketBufferHandle buffer = MessagePacketBuffer::NewWithData(LARGE_PAYLOAD, kPayloadLength);
+        ok &= !buffer.IsNull() &&
+            secureSessionMgr.BuildEncryptedMessagePayload(senders[0], payloadHeader, std::move(buffer), messages[i]) ==
+                CHIP_NO_ERROR;
+    }
+    NL_TEST_ASSERT(inSuite, ok);
+
+    NL_TEST_ASSERT(inSuite, secureSessionMgr.StartReceivePipeline(1) == CHIP_NO_ERROR);
+    for (uint32_t i = 0; i < kMessageCount; i++)
+    {
+        ok &= secureSessionMgr.SendPreparedMessage(senders[0], messages[i]) == CHIP_NO_ERROR;
+    }
+    ctx.DriveIOUntil(10000, [&] { return pipelineCallback.mTotalReceivedCount + pipelineCallback.mErrorCount >= kMessageCount; });
+
+    NL_TEST_ASSERT(inSuite, ok);
+    NL_TEST_ASSERT(inSuite, pipelineCallback.mTotalReceivedCount + pipelineCallback.mErrorCount == kMessageCount);
+    NL_TEST_ASSERT(inSuite, pipelineCallback.mTotalReceivedCount >= CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_QUEUE_SIZE);
+    NL_TEST_ASSERT(inSuite, pipelineCallback.mNoMemoryErrorCount == pipelineCallback.mErrorCount);
+    NL_TEST_ASSERT(inSuite, pipelineCallback.mOrderErrorCount == 0);
+
+    secureSessionMgr.StopReceivePipeline();
+}
+
+#endif // CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+
 // Test Suite
 
 /**
@@ -484,6 +789,11 @@ const nlTest sTests[] =
     NL_TEST_DEF("Message Self Test",              CheckMessageTest),
     NL_TEST_DEF("Send Encrypted Packet Test",     SendEncryptedPacketTest),
     NL_TEST_DEF("Send Bad Encrypted Packet Test", SendBadEncryptedPacketTest),
+#if CHIP_CONFIG_SECURE_RECEIVE_PIPELINE_MAX_WORKERS > 0
+    NL_TEST_DEF("Receive Pipeline Test",          ReceivePipelineTest),
+    NL_TEST_DEF("Receive Pipeline Worker Counts", ReceivePipelineWorkerCountsTest),
+    NL_TEST_DEF("Receive Pipeline Full Queue",    ReceivePipelineFullQueueTest),
+#endif
 
     NL_TEST_SENTINEL()
 };